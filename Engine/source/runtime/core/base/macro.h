@@ -36,6 +36,13 @@
 #define VESPER_STRINGIFY(x) #x
 #define VESPER_CONCAT(a, b) a##b
 
+// Keep a function out of line (e.g. thread_local accessors that must be re-read after a fiber migrates)
+#if defined(_MSC_VER)
+    #define VESPER_NOINLINE __declspec(noinline)
+#else
+    #define VESPER_NOINLINE __attribute__((noinline))
+#endif
+
 // Disable copy
 #define VESPER_DISABLE_COPY(ClassName) \
     ClassName(const ClassName&) = delete; \
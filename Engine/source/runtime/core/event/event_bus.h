@@ -3,7 +3,7 @@
 #include "runtime/core/base/macro.h"
 #include "runtime/core/event/event_types.h"
 #include "runtime/core/threading/spsc_queue.h"
-#include "runtime/core/threading/mpsc_queue.h"
+#include "runtime/core/threading/mpmc_queue.h"
 
 #include <atomic>
 #include <chrono>
@@ -150,7 +150,7 @@ private:
     EventChannelConfig m_config;
 };
 
-/// @brief Multi-producer event channel using MPSC queue
+/// @brief Multi-producer event channel using a lock-free MPMC queue
 template<size_t Capacity = 256>
 class MPEventChannel
 {
@@ -228,7 +228,7 @@ private:
     }
 
 private:
-    MPSCQueue<EventWrapper, Capacity> m_queue;
+    MPMCQueue<EventWrapper, Capacity> m_queue;
     EventChannelConfig m_config;
 };
 
@@ -188,9 +188,15 @@ struct GPUFenceCompletedEvent : Event
 struct FrameTimingEvent : Event
 {
     uint64_t frameIndex{0};
-    float cpuTimeMs{0.0f};
+    float cpuTimeMs{0.0f};          // Render thread time spent on the frame
     float gpuTimeMs{0.0f};
-    float frameTimeMs{0.0f};
+    float frameTimeMs{0.0f};        // Interval since the previous rendered frame
+
+    // Pipeline latency of the rendered frame
+    float inputToPacketMs{0.0f};    // Input sampled -> render packet produced (logic)
+    float packetToConsumeMs{0.0f};  // Packet produced -> packet consumed (queueing + render)
+    float inputToConsumeMs{0.0f};   // End-to-end CPU latency
+    uint32_t framesSkipped{0};      // Older packets superseded by this one
 
     FrameTimingEvent()
     {
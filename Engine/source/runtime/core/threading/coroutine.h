@@ -0,0 +1,281 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+#include "runtime/core/threading/coroutine_frame_pool.h"
+#include "runtime/core/threading/wait_group.h"
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace vesper {
+
+// ============================================================================
+// Coroutine tasks
+// ============================================================================
+//
+// Straight-line async code on top of WorkerPool:
+//
+//   AsyncTask<TexturePtr> load(WorkerPool& pool, std::string path)
+//   {
+//       co_await pool.schedule();                           // continue on a worker
+//       TextureData data = decode(path);
+//       co_await pool.switchTo(TaskAffinity::RenderOnly);   // hop to the render thread
+//       co_return upload(data);
+//   }
+//
+//   WaitGroupPtr done = spawn(load(pool, "a.png"));          // or co_await it from another AsyncTask
+//
+// A coroutine only ever runs on one thread at a time; after each co_await it continues
+// on whichever thread resumed it. co_await on a WaitGroup/TaskCounter resumes on the
+// thread that completed the last task, so follow it with schedule()/switchTo() when the
+// continuation must run somewhere specific.
+
+namespace detail {
+
+/// @brief Frame allocation shared by every promise type
+struct PooledCoroutineFrame
+{
+    static void* operator new(size_t size)
+    {
+        return CoroutineFramePool::allocate(size);
+    }
+
+    static void operator delete(void* frame, size_t size) noexcept
+    {
+        CoroutineFramePool::deallocate(frame, size);
+    }
+};
+
+/// @brief Promise state common to AsyncTask<T> and AsyncTask<void>
+struct AsyncPromiseBase : PooledCoroutineFrame
+{
+    std::coroutine_handle<> continuation;
+
+    /// @brief Resume whoever awaited us (symmetric transfer: no stack growth on long chains)
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+        {
+            std::coroutine_handle<> next = handle.promise().continuation;
+            return next ? next : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    // Lazy: the body starts when the task is awaited or spawned
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+
+    // Tasks run on pool threads with nobody to rethrow to (matches Task::execute)
+    void unhandled_exception() const noexcept { std::terminate(); }
+};
+
+template<typename T>
+struct AsyncPromise : AsyncPromiseBase
+{
+    std::optional<T> value;
+
+    template<typename U>
+        requires std::is_convertible_v<U&&, T>
+    void return_value(U&& result)
+    {
+        value.emplace(std::forward<U>(result));
+    }
+
+    T takeResult() { return std::move(*value); }
+};
+
+template<>
+struct AsyncPromise<void> : AsyncPromiseBase
+{
+    void return_void() const noexcept {}
+    void takeResult() const noexcept {}
+};
+
+} // namespace detail
+
+/// @brief Lazily started, move-only coroutine returning T
+/// Await it from another coroutine (co_await task) or start it with spawn().
+/// Frames come from CoroutineFramePool, so steady-state coroutines never hit the heap.
+template<typename T = void>
+class [[nodiscard]] AsyncTask
+{
+public:
+    struct promise_type : detail::AsyncPromise<T>
+    {
+        AsyncTask get_return_object() noexcept
+        {
+            return AsyncTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    AsyncTask() = default;
+
+    AsyncTask(AsyncTask&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, nullptr))
+    {}
+
+    AsyncTask& operator=(AsyncTask&& other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    ~AsyncTask() { destroy(); }
+
+    VESPER_DISABLE_COPY(AsyncTask)
+
+    /// @brief Check if the task holds a coroutine
+    [[nodiscard]] bool isValid() const { return static_cast<bool>(m_handle); }
+
+    /// @brief Check if the coroutine ran to completion
+    [[nodiscard]] bool isDone() const { return !m_handle || m_handle.done(); }
+
+    // Awaiting starts the task and resumes the awaiter when it finishes
+    bool await_ready() const noexcept { return isDone(); }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        m_handle.promise().continuation = awaiting;
+        return m_handle;
+    }
+
+    T await_resume() { return m_handle.promise().takeResult(); }
+
+private:
+    explicit AsyncTask(Handle handle)
+        : m_handle(handle)
+    {}
+
+    void destroy()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+    Handle m_handle;
+};
+
+namespace detail {
+
+/// @brief Eager, self-destroying coroutine used to drive spawned tasks
+struct DetachedCoroutine
+{
+    struct promise_type : PooledCoroutineFrame
+    {
+        DetachedCoroutine get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+inline DetachedCoroutine runDetached(AsyncTask<void> task, WaitGroupPtr completion)
+{
+    co_await task;
+    completion->done();
+}
+
+/// @brief co_await on a WaitGroup or TaskCounter
+/// The awaiter lives in the coroutine frame and is linked into the counter's
+/// suspended-waiter list, so waiting allocates nothing.
+template<typename Counter>
+class CounterAwaiter : private CounterWaiter
+{
+public:
+    explicit CounterAwaiter(const Counter& counter)
+        : m_counter(counter)
+    {}
+
+    bool await_ready() const noexcept { return m_counter.isDone(); }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_handle = handle;
+        resume = [](CounterWaiter* waiter) {
+            static_cast<CounterAwaiter*>(waiter)->m_handle.resume();
+        };
+        // May resume us (and run the rest of the coroutine) before returning
+        m_counter.addSuspendedWaiter(this);
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    const Counter& m_counter;
+    std::coroutine_handle<> m_handle;
+};
+
+/// @brief co_await on a WaitGroupPtr: keeps the group alive until registration is finished
+class WaitGroupAwaiter
+{
+public:
+    explicit WaitGroupAwaiter(WaitGroupPtr group)
+        : m_group(std::move(group))
+        , m_awaiter(*m_group)
+    {}
+
+    bool await_ready() const noexcept { return m_awaiter.await_ready(); }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        // The coroutine may finish (and free this awaiter) inside await_suspend
+        WaitGroupPtr keepAlive = m_group;
+        m_awaiter.await_suspend(handle);
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    WaitGroupPtr m_group;
+    CounterAwaiter<WaitGroup> m_awaiter;
+};
+
+} // namespace detail
+
+/// @brief Suspend until the wait group reaches zero (resumes on the completing thread)
+inline detail::WaitGroupAwaiter operator co_await(WaitGroupPtr group)
+{
+    return detail::WaitGroupAwaiter(std::move(group));
+}
+
+/// @brief Suspend until the wait group reaches zero (caller keeps it alive)
+inline detail::CounterAwaiter<WaitGroup> operator co_await(const WaitGroup& group)
+{
+    return detail::CounterAwaiter<WaitGroup>(group);
+}
+
+/// @brief Suspend until the counter reaches zero (resumes on the completing thread)
+inline detail::CounterAwaiter<TaskCounter> operator co_await(const TaskCounter& counter)
+{
+    return detail::CounterAwaiter<TaskCounter>(counter);
+}
+
+/// @brief Start a task without awaiting it
+/// Runs on the calling thread until its first suspension.
+/// @return WaitGroup signalled when the task has finished
+inline WaitGroupPtr spawn(AsyncTask<void> task)
+{
+    WaitGroupPtr completion = makeWaitGroup(1);
+    detail::runDetached(std::move(task), completion);
+    return completion;
+}
+
+} // namespace vesper
@@ -0,0 +1,156 @@
+#include "runtime/core/threading/coroutine_frame_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace vesper {
+
+namespace {
+
+constexpr size_t kClassCount = std::countr_zero(CoroutineFramePool::kMaxBlockSize) -
+                               std::countr_zero(CoroutineFramePool::kMinBlockSize) + 1;
+constexpr size_t kChunkBytes = 64 * 1024;   // Carved into blocks when a class runs dry
+constexpr size_t kTransferBatch = 16;       // Blocks moved between a thread cache and the shared list
+constexpr size_t kCacheHighWater = 4 * kTransferBatch;
+
+/// @brief Size class index of a request that fits in a pooled block
+inline size_t sizeClassOf(size_t size)
+{
+    const size_t block = std::bit_ceil(std::max(size, CoroutineFramePool::kMinBlockSize));
+    return static_cast<size_t>(std::countr_zero(block) - std::countr_zero(CoroutineFramePool::kMinBlockSize));
+}
+
+inline size_t blockSizeOf(size_t sizeClass)
+{
+    return CoroutineFramePool::kMinBlockSize << sizeClass;
+}
+
+struct SharedFramePool
+{
+    std::mutex mutex;
+    std::array<std::vector<void*>, kClassCount> freeLists;
+    std::vector<std::unique_ptr<std::byte[]>> chunks;
+    std::atomic<size_t> allocatedBytes{0};
+
+    /// @brief Intentionally never destroyed: coroutines may finish on worker threads of
+    /// static pools after static destruction has begun
+    static SharedFramePool& get()
+    {
+        static SharedFramePool* s_pool = new SharedFramePool();
+        return *s_pool;
+    }
+};
+
+struct ThreadFrameCache
+{
+    std::array<std::vector<void*>, kClassCount> blocks;
+
+    ~ThreadFrameCache()
+    {
+        SharedFramePool& shared = SharedFramePool::get();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        for (size_t sizeClass = 0; sizeClass < kClassCount; ++sizeClass)
+        {
+            auto& list = shared.freeLists[sizeClass];
+            list.insert(list.end(), blocks[sizeClass].begin(), blocks[sizeClass].end());
+        }
+    }
+
+    void refill(size_t sizeClass)
+    {
+        SharedFramePool& shared = SharedFramePool::get();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+
+        auto& freeList = shared.freeLists[sizeClass];
+        if (freeList.empty())
+        {
+            const size_t blockSize = blockSizeOf(sizeClass);
+            auto chunk = std::make_unique<std::byte[]>(kChunkBytes);
+            for (size_t offset = 0; offset + blockSize <= kChunkBytes; offset += blockSize)
+            {
+                freeList.push_back(chunk.get() + offset);
+            }
+            shared.chunks.push_back(std::move(chunk));
+            shared.allocatedBytes.fetch_add(kChunkBytes, std::memory_order_relaxed);
+        }
+
+        auto& cache = blocks[sizeClass];
+        const size_t take = std::min(kTransferBatch, freeList.size());
+        cache.insert(cache.end(), freeList.end() - static_cast<ptrdiff_t>(take), freeList.end());
+        freeList.resize(freeList.size() - take);
+    }
+
+    void spill(size_t sizeClass)
+    {
+        SharedFramePool& shared = SharedFramePool::get();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+
+        auto& cache = blocks[sizeClass];
+        auto& freeList = shared.freeLists[sizeClass];
+        freeList.insert(freeList.end(), cache.end() - static_cast<ptrdiff_t>(kTransferBatch), cache.end());
+        cache.resize(cache.size() - kTransferBatch);
+    }
+};
+
+thread_local ThreadFrameCache t_frameCache;
+
+static_assert(kChunkBytes % CoroutineFramePool::kMaxBlockSize == 0, "chunks must split evenly into blocks");
+
+} // namespace
+
+void* CoroutineFramePool::allocate(size_t size)
+{
+    if (size > kMaxBlockSize)
+    {
+        return ::operator new(size);
+    }
+
+    const size_t sizeClass = sizeClassOf(size);
+    auto& cache = t_frameCache.blocks[sizeClass];
+    if (cache.empty())
+    {
+        cache.reserve(kCacheHighWater + 1);
+        t_frameCache.refill(sizeClass);
+    }
+
+    void* block = cache.back();
+    cache.pop_back();
+    return block;
+}
+
+void CoroutineFramePool::deallocate(void* block, size_t size)
+{
+    if (!block)
+    {
+        return;
+    }
+
+    if (size > kMaxBlockSize)
+    {
+        ::operator delete(block, size);
+        return;
+    }
+
+    // Frames often finish on a different thread than the one that created them; the
+    // block simply joins this thread's cache and flows back through the shared list
+    const size_t sizeClass = sizeClassOf(size);
+    auto& cache = t_frameCache.blocks[sizeClass];
+    cache.push_back(block);
+    if (cache.size() > kCacheHighWater)
+    {
+        t_frameCache.spill(sizeClass);
+    }
+}
+
+size_t CoroutineFramePool::allocatedBytes()
+{
+    return SharedFramePool::get().allocatedBytes.load(std::memory_order_relaxed);
+}
+
+} // namespace vesper
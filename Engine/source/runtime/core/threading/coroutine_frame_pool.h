@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+
+namespace vesper {
+
+/// @brief Process-wide recycler for coroutine frames
+/// Frames are rounded up to a power-of-two size class (128 B - 4 KB) and recycled through
+/// per-thread caches that exchange blocks with a shared free list in batches, like TaskPool.
+/// Frames larger than the biggest class go straight to the heap. Blocks carry no header:
+/// the promise's sized operator delete passes the frame size back in.
+class CoroutineFramePool
+{
+public:
+    static constexpr size_t kMinBlockSize = 128;
+    static constexpr size_t kMaxBlockSize = 4096;
+
+    /// @brief Get a block of at least size bytes (aligned to __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    [[nodiscard]] static void* allocate(size_t size);
+
+    /// @brief Return a block to the calling thread's cache
+    /// @param size The size passed to allocate()
+    static void deallocate(void* block, size_t size);
+
+    /// @brief Total bytes of pooled blocks ever allocated (diagnostics; stays flat in steady state)
+    [[nodiscard]] static size_t allocatedBytes();
+
+    CoroutineFramePool() = delete;
+};
+
+} // namespace vesper
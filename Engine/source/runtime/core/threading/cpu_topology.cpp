@@ -0,0 +1,216 @@
+#include "runtime/core/threading/cpu_topology.h"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace vesper {
+
+namespace {
+
+/// @brief Read the first line of a sysfs attribute, empty if missing
+std::string readLine(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    if (file)
+    {
+        std::getline(file, line);
+    }
+    return line;
+}
+
+/// @brief Lowest CPU of a cpu-list attribute, or fallback if missing/empty
+uint32_t lowestCpuIn(const std::filesystem::path& path, uint32_t fallback)
+{
+    const auto cpus = CpuTopology::parseCpuList(readLine(path));
+    return cpus.empty() ? fallback : *std::min_element(cpus.begin(), cpus.end());
+}
+
+/// @brief Find the L3 domain of a CPU by scanning its cache indices for level 3
+bool findL3(const std::filesystem::path& cpuDir, uint32_t cpuId, uint32_t& l3)
+{
+    std::error_code ec;
+    const auto cacheDir = cpuDir / "cache";
+    if (!std::filesystem::is_directory(cacheDir, ec))
+    {
+        return false;
+    }
+
+    for (const auto& entry : std::filesystem::directory_iterator(cacheDir, ec))
+    {
+        const std::string name = entry.path().filename().string();
+        if (name.rfind("index", 0) != 0 || readLine(entry.path() / "level") != "3")
+        {
+            continue;
+        }
+        l3 = lowestCpuIn(entry.path() / "shared_cpu_list", cpuId);
+        return true;
+    }
+    return false;
+}
+
+#ifdef __linux__
+/// @brief CPUs the calling process may run on, empty if the mask cannot be read
+std::vector<uint32_t> processAffinityCpus()
+{
+    std::vector<uint32_t> cpus;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) != 0)
+    {
+        return cpus;
+    }
+
+    for (uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &mask))
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+#endif
+
+} // namespace
+
+CpuTopology CpuTopology::detect()
+{
+#ifdef __linux__
+    // sysfs lists every online CPU; taskset and cgroup cpusets narrow what we may actually use
+    CpuTopology topology = fromSysfs("/sys/devices/system/cpu");
+    const std::vector<uint32_t> allowed = processAffinityCpus();
+    return allowed.empty() ? topology : topology.restrictedTo(allowed);
+#else
+    return {};
+#endif
+}
+
+CpuTopology CpuTopology::fromSysfs(const std::filesystem::path& cpuRoot)
+{
+    CpuTopology topology;
+
+    for (uint32_t id : parseCpuList(readLine(cpuRoot / "online")))
+    {
+        const auto cpuDir = cpuRoot / ("cpu" + std::to_string(id));
+        const auto topologyDir = cpuDir / "topology";
+
+        LogicalCpu cpu;
+        cpu.id = id;
+
+        // core_cpus_list replaced thread_siblings_list in newer kernels
+        cpu.core = lowestCpuIn(topologyDir / "core_cpus_list",
+                               lowestCpuIn(topologyDir / "thread_siblings_list", id));
+
+        const std::string package = readLine(topologyDir / "physical_package_id");
+        cpu.package = package.empty() ? 0 : static_cast<uint32_t>(std::stoul(package));
+
+        // No L3 (or no cache info): treat the whole package as one cache domain
+        if (!findL3(cpuDir, id, cpu.l3))
+        {
+            cpu.l3 = lowestCpuIn(topologyDir / "package_cpus_list",
+                                 lowestCpuIn(topologyDir / "core_siblings_list", 0));
+        }
+
+        topology.m_cpus.push_back(cpu);
+    }
+
+    std::sort(topology.m_cpus.begin(), topology.m_cpus.end(), [](const LogicalCpu& a, const LogicalCpu& b) {
+        return std::tie(a.package, a.l3, a.core, a.id) < std::tie(b.package, b.l3, b.core, b.id);
+    });
+    topology.countDomains();
+
+    return topology;
+}
+
+CpuTopology CpuTopology::restrictedTo(const std::vector<uint32_t>& allowedCpus) const
+{
+    const std::set<uint32_t> allowed(allowedCpus.begin(), allowedCpus.end());
+
+    CpuTopology topology;
+    for (const LogicalCpu& cpu : m_cpus)
+    {
+        if (allowed.contains(cpu.id))
+        {
+            topology.m_cpus.push_back(cpu);
+        }
+    }
+    topology.countDomains();
+
+    return topology;
+}
+
+void CpuTopology::countDomains()
+{
+    std::set<uint32_t> cores;
+    std::set<uint32_t> l3s;
+    std::set<uint32_t> packages;
+    for (const LogicalCpu& cpu : m_cpus)
+    {
+        cores.insert(cpu.core);
+        l3s.insert(cpu.l3);
+        packages.insert(cpu.package);
+    }
+    m_physicalCoreCount = static_cast<uint32_t>(cores.size());
+    m_l3Count = static_cast<uint32_t>(l3s.size());
+    m_packageCount = static_cast<uint32_t>(packages.size());
+}
+
+std::vector<LogicalCpu> CpuTopology::placementOrder(bool includeSmtSiblings) const
+{
+    // m_cpus is sorted by (package, l3, core, id): the first entry of each core is its primary thread
+    std::vector<LogicalCpu> order;
+    std::vector<LogicalCpu> siblings;
+    std::set<uint32_t> seenCores;
+
+    for (const LogicalCpu& cpu : m_cpus)
+    {
+        if (seenCores.insert(cpu.core).second)
+        {
+            order.push_back(cpu);
+        }
+        else if (includeSmtSiblings)
+        {
+            siblings.push_back(cpu);
+        }
+    }
+
+    order.insert(order.end(), siblings.begin(), siblings.end());
+    return order;
+}
+
+std::vector<uint32_t> CpuTopology::parseCpuList(const std::string& list)
+{
+    std::vector<uint32_t> cpus;
+    std::stringstream stream(list);
+    std::string range;
+
+    while (std::getline(stream, range, ','))
+    {
+        if (range.empty() || !std::isdigit(static_cast<unsigned char>(range.front())))
+        {
+            continue;
+        }
+
+        const size_t dash = range.find('-');
+        const uint32_t first = static_cast<uint32_t>(std::stoul(range.substr(0, dash)));
+        const uint32_t last = dash == std::string::npos ? first
+                                                        : static_cast<uint32_t>(std::stoul(range.substr(dash + 1)));
+        for (uint32_t cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+} // namespace vesper
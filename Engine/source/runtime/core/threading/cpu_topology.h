@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace vesper {
+
+/// @brief One logical CPU (hardware thread) and the resources it shares
+/// Core and L3 are identified by the lowest logical CPU id that shares them
+struct LogicalCpu
+{
+    uint32_t id{0};         // OS logical CPU index (what affinity masks use)
+    uint32_t core{0};       // Physical core (SMT siblings have the same value)
+    uint32_t l3{0};         // Last-level cache domain (CCX / die / socket)
+    uint32_t package{0};    // Physical socket
+};
+
+/// @brief CPU topology snapshot used for worker placement and steal ordering
+/// Read from /sys/devices/system/cpu on Linux, limited to the CPUs the process may run on.
+/// Elsewhere (or if sysfs is unavailable) the topology is empty and callers fall back to
+/// OS scheduling with a flat steal order.
+class CpuTopology
+{
+public:
+    /// @brief Detect the topology of the running machine
+    /// Only CPUs in the process affinity mask (which also reflects the cgroup cpuset) are kept
+    static CpuTopology detect();
+
+    /// @brief Parse a sysfs-style tree (cpuRoot/online, cpuRoot/cpuN/topology, cpuRoot/cpuN/cache)
+    /// @param cpuRoot Usually /sys/devices/system/cpu
+    static CpuTopology fromSysfs(const std::filesystem::path& cpuRoot);
+
+    /// @brief Keep only the given logical CPUs, recounting cores, L3 domains and packages
+    /// @param allowedCpus Logical CPU ids, e.g. from the process affinity mask
+    [[nodiscard]] CpuTopology restrictedTo(const std::vector<uint32_t>& allowedCpus) const;
+
+    /// @brief Check if any CPU was detected
+    [[nodiscard]] bool isValid() const { return !m_cpus.empty(); }
+
+    /// @brief Online logical CPUs, sorted by (package, l3, core, id)
+    [[nodiscard]] const std::vector<LogicalCpu>& cpus() const { return m_cpus; }
+
+    [[nodiscard]] uint32_t physicalCoreCount() const { return m_physicalCoreCount; }
+    [[nodiscard]] uint32_t l3Count() const { return m_l3Count; }
+    [[nodiscard]] uint32_t packageCount() const { return m_packageCount; }
+
+    /// @brief CPUs to pin workers to, in order
+    /// One CPU per physical core, filling an L3 domain before moving to the next one;
+    /// SMT siblings follow once every physical core is used, if requested
+    /// @param includeSmtSiblings Append the remaining hardware threads of each core
+    [[nodiscard]] std::vector<LogicalCpu> placementOrder(bool includeSmtSiblings) const;
+
+    /// @brief Parse a sysfs cpu list such as "0-3,8,10-11"
+    static std::vector<uint32_t> parseCpuList(const std::string& list);
+
+private:
+    /// @brief Recompute the core, L3 and package counts from m_cpus
+    void countDomains();
+
+    std::vector<LogicalCpu> m_cpus;
+    uint32_t m_physicalCoreCount{0};
+    uint32_t m_l3Count{0};
+    uint32_t m_packageCount{0};
+};
+
+} // namespace vesper
@@ -0,0 +1,64 @@
+#include "runtime/core/threading/event_count.h"
+
+#ifdef __linux__
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace vesper {
+
+namespace {
+
+#ifdef __linux__
+/// @brief Sleep while *word == expected (private futex, no timeout)
+inline void futexWait(std::atomic<uint32_t>& word, uint32_t expected)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+}
+
+/// @brief Wake up to count threads sleeping on word
+inline void futexWake(std::atomic<uint32_t>& word, int count)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32-bit integer");
+#endif
+
+} // namespace
+
+void EventCount::wait(Key key)
+{
+    // Loop: futex/atomic wait may return spuriously (signals, stale wakes)
+    while (m_epoch.load(std::memory_order_acquire) == key)
+    {
+#ifdef __linux__
+        futexWait(m_epoch, key);
+#else
+        // Portable fallback: WaitOnAddress on Windows, futex/ulock in other standard libraries
+        m_epoch.wait(key, std::memory_order_acquire);
+#endif
+    }
+
+    m_waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void EventCount::wake(bool all)
+{
+#ifdef __linux__
+    futexWake(m_epoch, all ? INT_MAX : 1);
+#else
+    if (all)
+    {
+        m_epoch.notify_all();
+    }
+    else
+    {
+        m_epoch.notify_one();
+    }
+#endif
+}
+
+} // namespace vesper
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace vesper {
+
+/// @brief Eventcount: lets threads sleep until "something changed" without a shared mutex
+/// Waiters announce themselves, re-check their condition, and only then park on the epoch
+/// word (futex on Linux, std::atomic::wait elsewhere). Notifiers bump the epoch and issue
+/// a wake syscall only when a waiter is registered, so the no-sleeper path is one fence and
+/// one load.
+///
+/// Usage (waiter):
+///   auto key = ec.prepareWait();
+///   if (conditionHolds()) { ec.cancelWait(); return; }
+///   ec.wait(key);
+///
+/// Usage (notifier): make the condition true, then ec.notifyOne() / ec.notifyAll()
+class EventCount
+{
+public:
+    using Key = uint32_t;
+
+    EventCount() = default;
+    ~EventCount() = default;
+
+    VESPER_DISABLE_COPY_AND_MOVE(EventCount)
+
+    /// @brief Register as a waiter; the condition must be re-checked afterwards
+    /// @return Key to pass to wait()
+    [[nodiscard]] Key prepareWait()
+    {
+        m_waiters.fetch_add(1, std::memory_order_relaxed);
+        // Pairs with the fence in notify: either we see the notifier's update, or it sees us
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return m_epoch.load(std::memory_order_acquire);
+    }
+
+    /// @brief Unregister after prepareWait() when the condition turned out to hold
+    void cancelWait()
+    {
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Park until notified (may return spuriously); unregisters the waiter
+    /// @param key Value returned by the matching prepareWait()
+    void wait(Key key);
+
+    /// @brief Wake one waiter, if any
+    /// @return true if a wake was issued
+    bool notifyOne()
+    {
+        return notify(false);
+    }
+
+    /// @brief Wake all waiters, if any
+    /// @return true if a wake was issued
+    bool notifyAll()
+    {
+        return notify(true);
+    }
+
+    /// @brief Number of threads between prepareWait() and wake-up (approximate)
+    [[nodiscard]] uint32_t waiterCount() const
+    {
+        return m_waiters.load(std::memory_order_relaxed);
+    }
+
+private:
+    bool notify(bool all)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waiters.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        m_epoch.fetch_add(1, std::memory_order_release);
+        wake(all);
+        return true;
+    }
+
+    /// @brief Platform wake on m_epoch
+    void wake(bool all);
+
+private:
+    static constexpr size_t kCacheLineSize = 64;
+
+    alignas(kCacheLineSize) std::atomic<uint32_t> m_epoch{0};
+    std::atomic<uint32_t> m_waiters{0};
+};
+
+} // namespace vesper
@@ -0,0 +1,261 @@
+#include "runtime/core/threading/fiber.h"
+#include "runtime/core/log/log_system.h"
+
+#include <cstdint>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#endif
+
+namespace vesper {
+
+#ifdef _WIN32
+
+struct FiberContext::Impl
+{
+    void* fiber{nullptr};
+    bool ownsFiber{false};      // Created by create() (deleted on destruction)
+    bool convertedThread{false}; // bindToThread() had to convert the thread
+    EntryPoint entry{nullptr};
+    void* arg{nullptr};
+
+    static void WINAPI start(void* param)
+    {
+        auto* impl = static_cast<Impl*>(param);
+        impl->entry(impl->arg);
+    }
+};
+
+FiberContext::FiberContext()
+    : m_impl(std::make_unique<Impl>())
+{}
+
+FiberContext::~FiberContext()
+{
+    if (m_impl->ownsFiber && m_impl->fiber)
+    {
+        DeleteFiber(m_impl->fiber);
+    }
+}
+
+bool FiberContext::create(size_t stackSize, EntryPoint entry, void* arg)
+{
+    m_impl->entry = entry;
+    m_impl->arg = arg;
+    m_impl->fiber = CreateFiberEx(stackSize, stackSize, FIBER_FLAG_FLOAT_SWITCH, &Impl::start, m_impl.get());
+    m_impl->ownsFiber = m_impl->fiber != nullptr;
+    return m_impl->ownsFiber;
+}
+
+bool FiberContext::bindToThread()
+{
+    if (IsThreadAFiber())
+    {
+        m_impl->fiber = GetCurrentFiber();
+        return true;
+    }
+
+    m_impl->fiber = ConvertThreadToFiberEx(nullptr, FIBER_FLAG_FLOAT_SWITCH);
+    m_impl->convertedThread = m_impl->fiber != nullptr;
+    return m_impl->convertedThread;
+}
+
+void FiberContext::unbindFromThread()
+{
+    if (m_impl->convertedThread)
+    {
+        ConvertFiberToThread();
+        m_impl->convertedThread = false;
+    }
+    m_impl->fiber = nullptr;
+}
+
+void FiberContext::switchTo(FiberContext& from, FiberContext& to)
+{
+    (void)from;  // Windows tracks the running fiber itself
+    SwitchToFiber(to.m_impl->fiber);
+}
+
+#else
+
+// On x86-64 ELF targets (Linux) fibers switch with a few instructions of assembly; swapcontext
+// also saves and restores the signal mask, a sigprocmask syscall on every switch. Other POSIX
+// targets fall back to ucontext and pay that cost.
+#if defined(__x86_64__) && defined(__ELF__)
+#define VESPER_FIBER_ASM_SWITCH
+#endif
+
+#ifdef VESPER_FIBER_ASM_SWITCH
+
+extern "C" {
+
+/// Push the System V callee-saved registers, MXCSR and the x87 control word on the running stack,
+/// store the stack pointer in *from, then load 'to' and pop the same frame from it
+void vesper_fiber_switch(void** from, void* to);
+
+/// First return address of a fiber: calls r13(r12), as laid out by FiberContext::create()
+void vesper_fiber_trampoline();
+
+}
+
+__asm__(
+    ".text\n"
+    ".globl vesper_fiber_switch\n"
+    ".hidden vesper_fiber_switch\n"
+    ".type vesper_fiber_switch, @function\n"
+    ".p2align 4\n"
+    "vesper_fiber_switch:\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r15\n"
+    "    pushq %r14\n"
+    "    pushq %r13\n"
+    "    pushq %r12\n"
+    "    subq $8, %rsp\n"
+    "    stmxcsr (%rsp)\n"
+    "    fnstcw 4(%rsp)\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq %rsi, %rsp\n"
+    "    ldmxcsr (%rsp)\n"
+    "    fldcw 4(%rsp)\n"
+    "    addq $8, %rsp\n"
+    "    popq %r12\n"
+    "    popq %r13\n"
+    "    popq %r14\n"
+    "    popq %r15\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n"
+    ".size vesper_fiber_switch, .-vesper_fiber_switch\n"
+    "\n"
+    ".globl vesper_fiber_trampoline\n"
+    ".hidden vesper_fiber_trampoline\n"
+    ".type vesper_fiber_trampoline, @function\n"
+    ".p2align 4\n"
+    "vesper_fiber_trampoline:\n"
+    "    movq %r12, %rdi\n"
+    "    callq *%r13\n"
+    "    ud2\n"
+    ".size vesper_fiber_trampoline, .-vesper_fiber_trampoline\n"
+);
+
+#endif
+
+struct FiberContext::Impl
+{
+#ifdef VESPER_FIBER_ASM_SWITCH
+    void* stackPointer{nullptr};  // Saved by vesper_fiber_switch while not running
+#else
+    ucontext_t context{};
+#endif
+    void* stack{nullptr};       // mmap'ed region including the guard page
+    size_t mappedSize{0};
+    EntryPoint entry{nullptr};
+    void* arg{nullptr};
+
+#ifdef VESPER_FIBER_ASM_SWITCH
+    static void start(Impl* impl)
+    {
+        impl->entry(impl->arg);
+    }
+#else
+    // makecontext only passes int arguments: split the Impl pointer in two
+    static void start(unsigned int high, unsigned int low)
+    {
+        const uint64_t address = (static_cast<uint64_t>(high) << 32) | static_cast<uint64_t>(low);
+        auto* impl = reinterpret_cast<Impl*>(static_cast<uintptr_t>(address));
+        impl->entry(impl->arg);
+    }
+#endif
+};
+
+FiberContext::FiberContext()
+    : m_impl(std::make_unique<Impl>())
+{}
+
+FiberContext::~FiberContext()
+{
+    if (m_impl->stack)
+    {
+        munmap(m_impl->stack, m_impl->mappedSize);
+    }
+}
+
+bool FiberContext::create(size_t stackSize, EntryPoint entry, void* arg)
+{
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    stackSize = (stackSize + pageSize - 1) / pageSize * pageSize;
+
+    // One extra page below the stack, left inaccessible so an overflow faults instead of
+    // silently corrupting the neighbouring fiber
+    const size_t mappedSize = stackSize + pageSize;
+    void* memory = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+    {
+        LOG_ERROR("FiberContext: Failed to allocate a {} byte stack", stackSize);
+        return false;
+    }
+    mprotect(memory, pageSize, PROT_NONE);
+
+    m_impl->stack = memory;
+    m_impl->mappedSize = mappedSize;
+    m_impl->entry = entry;
+    m_impl->arg = arg;
+
+#ifdef VESPER_FIBER_ASM_SWITCH
+    // The frame vesper_fiber_switch pops, from the stack pointer up: MXCSR and x87 control word
+    // (their power-on defaults), r12 = Impl, r13 = start, r14, r15, rbx, rbp, and the trampoline as
+    // return address. The trampoline starts with a 16-byte aligned stack pointer, so start() is
+    // entered with the alignment the ABI expects after a call.
+    auto* top = reinterpret_cast<uint64_t*>(static_cast<uint8_t*>(memory) + mappedSize);
+    uint64_t* frame = top - 2 - 8;
+    frame[0] = 0x1F80ull | (0x037Full << 32);
+    frame[1] = reinterpret_cast<uintptr_t>(m_impl.get());
+    frame[2] = reinterpret_cast<uintptr_t>(&Impl::start);
+    frame[3] = 0;
+    frame[4] = 0;
+    frame[5] = 0;
+    frame[6] = 0;
+    frame[7] = reinterpret_cast<uintptr_t>(&vesper_fiber_trampoline);
+    m_impl->stackPointer = frame;
+#else
+    getcontext(&m_impl->context);
+    m_impl->context.uc_stack.ss_sp = static_cast<uint8_t*>(memory) + pageSize;
+    m_impl->context.uc_stack.ss_size = stackSize;
+    m_impl->context.uc_link = nullptr;
+
+    const uint64_t address = reinterpret_cast<uintptr_t>(m_impl.get());
+    makecontext(&m_impl->context, reinterpret_cast<void (*)()>(&Impl::start), 2,
+                static_cast<unsigned int>(address >> 32), static_cast<unsigned int>(address & 0xFFFFFFFFu));
+#endif
+    return true;
+}
+
+bool FiberContext::bindToThread()
+{
+    // The context is captured by the first switchTo() away from the thread
+    return true;
+}
+
+void FiberContext::unbindFromThread()
+{
+}
+
+void FiberContext::switchTo(FiberContext& from, FiberContext& to)
+{
+#ifdef VESPER_FIBER_ASM_SWITCH
+    vesper_fiber_switch(&from.m_impl->stackPointer, to.m_impl->stackPointer);
+#else
+    swapcontext(&from.m_impl->context, &to.m_impl->context);
+#endif
+}
+
+#endif
+
+} // namespace vesper
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace vesper {
+
+/// @brief Execution context that threads can switch between cooperatively
+/// Either a fiber with its own stack (create()), or the context of an OS thread
+/// (bindToThread()) that fibers switch back to. Backed by Win32 fibers on Windows, a register-only
+/// assembly switch on x86-64 Linux, and ucontext elsewhere (swapcontext makes a sigprocmask
+/// syscall per switch, over ten times slower); fiber stacks get a guard page where the platform
+/// allows it.
+///
+/// Usage:
+///   FiberContext thread, fiber;
+///   thread.bindToThread();
+///   fiber.create(64 * 1024, &entry, arg);
+///   FiberContext::switchTo(thread, fiber);   // runs entry(arg) until it switches back
+///   thread.unbindFromThread();
+class FiberContext
+{
+public:
+    using EntryPoint = void (*)(void* arg);
+
+    FiberContext();
+    ~FiberContext();
+
+    VESPER_DISABLE_COPY_AND_MOVE(FiberContext)
+
+    /// @brief Make this a fiber that starts executing entry(arg) when first switched to
+    /// The entry point must never return (switch away instead)
+    /// @param stackSize Stack size in bytes (rounded up to the page size)
+    /// @return false if the stack could not be allocated
+    bool create(size_t stackSize, EntryPoint entry, void* arg);
+
+    /// @brief Make this the context of the calling thread (required before switching away from it)
+    /// @return false on failure
+    bool bindToThread();
+
+    /// @brief Undo bindToThread() (must be called on the same thread, while running on it)
+    void unbindFromThread();
+
+    /// @brief Save the running context into 'from' and resume 'to'
+    /// Returns when some thread switches back to 'from'. Fibers may resume on a different
+    /// thread than the one they were suspended on, so thread_local values cached across
+    /// this call must not be trusted.
+    static void switchTo(FiberContext& from, FiberContext& to);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
+} // namespace vesper
@@ -0,0 +1,79 @@
+#include "runtime/core/threading/frame_pacer.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace vesper {
+
+FramePacer::FramePacer(uint32_t maxFramesAhead)
+    : m_maxFramesAhead(std::min(maxFramesAhead, kMaxFramesAhead))
+{}
+
+void FramePacer::setMaxFramesAhead(uint32_t frames)
+{
+    m_maxFramesAhead.store(std::min(frames, kMaxFramesAhead), std::memory_order_relaxed);
+    // A larger budget may unblock the logic thread right away
+    m_logicEvent.notifyAll();
+}
+
+void FramePacer::beginLogicFrame()
+{
+    // The render thread reads this slot only after endLogicFrame() publishes it, and the
+    // frame that last used it is at least kTimingSlots - kMaxFramesAhead frames old
+    const uint64_t frame = m_produced.load(std::memory_order_relaxed);
+    FrameStamps& stamps = m_stamps[frame % kTimingSlots];
+    stamps.inputSampledNs = nowNanoseconds();
+    stamps.producedNs = 0;
+}
+
+void FramePacer::endLogicFrame()
+{
+    const uint64_t frame = m_produced.load(std::memory_order_relaxed);
+    m_stamps[frame % kTimingSlots].producedNs = nowNanoseconds();
+
+    m_produced.store(frame + 1, std::memory_order_release);
+    m_renderEvent.notifyOne();
+}
+
+uint64_t FramePacer::beginRenderFrame()
+{
+    const uint64_t produced = m_produced.load(std::memory_order_acquire);
+    m_renderSkipped = static_cast<uint32_t>(produced - m_taken - 1);
+    m_taken = produced;
+    m_renderFrame = produced - 1;
+    m_renderBeginNs = nowNanoseconds();
+    return m_renderFrame;
+}
+
+FramePacer::FrameLatency FramePacer::endRenderFrame()
+{
+    const FrameStamps& stamps = m_stamps[m_renderFrame % kTimingSlots];
+
+    FrameLatency latency;
+    latency.frameIndex = m_renderFrame;
+    latency.inputSampledNs = stamps.inputSampledNs;
+    latency.producedNs = stamps.producedNs;
+    latency.consumeBeginNs = m_renderBeginNs;
+    latency.consumedNs = nowNanoseconds();
+    latency.framesSkipped = m_renderSkipped;
+
+    // Read the stamps before releasing the slot to the logic thread
+    m_consumed.store(m_taken, std::memory_order_release);
+    m_logicEvent.notifyOne();
+    return latency;
+}
+
+void FramePacer::stop()
+{
+    m_stopped.store(true, std::memory_order_release);
+    m_logicEvent.notifyAll();
+    m_renderEvent.notifyAll();
+}
+
+uint64_t FramePacer::nowNanoseconds()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace vesper
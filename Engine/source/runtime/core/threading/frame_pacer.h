@@ -0,0 +1,196 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+#include "runtime/core/threading/event_count.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace vesper {
+
+/// @brief Paces a logic (producer) thread against a render (consumer) thread
+/// The logic thread may run at most maxFramesAhead frames ahead of the frame the render
+/// thread is working on: 0 = lockstep (no overlap), 1 = classic two-stage pipeline,
+/// 2 = one extra frame of slack. Both sides sleep on EventCounts while they cannot
+/// proceed, so an idle pipeline burns no CPU and a blocked side wakes as soon as the
+/// other one publishes.
+///
+/// The render thread always renders the newest produced frame; older frames it never
+/// started are counted as skipped. Per-frame timestamps (input sample -> packet produced
+/// -> packet consumed) are returned by endRenderFrame().
+///
+/// Usage (logic):                          Usage (render):
+///   while (pacer.waitForLogicSlot() ==      while (pacer.waitForFrame() ==
+///          FramePacer::WaitResult::Ready)          FramePacer::WaitResult::Ready)
+///   {                                       {
+///       pacer.beginLogicFrame();                pacer.beginRenderFrame();
+///       ... produce packet ...                  ... consume packet ...
+///       pacer.endLogicFrame();                  auto latency = pacer.endRenderFrame();
+///   }                                       }
+class FramePacer
+{
+public:
+    static constexpr uint32_t kMaxFramesAhead = 2;
+
+    enum class WaitResult : uint8_t
+    {
+        Ready,          // This side may start a frame
+        Interrupted,    // The caller's interrupt condition became true (e.g. affinity tasks queued)
+        Stopped,        // stop() was called
+    };
+
+    /// @brief Timestamps of one rendered frame (steady_clock nanoseconds)
+    struct FrameLatency
+    {
+        uint64_t frameIndex{0};         // Index of the produced frame that was rendered
+        uint64_t inputSampledNs{0};     // beginLogicFrame()
+        uint64_t producedNs{0};         // endLogicFrame()
+        uint64_t consumeBeginNs{0};     // beginRenderFrame()
+        uint64_t consumedNs{0};         // endRenderFrame()
+        uint32_t framesSkipped{0};      // Produced frames superseded before rendering started
+    };
+
+    explicit FramePacer(uint32_t maxFramesAhead = 1);
+    ~FramePacer() = default;
+
+    VESPER_DISABLE_COPY_AND_MOVE(FramePacer)
+
+    /// @brief Change how far logic may run ahead (clamped to kMaxFramesAhead)
+    void setMaxFramesAhead(uint32_t frames);
+
+    [[nodiscard]] uint32_t maxFramesAhead() const { return m_maxFramesAhead.load(std::memory_order_relaxed); }
+
+    // ========================================================================
+    // Logic thread
+    // ========================================================================
+
+    /// @brief Block until logic may start its next frame
+    /// @param interrupted Polled while waiting; notify logicWakeEvent() after making it true
+    template<typename Interrupt>
+    WaitResult waitForLogicSlot(Interrupt&& interrupted)
+    {
+        return waitUntil(m_logicEvent, [this]() { return canProduce(); }, interrupted);
+    }
+
+    WaitResult waitForLogicSlot()
+    {
+        return waitForLogicSlot([]() { return false; });
+    }
+
+    /// @brief Start producing a frame (stamps the input sample time)
+    void beginLogicFrame();
+
+    /// @brief Publish the produced frame to the render thread
+    void endLogicFrame();
+
+    // ========================================================================
+    // Render thread
+    // ========================================================================
+
+    /// @brief Block until a produced frame is available
+    /// @param interrupted Polled while waiting; notify renderWakeEvent() after making it true
+    template<typename Interrupt>
+    WaitResult waitForFrame(Interrupt&& interrupted)
+    {
+        return waitUntil(m_renderEvent, [this]() { return hasFrame(); }, interrupted);
+    }
+
+    WaitResult waitForFrame()
+    {
+        return waitForFrame([]() { return false; });
+    }
+
+    /// @brief Take every produced frame; the newest one is rendered
+    /// @return Index of the frame to render
+    uint64_t beginRenderFrame();
+
+    /// @brief Finish the frame, letting logic proceed
+    FrameLatency endRenderFrame();
+
+    // ========================================================================
+    // Control
+    // ========================================================================
+
+    /// @brief Unblock both sides for good (shutdown)
+    void stop();
+
+    [[nodiscard]] bool isStopped() const { return m_stopped.load(std::memory_order_acquire); }
+
+    /// @brief Events to notify when a logic/render interrupt condition becomes true
+    EventCount& logicWakeEvent() { return m_logicEvent; }
+    EventCount& renderWakeEvent() { return m_renderEvent; }
+
+    /// @brief Frames produced / fully consumed so far
+    [[nodiscard]] uint64_t framesProduced() const { return m_produced.load(std::memory_order_acquire); }
+    [[nodiscard]] uint64_t framesConsumed() const { return m_consumed.load(std::memory_order_acquire); }
+
+private:
+    // More than the kMaxFramesAhead + 1 frames that can be in flight
+    static constexpr uint32_t kTimingSlots = 4;
+
+    struct FrameStamps
+    {
+        uint64_t inputSampledNs{0};
+        uint64_t producedNs{0};
+    };
+
+    [[nodiscard]] bool canProduce() const
+    {
+        return m_produced.load(std::memory_order_acquire) - m_consumed.load(std::memory_order_acquire) <=
+               m_maxFramesAhead.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool hasFrame() const
+    {
+        return m_produced.load(std::memory_order_acquire) > m_taken;
+    }
+
+    template<typename Ready, typename Interrupt>
+    WaitResult waitUntil(EventCount& event, Ready&& ready, Interrupt& interrupted)
+    {
+        while (true)
+        {
+            if (isStopped())
+            {
+                return WaitResult::Stopped;
+            }
+            if (ready())
+            {
+                return WaitResult::Ready;
+            }
+            if (interrupted())
+            {
+                return WaitResult::Interrupted;
+            }
+
+            const EventCount::Key key = event.prepareWait();
+            if (isStopped() || ready() || interrupted())
+            {
+                event.cancelWait();
+                continue;
+            }
+            event.wait(key);
+        }
+    }
+
+    static uint64_t nowNanoseconds();
+
+private:
+    std::atomic<uint32_t> m_maxFramesAhead;
+    std::atomic<bool> m_stopped{false};
+
+    alignas(64) std::atomic<uint64_t> m_produced{0};    // Written by logic
+    alignas(64) std::atomic<uint64_t> m_consumed{0};    // Written by render
+    uint64_t m_taken{0};                                // Render thread only
+
+    std::array<FrameStamps, kTimingSlots> m_stamps{};   // Slot frame % kTimingSlots, written by logic
+    uint64_t m_renderFrame{0};                          // Render thread only
+    uint64_t m_renderBeginNs{0};
+    uint32_t m_renderSkipped{0};
+
+    EventCount m_logicEvent;
+    EventCount m_renderEvent;
+};
+
+} // namespace vesper
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace vesper {
+
+/// @brief Move-only type-erased void() callable with fixed inline storage
+/// Never allocates: callables larger than Capacity are rejected at compile time
+/// (capture a pointer to the data instead of the data itself)
+/// @tparam Capacity Size of the inline closure storage in bytes
+template<size_t Capacity>
+class InlineFunction
+{
+public:
+    static constexpr size_t kCapacity = Capacity;
+
+    InlineFunction() = default;
+
+    InlineFunction(std::nullptr_t) {}
+
+    template<typename F,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineFunction> &&
+                                         std::is_invocable_r_v<void, std::decay_t<F>&>>>
+    InlineFunction(F&& fn)
+    {
+        emplace(std::forward<F>(fn));
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept
+    {
+        moveFrom(other);
+    }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineFunction& operator=(std::nullptr_t)
+    {
+        reset();
+        return *this;
+    }
+
+    ~InlineFunction()
+    {
+        reset();
+    }
+
+    VESPER_DISABLE_COPY(InlineFunction)
+
+    /// @brief Invoke the stored callable (must not be empty)
+    void operator()()
+    {
+        m_ops->invoke(m_storage);
+    }
+
+    /// @brief Check if a callable is stored
+    explicit operator bool() const { return m_ops != nullptr; }
+
+    bool operator==(std::nullptr_t) const { return m_ops == nullptr; }
+
+    /// @brief Destroy the stored callable
+    void reset()
+    {
+        if (m_ops)
+        {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+private:
+    struct Ops
+    {
+        void (*invoke)(void* storage);
+        void (*relocate)(void* dst, void* src);   // Move-construct into dst, destroy src
+        void (*destroy)(void* storage);
+    };
+
+    template<typename Fn>
+    static constexpr Ops kOpsFor{
+        [](void* storage) { (*static_cast<Fn*>(storage))(); },
+        [](void* dst, void* src) {
+            ::new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+            static_cast<Fn*>(src)->~Fn();
+        },
+        [](void* storage) { static_cast<Fn*>(storage)->~Fn(); },
+    };
+
+    template<typename F>
+    void emplace(F&& fn)
+    {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= Capacity,
+                      "Callable too large for inline task storage - capture a pointer to the data instead");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t),
+                      "Callable is over-aligned for inline task storage");
+
+        // Empty std::function / null function pointers stay empty
+        if constexpr (std::is_constructible_v<bool, const Fn&>)
+        {
+            if (!static_cast<bool>(fn))
+            {
+                return;
+            }
+        }
+
+        ::new (static_cast<void*>(m_storage)) Fn(std::forward<F>(fn));
+        m_ops = &kOpsFor<Fn>;
+    }
+
+    void moveFrom(InlineFunction& other) noexcept
+    {
+        if (other.m_ops)
+        {
+            other.m_ops->relocate(m_storage, other.m_storage);
+            m_ops = other.m_ops;
+            other.m_ops = nullptr;
+        }
+    }
+
+private:
+    alignas(std::max_align_t) std::byte m_storage[Capacity];
+    const Ops* m_ops{nullptr};
+};
+
+} // namespace vesper
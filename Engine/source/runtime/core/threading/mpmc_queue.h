@@ -0,0 +1,300 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+#include "runtime/core/threading/spsc_queue.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace vesper {
+
+/// @brief Lock-free Multi Producer Multi Consumer (MPMC) bounded queue
+/// Based on Dmitry Vyukov's bounded MPMC queue: each cell carries a sequence number
+/// that tells producers and consumers whether it is free for the current lap, so both
+/// sides only contend on a single CAS of their position counter.
+/// The mutex/condvar is only touched by producers blocked under OverflowPolicy::Block.
+/// @tparam T Element type (only moved from on successful enqueue)
+/// @tparam Capacity Maximum number of elements (must be power of 2)
+template<typename T, size_t Capacity>
+class MPMCQueue
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+    static_assert(Capacity >= 2, "Capacity must be at least 2");
+
+public:
+    MPMCQueue()
+    {
+        for (size_t i = 0; i < Capacity; ++i)
+        {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MPMCQueue() = default;
+
+    VESPER_DISABLE_COPY_AND_MOVE(MPMCQueue)
+
+    /// @brief Signal shutdown to unblock waiting producers
+    void shutdown()
+    {
+        m_shutdown.store(true, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cv.notify_all();
+    }
+
+    /// @brief Check if queue is in shutdown state
+    [[nodiscard]] bool isShutdown() const
+    {
+        return m_shutdown.load(std::memory_order_acquire);
+    }
+
+    /// @brief Try to enqueue an item (thread-safe, lock-free)
+    /// @param item Item to enqueue
+    /// @return true if successful, false if queue is full
+    bool tryEnqueue(const T& item)
+    {
+        return tryEnqueueImpl(item);
+    }
+
+    /// @brief Try to enqueue an item (thread-safe, lock-free, move version)
+    /// @param item Item to enqueue (left untouched if the queue is full)
+    /// @return true if successful, false if queue is full
+    bool tryEnqueue(T&& item)
+    {
+        return tryEnqueueImpl(std::move(item));
+    }
+
+    /// @brief Enqueue with specified overflow policy (thread-safe)
+    /// @param item Item to enqueue
+    /// @param policy How to handle overflow
+    /// @return true if item was enqueued, false if dropped (DropNewest) or shutdown (Block)
+    template<typename U>
+    bool enqueue(U&& item, OverflowPolicy policy)
+    {
+        switch (policy)
+        {
+            case OverflowPolicy::Block:
+            {
+                if (tryEnqueueImpl(std::forward<U>(item)))
+                {
+                    return true;
+                }
+
+                // Slow path: register as a waiter so consumers know to signal.
+                // The fence pairs with the one in tryDequeue: either we see the freed
+                // cell or the consumer sees us waiting
+                m_waitingProducers.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                bool enqueued = false;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    while (!m_shutdown.load(std::memory_order_acquire))
+                    {
+                        if (tryEnqueueImpl(std::forward<U>(item)))
+                        {
+                            enqueued = true;
+                            break;
+                        }
+                        m_cv.wait(lock, [this]() {
+                            return !isFull() || m_shutdown.load(std::memory_order_acquire);
+                        });
+                    }
+                }
+                m_waitingProducers.fetch_sub(1, std::memory_order_relaxed);
+
+                if (!enqueued)
+                {
+                    m_stats.drop_count.fetch_add(1, std::memory_order_relaxed);
+                }
+                return enqueued;
+            }
+
+            case OverflowPolicy::DropNewest:
+            {
+                if (!tryEnqueueImpl(std::forward<U>(item)))
+                {
+                    m_stats.drop_count.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Try to dequeue an item (thread-safe, lock-free)
+    /// @param item Output item
+    /// @return true if successful, false if queue is empty
+    bool tryDequeue(T& item)
+    {
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        for (;;)
+        {
+            cell = &m_cells[pos & kIndexMask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+            if (diff == 0)
+            {
+                // Cell holds the item of this lap; claim it
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // Queue is empty
+            }
+            else
+            {
+                // Another consumer took this cell; catch up
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        item = std::move(cell->data);
+        // Hand the cell to the producer of the next lap
+        cell->sequence.store(pos + Capacity, std::memory_order_release);
+
+        m_stats.dequeue_count.fetch_add(1, std::memory_order_relaxed);
+
+        // Notify blocked producers only if there are any (keeps the fast path lock-free)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_waitingProducers.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cv.notify_one();
+        }
+
+        return true;
+    }
+
+    /// @brief Try to dequeue an item (thread-safe, lock-free)
+    /// @return Optional containing the item, or empty if queue is empty
+    std::optional<T> tryDequeue()
+    {
+        T item;
+        if (tryDequeue(item))
+        {
+            return item;
+        }
+        return std::nullopt;
+    }
+
+    /// @brief Check if queue is empty (approximate under concurrency)
+    [[nodiscard]] bool isEmpty() const
+    {
+        return size() == 0;
+    }
+
+    /// @brief Check if queue is full (approximate under concurrency)
+    [[nodiscard]] bool isFull() const
+    {
+        return size() >= Capacity;
+    }
+
+    /// @brief Get current number of elements in queue (approximate under concurrency)
+    [[nodiscard]] size_t size() const
+    {
+        const size_t tail = m_dequeuePos.load(std::memory_order_acquire);
+        const size_t head = m_enqueuePos.load(std::memory_order_acquire);
+        // Positions are read separately, so a racing consumer can make tail pass head
+        return head > tail ? head - tail : 0;
+    }
+
+    /// @brief Get queue capacity
+    [[nodiscard]] static constexpr size_t capacity() { return Capacity; }
+
+    /// @brief Get queue statistics
+    [[nodiscard]] const QueueStats& stats() const { return m_stats; }
+
+    /// @brief Reset statistics
+    void resetStats() { m_stats.reset(); }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T data{};
+    };
+
+    template<typename U>
+    bool tryEnqueueImpl(U&& item)
+    {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        for (;;)
+        {
+            cell = &m_cells[pos & kIndexMask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                // Cell is free for this lap; claim it
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // Queue is full (consumer of the previous lap not done yet)
+            }
+            else
+            {
+                // Another producer took this cell; catch up
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data = std::forward<U>(item);
+        // Publish to consumers
+        cell->sequence.store(pos + 1, std::memory_order_release);
+
+        m_stats.enqueue_count.fetch_add(1, std::memory_order_relaxed);
+
+        // Update peak depth
+        const size_t tail = m_dequeuePos.load(std::memory_order_relaxed);
+        const uint32_t currentDepth = pos + 1 > tail ? static_cast<uint32_t>(pos + 1 - tail) : 0;
+        uint32_t peak = m_stats.peak_depth.load(std::memory_order_relaxed);
+        while (currentDepth > peak)
+        {
+            if (m_stats.peak_depth.compare_exchange_weak(peak, currentDepth,
+                std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+
+        return true;
+    }
+
+private:
+    static constexpr size_t kIndexMask = Capacity - 1;
+    static constexpr size_t kCacheLineSize = 64;
+
+    alignas(kCacheLineSize) std::atomic<size_t> m_enqueuePos{0};
+    alignas(kCacheLineSize) std::atomic<size_t> m_dequeuePos{0};
+    alignas(kCacheLineSize) std::array<Cell, Capacity> m_cells;
+
+    // Slow path for Block policy only
+    alignas(kCacheLineSize) std::atomic<uint32_t> m_waitingProducers{0};
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::atomic<bool> m_shutdown{false};
+
+    QueueStats m_stats;
+};
+
+} // namespace vesper
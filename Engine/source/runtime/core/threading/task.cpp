@@ -0,0 +1,60 @@
+#include "runtime/core/threading/task.h"
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace vesper {
+
+namespace {
+
+struct TaskNameRegistry
+{
+    std::mutex mutex;
+    std::deque<std::string> names;                          // Index = id - 1; deque keeps c_str() stable
+    std::unordered_map<std::string_view, TaskNameId> ids;   // Views into names
+
+    static TaskNameRegistry& get()
+    {
+        static TaskNameRegistry s_registry;
+        return s_registry;
+    }
+};
+
+} // namespace
+
+TaskNameId internTaskName(std::string_view name)
+{
+    if (name.empty())
+    {
+        return kInvalidTaskNameId;
+    }
+
+    TaskNameRegistry& registry = TaskNameRegistry::get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    if (auto it = registry.ids.find(name); it != registry.ids.end())
+    {
+        return it->second;
+    }
+
+    const std::string& stored = registry.names.emplace_back(name);
+    const auto id = static_cast<TaskNameId>(registry.names.size());
+    registry.ids.emplace(stored, id);
+    return id;
+}
+
+const char* taskNameString(TaskNameId id)
+{
+    if (id == kInvalidTaskNameId)
+    {
+        return "";
+    }
+
+    TaskNameRegistry& registry = TaskNameRegistry::get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return id <= registry.names.size() ? registry.names[id - 1].c_str() : "";
+}
+
+} // namespace vesper
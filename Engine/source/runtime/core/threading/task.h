@@ -1,12 +1,16 @@
 #pragma once
 
 #include "runtime/core/base/macro.h"
+#include "runtime/core/threading/inline_function.h"
+#include "runtime/core/threading/task_profiler.h"
 #include "runtime/core/threading/wait_group.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace vesper {
 
@@ -30,10 +34,34 @@ enum class TaskPriority : uint8_t
 /// @brief Function type for task execution (heap-allocating, flexible)
 using TaskFunction = std::function<void()>;
 
+/// @brief Inline closure capacity of a Task record
+/// Large enough for a std::function, a shared_ptr plus a few pointers, or a range split
+inline constexpr size_t kTaskInlineStorageSize = 64;
+
+/// @brief Move-only task closure stored inline in the Task record (no heap allocation)
+using InlineTaskFunction = InlineFunction<kTaskInlineStorageSize>;
+
+/// @brief Interned task debug name (0 = unnamed)
+using TaskNameId = uint32_t;
+inline constexpr TaskNameId kInvalidTaskNameId = 0;
+
+/// @brief Intern a debug name, returning a stable id (thread-safe, takes a lock)
+/// Intern once and keep the id, e.g. static const TaskNameId kId = internTaskName("Culling");
+[[nodiscard]] TaskNameId internTaskName(std::string_view name);
+
+/// @brief Look up an interned name ("" for kInvalidTaskNameId or unknown ids)
+[[nodiscard]] const char* taskNameString(TaskNameId id);
+
 /// @brief Lightweight function pointer type (no heap allocation)
 /// @param userData User-provided context pointer
 using LightTaskFunc = void(*)(void* userData);
 
+/// @brief Type-erased range body used by WorkerPool::parallelFor (no heap allocation)
+/// @param context Caller-owned body object
+/// @param begin First index of the chunk
+/// @param end One past the last index of the chunk
+using RangeTaskFunc = void(*)(void* context, size_t begin, size_t end);
+
 // Forward declaration for LightTask::toTask()
 struct Task;
 
@@ -75,36 +103,65 @@ struct LightTask
 };
 
 /// @brief A unit of work to be executed by the task system
+/// Fixed-size, move-only record: the closure lives inline and completion is signalled
+/// through a non-owning TaskCounter pointer, so submitting a Task never allocates.
+/// The optional WaitGroupPtr only serves the legacy submit() API that returns one.
 struct Task
 {
-    TaskFunction    function;           // The work to execute
-    TaskAffinity    affinity{TaskAffinity::AnyThread};
-    TaskPriority    priority{TaskPriority::Normal};
-    WaitGroupPtr    waitGroup;          // Optional wait group to signal on completion
-    std::string     debugName;          // Optional name for debugging/profiling
+    InlineTaskFunction  function;                       // The work to execute (inline storage)
+    TaskCounter*        counter{nullptr};               // Optional counter to signal (caller keeps it alive)
+    WaitGroupPtr        waitGroup;                      // Optional wait group to signal on completion
+    TaskNameId          debugNameId{kInvalidTaskNameId}; // Interned name for debugging/profiling
+    uint32_t            profileId{0};                   // TaskProfiler event id (0 = not traced)
+    TaskAffinity        affinity{TaskAffinity::AnyThread};
+    TaskPriority        priority{TaskPriority::Normal};
 
     Task() = default;
 
-    Task(TaskFunction fn,
+    Task(InlineTaskFunction fn,
          TaskAffinity aff = TaskAffinity::AnyThread,
          TaskPriority prio = TaskPriority::Normal,
          WaitGroupPtr wg = nullptr,
-         std::string name = "")
+         TaskNameId nameId = kInvalidTaskNameId)
         : function(std::move(fn))
+        , waitGroup(std::move(wg))
+        , debugNameId(nameId)
         , affinity(aff)
         , priority(prio)
-        , waitGroup(std::move(wg))
-        , debugName(std::move(name))
     {}
 
+    Task(Task&&) noexcept = default;
+    Task& operator=(Task&&) noexcept = default;
+    ~Task() = default;
+
+    VESPER_DISABLE_COPY(Task)
+
     /// @brief Execute the task and signal completion
     void execute()
     {
+        profileId = TaskProfiler::recordStart(profileId, debugNameId);
+
         if (function)
         {
             function();
         }
 
+        if (profileId != 0)
+        {
+            TaskProfiler::record(TaskEventType::End, profileId, debugNameId);
+        }
+
+        signalDone();
+    }
+
+    /// @brief Signal completion without running (task dropped)
+    void signalDone()
+    {
+        if (counter)
+        {
+            counter->done();
+        }
+
         if (waitGroup)
         {
             waitGroup->done();
@@ -114,7 +171,7 @@ struct Task
     /// @brief Check if task is valid (has a function)
     [[nodiscard]] bool isValid() const
     {
-        return function != nullptr;
+        return static_cast<bool>(function);
     }
 
     /// @brief Check if task can run on worker threads
@@ -122,6 +179,12 @@ struct Task
     {
         return affinity == TaskAffinity::AnyThread;
     }
+
+    /// @brief Get the debug name ("" if unnamed)
+    [[nodiscard]] const char* debugName() const
+    {
+        return taskNameString(debugNameId);
+    }
 };
 
 // Implementation of LightTask::toTask() (must be after Task definition)
@@ -146,7 +209,7 @@ class TaskBuilder
 public:
     TaskBuilder() = default;
 
-    TaskBuilder& withFunction(TaskFunction fn)
+    TaskBuilder& withFunction(InlineTaskFunction fn)
     {
         m_task.function = std::move(fn);
         return *this;
@@ -170,9 +233,21 @@ public:
         return *this;
     }
 
-    TaskBuilder& withDebugName(std::string name)
+    TaskBuilder& withCounter(TaskCounter& counter)
+    {
+        m_task.counter = &counter;
+        return *this;
+    }
+
+    TaskBuilder& withDebugName(std::string_view name)
+    {
+        m_task.debugNameId = internTaskName(name);
+        return *this;
+    }
+
+    TaskBuilder& withDebugName(TaskNameId nameId)
     {
-        m_task.debugName = std::move(name);
+        m_task.debugNameId = nameId;
         return *this;
     }
 
@@ -186,7 +261,7 @@ private:
 };
 
 /// @brief Create a simple task with a function
-inline Task makeTask(TaskFunction fn,
+inline Task makeTask(InlineTaskFunction fn,
                      TaskAffinity affinity = TaskAffinity::AnyThread,
                      TaskPriority priority = TaskPriority::Normal)
 {
@@ -194,7 +269,7 @@ inline Task makeTask(TaskFunction fn,
 }
 
 /// @brief Create a task with a wait group
-inline Task makeTask(TaskFunction fn,
+inline Task makeTask(InlineTaskFunction fn,
                      WaitGroupPtr wg,
                      TaskAffinity affinity = TaskAffinity::AnyThread,
                      TaskPriority priority = TaskPriority::Normal)
@@ -0,0 +1,221 @@
+#include "runtime/core/threading/task_graph.h"
+#include "runtime/core/threading/worker_pool.h"
+#include "runtime/core/log/log_system.h"
+
+#include <exception>
+
+namespace vesper {
+
+TaskGraph::~TaskGraph()
+{
+    if (isRunning())
+    {
+        // Node tasks still reference this graph
+        LOG_FATAL("TaskGraph destroyed while running");
+        std::terminate();
+    }
+}
+
+TaskGraph::NodeId TaskGraph::addNode(InlineTaskFunction fn,
+                                     TaskAffinity affinity,
+                                     TaskPriority priority,
+                                     TaskNameId nameId)
+{
+    if (isRunning())
+    {
+        LOG_ERROR("TaskGraph: Cannot add nodes while the graph is running");
+        return kInvalidNode;
+    }
+
+    Node& node = m_nodes.emplace_back();
+    node.function = std::move(fn);
+    node.affinity = affinity;
+    node.priority = priority;
+    node.nameId = nameId;
+
+    m_compiled = false;
+    return static_cast<NodeId>(m_nodes.size() - 1);
+}
+
+void TaskGraph::addDependency(NodeId before, NodeId after)
+{
+    if (before >= m_nodes.size() || after >= m_nodes.size() || before == after)
+    {
+        LOG_ERROR("TaskGraph: Invalid dependency {} -> {}", before, after);
+        return;
+    }
+
+    if (isRunning())
+    {
+        LOG_ERROR("TaskGraph: Cannot add dependencies while the graph is running");
+        return;
+    }
+
+    m_edges.emplace_back(before, after);
+    m_compiled = false;
+}
+
+bool TaskGraph::compile()
+{
+    const size_t nodeCount = m_nodes.size();
+
+    for (Node& node : m_nodes)
+    {
+        node.predecessorCount = 0;
+        node.successorCount = 0;
+    }
+    for (const auto& [before, after] : m_edges)
+    {
+        ++m_nodes[before].successorCount;
+        ++m_nodes[after].predecessorCount;
+    }
+
+    // Successor lists: prefix sum over successor counts, then scatter
+    uint32_t offset = 0;
+    for (Node& node : m_nodes)
+    {
+        node.firstSuccessor = offset;
+        offset += node.successorCount;
+    }
+
+    m_successors.assign(m_edges.size(), kInvalidNode);
+    std::vector<uint32_t> filled(nodeCount, 0);
+    for (const auto& [before, after] : m_edges)
+    {
+        m_successors[m_nodes[before].firstSuccessor + filled[before]++] = after;
+    }
+
+    m_roots.clear();
+    for (NodeId i = 0; i < nodeCount; ++i)
+    {
+        if (m_nodes[i].predecessorCount == 0)
+        {
+            m_roots.push_back(i);
+        }
+    }
+
+    // Kahn's algorithm: every node must be reachable in topological order
+    std::vector<uint32_t> remaining(nodeCount);
+    std::vector<NodeId> order(m_roots);
+    for (NodeId i = 0; i < nodeCount; ++i)
+    {
+        remaining[i] = m_nodes[i].predecessorCount;
+    }
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        const Node& node = m_nodes[order[i]];
+        for (uint32_t s = 0; s < node.successorCount; ++s)
+        {
+            const NodeId successor = m_successors[node.firstSuccessor + s];
+            if (--remaining[successor] == 0)
+            {
+                order.push_back(successor);
+            }
+        }
+    }
+
+    if (order.size() != nodeCount)
+    {
+        LOG_ERROR("TaskGraph: Dependency cycle detected ({} of {} nodes reachable)", order.size(), nodeCount);
+        m_compiled = false;
+        return false;
+    }
+
+    m_remainingPredecessors = std::make_unique<std::atomic<uint32_t>[]>(nodeCount);
+    m_compiled = true;
+    return true;
+}
+
+bool TaskGraph::dispatch(WorkerPool& pool)
+{
+    if (isRunning())
+    {
+        LOG_ERROR("TaskGraph: dispatch() called while the previous run is still in flight");
+        return false;
+    }
+
+    if (m_nodes.empty() || (!m_compiled && !compile()))
+    {
+        return false;
+    }
+
+    m_pool = &pool;
+    for (NodeId i = 0; i < m_nodes.size(); ++i)
+    {
+        m_remainingPredecessors[i].store(m_nodes[i].predecessorCount, std::memory_order_relaxed);
+    }
+
+    // Hold the run open until every root is out, so it cannot finish between two roots
+    m_pending.add(1);
+    for (NodeId root : m_roots)
+    {
+        dispatchNode(root);
+    }
+    m_pending.done();
+    return true;
+}
+
+void TaskGraph::wait(WorkerPool& pool)
+{
+    pool.waitFor(m_pending);
+}
+
+bool TaskGraph::run(WorkerPool& pool)
+{
+    if (!dispatch(pool))
+    {
+        return false;
+    }
+
+    wait(pool);
+    return true;
+}
+
+void TaskGraph::clear()
+{
+    if (isRunning())
+    {
+        LOG_ERROR("TaskGraph: Cannot clear while the graph is running");
+        return;
+    }
+
+    m_nodes.clear();
+    m_edges.clear();
+    m_successors.clear();
+    m_roots.clear();
+    m_remainingPredecessors.reset();
+    m_compiled = false;
+}
+
+void TaskGraph::dispatchNode(NodeId node)
+{
+    const Node& desc = m_nodes[node];
+
+    // Each node task signals m_pending; successors are dispatched (and counted) from inside
+    // the predecessor's task, so the counter cannot hit zero before the last node finishes
+    Task task([this, node]() { executeNode(node); }, desc.affinity, desc.priority, nullptr, desc.nameId);
+    if (!m_pool->submitContinuation(std::move(task), m_pending))
+    {
+        LOG_ERROR("TaskGraph: Node {} was dropped, its successors will not run", node);
+    }
+}
+
+void TaskGraph::executeNode(NodeId node)
+{
+    Node& desc = m_nodes[node];
+    if (desc.function)
+    {
+        desc.function();
+    }
+
+    for (uint32_t s = 0; s < desc.successorCount; ++s)
+    {
+        const NodeId successor = m_successors[desc.firstSuccessor + s];
+        if (m_remainingPredecessors[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            dispatchNode(successor);
+        }
+    }
+}
+
+} // namespace vesper
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+#include "runtime/core/threading/task.h"
+#include "runtime/core/threading/wait_group.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace vesper {
+
+class WorkerPool;
+
+/// @brief Reusable directed acyclic graph of tasks
+/// Nodes and edges are declared once; every run() resets the per-node predecessor
+/// counters and executes the graph again without allocating. A node becomes ready when
+/// its last predecessor finishes, and is pushed by that finishing thread straight onto
+/// its own work-stealing deque (AnyThread) or routed to the Render/Logic queue.
+///
+/// Usage:
+///   TaskGraph graph;
+///   auto a = graph.addNode([]{ updateTransforms(); });
+///   auto b = graph.addNode([]{ updateBounds(); });
+///   graph.addDependency(a, b);   // b runs after a
+///   graph.run(pool);             // every frame
+class TaskGraph
+{
+public:
+    using NodeId = uint32_t;
+    static constexpr NodeId kInvalidNode = UINT32_MAX;
+
+    TaskGraph() = default;
+    ~TaskGraph();
+
+    VESPER_DISABLE_COPY_AND_MOVE(TaskGraph)
+
+    /// @brief Add a node (not allowed while the graph is running)
+    /// The function is kept and invoked on every run
+    /// @param fn Work to execute
+    /// @param affinity Thread the node must run on
+    /// @param priority Priority used when the node goes through the global queues
+    /// @param nameId Interned debug name
+    /// @return Node id
+    NodeId addNode(InlineTaskFunction fn,
+                   TaskAffinity affinity = TaskAffinity::AnyThread,
+                   TaskPriority priority = TaskPriority::Normal,
+                   TaskNameId nameId = kInvalidTaskNameId);
+
+    /// @brief Declare that 'after' may only start once 'before' has finished
+    void addDependency(NodeId before, NodeId after);
+
+    /// @brief Validate the graph (acyclic) and build the successor tables
+    /// Called automatically by dispatch() after the graph was modified
+    /// @return false if the graph contains a cycle
+    bool compile();
+
+    /// @brief Start executing the graph (non-blocking)
+    /// @return false if the graph is invalid, empty or already running
+    bool dispatch(WorkerPool& pool);
+
+    /// @brief Wait for the current run to finish, help-running meanwhile
+    void wait(WorkerPool& pool);
+
+    /// @brief dispatch() + wait()
+    /// @return false if the graph could not be dispatched
+    bool run(WorkerPool& pool);
+
+    /// @brief Remove all nodes and edges (not allowed while running)
+    void clear();
+
+    /// @brief Check if a run is in flight
+    [[nodiscard]] bool isRunning() const { return !m_pending.isDone(); }
+
+    /// @brief Get number of nodes
+    [[nodiscard]] size_t nodeCount() const { return m_nodes.size(); }
+
+private:
+    struct Node
+    {
+        InlineTaskFunction  function;
+        TaskAffinity        affinity{TaskAffinity::AnyThread};
+        TaskPriority        priority{TaskPriority::Normal};
+        TaskNameId          nameId{kInvalidTaskNameId};
+        uint32_t            predecessorCount{0};
+        uint32_t            firstSuccessor{0};      // Index into m_successors
+        uint32_t            successorCount{0};
+    };
+
+    /// @brief Hand a ready node to the pool
+    void dispatchNode(NodeId node);
+
+    /// @brief Run a node, then release its successors
+    void executeNode(NodeId node);
+
+private:
+    std::vector<Node> m_nodes;
+    std::vector<std::pair<NodeId, NodeId>> m_edges;     // (before, after), as declared
+    std::vector<NodeId> m_successors;                   // Flattened successor lists (built by compile)
+    std::vector<NodeId> m_roots;                        // Nodes without predecessors
+    std::unique_ptr<std::atomic<uint32_t>[]> m_remainingPredecessors;
+
+    WorkerPool* m_pool{nullptr};                        // Pool of the current run
+    TaskCounter m_pending;                              // Nodes dispatched but not finished
+    bool m_compiled{false};
+};
+
+} // namespace vesper
@@ -0,0 +1,118 @@
+#include "runtime/core/threading/task_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vesper {
+
+namespace {
+
+constexpr size_t kChunkSize = 256;          // Records allocated at once when the pool runs dry
+constexpr size_t kTransferBatch = 64;       // Records moved between a thread cache and the shared list
+constexpr size_t kCacheHighWater = 4 * kTransferBatch;
+
+struct SharedTaskPool
+{
+    std::mutex mutex;
+    std::vector<Task*> freeList;
+    std::vector<std::unique_ptr<Task[]>> chunks;
+    std::atomic<size_t> allocated{0};
+
+    /// @brief Intentionally never destroyed: worker threads of static pools may return
+    /// records from their thread-local caches after static destruction has begun
+    static SharedTaskPool& get()
+    {
+        static SharedTaskPool* s_pool = new SharedTaskPool();
+        return *s_pool;
+    }
+};
+
+struct ThreadTaskCache
+{
+    std::vector<Task*> records;
+
+    ~ThreadTaskCache()
+    {
+        if (records.empty())
+        {
+            return;
+        }
+
+        SharedTaskPool& shared = SharedTaskPool::get();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        shared.freeList.insert(shared.freeList.end(), records.begin(), records.end());
+    }
+
+    void refill()
+    {
+        SharedTaskPool& shared = SharedTaskPool::get();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+
+        if (shared.freeList.empty())
+        {
+            auto chunk = std::make_unique<Task[]>(kChunkSize);
+            for (size_t i = 0; i < kChunkSize; ++i)
+            {
+                shared.freeList.push_back(&chunk[i]);
+            }
+            shared.chunks.push_back(std::move(chunk));
+            shared.allocated.fetch_add(kChunkSize, std::memory_order_relaxed);
+        }
+
+        const size_t take = std::min(kTransferBatch, shared.freeList.size());
+        records.insert(records.end(), shared.freeList.end() - static_cast<ptrdiff_t>(take), shared.freeList.end());
+        shared.freeList.resize(shared.freeList.size() - take);
+    }
+
+    void spill()
+    {
+        SharedTaskPool& shared = SharedTaskPool::get();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        shared.freeList.insert(shared.freeList.end(), records.end() - static_cast<ptrdiff_t>(kTransferBatch), records.end());
+        records.resize(records.size() - kTransferBatch);
+    }
+};
+
+thread_local ThreadTaskCache t_taskCache;
+
+} // namespace
+
+Task* TaskPool::acquire()
+{
+    if (t_taskCache.records.empty())
+    {
+        t_taskCache.records.reserve(kCacheHighWater + 1);
+        t_taskCache.refill();
+    }
+
+    Task* task = t_taskCache.records.back();
+    t_taskCache.records.pop_back();
+    return task;
+}
+
+void TaskPool::release(Task* task)
+{
+    if (!task)
+    {
+        return;
+    }
+
+    // Destroy captures now rather than when the record is reused
+    *task = Task{};
+
+    t_taskCache.records.push_back(task);
+    if (t_taskCache.records.size() > kCacheHighWater)
+    {
+        t_taskCache.spill();
+    }
+}
+
+size_t TaskPool::allocatedCount()
+{
+    return SharedTaskPool::get().allocated.load(std::memory_order_relaxed);
+}
+
+} // namespace vesper
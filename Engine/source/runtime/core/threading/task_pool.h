@@ -0,0 +1,30 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+#include "runtime/core/threading/task.h"
+
+#include <cstddef>
+
+namespace vesper {
+
+/// @brief Process-wide recycler for heap-stable Task records
+/// Work-stealing deques hold Task* rather than Task values (Chase-Lev stealing is only
+/// safe for trivially copyable elements), so records need a stable address that outlives
+/// the push. Records are cached per thread and exchanged with a shared free list in
+/// batches; after warm-up acquire/release never touch the heap or a lock.
+class TaskPool
+{
+public:
+    /// @brief Get an empty task record (owned by the caller until release)
+    [[nodiscard]] static Task* acquire();
+
+    /// @brief Clear a record and return it to the calling thread's cache
+    static void release(Task* task);
+
+    /// @brief Total records ever allocated (diagnostics; stays flat in steady state)
+    [[nodiscard]] static size_t allocatedCount();
+
+    TaskPool() = delete;
+};
+
+} // namespace vesper
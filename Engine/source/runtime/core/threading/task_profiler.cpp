@@ -0,0 +1,319 @@
+#include "runtime/core/threading/task_profiler.h"
+#include "runtime/core/threading/task.h"
+#include "runtime/core/threading/worker_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace vesper {
+
+namespace {
+
+static_assert((TaskProfiler::kEventsPerThread & (TaskProfiler::kEventsPerThread - 1)) == 0,
+              "ring size must be a power of two");
+
+/// @brief Single-writer ring of one thread's events
+struct ThreadEventBuffer
+{
+    std::unique_ptr<TaskEvent[]> events{std::make_unique<TaskEvent[]>(TaskProfiler::kEventsPerThread)};
+    std::atomic<uint64_t> head{0};      // Events ever written (owner thread only)
+    uint64_t clearedAt{0};              // Events before this index were cleared (guarded by registry mutex)
+    uint32_t threadIndex{0};
+    ThreadType threadType{ThreadType::Unknown};
+    std::string name;
+};
+
+struct ProfilerRegistry
+{
+    std::mutex mutex;
+    std::vector<ThreadEventBuffer*> buffers;
+
+    /// @brief Intentionally never destroyed (like the buffers): threads may record during
+    /// static destruction and traces are dumped after worker threads exit
+    static ProfilerRegistry& get()
+    {
+        static ProfilerRegistry* s_registry = new ProfilerRegistry();
+        return *s_registry;
+    }
+};
+
+thread_local ThreadEventBuffer* t_eventBuffer = nullptr;
+thread_local std::string t_threadName;
+
+const char* threadTypeName(ThreadType type)
+{
+    switch (type)
+    {
+        case ThreadType::Main:    return "Main";
+        case ThreadType::Render:  return "Render";
+        case ThreadType::Worker:  return "Worker";
+        case ThreadType::Unknown: break;
+    }
+    return "Thread";
+}
+
+ThreadEventBuffer& currentBuffer()
+{
+    if (!t_eventBuffer)
+    {
+        auto* buffer = new ThreadEventBuffer();
+        buffer->threadType = ThreadContext::currentThreadType();
+        buffer->name = t_threadName;
+
+        ProfilerRegistry& registry = ProfilerRegistry::get();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        buffer->threadIndex = static_cast<uint32_t>(registry.buffers.size()) + 1;
+        if (buffer->name.empty())
+        {
+            buffer->name = std::string(threadTypeName(buffer->threadType)) + " " + std::to_string(buffer->threadIndex);
+        }
+        registry.buffers.push_back(buffer);
+        t_eventBuffer = buffer;
+    }
+    return *t_eventBuffer;
+}
+
+inline uint64_t nowNanoseconds()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/// @brief Copy of one buffer's events taken during a dump
+struct ThreadSnapshot
+{
+    uint32_t tid{0};
+    ThreadType threadType{ThreadType::Unknown};
+    std::string name;
+    std::vector<TaskEvent> events;
+};
+
+ThreadSnapshot snapshot(ThreadEventBuffer& buffer)
+{
+    constexpr uint64_t kCapacity = TaskProfiler::kEventsPerThread;
+
+    ThreadSnapshot result;
+    result.tid = buffer.threadIndex;
+    result.threadType = buffer.threadType;
+    result.name = buffer.name;
+
+    const uint64_t end = buffer.head.load(std::memory_order_acquire);
+    const uint64_t begin = std::max(buffer.clearedAt, end > kCapacity ? end - kCapacity : 0);
+    result.events.reserve(static_cast<size_t>(end - begin));
+    for (uint64_t i = begin; i < end; ++i)
+    {
+        result.events.push_back(buffer.events[i & (kCapacity - 1)]);
+    }
+
+    // The owner kept writing while we copied: drop the slots it may have overwritten
+    const uint64_t after = buffer.head.load(std::memory_order_acquire);
+    if (after > kCapacity && after - kCapacity > begin)
+    {
+        const uint64_t overwritten = std::min(after - kCapacity - begin, end - begin);
+        result.events.erase(result.events.begin(), result.events.begin() + static_cast<ptrdiff_t>(overwritten));
+    }
+    return result;
+}
+
+/// @brief Write a task name as a JSON string body
+void writeEscaped(std::ofstream& out, const char* text)
+{
+    for (; *text; ++text)
+    {
+        const char c = *text;
+        if (c == '"' || c == '\\')
+        {
+            out << '\\' << c;
+        }
+        else if (static_cast<unsigned char>(c) >= 0x20)
+        {
+            out << c;
+        }
+    }
+}
+
+const char* eventName(uint32_t nameId)
+{
+    const char* name = taskNameString(nameId);
+    return *name ? name : "Task";
+}
+
+/// @brief Nanoseconds since the first event, as trace microseconds
+inline double toMicroseconds(uint64_t timestamp, uint64_t origin)
+{
+    return static_cast<double>(timestamp - origin) / 1000.0;
+}
+
+} // namespace
+
+void TaskProfiler::setThreadName(std::string_view name)
+{
+    t_threadName = name;
+    if (t_eventBuffer)
+    {
+        std::lock_guard<std::mutex> lock(ProfilerRegistry::get().mutex);
+        t_eventBuffer->name = t_threadName;
+    }
+}
+
+void TaskProfiler::record(TaskEventType type, uint32_t taskId, uint32_t nameId)
+{
+    ThreadEventBuffer& buffer = currentBuffer();
+    const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+
+    TaskEvent& event = buffer.events[head & (kEventsPerThread - 1)];
+    event.timestamp = nowNanoseconds();
+    event.taskId = taskId;
+    event.nameId = nameId;
+    event.type = type;
+
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void TaskProfiler::clear()
+{
+    ProfilerRegistry& registry = ProfilerRegistry::get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (ThreadEventBuffer* buffer : registry.buffers)
+    {
+        buffer->clearedAt = buffer->head.load(std::memory_order_acquire);
+    }
+}
+
+bool TaskProfiler::dumpChromeTrace(const std::string& path)
+{
+    std::vector<ThreadSnapshot> threads;
+    {
+        ProfilerRegistry& registry = ProfilerRegistry::get();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        threads.reserve(registry.buffers.size());
+        for (ThreadEventBuffer* buffer : registry.buffers)
+        {
+            threads.push_back(snapshot(*buffer));
+        }
+    }
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out)
+    {
+        return false;
+    }
+
+    // Where each task was submitted and where it ended, keyed by task id
+    struct EventSite
+    {
+        uint64_t timestamp{0};
+        uint32_t tid{0};
+    };
+    std::unordered_map<uint32_t, EventSite> submits;
+    std::unordered_map<uint32_t, EventSite> ends;
+    uint64_t origin = UINT64_MAX;
+
+    for (const ThreadSnapshot& thread : threads)
+    {
+        for (const TaskEvent& event : thread.events)
+        {
+            origin = std::min(origin, event.timestamp);
+            if (event.type == TaskEventType::Submit)
+            {
+                submits[event.taskId] = {event.timestamp, thread.tid};
+            }
+            else if (event.type == TaskEventType::End)
+            {
+                ends[event.taskId] = {event.timestamp, thread.tid};
+            }
+        }
+    }
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    out.setf(std::ios::fixed);
+    out.precision(3);
+
+    bool first = true;
+    auto beginEvent = [&]() -> std::ofstream& {
+        out << (first ? "" : ",\n");
+        first = false;
+        return out;
+    };
+
+    for (const ThreadSnapshot& thread : threads)
+    {
+        // Main and Render first, then workers in creation order
+        const uint32_t sortIndex = thread.threadType == ThreadType::Main     ? 0
+                                 : thread.threadType == ThreadType::Render   ? 1
+                                                                             : 1 + thread.tid;
+        beginEvent() << "{\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.tid
+                     << ",\"name\":\"thread_name\",\"args\":{\"name\":\"";
+        writeEscaped(out, thread.name.c_str());
+        out << "\"}}";
+        beginEvent() << "{\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.tid
+                     << ",\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":" << sortIndex << "}}";
+    }
+
+    for (const ThreadSnapshot& thread : threads)
+    {
+        for (const TaskEvent& event : thread.events)
+        {
+            if (event.type == TaskEventType::Steal)
+            {
+                beginEvent() << "{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":" << thread.tid
+                             << ",\"ts\":" << toMicroseconds(event.timestamp, origin)
+                             << ",\"name\":\"Steal\",\"cat\":\"steal\",\"args\":{\"task\":\"";
+                writeEscaped(out, eventName(event.nameId));
+                out << "\",\"id\":" << event.taskId << "}}";
+                continue;
+            }
+
+            if (event.type != TaskEventType::Start)
+            {
+                continue;
+            }
+
+            // Still running (or its end was overwritten): nothing to draw
+            const auto end = ends.find(event.taskId);
+            if (end == ends.end() || end->second.timestamp < event.timestamp)
+            {
+                continue;
+            }
+
+            const double startUs = toMicroseconds(event.timestamp, origin);
+            beginEvent() << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << thread.tid << ",\"ts\":" << startUs
+                         << ",\"dur\":" << toMicroseconds(end->second.timestamp, event.timestamp)
+                         << ",\"name\":\"";
+            writeEscaped(out, eventName(event.nameId));
+            out << "\",\"cat\":\"task\",\"args\":{\"id\":" << event.taskId;
+
+            const auto submit = submits.find(event.taskId);
+            if (submit != submits.end() && submit->second.timestamp <= event.timestamp)
+            {
+                out << ",\"queuedUs\":" << toMicroseconds(event.timestamp, submit->second.timestamp);
+            }
+            if (end->second.tid != thread.tid)
+            {
+                out << ",\"endedOnTid\":" << end->second.tid;
+            }
+            out << "}}";
+
+            // Flow arrow from the submitting thread to where the task started
+            if (submit != submits.end() && submit->second.timestamp <= event.timestamp)
+            {
+                beginEvent() << "{\"ph\":\"s\",\"pid\":1,\"tid\":" << submit->second.tid
+                             << ",\"ts\":" << toMicroseconds(submit->second.timestamp, origin)
+                             << ",\"id\":" << event.taskId << ",\"name\":\"submit\",\"cat\":\"flow\"}";
+                beginEvent() << "{\"ph\":\"f\",\"bp\":\"e\",\"pid\":1,\"tid\":" << thread.tid
+                             << ",\"ts\":" << startUs << ",\"id\":" << event.taskId
+                             << ",\"name\":\"submit\",\"cat\":\"flow\"}";
+            }
+        }
+    }
+
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace vesper
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace vesper {
+
+/// @brief What happened to a task at one point in time
+enum class TaskEventType : uint8_t
+{
+    Submit,     // Pushed onto a queue or deque (submitting thread)
+    Start,      // Began executing (executing thread)
+    End,        // Finished executing (may be another thread if a fiber migrated)
+    Steal,      // Taken from another worker's deque (thief thread)
+};
+
+/// @brief One timestamped task event (24 bytes)
+struct TaskEvent
+{
+    uint64_t timestamp{0};      // steady_clock nanoseconds
+    uint32_t taskId{0};         // Correlates Submit/Start/End/Steal of one task
+    uint32_t nameId{0};         // TaskNameId
+    TaskEventType type{TaskEventType::Submit};
+};
+
+/// @brief Process-wide task lifetime profiler
+/// Every thread that records gets its own fixed-size ring buffer (oldest events are
+/// overwritten), written without locks or atomics beyond a release store of the head.
+/// Buffers are created on a thread's first event and live until process exit, so a
+/// trace can still be dumped after worker threads have stopped.
+/// Recording is off by default; when off each hook costs one relaxed load.
+///
+/// Usage:
+///   TaskProfiler::setEnabled(true);
+///   ... run frames ...
+///   TaskProfiler::dumpChromeTrace("frame.json");   // open in chrome://tracing or Perfetto
+class TaskProfiler
+{
+public:
+    /// @brief Events kept per thread (power of two)
+    static constexpr size_t kEventsPerThread = 1 << 16;
+
+    /// @brief Start or stop recording
+    static void setEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+
+    [[nodiscard]] static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    /// @brief Label the calling thread in traces (default: derived from its ThreadType)
+    static void setThreadName(std::string_view name);
+
+    /// @brief A task is about to be queued
+    /// @return Id to store in Task::profileId (0 when not recording)
+    static uint32_t recordSubmit(uint32_t nameId)
+    {
+        if (!isEnabled())
+        {
+            return 0;
+        }
+
+        const uint32_t taskId = nextId();
+        record(TaskEventType::Submit, taskId, nameId);
+        return taskId;
+    }
+
+    /// @brief A task starts on the calling thread
+    /// @return Id to keep in Task::profileId (tasks run without being queued get one here)
+    static uint32_t recordStart(uint32_t taskId, uint32_t nameId)
+    {
+        if (!isEnabled())
+        {
+            return taskId;
+        }
+
+        if (taskId == 0)
+        {
+            taskId = nextId();
+        }
+        record(TaskEventType::Start, taskId, nameId);
+        return taskId;
+    }
+
+    /// @brief Record an event on the calling thread's buffer (even if recording is off)
+    static void record(TaskEventType type, uint32_t taskId, uint32_t nameId);
+
+    /// @brief Allocate an id correlating the events of one task or scope
+    [[nodiscard]] static uint32_t nextId() { return s_nextId.fetch_add(1, std::memory_order_relaxed); }
+
+    /// @brief Write every buffered event as Chrome trace event JSON
+    /// Start/End pairs become complete ("X") events on the starting thread, with flow
+    /// arrows from the submitting thread. Safe while tasks run; events overwritten during
+    /// the dump are skipped.
+    /// @return false if the file could not be written
+    static bool dumpChromeTrace(const std::string& path);
+
+    /// @brief Forget all buffered events (buffers stay allocated)
+    static void clear();
+
+    TaskProfiler() = delete;
+
+private:
+    inline static std::atomic<bool> s_enabled{false};
+    inline static std::atomic<uint32_t> s_nextId{1};
+};
+
+/// @brief RAII zone shown like a task in the trace (e.g. a frame phase on Main/Render)
+class ProfileScope
+{
+public:
+    explicit ProfileScope(uint32_t nameId)
+    {
+        if (TaskProfiler::isEnabled())
+        {
+            m_id = TaskProfiler::nextId();
+            m_nameId = nameId;
+            TaskProfiler::record(TaskEventType::Start, m_id, m_nameId);
+        }
+    }
+
+    ~ProfileScope()
+    {
+        // Close even if recording was switched off meanwhile, so the zone stays paired
+        if (m_id != 0)
+        {
+            TaskProfiler::record(TaskEventType::End, m_id, m_nameId);
+        }
+    }
+
+    VESPER_DISABLE_COPY_AND_MOVE(ProfileScope)
+
+private:
+    uint32_t m_id{0};
+    uint32_t m_nameId{0};
+};
+
+} // namespace vesper
@@ -3,8 +3,16 @@
 // Threading module main header - includes all threading components
 
 #include "runtime/core/threading/spsc_queue.h"
-#include "runtime/core/threading/mpsc_queue.h"
+#include "runtime/core/threading/mpmc_queue.h"
 #include "runtime/core/threading/wait_group.h"
+#include "runtime/core/threading/event_count.h"
+#include "runtime/core/threading/frame_pacer.h"
+#include "runtime/core/threading/fiber.h"
+#include "runtime/core/threading/inline_function.h"
 #include "runtime/core/threading/task.h"
+#include "runtime/core/threading/task_pool.h"
+#include "runtime/core/threading/task_profiler.h"
 #include "runtime/core/threading/work_stealing_deque.h"
 #include "runtime/core/threading/worker_pool.h"
+#include "runtime/core/threading/task_graph.h"
+#include "runtime/core/threading/coroutine.h"
@@ -8,9 +8,157 @@
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 namespace vesper {
 
+/// @brief Intrusive node of something suspended on a counter (e.g. a parked fiber)
+struct CounterWaiter
+{
+    CounterWaiter* next{nullptr};
+    void (*resume)(CounterWaiter* waiter){nullptr};  // Called once when the counter reaches zero
+};
+
+/// @brief Completion count plus the waiters suspended on it
+/// The count (low 32 bits) and the number of registered waiters (high 32 bits) share one atomic
+/// word, and the state is done only when the whole word is zero. A waiter counts itself in, which
+/// it may only do while the count is non-zero, before linking its node. The add() that takes the
+/// count to zero with waiters registered collects exactly that many nodes, clears their number
+/// with its last access to the state, and only then resumes them. So nothing touches the state
+/// after it becomes done: its owner may destroy it as soon as isDone() returns true, or as soon
+/// as one of its waiters is resumed.
+class CounterState
+{
+public:
+    CounterState() = default;
+    explicit CounterState(int32_t initialCount)
+        : m_state(static_cast<uint32_t>(initialCount))
+    {}
+
+    VESPER_DISABLE_COPY_AND_MOVE(CounterState)
+
+    /// @brief Add delta to the count, resuming the suspended waiters if it reaches zero
+    /// Raising the count again is only valid once the state is done (not while it hands over).
+    /// @return The new count
+    int32_t add(int32_t delta)
+    {
+        const uint64_t old = m_state.fetch_add(static_cast<uint64_t>(static_cast<int64_t>(delta)),
+                                               std::memory_order_acq_rel);
+        const int32_t oldCount = static_cast<int32_t>(static_cast<uint32_t>(old));
+        const uint32_t waiters = static_cast<uint32_t>(old >> kWaiterShift);
+        const int32_t newCount = oldCount + delta;
+        if (newCount < 0 || (oldCount == 0 && waiters != 0))
+        {
+            // Programming error - more completions than registered tasks, or re-armed while
+            // the last completion was still resuming its waiters
+            std::terminate();
+        }
+
+        if (newCount == 0 && waiters != 0)
+        {
+            resumeWaiters(waiters);
+        }
+        return newCount;
+    }
+
+    /// @brief Register a waiter; it is resumed immediately if the count is already zero
+    void addWaiter(CounterWaiter* waiter) const
+    {
+        uint64_t state = m_state.load(std::memory_order_acquire);
+        for (;;)
+        {
+            if (static_cast<uint32_t>(state) != 0)
+            {
+                if (m_state.compare_exchange_weak(state, state + kOneWaiter,
+                                                  std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    break;
+                }
+                continue;
+            }
+            if (state == 0)
+            {
+                waiter->resume(waiter);
+                return;
+            }
+
+            // Zero, but earlier waiters are still being handed over: resuming now would let
+            // this one destroy the state under the hand-over
+            std::this_thread::yield();
+            state = m_state.load(std::memory_order_acquire);
+        }
+
+        // Counted in: the count cannot finish handing over until this node is linked
+        CounterWaiter* head = m_head.load(std::memory_order_relaxed);
+        do
+        {
+            waiter->next = head;
+        } while (!m_head.compare_exchange_weak(head, waiter, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /// @brief Check if the count is zero and every waiter was handed over
+    [[nodiscard]] bool isDone() const
+    {
+        return m_state.load(std::memory_order_acquire) == 0;
+    }
+
+    /// @brief Get the current count
+    [[nodiscard]] int32_t count() const
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(m_state.load(std::memory_order_acquire)));
+    }
+
+    /// @brief Overwrite the count (only safe when no waiters)
+    void reset(int32_t count = 0)
+    {
+        m_state.store(static_cast<uint32_t>(count), std::memory_order_release);
+    }
+
+private:
+    static constexpr int kWaiterShift = 32;
+    static constexpr uint64_t kOneWaiter = uint64_t{1} << kWaiterShift;
+
+    /// @brief Collect the waiterCount registered nodes, release the state, then resume them
+    void resumeWaiters(uint32_t waiterCount)
+    {
+        CounterWaiter* waiters = nullptr;
+        uint32_t taken = 0;
+        while (taken < waiterCount)
+        {
+            CounterWaiter* node = m_head.exchange(nullptr, std::memory_order_acquire);
+            if (!node)
+            {
+                // A waiter is between counting itself in and linking its node
+                std::this_thread::yield();
+                continue;
+            }
+            while (node)
+            {
+                CounterWaiter* next = node->next;
+                node->next = waiters;
+                waiters = node;
+                node = next;
+                ++taken;
+            }
+        }
+
+        // Last access to the state: from here its owner may destroy it
+        m_state.fetch_sub(static_cast<uint64_t>(waiterCount) << kWaiterShift, std::memory_order_release);
+
+        while (waiters)
+        {
+            // A resumed waiter may run (and reuse its node) right away
+            CounterWaiter* next = waiters->next;
+            waiters->resume(waiters);
+            waiters = next;
+        }
+    }
+
+private:
+    mutable std::atomic<uint64_t> m_state{0};
+    mutable std::atomic<CounterWaiter*> m_head{nullptr};
+};
+
 /// @brief A synchronization primitive for waiting on a group of tasks to complete
 /// Similar to Go's sync.WaitGroup
 class WaitGroup
@@ -23,18 +171,17 @@ public:
 
     // Allow move for returning from functions
     WaitGroup(WaitGroup&& other) noexcept
-        : m_counter(other.m_counter.load(std::memory_order_relaxed))
+        : m_state(other.m_state.count())
     {
-        other.m_counter.store(0, std::memory_order_relaxed);
+        other.m_state.reset();
     }
 
     WaitGroup& operator=(WaitGroup&& other) noexcept
     {
         if (this != &other)
         {
-            m_counter.store(other.m_counter.load(std::memory_order_relaxed),
-                          std::memory_order_relaxed);
-            other.m_counter.store(0, std::memory_order_relaxed);
+            m_state.reset(other.m_state.count());
+            other.m_state.reset();
         }
         return *this;
     }
@@ -43,15 +190,7 @@ public:
     /// @param delta Amount to add (default 1)
     void add(int32_t delta = 1)
     {
-        const int32_t newValue = m_counter.fetch_add(delta, std::memory_order_acq_rel) + delta;
-
-        if (newValue < 0)
-        {
-            // This is a programming error - counter went negative
-            std::terminate();
-        }
-
-        if (newValue == 0)
+        if (m_state.add(delta) == 0)
         {
             // Wake all waiters
             std::lock_guard<std::mutex> lock(m_mutex);
@@ -59,6 +198,12 @@ public:
         }
     }
 
+    /// @brief Suspend-style wait: resume the waiter once the counter reaches zero
+    void addSuspendedWaiter(CounterWaiter* waiter) const
+    {
+        m_state.addWaiter(waiter);
+    }
+
     /// @brief Decrement the counter by 1 (called when a task completes)
     void done()
     {
@@ -70,34 +215,84 @@ public:
     {
         std::unique_lock<std::mutex> lock(m_mutex);
         m_cv.wait(lock, [this]() {
-            return m_counter.load(std::memory_order_acquire) == 0;
+            return m_state.isDone();
         });
     }
 
     /// @brief Non-blocking check if all tasks are done
     [[nodiscard]] bool isDone() const
     {
-        return m_counter.load(std::memory_order_acquire) == 0;
+        return m_state.isDone();
     }
 
     /// @brief Get current counter value
     [[nodiscard]] int32_t count() const
     {
-        return m_counter.load(std::memory_order_acquire);
+        return m_state.count();
     }
 
     /// @brief Reset the counter (only safe when no waiters)
     void reset()
     {
-        m_counter.store(0, std::memory_order_release);
+        m_state.reset();
     }
 
 private:
-    std::atomic<int32_t> m_counter{0};
+    CounterState m_state;  // Count, parked fibers and coroutines
     std::mutex m_mutex;
     std::condition_variable m_cv;
 };
 
+/// @brief Lightweight completion counter meant to live on the waiting thread's stack
+/// Unlike WaitGroup it has no mutex/condvar and is never heap-allocated, so it can only
+/// be waited on by polling (WorkerPool::waitFor with help-run) or by parking a fiber.
+/// The completion that makes it done is its last access (CounterState), so the owner may
+/// destroy it as soon as a wait returns.
+class TaskCounter
+{
+public:
+    TaskCounter() = default;
+    explicit TaskCounter(int32_t initialCount)
+        : m_state(initialCount)
+    {}
+    ~TaskCounter() = default;
+
+    VESPER_DISABLE_COPY_AND_MOVE(TaskCounter)
+
+    /// @brief Add delta to the counter
+    void add(int32_t delta = 1)
+    {
+        m_state.add(delta);
+    }
+
+    /// @brief Suspend-style wait: resume the waiter once the counter reaches zero
+    void addSuspendedWaiter(CounterWaiter* waiter) const
+    {
+        m_state.addWaiter(waiter);
+    }
+
+    /// @brief Decrement the counter by 1 (called when a task completes)
+    void done()
+    {
+        add(-1);
+    }
+
+    /// @brief Non-blocking check if all tasks are done
+    [[nodiscard]] bool isDone() const
+    {
+        return m_state.isDone();
+    }
+
+    /// @brief Get current counter value
+    [[nodiscard]] int32_t count() const
+    {
+        return m_state.count();
+    }
+
+private:
+    CounterState m_state;  // Count, parked fibers and coroutines
+};
+
 /// @brief Shared pointer wrapper for WaitGroup to allow multiple owners
 using WaitGroupPtr = std::shared_ptr<WaitGroup>;
 
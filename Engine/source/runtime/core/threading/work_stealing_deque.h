@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <type_traits>
 #include <vector>
 
 namespace vesper {
@@ -14,10 +15,14 @@ namespace vesper {
 /// @brief Lock-free work-stealing deque
 /// Owner thread pushes/pops from bottom, thieves steal from top
 /// Based on "Dynamic Circular Work-Stealing Deque" by Chase and Lev
-/// @tparam T Element type
+/// @tparam T Element type - must be trivially copyable (e.g. Task*), since a thief reads
+///           the slot before its CAS and a losing read must not disturb the owner's copy
 template<typename T>
 class WorkStealingDeque
 {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "WorkStealingDeque elements must be trivially copyable; store pointers to records");
+
 public:
     static constexpr size_t kInitialCapacity = 1024;
 
@@ -27,7 +32,10 @@ public:
         , m_bottom(0)
     {}
 
-    ~WorkStealingDeque() = default;
+    ~WorkStealingDeque()
+    {
+        delete m_buffer.load(std::memory_order_relaxed);
+    }
 
     VESPER_DISABLE_COPY_AND_MOVE(WorkStealingDeque)
 
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <utility>
 
 // Platform-specific includes for thread naming/affinity
 #ifdef _WIN32
@@ -17,8 +18,39 @@
 #endif
 #endif
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
 namespace vesper {
 
+namespace {
+
+/// @brief Hint to the CPU that we are in a spin-wait loop
+inline void cpuPause()
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/// @brief Move a task out of its deque record and recycle the record
+inline std::optional<Task> takeRecord(std::optional<Task*> record)
+{
+    if (!record)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<Task> task(std::move(**record));
+    TaskPool::release(*record);
+    return task;
+}
+
+} // namespace
+
 // ============================================================================
 // Platform-specific thread utilities
 // ============================================================================
@@ -58,6 +90,26 @@ void WorkerPool::setThreadAffinity(uint64_t mask)
     // macOS doesn't support thread affinity in the same way
 }
 
+void WorkerPool::setThreadAffinityToCpu(uint32_t cpu)
+{
+#ifdef _WIN32
+    if (cpu < 64)
+    {
+        SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1ULL << cpu));
+    }
+#elif defined(__linux__)
+    if (cpu < CPU_SETSIZE)
+    {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(cpu, &cpuset);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+    }
+#else
+    (void)cpu;
+#endif
+}
+
 void WorkerPool::setThreadPriority(int32_t priority)
 {
     if (priority == 0) return;  // 0 means normal priority
@@ -92,6 +144,11 @@ void WorkerPool::setThreadPriority(int32_t priority)
 }
 
 thread_local std::mt19937 WorkerPool::t_rng{std::random_device{}()};
+thread_local WorkerPool* WorkerPool::t_localQueuePool = nullptr;
+thread_local uint32_t WorkerPool::t_localQueueIndex = UINT32_MAX;
+thread_local FiberContext* WorkerPool::t_schedulerContext = nullptr;
+thread_local WorkerPool::JobFiber* WorkerPool::t_currentFiber = nullptr;
+thread_local WorkerPool::FiberSwitch WorkerPool::t_fiberSwitch{};
 
 WorkerPool::WorkerPool() = default;
 
@@ -142,11 +199,23 @@ bool WorkerPool::initialize(const WorkerPoolConfig& config)
 
     LOG_INFO("WorkerPool: Initializing with {} worker threads", numWorkers);
 
-    // Create local queues for each worker
-    m_localQueues.reserve(numWorkers);
-    for (uint32_t i = 0; i < numWorkers; ++i)
+    // Create local queues for each worker, plus the external ones lent to Main/Render threads
+    m_localQueues.reserve(numWorkers + kExternalQueueCount);
+    for (uint32_t i = 0; i < numWorkers + kExternalQueueCount; ++i)
+    {
+        m_localQueues.push_back(std::make_unique<WorkStealingDeque<Task*>>());
+    }
+    for (auto& claimed : m_externalQueueClaimed)
+    {
+        claimed.store(false, std::memory_order_relaxed);
+    }
+
+    assignWorkerPlacements(numWorkers);
+    buildStealOrders();
+
+    if (config.enableFibers)
     {
-        m_localQueues.push_back(std::make_unique<WorkStealingDeque<Task>>());
+        createFibers();
     }
 
     m_running.store(true, std::memory_order_release);
@@ -182,7 +251,7 @@ void WorkerPool::shutdown()
     m_renderQueue.shutdown();
 
     // Wake all workers
-    m_cv.notify_all();
+    notifyWorkers();
 
     // Wait for all workers to finish
     for (auto& worker : m_workers)
@@ -195,6 +264,24 @@ void WorkerPool::shutdown()
 
     m_workers.clear();
     m_localQueues.clear();
+    m_placements.clear();
+    m_stealOrders.clear();
+
+    if (m_fibersEnabled)
+    {
+        // Fibers still parked on counters that never completed cannot be unwound
+        if (m_freeFibers.size() != m_fibers.size())
+        {
+            LOG_WARN("WorkerPool: {} fibers were still suspended at shutdown",
+                     m_fibers.size() - m_freeFibers.size());
+        }
+
+        JobFiber* fiber = nullptr;
+        while (m_freeFibers.tryDequeue(fiber)) {}
+        while (m_readyFibers.tryDequeue(fiber)) {}
+        m_fibers.clear();
+        m_fibersEnabled = false;
+    }
 
     // Drain remaining priority queues (AnyThread tasks)
     Task task;
@@ -203,10 +290,7 @@ void WorkerPool::shutdown()
         while (m_priorityQueues[i].tryDequeue(task))
         {
             LOG_WARN("WorkerPool: Dropping unprocessed AnyThread task (priority {})", i);
-            if (task.waitGroup)
-            {
-                task.waitGroup->done();
-            }
+            task.signalDone();
             m_pendingTasks.fetch_sub(1, std::memory_order_release);
         }
     }
@@ -215,18 +299,12 @@ void WorkerPool::shutdown()
     while (m_logicQueue.tryDequeue(task))
     {
         LOG_WARN("WorkerPool: Dropping unprocessed LogicOnly task");
-        if (task.waitGroup)
-        {
-            task.waitGroup->done();
-        }
+        task.signalDone();
     }
     while (m_renderQueue.tryDequeue(task))
     {
         LOG_WARN("WorkerPool: Dropping unprocessed RenderOnly task");
-        if (task.waitGroup)
-        {
-            task.waitGroup->done();
-        }
+        task.signalDone();
     }
 
     LOG_INFO("WorkerPool: Shutdown complete. Tasks completed: {}",
@@ -236,8 +314,10 @@ void WorkerPool::shutdown()
 template<typename Queue>
 bool WorkerPool::enqueueWithPolicy(Queue& queue, Task& task, bool updatePendingCount)
 {
-    // Fast path: try to enqueue immediately
-    if (queue.tryEnqueue(task))
+    task.profileId = TaskProfiler::recordSubmit(task.debugNameId);
+
+    // Fast path: try to enqueue immediately (task is only moved from on success)
+    if (queue.tryEnqueue(std::move(task)))
     {
         if (updatePendingCount)
         {
@@ -329,7 +409,7 @@ bool WorkerPool::enqueueWithPolicy(Queue& queue, Task& task, bool updatePendingC
 
             while (!enqueued)
             {
-                if (queue.tryEnqueue(task))
+                if (queue.tryEnqueue(std::move(task)))
                 {
                     enqueued = true;
                     break;
@@ -433,39 +513,199 @@ WaitGroupPtr WorkerPool::submit(Task task)
         return wg;
     }
 
-    // Route based on affinity
-    bool success = false;
+    const bool anyThread = task.affinity == TaskAffinity::AnyThread;
+    if (!routeTask(task))
+    {
+        // Task was dropped (Drop policy)
+        task.signalDone();
+        return wg;
+    }
+
+    // ExecuteInline only applies on overflow; queued tasks still need a worker
+    if (anyThread)
+    {
+        wakeWorker();
+    }
+
+    m_stats.tasksSubmitted.fetch_add(1, std::memory_order_relaxed);
+    return wg;
+}
+
+bool WorkerPool::submit(Task task, TaskCounter& counter)
+{
+    if (!m_running.load(std::memory_order_acquire))
+    {
+        LOG_WARN("WorkerPool: Cannot submit task - pool is not running");
+        return false;
+    }
+
+    counter.add(1);
+    task.counter = &counter;
+
+    m_stats.tasksSubmitted.fetch_add(1, std::memory_order_relaxed);
+
+    if (m_syncMode)
+    {
+        m_stats.tasksExecutedInline.fetch_add(1, std::memory_order_relaxed);
+        task.execute();
+        m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    const bool anyThread = task.affinity == TaskAffinity::AnyThread;
+    if (!routeTask(task))
+    {
+        task.signalDone();
+        return false;
+    }
+
+    // ExecuteInline only applies on overflow; queued tasks still need a worker
+    if (anyThread)
+    {
+        wakeWorker();
+    }
+    return true;
+}
+
+bool WorkerPool::submitContinuation(Task task, TaskCounter& counter)
+{
+    if (task.affinity != TaskAffinity::AnyThread || m_syncMode || t_localQueuePool != this ||
+        !m_running.load(std::memory_order_acquire))
+    {
+        return submit(std::move(task), counter);
+    }
+
+    counter.add(1);
+
+    Task* record = TaskPool::acquire();
+    *record = std::move(task);
+    record->counter = &counter;
+    record->profileId = TaskProfiler::recordSubmit(record->debugNameId);
+    m_localQueues[t_localQueueIndex]->push(record);
+
+    m_pendingTasks.fetch_add(1, std::memory_order_release);
+    m_stats.tasksSubmitted.fetch_add(1, std::memory_order_relaxed);
+    wakeWorker();
+    return true;
+}
+
+bool WorkerPool::postCoroutine(std::coroutine_handle<> handle, TaskAffinity affinity, TaskPriority priority)
+{
+    if (!m_running.load(std::memory_order_acquire))
+    {
+        LOG_WARN("WorkerPool: Cannot schedule coroutine - pool is not running, resuming inline");
+        return false;
+    }
+
+    // Sync mode: there is no other thread to hop to
+    if (m_syncMode)
+    {
+        return false;
+    }
+
+    static const TaskNameId kResumeTaskName = internTaskName("Coroutine.Resume");
+
+    Task task([handle]() { handle.resume(); }, affinity, priority, nullptr, kResumeTaskName);
+    if (!routeTask(task))
+    {
+        // Dropped: keep the coroutine alive by continuing on this thread
+        return false;
+    }
+
+    if (affinity == TaskAffinity::AnyThread)
+    {
+        wakeWorker();
+    }
+
+    m_stats.tasksSubmitted.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool WorkerPool::isOnAffinityThread(TaskAffinity affinity)
+{
+    switch (affinity)
+    {
+        case TaskAffinity::AnyThread:
+            return ThreadContext::isWorkerThread();
+
+        case TaskAffinity::RenderOnly:
+            return ThreadContext::isRenderThread();
+
+        case TaskAffinity::LogicOnly:
+            return ThreadContext::isMainThread();
+    }
+
+    return false;
+}
+
+bool WorkerPool::routeTask(Task& task)
+{
     switch (task.affinity)
     {
         case TaskAffinity::AnyThread:
-        {
-            size_t queueIndex = priorityToIndex(task.priority);
-            success = enqueueWithPolicy(m_priorityQueues[queueIndex], task, true);
-            if (success && m_config.overflowPolicy != QueueOverflowPolicy::ExecuteInline)
+            return enqueueWithPolicy(m_priorityQueues[priorityToIndex(task.priority)], task, true);
+
+        case TaskAffinity::RenderOnly:
+            if (!enqueueWithPolicy(m_renderQueue, task, false))
+            {
+                return false;
+            }
+            notifyWakeEvent(m_renderWakeEvent);
+            return true;
+
+        case TaskAffinity::LogicOnly:
+            if (!enqueueWithPolicy(m_logicQueue, task, false))
             {
-                m_cv.notify_one();
+                return false;
             }
-            break;
-        }
+            notifyWakeEvent(m_logicWakeEvent);
+            return true;
+    }
+
+    return false;
+}
+
+void WorkerPool::notifyWakeEvent(const std::atomic<EventCount*>& event)
+{
+    if (EventCount* wakeEvent = event.load(std::memory_order_acquire))
+    {
+        wakeEvent->notifyAll();
+    }
+}
+
+bool WorkerPool::hasPendingTasks(TaskAffinity affinity) const
+{
+    switch (affinity)
+    {
+        case TaskAffinity::AnyThread:
+            return m_pendingTasks.load(std::memory_order_acquire) > 0;
 
         case TaskAffinity::RenderOnly:
-            success = enqueueWithPolicy(m_renderQueue, task, false);
-            break;
+            return !m_renderQueue.isEmpty();
 
         case TaskAffinity::LogicOnly:
-            success = enqueueWithPolicy(m_logicQueue, task, false);
-            break;
+            return !m_logicQueue.isEmpty();
     }
 
-    if (!success)
+    return false;
+}
+
+void WorkerPool::setAffinityWakeEvent(TaskAffinity affinity, EventCount* event)
+{
+    switch (affinity)
     {
-        // Task was dropped (Drop policy)
-        wg->done();
-        return wg;
-    }
+        case TaskAffinity::RenderOnly:
+            m_renderWakeEvent.store(event, std::memory_order_release);
+            break;
 
-    m_stats.tasksSubmitted.fetch_add(1, std::memory_order_relaxed);
-    return wg;
+        case TaskAffinity::LogicOnly:
+            m_logicWakeEvent.store(event, std::memory_order_release);
+            break;
+
+        case TaskAffinity::AnyThread:
+            LOG_WARN("WorkerPool: AnyThread tasks already wake workers, ignoring wake event");
+            break;
+    }
 }
 
 WaitGroupPtr WorkerPool::submit(TaskFunction fn, TaskAffinity affinity, TaskPriority priority)
@@ -476,8 +716,8 @@ WaitGroupPtr WorkerPool::submit(TaskFunction fn, TaskAffinity affinity, TaskPrio
 WaitGroupPtr WorkerPool::submit(const LightTask& lightTask)
 {
     // Convert to regular task and submit
-    // Note: This does allocate due to std::function, but keeps the API simple
-    // For truly zero-allocation, use submitLightBatch with pre-allocated structures
+    // The closure is stored inline; only the returned WaitGroup allocates
+    // For zero-allocation submission use the TaskCounter overloads
     return submit(lightTask.toTask());
 }
 
@@ -521,52 +761,77 @@ WaitGroupPtr WorkerPool::submitLightBatch(LightTaskFunc* functions,
             continue;
         }
 
-        // Create task with captured function pointer and userData
-        // This is a small lambda that just calls the function pointer
-        LightTaskFunc fn = functions[i];
-        void* data = userData ? userData[i] : nullptr;
-
-        Task task;
-        task.function = [fn, data]() { fn(data); };
-        task.affinity = affinity;
-        task.priority = priority;
+        Task task = LightTask(functions[i], userData ? userData[i] : nullptr, affinity, priority).toTask();
         task.waitGroup = wg;
 
-        bool success = false;
-        switch (affinity)
+        if (!routeTask(task))
         {
-            case TaskAffinity::AnyThread:
-            {
-                size_t queueIndex = priorityToIndex(priority);
-                success = enqueueWithPolicy(m_priorityQueues[queueIndex], task, true);
-                break;
-            }
+            task.signalDone();
+            continue;
+        }
+
+        anyEnqueued = true;
+        m_stats.tasksSubmitted.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (anyEnqueued)
+    {
+        notifyWorkers();
+    }
+
+    return wg;
+}
+
+void WorkerPool::submitLightBatch(TaskCounter& counter,
+                                  LightTaskFunc* functions,
+                                  void** userData,
+                                  size_t count,
+                                  TaskAffinity affinity,
+                                  TaskPriority priority)
+{
+    if (count == 0 || functions == nullptr)
+    {
+        return;
+    }
+
+    bool anyEnqueued = false;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!functions[i])
+        {
+            continue;
+        }
 
-            case TaskAffinity::RenderOnly:
-                success = enqueueWithPolicy(m_renderQueue, task, false);
-                break;
+        void* data = userData ? userData[i] : nullptr;
+        m_stats.tasksSubmitted.fetch_add(1, std::memory_order_relaxed);
 
-            case TaskAffinity::LogicOnly:
-                success = enqueueWithPolicy(m_logicQueue, task, false);
-                break;
+        // Sync mode: execute immediately, the counter never goes up
+        if (m_syncMode)
+        {
+            m_stats.tasksExecutedInline.fetch_add(1, std::memory_order_relaxed);
+            functions[i](data);
+            m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
+            continue;
         }
 
-        if (!success)
+        Task task = LightTask(functions[i], data, affinity, priority).toTask();
+        task.counter = &counter;
+        counter.add(1);
+
+        if (!routeTask(task))
         {
-            wg->done();
+            task.signalDone();
             continue;
         }
 
         anyEnqueued = true;
-        m_stats.tasksSubmitted.fetch_add(1, std::memory_order_relaxed);
     }
 
     if (anyEnqueued)
     {
-        m_cv.notify_all();
+        notifyWorkers();
     }
-
-    return wg;
 }
 
 WaitGroupPtr WorkerPool::submitBatch(std::vector<Task>& tasks)
@@ -598,29 +863,10 @@ WaitGroupPtr WorkerPool::submitBatch(std::vector<Task>& tasks)
     {
         task.waitGroup = wg;
 
-        bool success = false;
-        switch (task.affinity)
-        {
-            case TaskAffinity::AnyThread:
-            {
-                size_t queueIndex = priorityToIndex(task.priority);
-                success = enqueueWithPolicy(m_priorityQueues[queueIndex], task, true);
-                break;
-            }
-
-            case TaskAffinity::RenderOnly:
-                success = enqueueWithPolicy(m_renderQueue, task, false);
-                break;
-
-            case TaskAffinity::LogicOnly:
-                success = enqueueWithPolicy(m_logicQueue, task, false);
-                break;
-        }
-
-        if (!success)
+        if (!routeTask(task))
         {
             // Task was dropped (Drop policy)
-            wg->done();
+            task.signalDone();
             continue;
         }
 
@@ -630,7 +876,7 @@ WaitGroupPtr WorkerPool::submitBatch(std::vector<Task>& tasks)
 
     if (anyEnqueued)
     {
-        m_cv.notify_all();
+        notifyWorkers();
     }
 
     return wg;
@@ -645,28 +891,25 @@ bool WorkerPool::helpRunOne()
 
     // Try priority queues from highest to lowest
     Task task;
-    for (int i = static_cast<int>(kPriorityLevels) - 1; i >= 0; --i)
+    if (tryDequeueGlobal(task))
     {
-        if (m_priorityQueues[i].tryDequeue(task))
-        {
-            task.execute();
-            m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
-            m_stats.helpRunCount.fetch_add(1, std::memory_order_relaxed);
-            m_pendingTasks.fetch_sub(1, std::memory_order_release);
-            return true;
-        }
+        m_pendingTasks.fetch_sub(1, std::memory_order_release);
+        task.execute();
+        m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
+        m_stats.helpRunCount.fetch_add(1, std::memory_order_relaxed);
+        return true;
     }
 
     // Try stealing from workers
     for (auto& queue : m_localQueues)
     {
-        if (auto stolen = queue->steal())
+        if (auto stolen = takeRecord(queue->steal()))
         {
+            m_pendingTasks.fetch_sub(1, std::memory_order_release);
             stolen->execute();
             m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
             m_stats.helpRunCount.fetch_add(1, std::memory_order_relaxed);
             m_stats.tasksStolen.fetch_add(1, std::memory_order_relaxed);
-            m_pendingTasks.fetch_sub(1, std::memory_order_release);
             return true;
         }
     }
@@ -731,6 +974,18 @@ void WorkerPool::waitFor(WaitGroupPtr wg, bool allowHelpRun)
         return;
     }
 
+    // Inside a fiber: suspend instead of help-running on top of the current stack
+    if (isInFiber())
+    {
+        while (!wg->isDone())
+        {
+            parkCurrentFiber(wg.get(), [](const void* target, CounterWaiter* waiter) {
+                static_cast<const WaitGroup*>(target)->addSuspendedWaiter(waiter);
+            });
+        }
+        return;
+    }
+
     if (allowHelpRun && m_config.enableHelpRun)
     {
         // Smart help-run based on current thread type
@@ -804,50 +1059,335 @@ void WorkerPool::waitFor(WaitGroupPtr wg, bool allowHelpRun)
     }
 }
 
-void WorkerPool::workerLoop(uint32_t workerId)
+void WorkerPool::waitFor(const TaskCounter& counter)
 {
-    // Register this thread as a worker thread
-    ScopedThreadRegistration threadReg(ThreadType::Worker);
-
-    // Apply thread configuration
+    if (counter.isDone())
+    {
+        return;
+    }
+
+    // Inside a fiber: run our own splits first (most likely on the critical path), then
+    // suspend. Re-read the deque every time since the fiber may have moved to another worker
+    if (isInFiber())
+    {
+        while (!counter.isDone())
+        {
+            if (auto task = popCurrentWorkerTask())
+            {
+                m_pendingTasks.fetch_sub(1, std::memory_order_release);
+                task->execute();
+                m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+
+            parkCurrentFiber(&counter, [](const void* target, CounterWaiter* waiter) {
+                static_cast<const TaskCounter*>(target)->addSuspendedWaiter(waiter);
+            });
+        }
+        return;
+    }
+
+    LocalQueueScope localQueue(*this);
+    const ThreadType threadType = ThreadContext::currentThreadType();
+
+    uint32_t spinCount = 0;
+    constexpr uint32_t kSpinBeforeYield = 64;
+
+    while (!counter.isDone())
+    {
+        bool didWork = false;
+
+        // Our own splits first: they are the most likely to be on the critical path
+        if (localQueue.queue())
+        {
+            if (auto task = takeRecord(localQueue.queue()->pop()))
+            {
+                m_pendingTasks.fetch_sub(1, std::memory_order_release);
+                task->execute();
+                m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
+                didWork = true;
+            }
+        }
+
+        if (!didWork)
+        {
+            didWork = helpRunOne();
+        }
+
+        if (!didWork && threadType == ThreadType::Main)
+        {
+            didWork = processLogicTask();
+        }
+
+        if (!didWork && threadType == ThreadType::Render)
+        {
+            didWork = processRenderTask();
+        }
+
+        if (didWork)
+        {
+            spinCount = 0;
+        }
+        else if (++spinCount < kSpinBeforeYield)
+        {
+            cpuPause();
+        }
+        else
+        {
+            // Remaining work is running on other threads, nothing to steal
+            std::this_thread::yield();
+        }
+    }
+}
+
+// ============================================================================
+// Parallel range execution
+// ============================================================================
+
+WorkerPool::LocalQueueScope::LocalQueueScope(WorkerPool& pool)
+    : m_pool(pool)
+{
+    // Workers (and threads that already claimed a deque further up the stack) reuse theirs
+    if (t_localQueuePool == &pool)
+    {
+        m_queue = pool.m_localQueues[t_localQueueIndex].get();
+        return;
+    }
+
+    // Thread already owns a deque of another pool; run without one
+    if (t_localQueuePool != nullptr || pool.m_localQueues.empty())
+    {
+        return;
+    }
+
+    const size_t firstExternal = pool.m_localQueues.size() - kExternalQueueCount;
+    for (size_t slot = 0; slot < kExternalQueueCount; ++slot)
+    {
+        bool expected = false;
+        if (pool.m_externalQueueClaimed[slot].compare_exchange_strong(expected, true,
+            std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            m_claimedSlot = static_cast<int32_t>(slot);
+            t_localQueuePool = &pool;
+            t_localQueueIndex = static_cast<uint32_t>(firstExternal + slot);
+            m_queue = pool.m_localQueues[t_localQueueIndex].get();
+            return;
+        }
+    }
+}
+
+WorkerPool::LocalQueueScope::~LocalQueueScope()
+{
+    if (m_claimedSlot >= 0)
+    {
+        t_localQueuePool = nullptr;
+        t_localQueueIndex = UINT32_MAX;
+        m_pool.m_externalQueueClaimed[static_cast<size_t>(m_claimedSlot)].store(false, std::memory_order_release);
+    }
+}
+
+size_t WorkerPool::autoGrainSize(size_t count) const
+{
+    // Aim for ~8 chunks per participating thread so stealing can balance uneven work
+    const size_t threads = m_workers.size() + 1;
+    return std::max<size_t>(1, count / (threads * 8));
+}
+
+void WorkerPool::runParallelRange(ParallelRangeJob& job, size_t begin, size_t end)
+{
+    const size_t count = end - begin;
+    if (job.grainSize == 0)
+    {
+        job.grainSize = autoGrainSize(count);
+    }
+
+    // Nothing to split across: run inline
+    if (m_syncMode || m_workers.empty() || count <= job.grainSize ||
+        !m_running.load(std::memory_order_acquire))
+    {
+        job.function(job.context, begin, end);
+        return;
+    }
+
+    LocalQueueScope localQueue(*this);
+    if (!localQueue.queue())
+    {
+        // All external deques are in use by other threads
+        job.function(job.context, begin, end);
+        return;
+    }
+
+    // The calling thread processes the root range itself and splits as thieves show up
+    job.pending.add(1);
+    executeRange(job, begin, end);
+
+    // Help with (or wait for) the splits that were stolen
+    waitFor(job.pending);
+}
+
+void WorkerPool::executeRange(ParallelRangeJob& job, size_t begin, size_t end)
+{
+    LocalQueueScope localQueue(*this);
+    WorkStealingDeque<Task*>* queue = localQueue.queue();
+    const size_t grain = job.grainSize;
+
+    while (end - begin > grain)
+    {
+        if (queue && queue->isEmpty())
+        {
+            // Lazy binary splitting: our previous split was taken (or there was none),
+            // so there is demand - give away the upper half
+            const size_t mid = begin + (end - begin) / 2;
+            pushRangeTask(*queue, job, mid, end);
+            end = mid;
+            continue;
+        }
+
+        // Nobody has stolen our last split yet; do one grain of work and re-check
+        job.function(job.context, begin, begin + grain);
+        begin += grain;
+
+        // The body may have parked this fiber and resumed it on another worker
+        if (m_fibersEnabled)
+        {
+            queue = currentLocalQueue();
+        }
+    }
+
+    job.function(job.context, begin, end);
+
+    // Last access to job: the owner may return (and destroy it) right after this
+    job.pending.done();
+}
+
+void WorkerPool::pushRangeTask(WorkStealingDeque<Task*>& queue, ParallelRangeJob& job, size_t begin, size_t end)
+{
+    job.pending.add(1);
+
+    static const TaskNameId kRangeTaskName = internTaskName("WorkerPool.ParallelRange");
+
+    // executeRange signals job.pending itself, so the record carries no counter
+    Task* record = TaskPool::acquire();
+    record->function = [this, &job, begin, end]() { executeRange(job, begin, end); };
+    record->debugNameId = kRangeTaskName;
+    record->profileId = TaskProfiler::recordSubmit(kRangeTaskName);
+    queue.push(record);
+
+    m_pendingTasks.fetch_add(1, std::memory_order_release);
+    m_stats.tasksSubmitted.fetch_add(1, std::memory_order_relaxed);
+    m_stats.rangeSplits.fetch_add(1, std::memory_order_relaxed);
+    wakeWorker();
+}
+
+void WorkerPool::workerLoop(uint32_t workerId)
+{
+    // Register this thread as a worker thread
+    ScopedThreadRegistration threadReg(ThreadType::Worker);
+
+    // Apply thread configuration
     std::string threadName = m_config.threadConfig.namePrefix + "-" + std::to_string(workerId);
     setThreadName(threadName);
-    setThreadAffinity(m_config.threadConfig.affinityMask);
+    TaskProfiler::setThreadName(threadName);
+    if (m_placements[workerId].cpu != WorkerPlacement::kUnpinned)
+    {
+        setThreadAffinityToCpu(m_placements[workerId].cpu);
+    }
+    else
+    {
+        setThreadAffinity(m_config.threadConfig.affinityMask);
+    }
     setThreadPriority(m_config.threadConfig.priority);
 
     LOG_DEBUG("WorkerPool: Worker {} started (name: {})", workerId, threadName);
 
     auto& localQueue = *m_localQueues[workerId];
+    t_localQueuePool = this;
+    t_localQueueIndex = workerId;
+
+    // Fiber mode: this stack becomes the scheduler context fibers switch back to
+    FiberContext schedulerContext;
+    if (m_fibersEnabled)
+    {
+        schedulerContext.bindToThread();
+        t_schedulerContext = &schedulerContext;
+    }
+
+    uint32_t idleSpins = 0;
+    constexpr uint32_t kIdleSpinsBeforePark = 64;
 
     while (m_running.load(std::memory_order_acquire))
     {
+        // Resumed continuations first: their counters are done and they may unblock more work
+        JobFiber* readyFiber = nullptr;
+        if (m_fibersEnabled && m_readyFibers.tryDequeue(readyFiber))
+        {
+            idleSpins = 0;
+            m_pendingTasks.fetch_sub(1, std::memory_order_release);
+            resumeFiber(*readyFiber);
+            continue;
+        }
+
         // Try to get a task
         auto task = tryGetTask(workerId);
 
         if (task)
         {
-            task->execute();
-            m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
+            idleSpins = 0;
             m_pendingTasks.fetch_sub(1, std::memory_order_release);
+            runTask(*task);
+            continue;
         }
-        else
+
+        // Spin briefly: bursts of submissions usually arrive within a few microseconds
+        if (++idleSpins < kIdleSpinsBeforePark)
         {
-            // No task found, wait for notification
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_cv.wait_for(lock, std::chrono::milliseconds(1), [this]() {
-                return !m_running.load(std::memory_order_acquire) ||
-                       m_pendingTasks.load(std::memory_order_acquire) > 0;
-            });
+            cpuPause();
+            continue;
+        }
+        idleSpins = 0;
+
+        // Park until a submitter signals new work. Re-check after registering so a
+        // submission racing with us is either seen here or wakes us
+        const EventCount::Key key = m_workAvailable.prepareWait();
+        if (!m_running.load(std::memory_order_acquire) ||
+            m_pendingTasks.load(std::memory_order_acquire) > 0)
+        {
+            m_workAvailable.cancelWait();
+            continue;
         }
+
+        m_stats.workerParks.fetch_add(1, std::memory_order_relaxed);
+        m_workAvailable.wait(key);
     }
 
-    // Drain remaining tasks in local queue before exiting
-    while (auto task = localQueue.pop())
+    // Drain remaining tasks in local queue (and resumable fibers) before exiting
+    for (;;)
     {
-        task->execute();
-        m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
+        JobFiber* readyFiber = nullptr;
+        if (m_fibersEnabled && m_readyFibers.tryDequeue(readyFiber))
+        {
+            m_pendingTasks.fetch_sub(1, std::memory_order_release);
+            resumeFiber(*readyFiber);
+            continue;
+        }
+
+        auto task = takeRecord(localQueue.pop());
+        if (!task)
+        {
+            break;
+        }
         m_pendingTasks.fetch_sub(1, std::memory_order_release);
+        runTask(*task);
     }
+
+    if (m_fibersEnabled)
+    {
+        t_schedulerContext = nullptr;
+        schedulerContext.unbindFromThread();
+    }
+
+    t_localQueuePool = nullptr;
+    t_localQueueIndex = UINT32_MAX;
 }
 
 std::optional<Task> WorkerPool::tryGetTask(uint32_t workerId)
@@ -855,58 +1395,366 @@ std::optional<Task> WorkerPool::tryGetTask(uint32_t workerId)
     auto& localQueue = *m_localQueues[workerId];
 
     // 1. Try local queue first (LIFO for cache locality)
-    if (auto task = localQueue.pop())
+    if (auto task = takeRecord(localQueue.pop()))
     {
         return task;
     }
 
     // 2. Try priority queues from highest to lowest
     Task globalTask;
-    for (int i = static_cast<int>(kPriorityLevels) - 1; i >= 0; --i)
+    if (tryDequeueGlobal(globalTask))
     {
-        if (m_priorityQueues[i].tryDequeue(globalTask))
-        {
-            return globalTask;
-        }
+        return globalTask;
     }
 
     // 3. Try stealing from other workers
     return trySteal(workerId);
 }
 
+bool WorkerPool::tryDequeueGlobal(Task& task)
+{
+    for (int i = static_cast<int>(kPriorityLevels) - 1; i >= 0; --i)
+    {
+        if (m_priorityQueues[i].tryDequeue(task))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::optional<Task> WorkerPool::trySteal(uint32_t thiefId)
 {
-    if (m_localQueues.size() <= 1)
+    const StealOrder& order = m_stealOrders[thiefId];
+
+    // 1. Victims sharing our L3: cheap to steal from, and the task's data is likely cached nearby
+    if (auto task = stealFromTier(order.victims, 0, order.sameL3End, UINT32_MAX))
+    {
+        m_stats.tasksStolen.fetch_add(1, std::memory_order_relaxed);
+        m_stats.localSteals.fetch_add(1, std::memory_order_relaxed);
+        return task;
+    }
+
+    // 2. Same package, then other packages. Only a few attempts each: idle workers
+    //    polling remote deques is what causes cross-LLC traffic storms
+    auto task = stealFromTier(order.victims, order.sameL3End, order.samePackageEnd, kRemoteStealAttempts);
+    if (!task)
+    {
+        task = stealFromTier(order.victims, order.samePackageEnd, order.victims.size(), kRemoteStealAttempts);
+    }
+
+    if (task)
+    {
+        m_stats.tasksStolen.fetch_add(1, std::memory_order_relaxed);
+        m_stats.remoteSteals.fetch_add(1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+std::optional<Task> WorkerPool::stealFromTier(const std::vector<uint32_t>& victims, size_t begin, size_t end,
+                                              uint32_t maxAttempts)
+{
+    const size_t count = end - begin;
+    if (count == 0)
     {
         return std::nullopt;
     }
 
-    // Random victim selection
-    std::uniform_int_distribution<uint32_t> dist(0,
-        static_cast<uint32_t>(m_localQueues.size()) - 1);
+    // Random starting victim so thieves of the same tier do not all hit the same deque
+    const size_t start = t_rng() % count;
+    const size_t attempts = std::min<size_t>(count, maxAttempts);
+    for (size_t i = 0; i < attempts; ++i)
+    {
+        const uint32_t victimId = victims[begin + (start + i) % count];
+        if (auto task = takeRecord(m_localQueues[victimId]->steal()))
+        {
+            if (task->profileId != 0)
+            {
+                TaskProfiler::record(TaskEventType::Steal, task->profileId, task->debugNameId);
+            }
+            return task;
+        }
+    }
+
+    return std::nullopt;
+}
+
+void WorkerPool::assignWorkerPlacements(uint32_t numWorkers)
+{
+    m_placements.assign(numWorkers, WorkerPlacement{});
+
+    const ThreadConfig& threadConfig = m_config.threadConfig;
+    if (!threadConfig.pinToPhysicalCores || threadConfig.affinityMask != 0)
+    {
+        return;
+    }
 
-    // Try a few random victims
-    for (int attempt = 0; attempt < 3; ++attempt)
+    const CpuTopology topology = CpuTopology::detect();
+    const std::vector<LogicalCpu> cpus = topology.placementOrder(threadConfig.useSmtSiblings);
+    if (cpus.empty())
     {
-        uint32_t victimId = dist(t_rng);
-        if (victimId == thiefId)
+        LOG_DEBUG("WorkerPool: CPU topology unavailable, workers are not pinned");
+        return;
+    }
+
+    // Two workers hard-pinned to one CPU would serialize while other CPUs idle, so workers past
+    // the end of the order stay unpinned and float over the CPUs left (with Main and Render)
+    const uint32_t pinnedCount = std::min(numWorkers, static_cast<uint32_t>(cpus.size()));
+    for (uint32_t i = 0; i < pinnedCount; ++i)
+    {
+        m_placements[i].cpu = cpus[i].id;
+        m_placements[i].l3 = cpus[i].l3;
+        m_placements[i].package = cpus[i].package;
+    }
+
+    LOG_INFO("WorkerPool: Pinning {} of {} workers over {} cores, {} L3 domains, {} packages",
+             pinnedCount, numWorkers, topology.physicalCoreCount(), topology.l3Count(), topology.packageCount());
+}
+
+void WorkerPool::buildStealOrders()
+{
+    const uint32_t numWorkers = static_cast<uint32_t>(m_placements.size());
+    m_stealOrders.assign(numWorkers, StealOrder{});
+
+    for (uint32_t thief = 0; thief < numWorkers; ++thief)
+    {
+        const WorkerPlacement& home = m_placements[thief];
+        StealOrder& order = m_stealOrders[thief];
+        std::vector<uint32_t> samePackage;
+        std::vector<uint32_t> remote;
+
+        for (uint32_t victim = 0; victim < numWorkers; ++victim)
         {
-            continue;
+            if (victim == thief)
+            {
+                continue;
+            }
+
+            // An unpinned worker may run anywhere: like the Main/Render deques it is neither
+            // near nor remote to a pinned one
+            const WorkerPlacement& placement = m_placements[victim];
+            const bool homePinned = home.cpu != WorkerPlacement::kUnpinned;
+            const bool victimPinned = placement.cpu != WorkerPlacement::kUnpinned;
+            if (homePinned != victimPinned)
+            {
+                samePackage.push_back(victim);
+            }
+            else if (placement.l3 == home.l3 && placement.package == home.package)
+            {
+                order.victims.push_back(victim);
+            }
+            else if (placement.package == home.package)
+            {
+                samePackage.push_back(victim);
+            }
+            else
+            {
+                remote.push_back(victim);
+            }
         }
 
-        if (auto task = m_localQueues[victimId]->steal())
+        // Deques lent to Main/Render are not pinned: treat them as same-package
+        for (uint32_t external = numWorkers; external < m_localQueues.size(); ++external)
         {
-            m_stats.tasksStolen.fetch_add(1, std::memory_order_relaxed);
-            return task;
+            samePackage.push_back(external);
         }
+
+        order.sameL3End = order.victims.size();
+        order.victims.insert(order.victims.end(), samePackage.begin(), samePackage.end());
+        order.samePackageEnd = order.victims.size();
+        order.victims.insert(order.victims.end(), remote.begin(), remote.end());
     }
+}
 
-    return std::nullopt;
+// ============================================================================
+// Fiber mode
+// ============================================================================
+
+void WorkerPool::createFibers()
+{
+    const uint32_t count = std::clamp<uint32_t>(m_config.fiberCount, 1, static_cast<uint32_t>(kMaxFibers));
+    m_fibers.reserve(count);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        auto fiber = std::make_unique<JobFiber>();
+        fiber->pool = this;
+        fiber->resume = [](CounterWaiter* waiter) {
+            auto* parked = static_cast<JobFiber*>(waiter);
+            parked->pool->makeFiberReady(*parked);
+        };
+
+        if (!fiber->context.create(m_config.fiberStackSize, &WorkerPool::fiberMain, fiber.get()))
+        {
+            break;
+        }
+
+        m_freeFibers.tryEnqueue(fiber.get());
+        m_fibers.push_back(std::move(fiber));
+    }
+
+    m_fibersEnabled = !m_fibers.empty();
+    if (m_fibersEnabled)
+    {
+        LOG_INFO("WorkerPool: Fiber mode with {} fibers ({} KiB stacks)",
+                 m_fibers.size(), m_config.fiberStackSize / 1024);
+    }
+    else
+    {
+        LOG_WARN("WorkerPool: Could not allocate fibers, falling back to help-run waiting");
+    }
+}
+
+bool WorkerPool::isInFiber() const
+{
+    JobFiber* fiber = currentFiber();
+    return fiber != nullptr && fiber->pool == this;
+}
+
+void WorkerPool::runTask(Task& task)
+{
+    JobFiber* fiber = nullptr;
+    if (m_fibersEnabled && m_freeFibers.tryDequeue(fiber))
+    {
+        fiber->task = std::move(task);
+        resumeFiber(*fiber);
+        return;
+    }
+
+    if (m_fibersEnabled)
+    {
+        // Every fiber is parked or busy: the task can still run, but would help-run if it waits
+        m_stats.fiberPoolExhausted.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    task.execute();
+    m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
+}
+
+void WorkerPool::resumeFiber(JobFiber& fiber)
+{
+    t_currentFiber = &fiber;
+    FiberContext::switchTo(*t_schedulerContext, fiber.context);
+    t_currentFiber = nullptr;
+
+    // Back on the scheduler stack: the fiber is fully switched out, so it is now safe to
+    // hand it to another thread
+    const FiberSwitch request = std::exchange(t_fiberSwitch, FiberSwitch{});
+    switch (request.action)
+    {
+        case FiberAction::Finished:
+            m_freeFibers.tryEnqueue(&fiber);
+            break;
+
+        case FiberAction::Park:
+            // May resume the fiber right away if the counter reached zero meanwhile
+            request.park(request.waitTarget, &fiber);
+            break;
+
+        case FiberAction::None:
+            break;
+    }
+}
+
+void WorkerPool::fiberMain(void* arg)
+{
+    JobFiber& fiber = *static_cast<JobFiber*>(arg);
+    for (;;)
+    {
+        fiber.pool->runFiberTasks(fiber);
+
+        FiberSwitch request;
+        request.action = FiberAction::Finished;
+        switchToScheduler(fiber, request);
+    }
+}
+
+void WorkerPool::runFiberTasks(JobFiber& fiber)
+{
+    fiber.task.execute();
+    fiber.task = Task{};
+    m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
+
+    // Keep going on this fiber while there is work: saves two context switches per task.
+    // Ready fibers go back through the scheduler so continuations are not starved
+    while (m_running.load(std::memory_order_acquire) && m_readyFibers.isEmpty())
+    {
+        auto task = tryGetTaskOnCurrentWorker();
+        if (!task)
+        {
+            return;
+        }
+
+        m_pendingTasks.fetch_sub(1, std::memory_order_release);
+        task->execute();
+        m_stats.tasksCompleted.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void WorkerPool::parkCurrentFiber(const void* target, void (*park)(const void*, CounterWaiter*))
+{
+    JobFiber* fiber = currentFiber();
+    m_stats.fibersParked.fetch_add(1, std::memory_order_relaxed);
+
+    FiberSwitch request;
+    request.action = FiberAction::Park;
+    request.waitTarget = target;
+    request.park = park;
+    switchToScheduler(*fiber, request);
+
+    // Resumed, possibly on another worker, after the counter reached zero
+}
+
+void WorkerPool::switchToScheduler(JobFiber& fiber, const FiberSwitch& request)
+{
+    // Must not be inlined into callers: thread_locals are re-read on whichever thread runs us now
+    t_fiberSwitch = request;
+    FiberContext::switchTo(fiber.context, *t_schedulerContext);
+}
+
+void WorkerPool::makeFiberReady(JobFiber& fiber)
+{
+    // Capacity equals the fiber count limit, so this cannot fail
+    m_readyFibers.tryEnqueue(&fiber);
+    m_pendingTasks.fetch_add(1, std::memory_order_release);
+    wakeWorker();
+}
+
+std::optional<Task> WorkerPool::tryGetTaskOnCurrentWorker()
+{
+    return tryGetTask(t_localQueueIndex);
+}
+
+std::optional<Task> WorkerPool::popCurrentWorkerTask()
+{
+    WorkStealingDeque<Task*>* queue = currentLocalQueue();
+    return queue ? takeRecord(queue->pop()) : std::nullopt;
+}
+
+WorkStealingDeque<Task*>* WorkerPool::currentLocalQueue()
+{
+    return t_localQueuePool == this ? m_localQueues[t_localQueueIndex].get() : nullptr;
+}
+
+WorkerPool::JobFiber* WorkerPool::currentFiber()
+{
+    return t_currentFiber;
+}
+
+void WorkerPool::wakeWorker()
+{
+    if (m_workAvailable.notifyOne())
+    {
+        m_stats.workerWakes.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 void WorkerPool::notifyWorkers()
 {
-    m_cv.notify_all();
+    if (m_workAvailable.notifyAll())
+    {
+        m_stats.workerWakes.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 } // namespace vesper
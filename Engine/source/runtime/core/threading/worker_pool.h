@@ -1,20 +1,28 @@
 #pragma once
 
 #include "runtime/core/base/macro.h"
+#include "runtime/core/threading/cpu_topology.h"
+#include "runtime/core/threading/event_count.h"
+#include "runtime/core/threading/fiber.h"
 #include "runtime/core/threading/task.h"
+#include "runtime/core/threading/task_pool.h"
 #include "runtime/core/threading/wait_group.h"
 #include "runtime/core/threading/work_stealing_deque.h"
-#include "runtime/core/threading/mpsc_queue.h"
+#include "runtime/core/threading/mpmc_queue.h"
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <coroutine>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <random>
+#include <span>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 namespace vesper {
@@ -106,6 +114,10 @@ struct ThreadConfig
     std::string namePrefix{"VesperWorker"};  // Thread name prefix (e.g., "VesperWorker-0")
     int32_t priority{0};                      // 0 = normal, positive = higher, negative = lower
     uint64_t affinityMask{0};                 // 0 = no affinity (OS decides)
+    bool pinToPhysicalCores{true};            // Pin one worker per physical core, filling an L3 before the next
+                                              // (Linux, ignored when affinityMask is set). Workers beyond the
+                                              // usable CPUs stay unpinned, never two on one CPU
+    bool useSmtSiblings{false};               // Also pin to SMT siblings once every physical core has a worker
 };
 
 /// @brief Worker pool configuration
@@ -116,6 +128,10 @@ struct WorkerPoolConfig
     QueueOverflowPolicy overflowPolicy{QueueOverflowPolicy::Block};  // What to do when queue is full
     ThreadConfig threadConfig{};                        // Thread naming/affinity configuration
     bool syncFallback{true};                            // If true and numWorkers ends up 0, execute tasks synchronously
+    bool enableFibers{false};                           // Run AnyThread tasks on fibers: waitFor() inside a task parks
+                                                        // the fiber instead of help-running on the same stack
+    uint32_t fiberCount{128};                           // Pre-allocated fibers shared by all workers (max kMaxFibers)
+    size_t fiberStackSize{256 * 1024};                  // Stack size of each fiber in bytes
     // Note: Queue capacities are compile-time constants for performance
     // See kGlobalQueueCapacity and kAffinityQueueCapacity below
 };
@@ -130,6 +146,13 @@ struct WorkerPoolStats
     std::atomic<uint64_t> tasksDropped{0};          // Tasks dropped due to queue full (Drop policy)
     std::atomic<uint64_t> tasksExecutedInline{0};   // Tasks executed inline (ExecuteInline policy)
     std::atomic<uint64_t> tasksBlocked{0};          // Times blocked waiting for queue space
+    std::atomic<uint64_t> rangeSplits{0};           // Sub-ranges pushed to local deques by parallelFor
+    std::atomic<uint64_t> workerParks{0};           // Times an idle worker went to sleep
+    std::atomic<uint64_t> workerWakes{0};           // Wake syscalls issued by submitters
+    std::atomic<uint64_t> localSteals{0};           // Worker steals from a victim sharing the thief's L3
+    std::atomic<uint64_t> remoteSteals{0};          // Worker steals across L3/package (or from non-worker deques)
+    std::atomic<uint64_t> fibersParked{0};          // Times a task suspended its fiber in waitFor
+    std::atomic<uint64_t> fiberPoolExhausted{0};    // Tasks run on the worker stack because no fiber was free
 
     void reset()
     {
@@ -140,14 +163,33 @@ struct WorkerPoolStats
         tasksDropped.store(0, std::memory_order_relaxed);
         tasksExecutedInline.store(0, std::memory_order_relaxed);
         tasksBlocked.store(0, std::memory_order_relaxed);
+        rangeSplits.store(0, std::memory_order_relaxed);
+        workerParks.store(0, std::memory_order_relaxed);
+        workerWakes.store(0, std::memory_order_relaxed);
+        localSteals.store(0, std::memory_order_relaxed);
+        remoteSteals.store(0, std::memory_order_relaxed);
+        fibersParked.store(0, std::memory_order_relaxed);
+        fiberPoolExhausted.store(0, std::memory_order_relaxed);
     }
 };
 
+/// @brief Shared state of one parallelFor invocation
+/// Lives on the calling thread's stack for the duration of the call
+struct ParallelRangeJob
+{
+    RangeTaskFunc   function{nullptr};  // Type-erased range body
+    void*           context{nullptr};   // Body object owned by the caller
+    size_t          grainSize{1};       // Smallest range that is never split further
+    TaskCounter     pending;            // Outstanding range tasks (root + splits)
+};
+
 /// @brief Work-stealing thread pool for task execution
 /// Supports task affinity routing: AnyThread, RenderOnly, LogicOnly
 class WorkerPool
 {
 public:
+    static constexpr size_t kMaxFibers = 1024;  // Upper bound of WorkerPoolConfig::fiberCount
+
     WorkerPool();
     ~WorkerPool();
 
@@ -170,6 +212,24 @@ public:
     /// @return WaitGroup that will be signaled when task completes
     WaitGroupPtr submit(Task task);
 
+    /// @brief Submit a task that signals a caller-owned counter instead of a WaitGroup
+    /// Zero-allocation path: the closure lives inline in the task record and no
+    /// WaitGroup is created. The counter must outlive the task (wait with waitFor(counter)).
+    /// @param task Task to execute
+    /// @param counter Counter incremented now and decremented when the task completes
+    /// @return true if the task was enqueued or executed inline, false if dropped
+    bool submit(Task task, TaskCounter& counter);
+
+    /// @brief Submit a follow-up task from inside running work (zero-allocation)
+    /// AnyThread tasks go straight onto the calling thread's work-stealing deque when it
+    /// owns one (workers, or any thread inside waitFor/parallelFor): the data the task
+    /// consumes is likely still in this core's cache, and idle workers can steal it.
+    /// Otherwise (affinity tasks, foreign threads) behaves like submit(task, counter).
+    /// @param task Task to execute
+    /// @param counter Counter incremented now and decremented when the task completes
+    /// @return true if the task was enqueued or executed inline, false if dropped
+    bool submitContinuation(Task task, TaskCounter& counter);
+
     /// @brief Submit a function as a task
     /// @param fn Function to execute
     /// @param affinity Thread affinity
@@ -202,6 +262,20 @@ public:
                                   TaskAffinity affinity = TaskAffinity::AnyThread,
                                   TaskPriority priority = TaskPriority::Normal);
 
+    /// @brief Submit a batch of lightweight tasks signalling a caller-owned counter (zero-allocation)
+    /// @param counter Counter incremented by count and decremented as tasks complete
+    /// @param functions Array of function pointers
+    /// @param userData Array of user data pointers (parallel to functions)
+    /// @param count Number of tasks
+    /// @param affinity Thread affinity for all tasks
+    /// @param priority Priority for all tasks
+    void submitLightBatch(TaskCounter& counter,
+                          LightTaskFunc* functions,
+                          void** userData,
+                          size_t count,
+                          TaskAffinity affinity = TaskAffinity::AnyThread,
+                          TaskPriority priority = TaskPriority::Normal);
+
     /// @brief Submit a TaskBatch (template version)
     template<size_t N>
     WaitGroupPtr submitBatch(const TaskBatch<N>& batch)
@@ -215,6 +289,66 @@ public:
         );
     }
 
+    /// @brief Run fn(chunkBegin, chunkEnd) over [begin, end) in parallel and wait for completion
+    /// Uses lazy binary splitting: the executing thread pushes the upper half of its range onto
+    /// its local work-stealing deque only while that deque is empty (i.e. earlier splits were
+    /// stolen), so the number of tasks adapts to how many threads are actually idle.
+    /// The calling thread (Main/Render/Worker) participates and help-runs while waiting.
+    /// @param begin First index
+    /// @param end One past the last index
+    /// @param grainSize Smallest chunk handed to fn (0 = auto)
+    /// @param fn Callable invoked as fn(size_t chunkBegin, size_t chunkEnd)
+    template<typename Fn>
+    void parallelForRange(size_t begin, size_t end, size_t grainSize, Fn&& fn)
+    {
+        if (begin >= end)
+        {
+            return;
+        }
+
+        using Body = std::remove_reference_t<Fn>;
+
+        ParallelRangeJob job;
+        job.function = [](void* context, size_t chunkBegin, size_t chunkEnd) {
+            (*static_cast<Body*>(context))(chunkBegin, chunkEnd);
+        };
+        job.context = const_cast<void*>(static_cast<const void*>(std::addressof(fn)));
+        job.grainSize = grainSize;
+
+        runParallelRange(job, begin, end);
+    }
+
+    /// @brief Run fn(i) for every index in [begin, end) in parallel and wait for completion
+    /// @param begin First index
+    /// @param end One past the last index
+    /// @param grainSize Smallest number of indices per chunk (0 = auto)
+    /// @param fn Callable invoked as fn(size_t index)
+    template<typename Fn>
+    void parallelFor(size_t begin, size_t end, size_t grainSize, Fn&& fn)
+    {
+        parallelForRange(begin, end, grainSize, [&fn](size_t chunkBegin, size_t chunkEnd) {
+            for (size_t i = chunkBegin; i < chunkEnd; ++i)
+            {
+                fn(i);
+            }
+        });
+    }
+
+    /// @brief Run fn(item) for every element of a span in parallel and wait for completion
+    /// @param items Elements to process (must outlive the call, which it does since the call blocks)
+    /// @param fn Callable invoked as fn(T& item)
+    /// @param grainSize Smallest number of elements per chunk (0 = auto)
+    template<typename T, typename Fn>
+    void parallelForEach(std::span<T> items, Fn&& fn, size_t grainSize = 0)
+    {
+        parallelForRange(0, items.size(), grainSize, [&items, &fn](size_t chunkBegin, size_t chunkEnd) {
+            for (size_t i = chunkBegin; i < chunkEnd; ++i)
+            {
+                fn(items[i]);
+            }
+        });
+    }
+
     /// @brief Try to execute one AnyThread task from the pool (help-run)
     /// Call this while waiting to avoid idle spinning
     /// @return true if a task was executed
@@ -241,12 +375,88 @@ public:
     /// @param allowHelpRun If true, execute tasks while waiting
     void waitFor(WaitGroupPtr wg, bool allowHelpRun = true);
 
+    /// @brief Wait for a stack-allocated counter to reach zero, help-running meanwhile
+    /// Always help-runs (a TaskCounter has no blocking wait)
+    /// @param counter Counter to wait for
+    void waitFor(const TaskCounter& counter);
+
+    /// @brief Awaiter that resumes a coroutine through the pool (see schedule()/switchTo())
+    class ScheduleAwaiter
+    {
+    public:
+        ScheduleAwaiter(WorkerPool& pool, TaskAffinity affinity, TaskPriority priority, bool skipIfOnTarget)
+            : m_pool(pool)
+            , m_affinity(affinity)
+            , m_priority(priority)
+            , m_skipIfOnTarget(skipIfOnTarget)
+        {}
+
+        bool await_ready() const noexcept
+        {
+            return m_skipIfOnTarget && isOnAffinityThread(m_affinity);
+        }
+
+        /// @return false (continue inline) if the pool cannot queue the continuation
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            return m_pool.postCoroutine(handle, m_affinity, m_priority);
+        }
+
+        void await_resume() const noexcept {}
+
+    private:
+        WorkerPool& m_pool;
+        TaskAffinity m_affinity;
+        TaskPriority m_priority;
+        bool m_skipIfOnTarget;
+    };
+
+    /// @brief co_await to continue the coroutine as a task with the given affinity
+    /// Always suspends (even on a matching thread): use it to fan work out to workers.
+    /// Zero-allocation: the continuation is queued as a plain Task without a WaitGroup.
+    [[nodiscard]] ScheduleAwaiter schedule(TaskAffinity affinity = TaskAffinity::AnyThread,
+                                           TaskPriority priority = TaskPriority::Normal)
+    {
+        return ScheduleAwaiter(*this, affinity, priority, false);
+    }
+
+    /// @brief co_await to hop to a thread matching the affinity (no-op if already on one)
+    /// RenderOnly continuations run from processRenderTask(), LogicOnly ones from
+    /// processLogicTask(), AnyThread ones on a worker.
+    [[nodiscard]] ScheduleAwaiter switchTo(TaskAffinity affinity,
+                                           TaskPriority priority = TaskPriority::Normal)
+    {
+        return ScheduleAwaiter(*this, affinity, priority, true);
+    }
+
+    /// @brief Check if the calling thread may run tasks of the given affinity
+    [[nodiscard]] static bool isOnAffinityThread(TaskAffinity affinity);
+
+    /// @brief Check if the calling code runs on one of this pool's fibers (fiber mode only)
+    [[nodiscard]] bool isInFiber() const;
+
+    /// @brief Check if RenderOnly/LogicOnly tasks are waiting (AnyThread: any queued task)
+    [[nodiscard]] bool hasPendingTasks(TaskAffinity affinity) const;
+
+    /// @brief Notify an event whenever a task of the given affinity is queued
+    /// Lets the Render/Main thread sleep on its own EventCount (e.g. FramePacer) and still
+    /// wake up for affinity tasks. Pass nullptr to detach. AnyThread is not supported.
+    void setAffinityWakeEvent(TaskAffinity affinity, EventCount* event);
+
     /// @brief Check if pool is running
     [[nodiscard]] bool isRunning() const { return m_running.load(std::memory_order_acquire); }
 
     /// @brief Get number of worker threads
     [[nodiscard]] uint32_t workerCount() const { return static_cast<uint32_t>(m_workers.size()); }
 
+    /// @brief Logical CPU a worker is pinned to, or kUnpinnedCpu if the OS schedules it
+    [[nodiscard]] uint32_t workerCpu(uint32_t workerId) const
+    {
+        return workerId < m_placements.size() ? m_placements[workerId].cpu : kUnpinnedCpu;
+    }
+
+    static constexpr uint32_t kUnpinnedCpu = UINT32_MAX;
+
     /// @brief Get statistics
     [[nodiscard]] const WorkerPoolStats& stats() const { return m_stats; }
 
@@ -254,20 +464,133 @@ public:
     void resetStats() { m_stats.reset(); }
 
 private:
+    /// @brief RAII ownership of a local work-stealing deque for the current thread
+    /// Workers own their deque for life; Main/Render/other threads temporarily claim
+    /// one of the external deques (nullptr if all are taken)
+    class LocalQueueScope
+    {
+    public:
+        explicit LocalQueueScope(WorkerPool& pool);
+        ~LocalQueueScope();
+
+        VESPER_DISABLE_COPY_AND_MOVE(LocalQueueScope)
+
+        [[nodiscard]] WorkStealingDeque<Task*>* queue() const { return m_queue; }
+
+    private:
+        WorkerPool& m_pool;
+        WorkStealingDeque<Task*>* m_queue{nullptr};
+        int32_t m_claimedSlot{-1};
+    };
+
+    /// @brief Non-template core of parallelForRange
+    void runParallelRange(ParallelRangeJob& job, size_t begin, size_t end);
+
+    /// @brief Execute a range with lazy binary splitting, then signal job.pending
+    void executeRange(ParallelRangeJob& job, size_t begin, size_t end);
+
+    /// @brief Push [begin, end) of a job onto a local deque as a stealable task
+    void pushRangeTask(WorkStealingDeque<Task*>& queue, ParallelRangeJob& job, size_t begin, size_t end);
+
+    /// @brief Pick a grain size when the caller passed 0
+    [[nodiscard]] size_t autoGrainSize(size_t count) const;
+
     /// @brief Worker thread function
     void workerLoop(uint32_t workerId);
 
+    // ------------------------------------------------------------------------
+    // Fiber mode: tasks run on pooled fibers; a task that waits parks its fiber on the
+    // counter and the worker moves on. The fiber becomes ready when the counter hits zero
+    // and is resumed by whichever worker dequeues it. Fibers migrate between workers, so
+    // everything that reads thread_local state after a possible switch goes through the
+    // out-of-line accessors below.
+    // ------------------------------------------------------------------------
+
+    struct JobFiber : CounterWaiter
+    {
+        FiberContext context;
+        WorkerPool* pool{nullptr};
+        Task task;                  // Task the fiber starts with when resumed from the free list
+    };
+
+    enum class FiberAction : uint8_t
+    {
+        None,
+        Finished,   // Fiber ran out of work; return it to the free list
+        Park        // Fiber waits on a counter; register it as a suspended waiter
+    };
+
+    /// @brief Request left by a fiber for the scheduler it switches back to
+    struct FiberSwitch
+    {
+        FiberAction action{FiberAction::None};
+        const void* waitTarget{nullptr};
+        void (*park)(const void* target, CounterWaiter* waiter){nullptr};
+    };
+
+    /// @brief Allocate the fiber pool (fiber mode only)
+    void createFibers();
+
+    /// @brief Run a task on a free fiber, or on the current stack if none is free
+    void runTask(Task& task);
+
+    /// @brief Switch from the worker's scheduler context into a fiber and handle its request on return
+    void resumeFiber(JobFiber& fiber);
+
+    /// @brief Entry point of every fiber
+    static void fiberMain(void* arg);
+
+    /// @brief Run the fiber's task, then keep taking tasks on the same fiber while there are any
+    void runFiberTasks(JobFiber& fiber);
+
+    /// @brief Suspend the current fiber until the target counter reaches zero
+    void parkCurrentFiber(const void* target, void (*park)(const void*, CounterWaiter*));
+
+    /// @brief Leave the running fiber for the scheduler of the thread it currently runs on
+    VESPER_NOINLINE static void switchToScheduler(JobFiber& fiber, const FiberSwitch& request);
+
+    /// @brief Queue a parked fiber whose counter reached zero (any thread)
+    void makeFiberReady(JobFiber& fiber);
+
+    /// @brief tryGetTask for the worker the calling fiber currently runs on
+    VESPER_NOINLINE std::optional<Task> tryGetTaskOnCurrentWorker();
+
+    /// @brief Pop the current worker's own deque (fiber waitFor)
+    VESPER_NOINLINE std::optional<Task> popCurrentWorkerTask();
+
+    /// @brief Local deque of the calling thread, nullptr if it has none for this pool
+    VESPER_NOINLINE WorkStealingDeque<Task*>* currentLocalQueue();
+
+    VESPER_NOINLINE static JobFiber* currentFiber();
+
     /// @brief Try to get a task for execution
     /// @param workerId Worker requesting task
     /// @return Task if available
     std::optional<Task> tryGetTask(uint32_t workerId);
 
+    /// @brief Dequeue the highest-priority AnyThread task from the global queues
+    bool tryDequeueGlobal(Task& task);
+
     /// @brief Try to steal from another worker
+    /// Victims sharing the thief's L3 are swept first, then a few remote ones
     /// @param thiefId Worker trying to steal
     /// @return Stolen task if available
     std::optional<Task> trySteal(uint32_t thiefId);
 
-    /// @brief Wake up workers
+    /// @brief Try victims [begin, end) of a steal order, starting at a random one
+    std::optional<Task> stealFromTier(const std::vector<uint32_t>& victims, size_t begin, size_t end,
+                                      uint32_t maxAttempts);
+
+    /// @brief Pick a CPU for each worker from the machine topology (if pinning is enabled)
+    void assignWorkerPlacements(uint32_t numWorkers);
+
+    /// @brief Build each worker's victim list, nearest cache domain first
+    void buildStealOrders();
+
+    /// @brief Wake one parked worker (no syscall if none is parked)
+    void wakeWorker();
+
+    /// @brief Wake all parked workers (no syscall if none is parked)
     void notifyWorkers();
 
     /// @brief Enqueue task with overflow policy handling
@@ -275,12 +598,27 @@ private:
     template<typename Queue>
     bool enqueueWithPolicy(Queue& queue, Task& task, bool updatePendingCount);
 
+    /// @brief Queue a coroutine resumption as a task (ScheduleAwaiter)
+    /// @return false if the caller should resume the coroutine inline instead
+    bool postCoroutine(std::coroutine_handle<> handle, TaskAffinity affinity, TaskPriority priority);
+
+    /// @brief Route a task to the queue matching its affinity (shared by all submit paths)
+    /// Does not notify workers; on failure the task was dropped but not signalled
+    /// @return true if task was enqueued or executed inline
+    bool routeTask(Task& task);
+
+    /// @brief Notify an affinity wake event if one is attached
+    static void notifyWakeEvent(const std::atomic<EventCount*>& event);
+
     /// @brief Set thread name (platform-specific)
     static void setThreadName(const std::string& name);
 
     /// @brief Set thread affinity (platform-specific)
     static void setThreadAffinity(uint64_t mask);
 
+    /// @brief Pin the calling thread to a single logical CPU (platform-specific)
+    static void setThreadAffinityToCpu(uint32_t cpu);
+
     /// @brief Set thread priority (platform-specific)
     static void setThreadPriority(int32_t priority);
 
@@ -288,17 +626,52 @@ private:
     static constexpr size_t kGlobalQueueCapacity = 1024;
     static constexpr size_t kAffinityQueueCapacity = 512;
     static constexpr size_t kPriorityLevels = 4;  // Low, Normal, High, Critical
+    static constexpr size_t kExternalQueueCount = 4;  // Deques lent to non-worker threads (Main, Render, ...)
+    static constexpr uint32_t kRemoteStealAttempts = 3;  // Victims tried per remote tier before giving up
 
     // Worker threads
     std::vector<std::thread> m_workers;
-    std::vector<std::unique_ptr<WorkStealingDeque<Task>>> m_localQueues;
+
+    // Work-stealing deques of TaskPool records: [0, workerCount) belong to workers,
+    // the trailing kExternalQueueCount are claimed by non-worker threads running parallelFor
+    std::vector<std::unique_ptr<WorkStealingDeque<Task*>>> m_localQueues;
+    std::array<std::atomic<bool>, kExternalQueueCount> m_externalQueueClaimed{};
+
+    // Where each worker runs: CPU it is pinned to (kUnpinned if none) and its cache domains
+    struct WorkerPlacement
+    {
+        static constexpr uint32_t kUnpinned = kUnpinnedCpu;
+        uint32_t cpu{kUnpinned};
+        uint32_t l3{0};
+        uint32_t package{0};
+    };
+
+    // Victims of one worker: [0, sameL3End) share its L3, [sameL3End, samePackageEnd) share its
+    // package (plus the non-worker deques), the rest are on other packages
+    struct StealOrder
+    {
+        std::vector<uint32_t> victims;
+        size_t sameL3End{0};
+        size_t samePackageEnd{0};
+    };
+
+    std::vector<WorkerPlacement> m_placements;
+    std::vector<StealOrder> m_stealOrders;
+
+    // Fiber mode
+    std::vector<std::unique_ptr<JobFiber>> m_fibers;
+    MPMCQueue<JobFiber*, kMaxFibers> m_freeFibers;
+    MPMCQueue<JobFiber*, kMaxFibers> m_readyFibers;     // Parked fibers whose counter reached zero
+    bool m_fibersEnabled{false};
 
     // Priority-based global queues for AnyThread tasks (index = priority level)
-    std::array<MPSCQueue<Task, kGlobalQueueCapacity>, kPriorityLevels> m_priorityQueues;
+    std::array<MPMCQueue<Task, kGlobalQueueCapacity>, kPriorityLevels> m_priorityQueues;
 
-    // Affinity-specific queues (MPSC: multiple producers, single consumer on target thread)
-    MPSCQueue<Task, kAffinityQueueCapacity> m_renderQueue;  // RenderOnly tasks
-    MPSCQueue<Task, kAffinityQueueCapacity> m_logicQueue;   // LogicOnly tasks
+    // Affinity-specific queues (many producers; consumed by the target thread)
+    MPMCQueue<Task, kAffinityQueueCapacity> m_renderQueue;  // RenderOnly tasks
+    MPMCQueue<Task, kAffinityQueueCapacity> m_logicQueue;   // LogicOnly tasks
+    std::atomic<EventCount*> m_renderWakeEvent{nullptr};     // Notified when a RenderOnly task is queued
+    std::atomic<EventCount*> m_logicWakeEvent{nullptr};      // Notified when a LogicOnly task is queued
 
     // Helper to get queue index from priority
     static size_t priorityToIndex(TaskPriority priority)
@@ -307,10 +680,9 @@ private:
     }
 
     // Synchronization
-    std::mutex m_mutex;
-    std::condition_variable m_cv;
+    EventCount m_workAvailable;                 // Idle workers park here
     std::atomic<bool> m_running{false};
-    std::atomic<uint32_t> m_pendingTasks{0};
+    std::atomic<uint32_t> m_pendingTasks{0};    // AnyThread tasks and ready fibers queued but not yet taken
     std::atomic<uint32_t> m_workersBlockedOnEnqueue{0};  // Track workers blocked waiting to enqueue
 
     // Configuration
@@ -324,6 +696,16 @@ private:
 
     // Random number generator for work stealing victim selection
     thread_local static std::mt19937 t_rng;
+
+    // Local deque owned by the current thread (pool + index into m_localQueues)
+    thread_local static WorkerPool* t_localQueuePool;
+    thread_local static uint32_t t_localQueueIndex;
+
+    // Fiber mode: scheduler context of the worker thread, fiber running on it, and the
+    // request the fiber leaves when switching back
+    thread_local static FiberContext* t_schedulerContext;
+    thread_local static JobFiber* t_currentFiber;
+    thread_local static FiberSwitch t_fiberSwitch;
 };
 
 } // namespace vesper
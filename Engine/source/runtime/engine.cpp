@@ -1,14 +1,19 @@
 #include "runtime/engine.h"
 #include "runtime/core/log/log_system.h"
+#include "runtime/core/threading/frame_pacer.h"
+#include "runtime/core/threading/task_profiler.h"
 #include "runtime/core/threading/worker_pool.h"
 #include "runtime/core/event/event_bus.h"
 #include "runtime/function/global/global_context.h"
 #include "runtime/function/window/window_system.h"
+#include "runtime/function/physics/physics_manager.h"
+#include "runtime/function/physics/physics_scene.h"
 #include "runtime/function/render/render_packet.h"
 #include "runtime/function/render/render_system.h"
 #include "runtime/function/framework/scene/scene.h"
 #include "runtime/platform/input/input_system.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 
@@ -21,6 +26,34 @@
 
 namespace vesper {
 
+namespace {
+
+inline float nanosecondsToMs(uint64_t nanoseconds)
+{
+    return static_cast<float>(static_cast<double>(nanoseconds) / 1.0e6);
+}
+
+/// @brief Publish the latency of a rendered frame on the diagnostic channel
+void publishFrameTiming(EventBus* eventBus, const FramePacer::FrameLatency& latency, uint64_t previousConsumedNs)
+{
+    if (!eventBus)
+    {
+        return;
+    }
+
+    FrameTimingEvent event;
+    event.frameIndex = latency.frameIndex;
+    event.cpuTimeMs = nanosecondsToMs(latency.consumedNs - latency.consumeBeginNs);
+    event.frameTimeMs = previousConsumedNs != 0 ? nanosecondsToMs(latency.consumedNs - previousConsumedNs) : 0.0f;
+    event.inputToPacketMs = nanosecondsToMs(latency.producedNs - latency.inputSampledNs);
+    event.packetToConsumeMs = nanosecondsToMs(latency.consumedNs - latency.producedNs);
+    event.inputToConsumeMs = nanosecondsToMs(latency.consumedNs - latency.inputSampledNs);
+    event.framesSkipped = latency.framesSkipped;
+    eventBus->diagnosticChannel().publish(event);
+}
+
+} // namespace
+
 VesperEngine::VesperEngine() = default;
 
 VesperEngine::~VesperEngine()
@@ -44,6 +77,13 @@ bool VesperEngine::initialize(const EngineConfig& config)
     LOG_INFO("===========================================");
 
     m_multithreadingEnabled = config.enableMultithreading;
+    m_logicFramesAhead = std::min(config.logicFramesAhead, FramePacer::kMaxFramesAhead);
+
+    m_taskTracePath = config.taskTracePath;
+    if (!m_taskTracePath.empty())
+    {
+        TaskProfiler::setEnabled(true);
+    }
 
     // Initialize threading and pipeline systems via GlobalContext
     // Pass configuration to control worker pool creation
@@ -189,30 +229,63 @@ void VesperEngine::run()
 
     if (m_multithreadingEnabled)
     {
+        // Logic runs at most m_logicFramesAhead frames ahead of render; both sides sleep on
+        // the pacer and are woken early by affinity tasks queued for them
+        m_framePacer = std::make_unique<FramePacer>(m_logicFramesAhead);
+        WorkerPool* pool = getWorkerPool();
+        if (pool)
+        {
+            pool->setAffinityWakeEvent(TaskAffinity::LogicOnly, &m_framePacer->logicWakeEvent());
+            pool->setAffinityWakeEvent(TaskAffinity::RenderOnly, &m_framePacer->renderWakeEvent());
+        }
+
         // Start render thread
         m_renderThreadRunning.store(true, std::memory_order_release);
         m_renderThread = std::make_unique<std::thread>(&VesperEngine::renderThreadLoop, this);
 
-        LOG_INFO("Render thread started");
+        LOG_INFO("Render thread started (logic may run {} frame(s) ahead)", m_logicFramesAhead);
 
         // Main/Logic thread loop
         while (m_running.load(std::memory_order_acquire) && !m_windowSystem->shouldClose())
         {
+            const FramePacer::WaitResult wait = m_framePacer->waitForLogicSlot([pool]() {
+                return pool && pool->hasPendingTasks(TaskAffinity::LogicOnly);
+            });
+            if (wait == FramePacer::WaitResult::Stopped)
+            {
+                break;
+            }
+            if (wait == FramePacer::WaitResult::Interrupted)
+            {
+                pool->processAllLogicTasks();
+                continue;
+            }
+
             auto now = std::chrono::steady_clock::now();
             float deltaTime = std::chrono::duration<float>(now - m_lastFrameTime).count();
             m_lastFrameTime = now;
 
+            m_framePacer->beginLogicFrame();
             logicTick(deltaTime);
+            m_framePacer->endLogicFrame();
         }
 
         // Stop render thread
         m_renderThreadRunning.store(false, std::memory_order_release);
+        m_framePacer->stop();
         if (m_renderThread && m_renderThread->joinable())
         {
             m_renderThread->join();
         }
         m_renderThread.reset();
 
+        if (pool)
+        {
+            pool->setAffinityWakeEvent(TaskAffinity::LogicOnly, nullptr);
+            pool->setAffinityWakeEvent(TaskAffinity::RenderOnly, nullptr);
+        }
+        m_framePacer.reset();
+
         LOG_INFO("Render thread stopped");
     }
     else
@@ -230,6 +303,9 @@ void VesperEngine::run()
 
 void VesperEngine::logicTick(float deltaTime)
 {
+    static const TaskNameId kLogicTickName = internTaskName("Engine.LogicTick");
+    ProfileScope profileScope(kLogicTickName);
+
     // Reset per-frame input state
     m_inputSystem->tick();
 
@@ -256,41 +332,38 @@ void VesperEngine::logicTick(float deltaTime)
         renderSystem->processCameraInput(m_inputSystem.get(), deltaTime);
     }
 
-    // Update active scene
     auto* scene = g_runtime_global_context.m_active_scene.get();
-    if (scene)
-    {
-        scene->update(deltaTime);
-    }
+    auto* packetBuffer = g_runtime_global_context.m_render_packet_buffer.get();
 
-    // TODO: Update game logic (physics, AI, animation, etc.)
-    // These could be parallelized via worker pool
+    updatePhysics(scene, deltaTime);
 
-    // Example of submitting parallel tasks:
-    // if (auto* pool = getWorkerPool())
-    // {
-    //     auto wg = pool->submit([](){ /* parallel work */ });
-    //     pool->waitFor(wg, true); // Wait with help-run
-    // }
+    // TODO: Update game logic (AI, animation, etc.)
+    // These can become additional nodes of the scene frame graph
 
-    // Prepare and publish render packet
-    auto* packetBuffer = g_runtime_global_context.m_render_packet_buffer.get();
-    if (packetBuffer)
+    if (scene)
     {
-        // If we have an active scene, use its render preparation
-        if (scene)
+        // Culling on the GPU, the render thread is handed every drawable object to cull
+        scene->setCpuCulling(!(renderSystem && renderSystem->isInitialized() && renderSystem->isGpuCullingActive()));
+
+        if (auto* pool = getWorkerPool())
         {
-            scene->prepareForRendering(packetBuffer, m_frameIndex);
+            // Transforms -> bounds -> render packet, scheduled as a task graph on the workers
+            scene->tick(*pool, deltaTime, packetBuffer, m_frameIndex);
         }
         else
         {
-            // Fallback: manual packet preparation
-            RenderPacket* packet = packetBuffer->acquireForWrite();
-            if (packet)
-            {
-                prepareRenderPacket(packet);
-                packetBuffer->releaseWrite();
-            }
+            scene->update(deltaTime);
+            scene->prepareForRendering(packetBuffer, m_frameIndex);
+        }
+    }
+    else if (packetBuffer)
+    {
+        // Fallback: manual packet preparation
+        RenderPacket* packet = packetBuffer->acquireForWrite();
+        if (packet)
+        {
+            prepareRenderPacket(packet);
+            packetBuffer->releaseWrite();
         }
     }
 
@@ -310,61 +383,54 @@ void VesperEngine::renderThreadLoop()
 
     LOG_INFO("Render thread: Starting loop");
 
-    // Backoff state for when no work is available
-    uint32_t idleCount = 0;
-    constexpr uint32_t kSpinBeforeYield = 16;
-    constexpr uint32_t kYieldBeforeSleep = 32;
-    constexpr uint32_t kMaxSleepUs = 1000;
+    WorkerPool* pool = getWorkerPool();
+    uint64_t lastConsumedNs = 0;
 
     while (m_renderThreadRunning.load(std::memory_order_acquire))
     {
-        bool didWork = renderTick();
-
-        if (didWork)
+        // Sleep until logic publishes a frame; RenderOnly tasks (uploads, coroutine hops)
+        // are run as soon as they are queued
+        const FramePacer::WaitResult wait = m_framePacer->waitForFrame([pool]() {
+            return pool && pool->hasPendingTasks(TaskAffinity::RenderOnly);
+        });
+        if (wait == FramePacer::WaitResult::Stopped)
         {
-            idleCount = 0;
+            break;
         }
-        else
+        if (wait == FramePacer::WaitResult::Interrupted)
         {
-            ++idleCount;
-
-            if (idleCount < kSpinBeforeYield)
-            {
-                // Spin-wait briefly
-                std::atomic_signal_fence(std::memory_order_seq_cst);
-            }
-            else if (idleCount < kSpinBeforeYield + kYieldBeforeSleep)
-            {
-                std::this_thread::yield();
-            }
-            else
-            {
-                // Sleep with capped backoff
-                uint32_t sleepUs = std::min(
-                    1U << (idleCount - kSpinBeforeYield - kYieldBeforeSleep),
-                    kMaxSleepUs
-                );
-                std::this_thread::sleep_for(std::chrono::microseconds(sleepUs));
-            }
+            pool->processAllRenderTasks();
+            continue;
         }
+
+        m_framePacer->beginRenderFrame();
+        renderTick();
+        const FramePacer::FrameLatency latency = m_framePacer->endRenderFrame();
+
+        publishFrameTiming(getEventBus(), latency, lastConsumedNs);
+        lastConsumedNs = latency.consumedNs;
     }
 
     LOG_INFO("Render thread: Exiting loop");
 }
 
-bool VesperEngine::renderTick()
+void VesperEngine::renderTick()
 {
-    bool didWork = false;
+    static const TaskNameId kRenderTickName = internTaskName("Engine.RenderTick");
+    ProfileScope profileScope(kRenderTickName);
 
     // Process all pending RenderOnly tasks first
     // These are tasks that must run on the render thread (GPU operations, resource management)
     if (auto* pool = getWorkerPool())
     {
-        didWork = pool->processAllRenderTasks() > 0;
+        pool->processAllRenderTasks();
     }
 
-    // Execute RenderSystem tick (GPU work)
+    // Apply the newest render packet to the render scene before drawing
     auto* renderSystem = g_runtime_global_context.m_render_system.get();
+    applyLatestRenderPacket(renderSystem);
+
+    // Execute RenderSystem tick (GPU work)
     if (renderSystem && renderSystem->isInitialized())
     {
         // Calculate delta time for render system
@@ -374,38 +440,15 @@ bool VesperEngine::renderTick()
         lastRenderTime = now;
 
         renderSystem->tick(deltaTime);
-        didWork = true;
-    }
-
-    auto* packetBuffer = g_runtime_global_context.m_render_packet_buffer.get();
-    if (!packetBuffer)
-    {
-        return didWork;
     }
-
-    // Try to acquire a render packet
-    RenderPacket* packet = packetBuffer->acquireForRead();
-    if (!packet)
-    {
-        // No packet available
-        return didWork;
-    }
-
-    // TODO: Process render packet
-    // - Setup camera from packet->camera
-    // - Render visible objects from packet->visibleObjects
-    // - Process object updates (add/update/delete)
-    // - Handle resource loading requests
-
-    // Release the packet
-    packetBuffer->releaseRead();
-
-    return true;  // We did work (processed a packet)
 }
 
 void VesperEngine::tick()
 {
     // Single-threaded fallback - combines logic and render
+    static const TaskNameId kTickName = internTaskName("Engine.Tick");
+    ProfileScope profileScope(kTickName);
+
     auto now = std::chrono::steady_clock::now();
     float deltaTime = std::chrono::duration<float>(now - m_lastFrameTime).count();
     m_lastFrameTime = now;
@@ -431,10 +474,26 @@ void VesperEngine::tick()
 
     // Update active scene
     auto* scene = g_runtime_global_context.m_active_scene.get();
+    auto* packetBuffer = g_runtime_global_context.m_render_packet_buffer.get();
+    updatePhysics(scene, deltaTime);
     if (scene)
     {
+        scene->setCpuCulling(!(renderSystem && renderSystem->isInitialized() && renderSystem->isGpuCullingActive()));
         scene->update(deltaTime);
+        scene->prepareForRendering(packetBuffer, m_frameIndex);
     }
+    else if (packetBuffer)
+    {
+        RenderPacket* packet = packetBuffer->acquireForWrite();
+        if (packet)
+        {
+            prepareRenderPacket(packet);
+            packetBuffer->releaseWrite();
+        }
+    }
+
+    // Scene objects reach the GPU only through the render packet: consume it right away
+    applyLatestRenderPacket(renderSystem);
 
     // Render frame
     if (renderSystem && renderSystem->isInitialized())
@@ -445,6 +504,47 @@ void VesperEngine::tick()
     ++m_frameIndex;
 }
 
+void VesperEngine::applyLatestRenderPacket(RenderSystem* renderSystem)
+{
+    auto* packetBuffer = g_runtime_global_context.m_render_packet_buffer.get();
+    if (!packetBuffer)
+    {
+        return;
+    }
+
+    if (RenderPacket* packet = packetBuffer->acquireForRead())
+    {
+        if (renderSystem)
+        {
+            renderSystem->applyRenderPacket(*packet);
+        }
+
+        // TODO: Process the rest of the render packet
+        // - Setup camera from packet->camera
+        // - Handle resource loading requests
+
+        packetBuffer->releaseRead();
+    }
+}
+
+void VesperEngine::updatePhysics(Scene* scene, float deltaTime)
+{
+    auto* physics = g_runtime_global_context.m_physics_manager.get();
+    if (!physics)
+    {
+        return;
+    }
+
+    // Raycasts are answered from the scene's BVH, so a newly activated scene attaches itself
+    PhysicsScene* physicsScene = physics->getPhysicsScene();
+    if (scene && physicsScene && scene->getPhysicsScene() != physicsScene)
+    {
+        scene->setPhysicsScene(physicsScene);
+    }
+
+    physics->tick(deltaTime);
+}
+
 void VesperEngine::prepareRenderPacket(RenderPacket* packet)
 {
     // Fill render packet with current frame data
@@ -474,6 +574,10 @@ void VesperEngine::shutdown()
     // 1. Stop running (signals threads to exit)
     m_running.store(false, std::memory_order_release);
     m_renderThreadRunning.store(false, std::memory_order_release);
+    if (m_framePacer)
+    {
+        m_framePacer->stop();
+    }
 
     // 2. Wait for render thread to finish
     if (m_renderThread && m_renderThread->joinable())
@@ -482,6 +586,19 @@ void VesperEngine::shutdown()
     }
     m_renderThread.reset();
 
+    if (!m_taskTracePath.empty())
+    {
+        TaskProfiler::setEnabled(false);
+        if (TaskProfiler::dumpChromeTrace(m_taskTracePath))
+        {
+            LOG_INFO("Task trace written to {}", m_taskTracePath);
+        }
+        else
+        {
+            LOG_ERROR("Failed to write task trace to {}", m_taskTracePath);
+        }
+    }
+
     // 3. Clear active scene
     g_runtime_global_context.m_active_scene.reset();
 
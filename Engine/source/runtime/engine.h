@@ -16,7 +16,10 @@ namespace vesper
     class WorkerPool;
     class EventBus;
     class RenderPacketBuffer;
+    class FramePacer;
     struct RenderPacket;
+    class Scene;
+    class RenderSystem;
 
     /// @brief Engine initialization configuration
     struct EngineConfig {
@@ -27,6 +30,8 @@ namespace vesper
         bool resizable{true};
         uint32_t workerThreadCount{0}; // 0 = auto-detect
         bool enableMultithreading{true};
+        uint32_t logicFramesAhead{1};  // Frames logic may run ahead of render (0 = lockstep, max 2)
+        std::string taskTracePath{}; // Non-empty: record tasks and frame phases, write a Chrome trace here on shutdown
     };
 
     /// @brief Core engine class managing all subsystems
@@ -79,27 +84,37 @@ namespace vesper
         /// @brief Render thread main loop
         void renderThreadLoop();
 
-        /// @brief Render thread tick - consumes RenderPackets
-        /// @return true if work was performed (packet processed or tasks run)
-        bool renderTick();
+        /// @brief Render thread tick - runs RenderOnly tasks and consumes the latest RenderPacket
+        void renderTick();
 
         /// @brief Process one frame (single-threaded fallback)
         void tick();
 
+        /// @brief Attach the active scene to the physics scene if needed, then step physics
+        void updatePhysics(Scene *scene, float deltaTime);
+
         /// @brief Prepare render packet from current game state
         void prepareRenderPacket(RenderPacket *packet);
 
+        /// @brief Apply the newest published render packet to the render scene
+        void applyLatestRenderPacket(RenderSystem *renderSystem);
+
     private:
         std::unique_ptr<WindowSystem> m_windowSystem;
         std::unique_ptr<InputSystem> m_inputSystem;
 
         // Threading systems (managed via GlobalContext)
         std::unique_ptr<std::thread> m_renderThread;
+        std::unique_ptr<FramePacer> m_framePacer;   // Logic/render pipelining (multithreaded mode)
+        uint32_t m_logicFramesAhead{1};
 
         // Frame timing
         uint64_t m_frameIndex{0};
         std::chrono::steady_clock::time_point m_lastFrameTime;
 
+        // Task profiler output (empty = profiling off)
+        std::string m_taskTracePath;
+
         // State flags
         std::atomic<bool> m_running{false};
         std::atomic<bool> m_renderThreadRunning{false};
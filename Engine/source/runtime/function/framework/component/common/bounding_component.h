@@ -41,6 +41,16 @@ struct BoundingComponent
     /// @brief Local AABB maximum corner
     Vector3 aabbMax{0.5f, 0.5f, 0.5f};
 
+    // =========================================================================
+    // Cached World Space AABB (updated by system)
+    // =========================================================================
+
+    /// @brief World AABB minimum corner (encloses the transformed local AABB)
+    Vector3 worldAabbMin{-0.5f, -0.5f, -0.5f};
+
+    /// @brief World AABB maximum corner
+    Vector3 worldAabbMax{0.5f, 0.5f, 0.5f};
+
     // =========================================================================
     // Initialization Helpers
     // =========================================================================
@@ -69,21 +79,34 @@ struct BoundingComponent
     }
 
     /// @brief Update world bounds from transform
+    /// Computes the world sphere and the world AABB in one pass over the matrix rows. The AABB
+    /// uses Arvo's method: the transformed box center plus the local half extents projected
+    /// through the absolute rotation-scale rows, i.e. the tightest box around the rotated box.
     /// @param worldMatrix The entity's world transform matrix
     void updateWorldBounds(const Matrix4x4& worldMatrix)
     {
-        // Transform center to world space
-        Vector4 worldCenterH = worldMatrix.transform(Vector4(localCenter.x, localCenter.y, localCenter.z, 1.0f));
-        worldCenter = Vector3(worldCenterH.x, worldCenterH.y, worldCenterH.z);
-
-        // Compute approximate world radius (using max scale)
-        // Extract scale from matrix (approximate - assumes no shear)
-        float scaleX = Vector3(worldMatrix[0][0], worldMatrix[0][1], worldMatrix[0][2]).length();
-        float scaleY = Vector3(worldMatrix[1][0], worldMatrix[1][1], worldMatrix[1][2]).length();
-        float scaleZ = Vector3(worldMatrix[2][0], worldMatrix[2][1], worldMatrix[2][2]).length();
-        float maxScale = std::max({scaleX, scaleY, scaleZ});
-
-        worldRadius = localRadius * maxScale;
+        using namespace DirectX;
+
+        const XMMATRIX matrix = worldMatrix.toXMMatrix();
+
+        // Sphere: transformed center, radius scaled by the largest axis scale (assumes no shear)
+        worldCenter = Vector3::fromXMVector(XMVector3Transform(localCenter.toXMVector(), matrix));
+        const XMVECTOR maxScaleSq = XMVectorMax(XMVector3LengthSq(matrix.r[0]),
+                                                XMVectorMax(XMVector3LengthSq(matrix.r[1]), XMVector3LengthSq(matrix.r[2])));
+        worldRadius = localRadius * XMVectorGetX(XMVectorSqrt(maxScaleSq));
+
+        // AABB (Arvo)
+        const XMVECTOR localMin = aabbMin.toXMVector();
+        const XMVECTOR localMax = aabbMax.toXMVector();
+        const XMVECTOR halfExtent = XMVectorScale(XMVectorSubtract(localMax, localMin), 0.5f);
+        const XMVECTOR boxCenter = XMVector3Transform(XMVectorScale(XMVectorAdd(localMin, localMax), 0.5f), matrix);
+
+        XMVECTOR worldHalfExtent = XMVectorMultiply(XMVectorSplatX(halfExtent), XMVectorAbs(matrix.r[0]));
+        worldHalfExtent = XMVectorMultiplyAdd(XMVectorSplatY(halfExtent), XMVectorAbs(matrix.r[1]), worldHalfExtent);
+        worldHalfExtent = XMVectorMultiplyAdd(XMVectorSplatZ(halfExtent), XMVectorAbs(matrix.r[2]), worldHalfExtent);
+
+        worldAabbMin = Vector3::fromXMVector(XMVectorSubtract(boxCenter, worldHalfExtent));
+        worldAabbMax = Vector3::fromXMVector(XMVectorAdd(boxCenter, worldHalfExtent));
     }
 };
 
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "runtime/function/render/mesh.h"
+#include "runtime/function/render/material.h"
+#include "runtime/function/render/model.h"
+
+#include <memory>
+#include <cstdint>
+
+namespace vesper {
+
+/// @brief Render resource component - direct mesh, material and model references of a renderable
+/// The cold half of RenderableComponent: only read where the resources themselves are used, never
+/// while culling or filling render packets.
+struct RenderResourceComponent
+{
+    // =========================================================================
+    // Resource References
+    // =========================================================================
+
+    /// @brief Direct mesh reference (alternative to RenderableComponent::meshId)
+    std::shared_ptr<Mesh> mesh;
+
+    /// @brief Direct material reference (alternative to RenderableComponent::materialId)
+    MaterialPtr material;
+
+    /// @brief Optional model reference (for multi-submesh models)
+    std::shared_ptr<Model> model;
+
+    /// @brief Submesh index within model (if using model)
+    uint32_t submeshIndex{0};
+
+    // =========================================================================
+    // Validation
+    // =========================================================================
+
+    /// @brief Check if the referenced resources are loaded
+    bool isValid() const
+    {
+        // Valid if has direct mesh reference
+        if (mesh && mesh->isValid())
+        {
+            return true;
+        }
+
+        // Valid if has model with submeshes
+        if (model && model->isValid() && submeshIndex < model->getSubMeshCount())
+        {
+            return true;
+        }
+
+        return false;
+    }
+
+    /// @brief Get the mesh to render (resolves model submesh if needed)
+    std::shared_ptr<Mesh> getActiveMesh() const
+    {
+        if (mesh)
+        {
+            return mesh;
+        }
+
+        if (model && submeshIndex < model->getSubMeshCount())
+        {
+            return model->getSubMesh(submeshIndex).mesh;
+        }
+
+        return nullptr;
+    }
+
+    /// @brief Get the material to use (resolves model submesh if needed)
+    MaterialPtr getActiveMaterial() const
+    {
+        if (material)
+        {
+            return material;
+        }
+
+        if (model && submeshIndex < model->getSubMeshCount())
+        {
+            return model->getSubMesh(submeshIndex).material;
+        }
+
+        return nullptr;
+    }
+};
+
+} // namespace vesper
@@ -1,15 +1,13 @@
 #pragma once
 
-#include "runtime/function/render/mesh.h"
-#include "runtime/function/render/material.h"
-#include "runtime/function/render/model.h"
-
-#include <memory>
 #include <cstdint>
 
 namespace vesper {
 
-/// @brief Renderable component - associates mesh and material for rendering
+/// @brief Renderable component - what the render path reads for every entity, every frame
+/// A small POD: World packs it with BoundingComponent in its render group (see
+/// World::renderGroup), so culling and packet fills stream both arrays in lockstep. The resource
+/// references of the entity live in the cold RenderResourceComponent.
 struct RenderableComponent
 {
     // =========================================================================
@@ -22,17 +20,15 @@ struct RenderableComponent
     /// @brief Material resource ID (for resource manager lookup)
     uint32_t materialId{0};
 
-    /// @brief Direct mesh reference (alternative to ID)
-    std::shared_ptr<Mesh> mesh;
-
-    /// @brief Direct material reference (alternative to ID)
-    MaterialPtr material;
+    // =========================================================================
+    // Sorting and Layering
+    // =========================================================================
 
-    /// @brief Optional model reference (for multi-submesh models)
-    std::shared_ptr<Model> model;
+    /// @brief Render layer (for grouping/filtering)
+    uint32_t renderLayer{0};
 
-    /// @brief Submesh index within model (if using model)
-    uint32_t submeshIndex{0};
+    /// @brief Sort order within layer (lower = render first)
+    int32_t sortOrder{0};
 
     // =========================================================================
     // Rendering Flags
@@ -47,75 +43,22 @@ struct RenderableComponent
     /// @brief Whether this entity receives shadows
     bool receiveShadow{true};
 
-    // =========================================================================
-    // Sorting and Layering
-    // =========================================================================
-
-    /// @brief Render layer (for grouping/filtering)
-    uint32_t renderLayer{0};
-
-    /// @brief Sort order within layer (lower = render first)
-    int32_t sortOrder{0};
+    /// @brief Whether the entity has a RenderResourceComponent (kept in sync by World)
+    bool hasResources{false};
 
     // =========================================================================
     // Validation
     // =========================================================================
 
-    /// @brief Check if this component has valid rendering resources
+    /// @brief Check if this component names something to render
+    /// Either a mesh ID (resolved by the resource manager) or direct references, whose loading
+    /// state is checked by RenderResourceComponent::isValid() where the resources are used.
     bool isValid() const
     {
-        // Valid if has direct mesh reference
-        if (mesh && mesh->isValid())
-        {
-            return true;
-        }
-
-        // Valid if has model with submeshes
-        if (model && model->isValid() && submeshIndex < model->getSubMeshCount())
-        {
-            return true;
-        }
-
-        // Valid if has mesh ID (will be resolved by resource manager)
-        if (meshId != 0)
-        {
-            return true;
-        }
-
-        return false;
-    }
-
-    /// @brief Get the mesh to render (resolves model submesh if needed)
-    std::shared_ptr<Mesh> getActiveMesh() const
-    {
-        if (mesh)
-        {
-            return mesh;
-        }
-
-        if (model && submeshIndex < model->getSubMeshCount())
-        {
-            return model->getSubMesh(submeshIndex).mesh;
-        }
-
-        return nullptr;
-    }
-
-    /// @brief Get the material to use (resolves model submesh if needed)
-    MaterialPtr getActiveMaterial() const
-    {
-        if (material)
-        {
-            return material;
-        }
-
-        if (model && submeshIndex < model->getSubMeshCount())
-        {
-            return model->getSubMesh(submeshIndex).material;
-        }
-
-        return nullptr;
+        return meshId != 0 || hasResources;
     }
 };
 
+static_assert(sizeof(RenderableComponent) == 20, "RenderableComponent is streamed every frame: keep it small");
+
 } // namespace vesper
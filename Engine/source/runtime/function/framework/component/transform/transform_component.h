@@ -8,6 +8,10 @@
 namespace vesper {
 
 /// @brief Transform component - stores local and world space transforms
+/// Edit through World::patchComponent() (or registry patch/replace) so the change is tracked:
+/// only patched transforms and their descendants are recomputed by World::updateTransforms().
+/// World::getComponent() returns it const, so the setters below are reached from a patch
+/// function or on a freshly added component.
 struct TransformComponent
 {
     // =========================================================================
@@ -22,38 +26,31 @@ struct TransformComponent
     // Cached World Space Transform
     // =========================================================================
 
-    /// @brief World matrix (updated by TransformSystem)
+    /// @brief World matrix (updated by World::updateTransforms)
     Matrix4x4 worldMatrix;
 
-    /// @brief Dirty flag - set to true when local transform changes
-    bool dirty{true};
-
     // =========================================================================
-    // Convenience Setters (auto-mark dirty)
+    // Convenience Setters
     // =========================================================================
 
     void setPosition(const Vector3& pos)
     {
         localPosition = pos;
-        dirty = true;
     }
 
     void setRotation(const Quaternion& rot)
     {
         localRotation = rot;
-        dirty = true;
     }
 
     void setScale(const Vector3& scale)
     {
         localScale = scale;
-        dirty = true;
     }
 
     void setScale(float uniformScale)
     {
         localScale = Vector3(uniformScale, uniformScale, uniformScale);
-        dirty = true;
     }
 
     void setTransform(const Vector3& pos, const Quaternion& rot, const Vector3& scale)
@@ -61,7 +58,6 @@ struct TransformComponent
         localPosition = pos;
         localRotation = rot;
         localScale = scale;
-        dirty = true;
     }
 
     // =========================================================================
@@ -79,12 +75,6 @@ struct TransformComponent
         // TRS = T * R * S (right-to-left application)
         return scaleMatrix * rotationMatrix * translationMatrix;
     }
-
-    /// @brief Mark as needing update
-    void markDirty() { dirty = true; }
-
-    /// @brief Clear dirty flag (called after update)
-    void clearDirty() { dirty = false; }
 };
 
 /// @brief Hierarchy component - parent-child relationships
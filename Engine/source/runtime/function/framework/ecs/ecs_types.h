@@ -44,6 +44,30 @@ inline Entity idToEntity(uint32_t id)
     return static_cast<Entity>(id);
 }
 
+// ===========================================================================
+// Change Tracking
+// ===========================================================================
+
+/// @brief Set of entities that changed since it was last consumed
+/// Fed by registry signals (on_construct/on_update, i.e. emplace/patch/replace) and by
+/// the systems that propagate changes; the consumer clears it.
+using ChangeSet = entt::storage_for_t<entt::reactive>;
+
+/// @brief Local TransformComponent edits and hierarchy links (consumed by World::updateTransforms)
+constexpr EntityId kTransformChangeSet = entt::hashed_string::value("vesper.changes.transform");
+
+/// @brief Entities whose world bounds must be recomputed (consumed by World::updateBounds)
+constexpr EntityId kBoundsChangeSet = entt::hashed_string::value("vesper.changes.bounds");
+
+/// @brief Entities whose render description changed (consumed when filling RenderPacket::objectsToUpdate)
+constexpr EntityId kRenderChangeSet = entt::hashed_string::value("vesper.changes.render");
+
+/// @brief Get one of the change sets above (an unconnected, empty set if World did not create it)
+inline ChangeSet& changeSet(EntityRegistry& registry, EntityId id)
+{
+    return registry.storage<entt::reactive>(id);
+}
+
 // ===========================================================================
 // Name Component (optional, for debugging)
 // ===========================================================================
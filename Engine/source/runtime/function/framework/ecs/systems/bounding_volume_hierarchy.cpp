@@ -0,0 +1,663 @@
+#include "runtime/function/framework/ecs/systems/bounding_volume_hierarchy.h"
+#include "runtime/function/framework/component/common/bounding_component.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vesper {
+
+namespace {
+
+constexpr uint32_t kFreeHeight = UINT32_MAX;
+
+/// @brief Traversal stack entry: node and the frustum planes its box still straddles
+struct FrustumStackEntry
+{
+    uint32_t node;
+    uint32_t planeMask;
+};
+
+constexpr uint32_t kAllPlanes = (1u << Frustum::kPlaneCount) - 1;
+
+/// @brief Traversal scratch of the queries on this thread (reused to avoid per-query allocation)
+thread_local std::vector<uint32_t> t_nodeStack;
+thread_local std::vector<FrustumStackEntry> t_frustumStack;
+
+Vector3 minVector(const Vector3& a, const Vector3& b)
+{
+    return Vector3(std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z));
+}
+
+Vector3 maxVector(const Vector3& a, const Vector3& b)
+{
+    return Vector3(std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z));
+}
+
+/// @brief Half the surface area of a box (the insertion cost metric)
+float halfArea(const Vector3& min, const Vector3& max)
+{
+    const Vector3 extent = max - min;
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+bool containsBox(const Vector3& outerMin, const Vector3& outerMax, const Vector3& innerMin, const Vector3& innerMax)
+{
+    return outerMin.x <= innerMin.x && outerMin.y <= innerMin.y && outerMin.z <= innerMin.z &&
+           innerMax.x <= outerMax.x && innerMax.y <= outerMax.y && innerMax.z <= outerMax.z;
+}
+
+bool overlapsBox(const Vector3& aMin, const Vector3& aMax, const Vector3& bMin, const Vector3& bMax)
+{
+    return aMin.x <= bMax.x && bMin.x <= aMax.x &&
+           aMin.y <= bMax.y && bMin.y <= aMax.y &&
+           aMin.z <= bMax.z && bMin.z <= aMax.z;
+}
+
+/// @brief Squared distance from a point to a box (0 inside)
+float squaredDistanceToBox(const Vector3& point, const Vector3& min, const Vector3& max)
+{
+    const Vector3 closest = Vector3::clamp(point, min, max);
+    return (point - closest).squaredLength();
+}
+
+/// @brief Entry distance of a ray into a box, or a negative value on a miss
+float rayBoxEntry(const Vector3& origin, const Vector3& invDirection, float maxDistance, const Vector3& min, const Vector3& max)
+{
+    float entry = 0.0f;
+    float exit = maxDistance;
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        float t0 = (min[axis] - origin[axis]) * invDirection[axis];
+        float t1 = (max[axis] - origin[axis]) * invDirection[axis];
+        if (t0 > t1)
+        {
+            std::swap(t0, t1);
+        }
+        entry = std::max(entry, t0);
+        exit = std::min(exit, t1);
+        if (entry > exit)
+        {
+            return -1.0f;
+        }
+    }
+    return entry;
+}
+
+} // namespace
+
+// =============================================================================
+// Leaf Management
+// =============================================================================
+
+void BoundingVolumeHierarchy::insert(Entity entity, const Vector3& center, float radius)
+{
+    if (contains(entity))
+    {
+        return;
+    }
+
+    const uint32_t leaf = allocateNode();
+    Node& node = m_nodes[leaf];
+    node.entity = entity;
+    node.center = center;
+    node.radius = radius;
+    node.height = 0;
+
+    const float margin = std::max(radius * kFatMarginScale, kMinFatMargin);
+    const Vector3 extent(radius + margin, radius + margin, radius + margin);
+    node.min = center - extent;
+    node.max = center + extent;
+
+    const size_t index = static_cast<size_t>(entt::to_entity(entity));
+    if (index >= m_leafOfEntity.size())
+    {
+        m_leafOfEntity.resize(index + 1, kNullNode);
+    }
+    m_leafOfEntity[index] = leaf;
+
+    insertLeaf(leaf);
+    ++m_leafCount;
+}
+
+void BoundingVolumeHierarchy::remove(Entity entity)
+{
+    const uint32_t leaf = leafOf(entity);
+    if (leaf == kNullNode)
+    {
+        return;
+    }
+
+    removeLeaf(leaf);
+    freeNode(leaf);
+    m_leafOfEntity[static_cast<size_t>(entt::to_entity(entity))] = kNullNode;
+    --m_leafCount;
+}
+
+bool BoundingVolumeHierarchy::update(Entity entity, const Vector3& center, float radius)
+{
+    const uint32_t leaf = leafOf(entity);
+    if (leaf == kNullNode)
+    {
+        return false;
+    }
+
+    Node& node = m_nodes[leaf];
+    node.center = center;
+    node.radius = radius;
+
+    const Vector3 extent(radius, radius, radius);
+    if (containsBox(node.min, node.max, center - extent, center + extent))
+    {
+        return false;
+    }
+
+    removeLeaf(leaf);
+
+    const float margin = std::max(radius * kFatMarginScale, kMinFatMargin);
+    const Vector3 fatExtent(radius + margin, radius + margin, radius + margin);
+    m_nodes[leaf].min = center - fatExtent;
+    m_nodes[leaf].max = center + fatExtent;
+
+    insertLeaf(leaf);
+    return true;
+}
+
+bool BoundingVolumeHierarchy::contains(Entity entity) const
+{
+    return leafOf(entity) != kNullNode;
+}
+
+uint32_t BoundingVolumeHierarchy::height() const
+{
+    return m_root == kNullNode ? 0 : m_nodes[m_root].height + 1;
+}
+
+uint32_t BoundingVolumeHierarchy::leafOf(Entity entity) const
+{
+    const size_t index = static_cast<size_t>(entt::to_entity(entity));
+    if (index >= m_leafOfEntity.size())
+    {
+        return kNullNode;
+    }
+
+    const uint32_t leaf = m_leafOfEntity[index];
+    return (leaf != kNullNode && m_nodes[leaf].entity == entity) ? leaf : kNullNode;
+}
+
+// =============================================================================
+// Tree Maintenance
+// =============================================================================
+
+uint32_t BoundingVolumeHierarchy::allocateNode()
+{
+    if (m_freeList == kNullNode)
+    {
+        m_nodes.emplace_back();
+        return static_cast<uint32_t>(m_nodes.size() - 1);
+    }
+
+    const uint32_t node = m_freeList;
+    m_freeList = m_nodes[node].parent;
+    m_nodes[node] = Node{};
+    return node;
+}
+
+void BoundingVolumeHierarchy::freeNode(uint32_t node)
+{
+    m_nodes[node].entity = NullEntity;
+    m_nodes[node].height = kFreeHeight;
+    m_nodes[node].parent = m_freeList;
+    m_freeList = node;
+}
+
+void BoundingVolumeHierarchy::insertLeaf(uint32_t leaf)
+{
+    if (m_root == kNullNode)
+    {
+        m_root = leaf;
+        m_nodes[leaf].parent = kNullNode;
+        return;
+    }
+
+    // Walk down towards the sibling whose box grows the least (surface area heuristic)
+    const Vector3 leafMin = m_nodes[leaf].min;
+    const Vector3 leafMax = m_nodes[leaf].max;
+    uint32_t sibling = m_root;
+    while (!m_nodes[sibling].isLeaf())
+    {
+        const Node& node = m_nodes[sibling];
+        const float area = halfArea(node.min, node.max);
+        const float combinedArea = halfArea(minVector(node.min, leafMin), maxVector(node.max, leafMax));
+
+        // Pairing with this node creates a parent of combinedArea; descending grows this node anyway
+        const float cost = 2.0f * combinedArea;
+        const float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto childCost = [&](uint32_t child) {
+            const Node& childNode = m_nodes[child];
+            const float grownArea = halfArea(minVector(childNode.min, leafMin), maxVector(childNode.max, leafMax));
+            return childNode.isLeaf() ? grownArea + inheritanceCost
+                                      : grownArea - halfArea(childNode.min, childNode.max) + inheritanceCost;
+        };
+
+        const float leftCost = childCost(node.left);
+        const float rightCost = childCost(node.right);
+        if (cost < leftCost && cost < rightCost)
+        {
+            break;
+        }
+        sibling = leftCost < rightCost ? node.left : node.right;
+    }
+
+    // New parent takes the sibling's place
+    const uint32_t oldParent = m_nodes[sibling].parent;
+    const uint32_t newParent = allocateNode();
+    Node& parentNode = m_nodes[newParent];
+    parentNode.parent = oldParent;
+    parentNode.min = minVector(m_nodes[sibling].min, leafMin);
+    parentNode.max = maxVector(m_nodes[sibling].max, leafMax);
+    parentNode.height = m_nodes[sibling].height + 1;
+    parentNode.left = sibling;
+    parentNode.right = leaf;
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    if (oldParent == kNullNode)
+    {
+        m_root = newParent;
+    }
+    else if (m_nodes[oldParent].left == sibling)
+    {
+        m_nodes[oldParent].left = newParent;
+    }
+    else
+    {
+        m_nodes[oldParent].right = newParent;
+    }
+
+    refitAncestors(newParent);
+}
+
+void BoundingVolumeHierarchy::removeLeaf(uint32_t leaf)
+{
+    if (leaf == m_root)
+    {
+        m_root = kNullNode;
+        return;
+    }
+
+    // The sibling takes the parent's place
+    const uint32_t parent = m_nodes[leaf].parent;
+    const uint32_t grandParent = m_nodes[parent].parent;
+    const uint32_t sibling = m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+
+    m_nodes[sibling].parent = grandParent;
+    freeNode(parent);
+
+    if (grandParent == kNullNode)
+    {
+        m_root = sibling;
+        return;
+    }
+
+    if (m_nodes[grandParent].left == parent)
+    {
+        m_nodes[grandParent].left = sibling;
+    }
+    else
+    {
+        m_nodes[grandParent].right = sibling;
+    }
+    refitAncestors(grandParent);
+}
+
+void BoundingVolumeHierarchy::refitAncestors(uint32_t node)
+{
+    while (node != kNullNode)
+    {
+        node = balance(node);
+
+        Node& current = m_nodes[node];
+        const Node& left = m_nodes[current.left];
+        const Node& right = m_nodes[current.right];
+        current.min = minVector(left.min, right.min);
+        current.max = maxVector(left.max, right.max);
+        current.height = 1 + std::max(left.height, right.height);
+
+        node = current.parent;
+    }
+}
+
+uint32_t BoundingVolumeHierarchy::balance(uint32_t a)
+{
+    Node& nodeA = m_nodes[a];
+    if (nodeA.isLeaf() || nodeA.height < 2)
+    {
+        return a;
+    }
+
+    const uint32_t b = nodeA.left;
+    const uint32_t c = nodeA.right;
+    Node& nodeB = m_nodes[b];
+    Node& nodeC = m_nodes[c];
+    const int heightDifference = static_cast<int>(nodeC.height) - static_cast<int>(nodeB.height);
+
+    // Rotate 'up' (C or B) into A's place; A keeps the other child and the lower grandchild
+    auto rotateUp = [&](uint32_t up, Node& nodeUp, uint32_t& aChildSlot) {
+        const uint32_t f = nodeUp.left;
+        const uint32_t g = nodeUp.right;
+        Node& nodeF = m_nodes[f];
+        Node& nodeG = m_nodes[g];
+
+        nodeUp.left = a;
+        nodeUp.parent = nodeA.parent;
+        nodeA.parent = up;
+
+        if (nodeUp.parent == kNullNode)
+        {
+            m_root = up;
+        }
+        else if (m_nodes[nodeUp.parent].left == a)
+        {
+            m_nodes[nodeUp.parent].left = up;
+        }
+        else
+        {
+            m_nodes[nodeUp.parent].right = up;
+        }
+
+        const uint32_t kept = nodeF.height > nodeG.height ? f : g;
+        const uint32_t moved = kept == f ? g : f;
+        Node& nodeKept = m_nodes[kept];
+        Node& nodeMoved = m_nodes[moved];
+
+        nodeUp.right = kept;
+        aChildSlot = moved;
+        nodeMoved.parent = a;
+
+        const Node& nodeOther = m_nodes[nodeA.left == moved ? nodeA.right : nodeA.left];
+        nodeA.min = minVector(nodeOther.min, nodeMoved.min);
+        nodeA.max = maxVector(nodeOther.max, nodeMoved.max);
+        nodeA.height = 1 + std::max(nodeOther.height, nodeMoved.height);
+
+        nodeUp.min = minVector(nodeA.min, nodeKept.min);
+        nodeUp.max = maxVector(nodeA.max, nodeKept.max);
+        nodeUp.height = 1 + std::max(nodeA.height, nodeKept.height);
+        return up;
+    };
+
+    if (heightDifference > 1)
+    {
+        return rotateUp(c, nodeC, nodeA.right);
+    }
+    if (heightDifference < -1)
+    {
+        return rotateUp(b, nodeB, nodeA.left);
+    }
+    return a;
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+size_t BoundingVolumeHierarchy::queryFrustum(const Frustum& frustum, std::vector<Entity>& outEntities, size_t maxEntities) const
+{
+    const size_t firstOutput = outEntities.size();
+    if (m_root == kNullNode)
+    {
+        return 0;
+    }
+
+    // Output size at which the query gives up (maxEntities + 1 appended)
+    const size_t sizeLimit = maxEntities < SIZE_MAX - firstOutput ? firstOutput + maxEntities + 1 : SIZE_MAX;
+
+    std::vector<FrustumStackEntry>& stack = t_frustumStack;
+    stack.clear();
+    stack.push_back({m_root, kAllPlanes});
+
+    while (!stack.empty() && outEntities.size() < sizeLimit)
+    {
+        const auto [index, parentMask] = stack.back();
+        stack.pop_back();
+        const Node& node = m_nodes[index];
+
+        // Planes the parent box was fully inside are skipped: the child box is inside them too
+        uint32_t planeMask = parentMask;
+        bool outside = false;
+        for (int i = 0; i < Frustum::kPlaneCount && !outside; ++i)
+        {
+            const uint32_t bit = 1u << i;
+            if (!(planeMask & bit))
+            {
+                continue;
+            }
+
+            const FrustumPlane& plane = frustum.planes[i];
+            if (node.isLeaf())
+            {
+                // Leaves use the exact sphere, as Frustum::testSphere
+                outside = plane.signedDistance(node.center) < -node.radius;
+                continue;
+            }
+
+            const Vector3 positive(plane.normal.x >= 0.0f ? node.max.x : node.min.x,
+                                   plane.normal.y >= 0.0f ? node.max.y : node.min.y,
+                                   plane.normal.z >= 0.0f ? node.max.z : node.min.z);
+            const Vector3 negative(plane.normal.x >= 0.0f ? node.min.x : node.max.x,
+                                   plane.normal.y >= 0.0f ? node.min.y : node.max.y,
+                                   plane.normal.z >= 0.0f ? node.min.z : node.max.z);
+            if (plane.signedDistance(positive) < 0.0f)
+            {
+                outside = true;
+            }
+            else if (plane.signedDistance(negative) >= 0.0f)
+            {
+                planeMask &= ~bit;
+            }
+        }
+
+        if (outside)
+        {
+            continue;
+        }
+
+        if (node.isLeaf())
+        {
+            outEntities.push_back(node.entity);
+        }
+        else if (planeMask == 0)
+        {
+            // Box inside every plane: the whole subtree is visible
+            collectLeaves(index, outEntities, sizeLimit);
+        }
+        else
+        {
+            stack.push_back({node.right, planeMask});
+            stack.push_back({node.left, planeMask});
+        }
+    }
+
+    return outEntities.size() - firstOutput;
+}
+
+size_t BoundingVolumeHierarchy::querySphere(const Vector3& center, float radius, std::vector<Entity>& outEntities) const
+{
+    const size_t firstOutput = outEntities.size();
+    if (m_root == kNullNode)
+    {
+        return 0;
+    }
+
+    std::vector<uint32_t>& stack = t_nodeStack;
+    stack.clear();
+    stack.push_back(m_root);
+
+    while (!stack.empty())
+    {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (node.isLeaf())
+        {
+            const float reach = radius + node.radius;
+            if ((node.center - center).squaredLength() <= reach * reach)
+            {
+                outEntities.push_back(node.entity);
+            }
+        }
+        else if (squaredDistanceToBox(center, node.min, node.max) <= radius * radius)
+        {
+            stack.push_back(node.right);
+            stack.push_back(node.left);
+        }
+    }
+
+    return outEntities.size() - firstOutput;
+}
+
+size_t BoundingVolumeHierarchy::queryAABB(const Vector3& min, const Vector3& max, std::vector<Entity>& outEntities) const
+{
+    const size_t firstOutput = outEntities.size();
+    if (m_root == kNullNode)
+    {
+        return 0;
+    }
+
+    std::vector<uint32_t>& stack = t_nodeStack;
+    stack.clear();
+    stack.push_back(m_root);
+
+    while (!stack.empty())
+    {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (node.isLeaf())
+        {
+            if (squaredDistanceToBox(node.center, min, max) <= node.radius * node.radius)
+            {
+                outEntities.push_back(node.entity);
+            }
+        }
+        else if (overlapsBox(node.min, node.max, min, max))
+        {
+            stack.push_back(node.right);
+            stack.push_back(node.left);
+        }
+    }
+
+    return outEntities.size() - firstOutput;
+}
+
+bool BoundingVolumeHierarchy::raycast(const Vector3& origin, const Vector3& direction, float maxDistance, RaycastHit& outHit) const
+{
+    const float directionLengthSq = direction.squaredLength();
+    if (m_root == kNullNode || directionLengthSq <= 0.0f)
+    {
+        return false;
+    }
+
+    // Infinite components for axis-parallel rays make the slab test reject or span the whole axis
+    const Vector3 invDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+    float nearest = maxDistance;
+    Entity hitEntity = NullEntity;
+
+    std::vector<uint32_t>& stack = t_nodeStack;
+    stack.clear();
+    stack.push_back(m_root);
+
+    while (!stack.empty())
+    {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (node.isLeaf())
+        {
+            // |origin + t * direction - center| = radius, nearest root (0 if starting inside)
+            const Vector3 offset = origin - node.center;
+            const float b = offset.dot(direction);
+            const float c = offset.squaredLength() - node.radius * node.radius;
+            if (c > 0.0f && b > 0.0f)
+            {
+                continue;
+            }
+
+            const float discriminant = b * b - directionLengthSq * c;
+            if (discriminant < 0.0f)
+            {
+                continue;
+            }
+
+            const float t = std::max((-b - std::sqrt(discriminant)) / directionLengthSq, 0.0f);
+            if (t <= nearest)
+            {
+                nearest = t;
+                hitEntity = node.entity;
+            }
+            continue;
+        }
+
+        // Push the nearer child last so it is popped first and tightens 'nearest' sooner
+        const float leftEntry = rayBoxEntry(origin, invDirection, nearest, m_nodes[node.left].min, m_nodes[node.left].max);
+        const float rightEntry = rayBoxEntry(origin, invDirection, nearest, m_nodes[node.right].min, m_nodes[node.right].max);
+        if (leftEntry >= 0.0f && rightEntry >= 0.0f)
+        {
+            const bool leftFirst = leftEntry <= rightEntry;
+            stack.push_back(leftFirst ? node.right : node.left);
+            stack.push_back(leftFirst ? node.left : node.right);
+        }
+        else if (leftEntry >= 0.0f)
+        {
+            stack.push_back(node.left);
+        }
+        else if (rightEntry >= 0.0f)
+        {
+            stack.push_back(node.right);
+        }
+    }
+
+    if (hitEntity == NullEntity)
+    {
+        return false;
+    }
+
+    outHit.entity = hitEntity;
+    outHit.distance = nearest;
+    outHit.point = origin + direction * nearest;
+    return true;
+}
+
+void BoundingVolumeHierarchy::collectLeaves(uint32_t node, std::vector<Entity>& outEntities, size_t sizeLimit) const
+{
+    if (outEntities.size() >= sizeLimit)
+    {
+        return;
+    }
+
+    const Node& current = m_nodes[node];
+    if (current.isLeaf())
+    {
+        outEntities.push_back(current.entity);
+        return;
+    }
+    collectLeaves(current.left, outEntities, sizeLimit);
+    collectLeaves(current.right, outEntities, sizeLimit);
+}
+
+// =============================================================================
+// Registry Signal Handlers
+// =============================================================================
+
+void BoundingVolumeHierarchy::onBoundsConstructed(EntityRegistry& registry, Entity entity)
+{
+    const BoundingComponent& bounds = registry.get<BoundingComponent>(entity);
+    insert(entity, bounds.worldCenter, bounds.worldRadius);
+}
+
+void BoundingVolumeHierarchy::onBoundsDestroyed(EntityRegistry& /*registry*/, Entity entity)
+{
+    remove(entity);
+}
+
+} // namespace vesper
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+#include "runtime/function/framework/ecs/ecs_types.h"
+#include "runtime/function/framework/ecs/systems/frustum.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace vesper {
+
+/// @brief Nearest hit of a BoundingVolumeHierarchy::raycast
+struct RaycastHit
+{
+    Entity entity{NullEntity};
+    float distance{0.0f};
+    Vector3 point{0.0f, 0.0f, 0.0f};
+};
+
+/// @brief Dynamic AABB tree over the world bounding spheres, for hierarchical culling and queries
+/// Each leaf is one BoundingComponent: it keeps the exact world sphere and an AABB fattened by a
+/// margin, so a sphere moving inside its fat box costs nothing and only spheres that leave it are
+/// re-inserted. Insertion picks the sibling with the cheapest surface area increase and rotations
+/// keep the tree height balanced, so queries stay O(log n + hits) as objects move.
+///
+/// Queries test node boxes first and the leaf spheres last, so they return exactly the entities
+/// whose sphere passes the equivalent per-entity test (e.g. Frustum::testSphere), in tree order.
+/// Frustum queries accept whole subtrees whose box is inside every plane without testing them.
+///
+/// World keeps one in the registry context (registry.ctx().find<BoundingVolumeHierarchy>()):
+/// leaves follow BoundingComponent construction/destruction through registry signals (so
+/// entities created or destroyed through Scene are inserted/removed incrementally), and
+/// World::updateBounds() moves the leaves of the spheres it recomputes.
+class BoundingVolumeHierarchy
+{
+public:
+    /// @brief Fat AABB margin, relative to the sphere radius
+    static constexpr float kFatMarginScale = 0.25f;
+
+    /// @brief Minimum fat AABB margin (world units)
+    static constexpr float kMinFatMargin = 0.1f;
+
+    BoundingVolumeHierarchy() = default;
+
+    VESPER_DISABLE_COPY(BoundingVolumeHierarchy)
+
+    BoundingVolumeHierarchy(BoundingVolumeHierarchy&&) = default;
+    BoundingVolumeHierarchy& operator=(BoundingVolumeHierarchy&&) = default;
+
+    // =========================================================================
+    // Leaf Management
+    // =========================================================================
+
+    /// @brief Insert a leaf for an entity (no-op if it already has one)
+    void insert(Entity entity, const Vector3& center, float radius);
+
+    /// @brief Remove an entity's leaf (no-op if it has none)
+    void remove(Entity entity);
+
+    /// @brief Move an entity's sphere, re-inserting the leaf only if it left its fat AABB
+    /// @return true if the leaf was re-inserted
+    bool update(Entity entity, const Vector3& center, float radius);
+
+    /// @brief Check if an entity has a leaf
+    bool contains(Entity entity) const;
+
+    /// @brief Number of leaves
+    size_t size() const { return m_leafCount; }
+
+    /// @brief Height of the tree (0 = empty, 1 = single leaf)
+    uint32_t height() const;
+
+    // =========================================================================
+    // Queries
+    // =========================================================================
+
+    /// @brief Entities whose sphere passes Frustum::testSphere
+    /// @param frustum Frustum to test against
+    /// @param outEntities Output list the visible entities are appended to
+    /// @param maxEntities Give up once more than this many are found: the output is then
+    ///        incomplete and the return value is maxEntities + 1 (lets callers switch to a
+    ///        linear scan when most of the scene turns out to be visible)
+    /// @return Number of entities appended to outEntities
+    size_t queryFrustum(const Frustum& frustum, std::vector<Entity>& outEntities, size_t maxEntities = SIZE_MAX) const;
+
+    /// @brief Entities whose sphere intersects the given sphere
+    /// @return Number of entities appended to outEntities
+    size_t querySphere(const Vector3& center, float radius, std::vector<Entity>& outEntities) const;
+
+    /// @brief Entities whose sphere intersects the given AABB
+    /// @return Number of entities appended to outEntities
+    size_t queryAABB(const Vector3& min, const Vector3& max, std::vector<Entity>& outEntities) const;
+
+    /// @brief Nearest sphere hit along a ray
+    /// @param origin Ray origin
+    /// @param direction Ray direction (need not be normalized; distances are in its units)
+    /// @param maxDistance Maximum hit distance along the direction
+    /// @param outHit Nearest hit, written only if something is hit
+    /// @return true if a sphere is hit within maxDistance (rays starting inside a sphere hit at 0)
+    bool raycast(const Vector3& origin, const Vector3& direction, float maxDistance, RaycastHit& outHit) const;
+
+    // =========================================================================
+    // Registry Signal Handlers
+    // =========================================================================
+
+    /// @brief on_construct<BoundingComponent> handler
+    void onBoundsConstructed(EntityRegistry& registry, Entity entity);
+
+    /// @brief on_destroy<BoundingComponent> handler
+    void onBoundsDestroyed(EntityRegistry& registry, Entity entity);
+
+private:
+    static constexpr uint32_t kNullNode = UINT32_MAX;
+
+    struct Node
+    {
+        Vector3 min;                    // Fat box for leaves, union of children otherwise
+        Vector3 max;
+        Vector3 center;                 // Leaf sphere
+        float radius{0.0f};
+        uint32_t parent{kNullNode};     // Next free node while on the free list
+        uint32_t left{kNullNode};       // kNullNode for leaves
+        uint32_t right{kNullNode};
+        uint32_t height{0};             // 0 for leaves, -1 (UINT32_MAX) for free nodes
+        Entity entity{NullEntity};
+
+        bool isLeaf() const { return left == kNullNode; }
+    };
+
+    uint32_t allocateNode();
+    void freeNode(uint32_t node);
+
+    void insertLeaf(uint32_t leaf);
+    void removeLeaf(uint32_t leaf);
+
+    /// @brief Rotate the subtree at a node if its children heights differ by more than 1
+    /// @return Node now at the subtree root
+    uint32_t balance(uint32_t node);
+
+    /// @brief Recompute boxes and heights from a node up to the root, rebalancing on the way
+    void refitAncestors(uint32_t node);
+
+    /// @brief Append every leaf of a subtree, stopping once outEntities reaches sizeLimit
+    void collectLeaves(uint32_t node, std::vector<Entity>& outEntities, size_t sizeLimit) const;
+
+    /// @brief Leaf of an entity, or kNullNode
+    uint32_t leafOf(Entity entity) const;
+
+private:
+    std::vector<Node> m_nodes;
+    uint32_t m_root{kNullNode};
+    uint32_t m_freeList{kNullNode};
+    size_t m_leafCount{0};
+
+    // Entity index -> leaf (check the leaf's entity: indices are recycled)
+    std::vector<uint32_t> m_leafOfEntity;
+};
+
+} // namespace vesper
@@ -0,0 +1,376 @@
+#include "runtime/function/framework/ecs/systems/culling_buffer.h"
+#include "runtime/function/framework/component/common/bounding_component.h"
+#include "runtime/core/threading/worker_pool.h"
+
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace vesper {
+
+namespace {
+
+// Padding spheres fail every plane test (distance >= +inf never holds)
+constexpr float kPaddingRadius = -std::numeric_limits<float>::infinity();
+
+/// @brief Bit i set if lane i of a comparison mask is true
+inline uint32_t laneMask(DirectX::FXMVECTOR mask)
+{
+#if defined(_XM_SSE_INTRINSICS_)
+    return static_cast<uint32_t>(_mm_movemask_ps(mask));
+#else
+    DirectX::XMUINT4 lanes;
+    DirectX::XMStoreUInt4(&lanes, mask);
+    return (lanes.x & 1u) | ((lanes.y & 1u) << 1) | ((lanes.z & 1u) << 2) | ((lanes.w & 1u) << 3);
+#endif
+}
+
+/// @brief Frustum planes with each coefficient splatted across a vector
+struct SplatPlanes
+{
+    DirectX::XMVECTOR nx[Frustum::kPlaneCount];
+    DirectX::XMVECTOR ny[Frustum::kPlaneCount];
+    DirectX::XMVECTOR nz[Frustum::kPlaneCount];
+    DirectX::XMVECTOR d[Frustum::kPlaneCount];
+
+    // Absolute normals, to project box half extents onto the plane normal
+    DirectX::XMVECTOR absNx[Frustum::kPlaneCount];
+    DirectX::XMVECTOR absNy[Frustum::kPlaneCount];
+    DirectX::XMVECTOR absNz[Frustum::kPlaneCount];
+
+    explicit SplatPlanes(const Frustum& frustum)
+    {
+        for (int i = 0; i < Frustum::kPlaneCount; ++i)
+        {
+            nx[i] = DirectX::XMVectorReplicate(frustum.planes[i].normal.x);
+            ny[i] = DirectX::XMVectorReplicate(frustum.planes[i].normal.y);
+            nz[i] = DirectX::XMVectorReplicate(frustum.planes[i].normal.z);
+            d[i] = DirectX::XMVectorReplicate(frustum.planes[i].distance);
+            absNx[i] = DirectX::XMVectorAbs(nx[i]);
+            absNy[i] = DirectX::XMVectorAbs(ny[i]);
+            absNz[i] = DirectX::XMVectorAbs(nz[i]);
+        }
+    }
+
+    /// @brief Visibility of 4 spheres: lane set if no plane has the sphere fully behind it
+    DirectX::XMVECTOR testSpheres(const float* x, const float* y, const float* z, const float* r) const
+    {
+        using namespace DirectX;
+
+        const XMVECTOR cx = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(x));
+        const XMVECTOR cy = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(y));
+        const XMVECTOR cz = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(z));
+        const XMVECTOR negRadius = XMVectorNegate(XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(r)));
+
+        XMVECTOR inside = XMVectorTrueInt();
+        for (int i = 0; i < Frustum::kPlaneCount; ++i)
+        {
+            XMVECTOR distance = XMVectorMultiplyAdd(nx[i], cx, d[i]);
+            distance = XMVectorMultiplyAdd(ny[i], cy, distance);
+            distance = XMVectorMultiplyAdd(nz[i], cz, distance);
+            inside = XMVectorAndInt(inside, XMVectorGreaterOrEqual(distance, negRadius));
+        }
+        return inside;
+    }
+
+    /// @brief Visibility of 4 boxes given by centers and half extents: lane set if no plane has the box fully behind it
+    DirectX::XMVECTOR testBoxes(DirectX::FXMVECTOR cx, DirectX::FXMVECTOR cy, DirectX::FXMVECTOR cz,
+                                DirectX::GXMVECTOR hx, DirectX::HXMVECTOR hy, DirectX::HXMVECTOR hz) const
+    {
+        using namespace DirectX;
+
+        XMVECTOR inside = XMVectorTrueInt();
+        for (int i = 0; i < Frustum::kPlaneCount; ++i)
+        {
+            // Center distance plus the half extents projected on the normal (as testAABB's p-vertex)
+            XMVECTOR distance = XMVectorMultiplyAdd(nx[i], cx, d[i]);
+            distance = XMVectorMultiplyAdd(ny[i], cy, distance);
+            distance = XMVectorMultiplyAdd(nz[i], cz, distance);
+            distance = XMVectorMultiplyAdd(absNx[i], hx, distance);
+            distance = XMVectorMultiplyAdd(absNy[i], hy, distance);
+            distance = XMVectorMultiplyAdd(absNz[i], hz, distance);
+            inside = XMVectorAndInt(inside, XMVectorGreaterOrEqual(distance, XMVectorZero()));
+        }
+        return inside;
+    }
+};
+
+/// @brief Box stage over the set bits of one word: clears the lanes whose box is outside
+/// Survivors are compacted and tested 4 per batch, so the cost follows the survivor count
+/// without a branch per lane group. Arrays point at the word's first slot.
+uint64_t cullBoxes(const SplatPlanes& planes, uint64_t bits,
+                   const float* x, const float* y, const float* z,
+                   const float* ex, const float* ey, const float* ez)
+{
+    using namespace DirectX;
+
+    uint32_t lanes[CullingBuffer::kBitsPerWord + 3];
+    uint32_t count = 0;
+    for (uint64_t pending = bits; pending; pending &= pending - 1)
+    {
+        lanes[count++] = static_cast<uint32_t>(std::countr_zero(pending));
+    }
+
+    // Pad the last batch by repeating its last lane: the duplicate result is identical
+    for (uint32_t pad = count; pad % 4 != 0; ++pad)
+    {
+        lanes[pad] = lanes[count - 1];
+    }
+
+    uint64_t kept = 0;
+    for (uint32_t k = 0; k < count; k += 4)
+    {
+        const uint32_t a = lanes[k];
+        const uint32_t b = lanes[k + 1];
+        const uint32_t c = lanes[k + 2];
+        const uint32_t e = lanes[k + 3];
+        const uint32_t mask = laneMask(planes.testBoxes(
+            XMVectorSet(x[a], x[b], x[c], x[e]), XMVectorSet(y[a], y[b], y[c], y[e]), XMVectorSet(z[a], z[b], z[c], z[e]),
+            XMVectorSet(ex[a], ex[b], ex[c], ex[e]), XMVectorSet(ey[a], ey[b], ey[c], ey[e]), XMVectorSet(ez[a], ez[b], ez[c], ez[e])));
+
+        kept |= static_cast<uint64_t>(mask & 1u) << a;
+        kept |= static_cast<uint64_t>((mask >> 1) & 1u) << b;
+        kept |= static_cast<uint64_t>((mask >> 2) & 1u) << c;
+        kept |= static_cast<uint64_t>((mask >> 3) & 1u) << e;
+    }
+    return kept;
+}
+
+} // namespace
+
+// =============================================================================
+// Slot Management
+// =============================================================================
+
+void CullingBuffer::add(Entity entity, const Vector3& center, float radius, const Vector3& aabbMin, const Vector3& aabbMax)
+{
+    if (contains(entity))
+    {
+        return;
+    }
+
+    const size_t slot = m_entities.size();
+    if (slot == m_radius.size())
+    {
+        resizeSlots(slot + kBitsPerWord);
+    }
+
+    const size_t index = static_cast<size_t>(entt::to_entity(entity));
+    if (index >= m_slotOfEntity.size())
+    {
+        m_slotOfEntity.resize(index + 1, kNoSlot);
+    }
+    m_slotOfEntity[index] = static_cast<uint32_t>(slot);
+    m_entities.push_back(entity);
+    writeSlot(slot, center, radius, aabbMin, aabbMax);
+}
+
+void CullingBuffer::add(Entity entity, const Vector3& center, float radius)
+{
+    const Vector3 extent(radius, radius, radius);
+    add(entity, center, radius, center - extent, center + extent);
+}
+
+void CullingBuffer::remove(Entity entity)
+{
+    const uint32_t slot = slotOf(entity);
+    if (slot == kNoSlot)
+    {
+        return;
+    }
+
+    // Move the last slot into the hole
+    const size_t last = m_entities.size() - 1;
+    if (slot != last)
+    {
+        const Entity moved = m_entities[last];
+        m_entities[slot] = moved;
+        m_slotOfEntity[static_cast<size_t>(entt::to_entity(moved))] = slot;
+        moveSlot(last, slot);
+    }
+
+    m_slotOfEntity[static_cast<size_t>(entt::to_entity(entity))] = kNoSlot;
+    m_entities.pop_back();
+    const Vector3 origin(0.0f, 0.0f, 0.0f);
+    writeSlot(last, origin, kPaddingRadius, origin, origin);
+
+    // Give back whole words of padding
+    if (m_radius.size() - m_entities.size() > kBitsPerWord)
+    {
+        resizeSlots(m_radius.size() - kBitsPerWord);
+    }
+}
+
+void CullingBuffer::update(Entity entity, const Vector3& center, float radius, const Vector3& aabbMin, const Vector3& aabbMax)
+{
+    const uint32_t slot = slotOf(entity);
+    if (slot != kNoSlot)
+    {
+        writeSlot(slot, center, radius, aabbMin, aabbMax);
+    }
+}
+
+void CullingBuffer::update(Entity entity, const Vector3& center, float radius)
+{
+    const Vector3 extent(radius, radius, radius);
+    update(entity, center, radius, center - extent, center + extent);
+}
+
+bool CullingBuffer::contains(Entity entity) const
+{
+    return slotOf(entity) != kNoSlot;
+}
+
+uint32_t CullingBuffer::slotOf(Entity entity) const
+{
+    const size_t index = static_cast<size_t>(entt::to_entity(entity));
+    if (index >= m_slotOfEntity.size())
+    {
+        return kNoSlot;
+    }
+
+    const uint32_t slot = m_slotOfEntity[index];
+    return (slot != kNoSlot && m_entities[slot] == entity) ? slot : kNoSlot;
+}
+
+void CullingBuffer::writeSlot(size_t slot, const Vector3& center, float radius, const Vector3& aabbMin, const Vector3& aabbMax)
+{
+    m_centerX[slot] = center.x;
+    m_centerY[slot] = center.y;
+    m_centerZ[slot] = center.z;
+    m_radius[slot] = radius;
+
+    // Box re-centered on the sphere: grown by the center offset, exact when the centers match
+    const Vector3 offset = (aabbMin + aabbMax) * 0.5f - center;
+    const Vector3 boxExtent = (aabbMax - aabbMin) * 0.5f + Vector3(std::abs(offset.x), std::abs(offset.y), std::abs(offset.z));
+    m_boxExtentX[slot] = boxExtent.x;
+    m_boxExtentY[slot] = boxExtent.y;
+    m_boxExtentZ[slot] = boxExtent.z;
+
+    // A box no narrower than the sphere on any axis contains it and never rejects more
+    setTighterBox(slot, boxExtent.x < radius || boxExtent.y < radius || boxExtent.z < radius);
+}
+
+void CullingBuffer::setTighterBox(size_t slot, bool tighter)
+{
+    const uint64_t bit = uint64_t{1} << (slot % kBitsPerWord);
+    uint64_t& word = m_tighterBoxes[slot / kBitsPerWord];
+    word = tighter ? (word | bit) : (word & ~bit);
+}
+
+void CullingBuffer::moveSlot(size_t from, size_t to)
+{
+    m_centerX[to] = m_centerX[from];
+    m_centerY[to] = m_centerY[from];
+    m_centerZ[to] = m_centerZ[from];
+    m_radius[to] = m_radius[from];
+    m_boxExtentX[to] = m_boxExtentX[from];
+    m_boxExtentY[to] = m_boxExtentY[from];
+    m_boxExtentZ[to] = m_boxExtentZ[from];
+    setTighterBox(to, (m_tighterBoxes[from / kBitsPerWord] >> (from % kBitsPerWord)) & 1u);
+}
+
+void CullingBuffer::resizeSlots(size_t paddedSize)
+{
+    m_centerX.resize(paddedSize, 0.0f);
+    m_centerY.resize(paddedSize, 0.0f);
+    m_centerZ.resize(paddedSize, 0.0f);
+    m_radius.resize(paddedSize, kPaddingRadius);
+    m_boxExtentX.resize(paddedSize, 0.0f);
+    m_boxExtentY.resize(paddedSize, 0.0f);
+    m_boxExtentZ.resize(paddedSize, 0.0f);
+    m_tighterBoxes.resize(paddedSize / kBitsPerWord, 0);
+}
+
+// =============================================================================
+// Culling
+// =============================================================================
+
+size_t CullingBuffer::cull(const Frustum& frustum, std::vector<uint64_t>& visibleBits, WorkerPool* pool) const
+{
+    const size_t wordCount = m_radius.size() / kBitsPerWord;
+    visibleBits.resize(wordCount);
+
+    constexpr size_t kWordsPerChunk = kParallelChunkSize / kBitsPerWord;
+    if (!pool || wordCount <= kWordsPerChunk)
+    {
+        return cullWords(frustum, 0, wordCount, visibleBits.data());
+    }
+
+    std::atomic<size_t> visibleCount{0};
+    pool->parallelForRange(0, wordCount, kWordsPerChunk, [&](size_t firstWord, size_t lastWord) {
+        visibleCount.fetch_add(cullWords(frustum, firstWord, lastWord, visibleBits.data()), std::memory_order_relaxed);
+    });
+    return visibleCount.load(std::memory_order_relaxed);
+}
+
+size_t CullingBuffer::cullToSlots(const Frustum& frustum, std::vector<uint32_t>& visibleSlots, WorkerPool* pool) const
+{
+    std::vector<uint64_t> visibleBits;
+    const size_t visibleCount = cull(frustum, visibleBits, pool);
+
+    // Compaction is a linear scan over set bits: cheap next to the plane tests
+    visibleSlots.resize(visibleCount);
+    size_t written = 0;
+    for (size_t word = 0; word < visibleBits.size(); ++word)
+    {
+        uint64_t bits = visibleBits[word];
+        while (bits)
+        {
+            visibleSlots[written++] = static_cast<uint32_t>(word * kBitsPerWord + static_cast<size_t>(std::countr_zero(bits)));
+            bits &= bits - 1;
+        }
+    }
+    return visibleCount;
+}
+
+size_t CullingBuffer::cullWords(const Frustum& frustum, size_t firstWord, size_t lastWord, uint64_t* visibleBits) const
+{
+    const SplatPlanes planes(frustum);
+    size_t visibleCount = 0;
+
+    for (size_t word = firstWord; word < lastWord; ++word)
+    {
+        uint64_t bits = 0;
+        const size_t base = word * kBitsPerWord;
+
+        // Stage 1, spheres: 8 per iteration as two independent 4-wide dependency chains
+        for (size_t lane = 0; lane < kBitsPerWord; lane += 8)
+        {
+            const size_t i = base + lane;
+            const uint32_t low = laneMask(planes.testSpheres(&m_centerX[i], &m_centerY[i], &m_centerZ[i], &m_radius[i]));
+            const uint32_t high = laneMask(planes.testSpheres(&m_centerX[i + 4], &m_centerY[i + 4], &m_centerZ[i + 4], &m_radius[i + 4]));
+            bits |= static_cast<uint64_t>(low | (high << 4)) << lane;
+        }
+
+        // Stage 2, boxes: surviving spheres whose box is tighter than the sphere, gathered 4 at a time
+        const uint64_t boxed = bits & m_tighterBoxes[word];
+        if (boxed)
+        {
+            bits = (bits & ~boxed) | cullBoxes(planes, boxed, &m_centerX[base], &m_centerY[base], &m_centerZ[base],
+                                               &m_boxExtentX[base], &m_boxExtentY[base], &m_boxExtentZ[base]);
+        }
+
+        visibleBits[word] = bits;
+        visibleCount += static_cast<size_t>(std::popcount(bits));
+    }
+    return visibleCount;
+}
+
+// =============================================================================
+// Registry Signal Handlers
+// =============================================================================
+
+void CullingBuffer::onBoundsConstructed(EntityRegistry& registry, Entity entity)
+{
+    const BoundingComponent& bounds = registry.get<BoundingComponent>(entity);
+    add(entity, bounds.worldCenter, bounds.worldRadius, bounds.worldAabbMin, bounds.worldAabbMax);
+}
+
+void CullingBuffer::onBoundsDestroyed(EntityRegistry& /*registry*/, Entity entity)
+{
+    remove(entity);
+}
+
+} // namespace vesper
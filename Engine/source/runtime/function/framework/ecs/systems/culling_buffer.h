@@ -0,0 +1,145 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+#include "runtime/function/framework/ecs/ecs_types.h"
+#include "runtime/function/framework/ecs/systems/frustum.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace vesper {
+
+class WorkerPool;
+
+/// @brief Structure-of-arrays copy of the world bounding volumes, for batched frustum culling
+/// One slot per BoundingComponent: the sphere (centerX/Y/Z, radius) and the half extents of the
+/// world AABB live in separate float arrays so the culling kernel tests several objects per
+/// instruction against each of the 6 planes. An object is visible only if both its sphere and
+/// its box pass (the box is tighter for elongated or rotated objects): spheres are tested first,
+/// then the survivors whose box is narrower than the sphere are gathered 4 at a time for the box
+/// test, so views that reject most of the scene pay almost nothing for the second stage. The box
+/// is stored around the sphere center; BoundingComponent keeps the two centers equal, otherwise
+/// the stored box grows by their offset (conservative).
+/// Arrays are padded to a multiple of kBitsPerWord with never-visible spheres, so the kernel runs
+/// without a scalar tail and each 64-slot word of the output bitset is written by exactly one thread.
+///
+/// World keeps one in the registry context (registry.ctx().find<CullingBuffer>()): slots follow
+/// BoundingComponent construction/destruction through registry signals, and World::updateBounds()
+/// writes the spheres it recomputes. Removal swaps the last slot into the hole, so slot order is
+/// not stable across frames.
+class CullingBuffer
+{
+public:
+    /// @brief Slots per output bitset word
+    static constexpr size_t kBitsPerWord = 64;
+
+    /// @brief Slots per parallel culling task (multiple of kBitsPerWord)
+    static constexpr size_t kParallelChunkSize = 16 * 1024;
+
+    CullingBuffer() = default;
+
+    VESPER_DISABLE_COPY(CullingBuffer)
+
+    CullingBuffer(CullingBuffer&&) = default;
+    CullingBuffer& operator=(CullingBuffer&&) = default;
+
+    // =========================================================================
+    // Slot Management
+    // =========================================================================
+
+    /// @brief Add a slot for an entity (no-op if it already has one)
+    void add(Entity entity, const Vector3& center, float radius, const Vector3& aabbMin, const Vector3& aabbMax);
+
+    /// @brief Add a slot for an entity with a sphere only (its AABB is the sphere's box)
+    void add(Entity entity, const Vector3& center, float radius);
+
+    /// @brief Remove an entity's slot (no-op if it has none)
+    void remove(Entity entity);
+
+    /// @brief Overwrite the bounds of an entity's slot (no-op if it has none)
+    void update(Entity entity, const Vector3& center, float radius, const Vector3& aabbMin, const Vector3& aabbMax);
+
+    /// @brief Overwrite the bounds of an entity's slot with a sphere only (no-op if it has none)
+    void update(Entity entity, const Vector3& center, float radius);
+
+    /// @brief Check if an entity has a slot
+    bool contains(Entity entity) const;
+
+    /// @brief Number of slots (excluding padding)
+    size_t size() const { return m_entities.size(); }
+
+    /// @brief Entity owning a slot
+    Entity entityAt(size_t slot) const { return m_entities[slot]; }
+
+    // =========================================================================
+    // Culling
+    // =========================================================================
+
+    /// @brief Test every slot against the frustum (Frustum::testSphere && Frustum::testAABB)
+    /// Matches the scalar tests exactly when box and sphere share their center.
+    /// @param frustum Frustum to test against
+    /// @param visibleBits Output bitset: bit (slot % 64) of word (slot / 64) is set if visible
+    /// @param pool Pool used to split the slots into kParallelChunkSize tasks (nullptr = calling thread)
+    /// @return Number of visible slots
+    size_t cull(const Frustum& frustum, std::vector<uint64_t>& visibleBits, WorkerPool* pool = nullptr) const;
+
+    /// @brief Test every slot against the frustum and output the visible slots in ascending order
+    /// @param frustum Frustum to test against
+    /// @param visibleSlots Output list of visible slot indices
+    /// @param pool Pool used to split the work (nullptr = calling thread)
+    /// @return Number of visible slots
+    size_t cullToSlots(const Frustum& frustum, std::vector<uint32_t>& visibleSlots, WorkerPool* pool = nullptr) const;
+
+    // =========================================================================
+    // Registry Signal Handlers
+    // =========================================================================
+
+    /// @brief on_construct<BoundingComponent> handler
+    void onBoundsConstructed(EntityRegistry& registry, Entity entity);
+
+    /// @brief on_destroy<BoundingComponent> handler
+    void onBoundsDestroyed(EntityRegistry& registry, Entity entity);
+
+private:
+    /// @brief Cull words [firstWord, lastWord) of the padded arrays
+    /// @return Number of visible slots in the range
+    size_t cullWords(const Frustum& frustum, size_t firstWord, size_t lastWord, uint64_t* visibleBits) const;
+
+    /// @brief Slot of an entity, or kNoSlot
+    uint32_t slotOf(Entity entity) const;
+
+    /// @brief Write a slot's bounds (padding slots use the never-visible sphere)
+    void writeSlot(size_t slot, const Vector3& center, float radius, const Vector3& aabbMin, const Vector3& aabbMax);
+
+    /// @brief Mark whether a slot's box can reject more than its sphere
+    void setTighterBox(size_t slot, bool tighter);
+
+    /// @brief Copy a slot's bounds over another slot
+    void moveSlot(size_t from, size_t to);
+
+    /// @brief Grow or shrink the padded arrays
+    void resizeSlots(size_t paddedSize);
+
+private:
+    static constexpr uint32_t kNoSlot = UINT32_MAX;
+
+    // Per slot, padded to a multiple of kBitsPerWord
+    std::vector<float> m_centerX;
+    std::vector<float> m_centerY;
+    std::vector<float> m_centerZ;
+    std::vector<float> m_radius;
+    std::vector<float> m_boxExtentX;
+    std::vector<float> m_boxExtentY;
+    std::vector<float> m_boxExtentZ;
+
+    // Per 64-slot word: slots whose box is narrower than the sphere on some axis (box stage runs for these)
+    std::vector<uint64_t> m_tighterBoxes;
+
+    // Per slot, not padded
+    std::vector<Entity> m_entities;
+
+    // Entity index -> slot (check m_entities[slot] == entity: indices are recycled)
+    std::vector<uint32_t> m_slotOfEntity;
+};
+
+} // namespace vesper
@@ -8,16 +8,14 @@ void Frustum::extractFromViewProjection(const Matrix4x4& vp)
 {
     // Extract frustum planes from view-projection matrix
     // Using Gribb/Hartmann method
-    // Note: Matrix4x4 uses row-major storage, so we access elements accordingly
-
-    // For a row-major matrix M, a point p is transformed as p' = p * M
-    // The plane equations are:
-    // Left:   row3 + row0 >= 0
-    // Right:  row3 - row0 >= 0
-    // Bottom: row3 + row1 >= 0
-    // Top:    row3 - row1 >= 0
-    // Near:   row2 >= 0        (for D3D/Vulkan style [0,1] depth)
-    // Far:    row3 - row2 >= 0
+    // Note: Matrix4x4 uses row vectors (p' = p * M), so clip coordinates are dot products
+    // of p with the matrix columns and the planes are built from columns:
+    // Left:   col3 + col0 >= 0
+    // Right:  col3 - col0 >= 0
+    // Bottom: col3 + col1 >= 0
+    // Top:    col3 - col1 >= 0
+    // Near:   col2 >= 0        (for D3D/Vulkan style [0,1] depth)
+    // Far:    col3 - col2 >= 0
 
     // Get matrix elements
     // vp[row][col] - row-major access
@@ -26,29 +24,29 @@ void Frustum::extractFromViewProjection(const Matrix4x4& vp)
     float m20 = vp[2][0], m21 = vp[2][1], m22 = vp[2][2], m23 = vp[2][3];
     float m30 = vp[3][0], m31 = vp[3][1], m32 = vp[3][2], m33 = vp[3][3];
 
-    // Left plane: row3 + row0
+    // Left plane: col3 + col0
     planes[static_cast<int>(FrustumPlaneIndex::Left)] =
-        FrustumPlane::fromCoefficients(m30 + m00, m31 + m01, m32 + m02, m33 + m03);
+        FrustumPlane::fromCoefficients(m03 + m00, m13 + m10, m23 + m20, m33 + m30);
 
-    // Right plane: row3 - row0
+    // Right plane: col3 - col0
     planes[static_cast<int>(FrustumPlaneIndex::Right)] =
-        FrustumPlane::fromCoefficients(m30 - m00, m31 - m01, m32 - m02, m33 - m03);
+        FrustumPlane::fromCoefficients(m03 - m00, m13 - m10, m23 - m20, m33 - m30);
 
-    // Bottom plane: row3 + row1
+    // Bottom plane: col3 + col1
     planes[static_cast<int>(FrustumPlaneIndex::Bottom)] =
-        FrustumPlane::fromCoefficients(m30 + m10, m31 + m11, m32 + m12, m33 + m13);
+        FrustumPlane::fromCoefficients(m03 + m01, m13 + m11, m23 + m21, m33 + m31);
 
-    // Top plane: row3 - row1
+    // Top plane: col3 - col1
     planes[static_cast<int>(FrustumPlaneIndex::Top)] =
-        FrustumPlane::fromCoefficients(m30 - m10, m31 - m11, m32 - m12, m33 - m13);
+        FrustumPlane::fromCoefficients(m03 - m01, m13 - m11, m23 - m21, m33 - m31);
 
-    // Near plane: row2 (Vulkan/D3D style [0,1] depth range)
+    // Near plane: col2 (Vulkan/D3D style [0,1] depth range)
     planes[static_cast<int>(FrustumPlaneIndex::Near)] =
-        FrustumPlane::fromCoefficients(m20, m21, m22, m23);
+        FrustumPlane::fromCoefficients(m02, m12, m22, m32);
 
-    // Far plane: row3 - row2
+    // Far plane: col3 - col2
     planes[static_cast<int>(FrustumPlaneIndex::Far)] =
-        FrustumPlane::fromCoefficients(m30 - m20, m31 - m21, m32 - m22, m33 - m23);
+        FrustumPlane::fromCoefficients(m03 - m02, m13 - m12, m23 - m22, m33 - m32);
 }
 
 bool Frustum::testSphere(const Vector3& center, float radius) const
@@ -1,76 +1,126 @@
 #include "runtime/function/framework/ecs/systems/frustum_cull_system.h"
+#include "runtime/function/framework/ecs/world.h"
 #include "runtime/function/framework/component/transform/transform_component.h"
 #include "runtime/function/framework/component/mesh/renderable_component.h"
 #include "runtime/function/framework/component/common/bounding_component.h"
+#include "runtime/function/framework/ecs/systems/culling_buffer.h"
+#include "runtime/function/framework/ecs/systems/bounding_volume_hierarchy.h"
 
 namespace vesper {
 
-void FrustumCullSystem::cullEntities(EntityRegistry& registry,
-                                      const Frustum& frustum,
-                                      std::vector<Entity>& outVisible)
-{
-    outVisible.clear();
+namespace {
 
-    // Query all renderable entities with transforms
-    auto view = registry.view<TransformComponent, RenderableComponent>();
+/// @brief Visible slots of the last cull on this thread (reused to avoid per-frame allocation)
+thread_local std::vector<uint32_t> t_visibleSlots;
 
-    for (auto entity : view)
-    {
-        auto& renderable = view.get<RenderableComponent>(entity);
+/// @brief Visible bounded entities of the last BVH walk on this thread
+thread_local std::vector<Entity> t_visibleBounded;
 
-        // Skip invisible entities
-        if (!renderable.visible)
-            continue;
+/// @brief Scratch output for countVisible()
+thread_local std::vector<Entity> t_visibleEntities;
 
-        // Skip invalid renderables
-        if (!renderable.isValid())
-            continue;
-
-        // Check bounding component for frustum test
-        auto* bounds = registry.try_get<BoundingComponent>(entity);
+bool isDrawable(const RenderableComponent& renderable)
+{
+    return renderable.visible && renderable.isValid();
+}
 
-        if (bounds)
+/// @brief Append the drawable renderables among culled bounded entities
+template<typename Range, typename EntityOf>
+void appendDrawable(EntityRegistry& registry, const Range& culled, EntityOf&& entityOf, std::vector<Entity>& outVisible)
+{
+    const auto& transforms = registry.storage<TransformComponent>();
+    const auto& renderables = registry.storage<RenderableComponent>();
+    for (const auto& item : culled)
+    {
+        const Entity entity = entityOf(item);
+        if (transforms.contains(entity) && renderables.contains(entity) && isDrawable(renderables.get(entity)))
         {
-            // Test world-space bounding sphere against frustum
-            if (!frustum.testSphere(bounds->worldCenter, bounds->worldRadius))
-            {
-                continue; // Culled
-            }
+            outVisible.push_back(entity);
         }
-        // If no bounds, assume visible (conservative approach)
-
-        outVisible.push_back(entity);
     }
 }
 
-size_t FrustumCullSystem::countVisible(EntityRegistry& registry,
-                                        const Frustum& frustum)
-{
-    size_t count = 0;
+} // namespace
 
-    auto view = registry.view<TransformComponent, RenderableComponent>();
+void FrustumCullSystem::cullEntities(EntityRegistry& registry,
+                                      const Frustum& frustum,
+                                      std::vector<Entity>& outVisible,
+                                      WorkerPool* pool)
+{
+    outVisible.clear();
 
-    for (auto entity : view)
+    const BoundingVolumeHierarchy* bvh = registry.ctx().find<BoundingVolumeHierarchy>();
+    const CullingBuffer* culling = registry.ctx().find<CullingBuffer>();
+    if (!bvh && !culling)
     {
-        auto& renderable = view.get<RenderableComponent>(entity);
+        // Query all renderable entities with transforms
+        auto view = registry.view<TransformComponent, RenderableComponent>();
 
-        if (!renderable.visible || !renderable.isValid())
-            continue;
+        for (auto entity : view)
+        {
+            // Skip invisible or invalid renderables
+            if (!isDrawable(view.get<RenderableComponent>(entity)))
+                continue;
+
+            // Test world-space bounding sphere, then the tighter AABB, against frustum
+            // If no bounds, assume visible (conservative approach)
+            auto* bounds = registry.try_get<BoundingComponent>(entity);
+            if (bounds && !(frustum.testSphere(bounds->worldCenter, bounds->worldRadius) &&
+                            frustum.testAABB(bounds->worldAabbMin, bounds->worldAabbMax)))
+                continue;
 
-        auto* bounds = registry.try_get<BoundingComponent>(entity);
+            outVisible.push_back(entity);
+        }
+        return;
+    }
 
-        if (bounds)
+    // Hierarchical rejection first; a dense view falls through to the batched sphere tests
+    bool culled = false;
+    if (bvh)
+    {
+        const size_t budget = culling ? bvh->size() / kDenseViewDivisor : SIZE_MAX;
+        t_visibleBounded.clear();
+        if (bvh->queryFrustum(frustum, t_visibleBounded, budget) <= budget)
         {
-            if (!frustum.testSphere(bounds->worldCenter, bounds->worldRadius))
-            {
-                continue;
-            }
+            // The tree tests spheres: the AABB stage runs on the (few) survivors
+            const auto& bounds = registry.storage<BoundingComponent>();
+            std::erase_if(t_visibleBounded, [&](Entity entity) {
+                const BoundingComponent& entityBounds = bounds.get(entity);
+                return !frustum.testAABB(entityBounds.worldAabbMin, entityBounds.worldAabbMax);
+            });
+            appendDrawable(registry, t_visibleBounded, [](Entity entity) { return entity; }, outVisible);
+            culled = true;
         }
+    }
 
-        ++count;
+    if (!culled)
+    {
+        culling->cullToSlots(frustum, t_visibleSlots, pool);
+        appendDrawable(registry, t_visibleSlots, [culling](uint32_t slot) { return culling->entityAt(slot); }, outVisible);
     }
 
-    return count;
+    // Renderables without bounds are always visible: they follow the render group in the
+    // RenderableComponent storage (with the bounded ones that lack a transform)
+    const auto& transforms = registry.storage<TransformComponent>();
+    const auto& renderables = registry.storage<RenderableComponent>();
+    const auto& bounds = registry.storage<BoundingComponent>();
+    const auto renderableAt = renderables.rbegin();
+    for (size_t i = World::renderGroup(registry).size(); i < renderables.size(); ++i)
+    {
+        const Entity entity = renderables.data()[i];
+        if (transforms.contains(entity) && !bounds.contains(entity) && isDrawable(renderableAt[i]))
+        {
+            outVisible.push_back(entity);
+        }
+    }
+}
+
+size_t FrustumCullSystem::countVisible(EntityRegistry& registry,
+                                        const Frustum& frustum,
+                                        WorkerPool* pool)
+{
+    cullEntities(registry, frustum, t_visibleEntities, pool);
+    return t_visibleEntities.size();
 }
 
 Frustum FrustumCullSystem::buildFrustum(const Matrix4x4& viewMatrix,
@@ -7,24 +7,42 @@
 
 namespace vesper {
 
+class WorkerPool;
+
 /// @brief System for frustum culling entities
+/// Uses the acceleration structures World keeps in the registry context when present:
+/// - BoundingVolumeHierarchy first: whole subtrees outside (or inside) the frustum are rejected
+///   (or accepted) at once, so cost follows the number of visible objects.
+/// - CullingBuffer when the view turns out dense (more than 1/kDenseViewDivisor of the bounded
+///   entities visible): bounding spheres are tested in SIMD batches, optionally split across a
+///   WorkerPool, which beats the tree walk once a large part of the scene is visible.
+/// Registries without either fall back to testing each BoundingComponent directly. Every path
+/// tests the world sphere first and the tighter world AABB for the survivors.
 class FrustumCullSystem
 {
 public:
+    /// @brief The BVH walk gives up for the linear scan above size / kDenseViewDivisor visible entities
+    static constexpr size_t kDenseViewDivisor = 64;
+
     /// @brief Cull entities against frustum, outputting visible entities
+    /// Renderables without a BoundingComponent are always visible.
     /// @param registry The entity registry to query
     /// @param frustum The view frustum to test against
     /// @param outVisible Output vector of visible entities
+    /// @param pool Pool used to split the sphere tests (nullptr = calling thread)
     static void cullEntities(EntityRegistry& registry,
                              const Frustum& frustum,
-                             std::vector<Entity>& outVisible);
+                             std::vector<Entity>& outVisible,
+                             WorkerPool* pool = nullptr);
 
     /// @brief Cull entities and return count (without storing entities)
     /// @param registry The entity registry to query
     /// @param frustum The view frustum to test against
+    /// @param pool Pool used to split the sphere tests (nullptr = calling thread)
     /// @return Number of visible entities
     static size_t countVisible(EntityRegistry& registry,
-                               const Frustum& frustum);
+                               const Frustum& frustum,
+                               WorkerPool* pool = nullptr);
 
     /// @brief Build frustum from camera matrices
     /// @param viewMatrix Camera view matrix
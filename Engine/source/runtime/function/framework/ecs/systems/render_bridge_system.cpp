@@ -1,31 +1,196 @@
 #include "runtime/function/framework/ecs/systems/render_bridge_system.h"
 #include "runtime/function/framework/ecs/systems/frustum_cull_system.h"
+#include "runtime/function/framework/ecs/world.h"
 #include "runtime/function/framework/component/transform/transform_component.h"
 #include "runtime/function/framework/component/mesh/renderable_component.h"
 #include "runtime/function/framework/component/camera/camera_component.h"
 #include "runtime/function/framework/component/common/bounding_component.h"
 #include "runtime/function/render/render_packet.h"
 #include "runtime/function/render/camera.h"
+#include "runtime/core/threading/worker_pool.h"
+#include "runtime/core/base/macro.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <vector>
 
 namespace vesper {
 
+namespace {
+
+/// @brief Last epoch handed out by RenderChangeEpochs::stamp (shared so epochs never repeat across registries)
+std::atomic<uint64_t> g_lastRenderEpoch{0};
+
+/// @brief Culling output reused across frames on this thread
+thread_local std::vector<Entity> t_visibleEntities;
+
+/// @brief Per-chunk visible counts, then output offsets, of a fill without culling
+thread_local std::vector<size_t> t_chunkOffsets;
+
+/// @brief Build the render description of one entity
+RenderObjectDesc makeObjectDesc(Entity entity,
+                                const TransformComponent& transform,
+                                const RenderableComponent& renderable,
+                                const BoundingComponent* bounds)
+{
+    VESPER_ASSERT(renderable.meshId <= kMaxRenderResourceId && renderable.materialId <= kMaxRenderResourceId,
+                  "Render resource ids are 16-bit");
+
+    RenderObjectDesc desc;
+    desc.object_id = entityToId(entity);
+    desc.mesh_id = static_cast<uint16_t>(renderable.meshId);
+    desc.material_id = static_cast<uint16_t>(renderable.materialId);
+
+    // World transform as a 3x4 affine matrix
+    desc.setTransform(transform.worldMatrix.ptr());
+
+    // Copy bounding sphere if available
+    if (bounds)
+    {
+        desc.bounding_sphere[0] = bounds->worldCenter.x;
+        desc.bounding_sphere[1] = bounds->worldCenter.y;
+        desc.bounding_sphere[2] = bounds->worldCenter.z;
+        desc.bounding_sphere[3] = bounds->worldRadius;
+    }
+
+    return desc;
+}
+
+bool isDrawable(const RenderableComponent& renderable)
+{
+    return renderable.visible && renderable.isValid();
+}
+
+/// @brief Run fn(begin, end) over [0, count) in kParallelChunkSize chunks on the pool (or inline)
+template<typename Fn>
+void forEachChunk(WorkerPool* pool, size_t count, Fn&& fn)
+{
+    if (!pool || count <= RenderBridgeSystem::kParallelChunkSize)
+    {
+        fn(size_t{0}, count);
+        return;
+    }
+    pool->parallelForRange(0, count, RenderBridgeSystem::kParallelChunkSize, fn);
+}
+
+/// @brief Writes a packet's visible objects by index, from any thread
+/// Construction (on the filling thread) sizes the output of the packet's format. For descriptors
+/// it also decides which entries of the packet's previous fill may be kept: an entry is left
+/// untouched if it holds the same object and that object was not stamped as changed since.
+class VisibleObjectWriter
+{
+public:
+    VisibleObjectWriter(EntityRegistry& registry, RenderPacket& packet, size_t count)
+        : m_transforms(registry.storage<TransformComponent>())
+        , m_renderables(registry.storage<RenderableComponent>())
+        , m_bounds(registry.storage<BoundingComponent>())
+    {
+        if (packet.format == RenderPacketFormat::Instanced)
+        {
+            packet.visibleObjects.clear();
+            packet.visibleSource = nullptr;
+            packet.visibleInstances.resize(count);
+            m_instances = packet.visibleInstances.data();
+            return;
+        }
+        packet.visibleInstances.clear();
+
+        RenderChangeEpochs* epochs = registry.ctx().find<RenderChangeEpochs>();
+        const uint64_t epoch = epochs ? epochs->stamp(registry) : 0;
+        if (epochs && packet.visibleSource == epochs)
+        {
+            m_epochs = epochs;
+            m_previousEpoch = packet.visibleEpoch;
+            m_reusableCount = std::min(packet.visibleObjects.size(), count);
+        }
+
+        packet.visibleObjects.resize(count);
+        packet.visibleSource = epochs;
+        packet.visibleEpoch = epoch;
+        m_output = packet.visibleObjects.data();
+    }
+
+    void write(size_t index, Entity entity) const
+    {
+        if (needsDesc(index, entity))
+        {
+            m_output[index] = makeObjectDesc(entity, m_transforms.get(entity), m_renderables.get(entity),
+                                             m_bounds.contains(entity) ? &m_bounds.get(entity) : nullptr);
+        }
+    }
+
+    /// @brief write() with the renderable and bounds already at hand (render group walk)
+    void write(size_t index, Entity entity, const RenderableComponent& renderable, const BoundingComponent* bounds) const
+    {
+        if (needsDesc(index, entity))
+        {
+            m_output[index] = makeObjectDesc(entity, m_transforms.get(entity), renderable, bounds);
+        }
+    }
+
+private:
+    /// @brief Write an instance id, or decide whether the descriptor entry must be (re)built
+    bool needsDesc(size_t index, Entity entity) const
+    {
+        if (m_instances)
+        {
+            m_instances[index] = entityToId(entity);
+            return false;
+        }
+        return !(index < m_reusableCount && m_output[index].object_id == entityToId(entity) &&
+                 m_epochs->unchangedSince(entity, m_previousEpoch));
+    }
+
+private:
+    const entt::storage_for_t<TransformComponent>& m_transforms;
+    const entt::storage_for_t<RenderableComponent>& m_renderables;
+    const entt::storage_for_t<BoundingComponent>& m_bounds;
+    const RenderChangeEpochs* m_epochs{nullptr};
+    uint64_t m_previousEpoch{0};
+    size_t m_reusableCount{0};
+    RenderObjectDesc* m_output{nullptr};
+    uint32_t* m_instances{nullptr};
+};
+
+} // namespace
+
+uint64_t RenderChangeEpochs::stamp(EntityRegistry& registry)
+{
+    const uint64_t epoch = g_lastRenderEpoch.fetch_add(1, std::memory_order_relaxed) + 1;
+    for (Entity entity : changeSet(registry, kRenderChangeSet))
+    {
+        const size_t index = static_cast<size_t>(entt::to_entity(entity));
+        if (index >= changedAt.size())
+        {
+            changedAt.resize(index + 1, 0);
+        }
+        changedAt[index] = epoch;
+    }
+    return epoch;
+}
+
 void RenderBridgeSystem::fillRenderPacket(EntityRegistry& registry,
                                            RenderPacket* packet,
-                                           Entity mainCamera)
+                                           Entity mainCamera,
+                                           WorkerPool* pool,
+                                           bool frustumCull)
 {
     if (!packet)
         return;
 
-    packet->clear();
+    // visibleObjects is overwritten in place, keeping what did not change
+    packet->clearForRefill();
 
     // Fill camera parameters
     auto* cameraComp = registry.try_get<CameraComponent>(mainCamera);
     if (cameraComp && cameraComp->camera)
     {
         fillCameraParams(cameraComp->camera.get(), packet);
+    }
 
+    if (cameraComp && cameraComp->camera && frustumCull)
+    {
         // Build frustum from camera
         Frustum frustum = FrustumCullSystem::buildFrustum(
             cameraComp->camera->getViewMatrix(),
@@ -33,13 +198,17 @@ void RenderBridgeSystem::fillRenderPacket(EntityRegistry& registry,
         );
 
         // Fill visible objects with frustum culling
-        fillVisibleObjects(registry, packet, frustum);
+        fillVisibleObjects(registry, packet, frustum, pool);
     }
     else
     {
-        // No camera - fill all objects without culling
-        fillVisibleObjectsNoClip(registry, packet);
+        // No camera, or the consumer culls - fill all objects without culling
+        fillVisibleObjectsNoClip(registry, packet, pool);
     }
+
+    // The visible fill just stamped the change set: stamping it again would make the next
+    // refill of this packet rewrite every object that changed this frame
+    consumeObjectUpdates(registry, packet, false);
 }
 
 void RenderBridgeSystem::fillCameraParams(Camera* camera, RenderPacket* packet)
@@ -69,93 +238,131 @@ void RenderBridgeSystem::fillCameraParams(Camera* camera, RenderPacket* packet)
 
 void RenderBridgeSystem::fillVisibleObjects(EntityRegistry& registry,
                                              RenderPacket* packet,
-                                             const Frustum& frustum)
+                                             const Frustum& frustum,
+                                             WorkerPool* pool)
 {
     if (!packet)
         return;
 
-    auto view = registry.view<TransformComponent, RenderableComponent>();
+    // Frustum culling
+    FrustumCullSystem::cullEntities(registry, frustum, t_visibleEntities, pool);
 
-    for (auto [entity, transform, renderable] : view.each())
-    {
-        // Skip invisible
-        if (!renderable.visible)
-            continue;
+    // The visible count is known: every chunk writes straight into its final range
+    // (workers must not name the thread_local, they would see their own)
+    const std::vector<Entity>& visible = t_visibleEntities;
+    const VisibleObjectWriter writer(registry, *packet, visible.size());
+    forEachChunk(pool, visible.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            writer.write(i, visible[i]);
+        }
+    });
+}
+
+void RenderBridgeSystem::fillVisibleObjectsNoClip(EntityRegistry& registry,
+                                                   RenderPacket* packet,
+                                                   WorkerPool* pool)
+{
+    if (!packet)
+        return;
 
-        // Skip invalid renderables
-        if (!renderable.isValid())
-            continue;
+    // The render group leads both storages: position i < groupSize holds the same entity's
+    // renderable and bounds (with a transform); renderables without bounds follow
+    const size_t groupSize = World::renderGroup(registry).size();
+    const auto& transforms = registry.storage<TransformComponent>();
+    const auto& renderables = registry.storage<RenderableComponent>();
+    const auto& bounds = registry.storage<BoundingComponent>();
+    const Entity* entities = renderables.data();
+    const size_t entityCount = renderables.size();
+    const auto renderableAt = renderables.rbegin();
+    const auto boundsAt = bounds.rbegin();
 
-        // Frustum culling
-        auto* bounds = registry.try_get<BoundingComponent>(entity);
-        if (bounds)
+    const auto isVisible = [&](size_t i) {
+        return (i < groupSize || transforms.contains(entities[i])) && isDrawable(renderableAt[i]);
+    };
+
+    // Count the drawable renderables per chunk, then turn the counts into output offsets
+    const size_t chunkCount = (entityCount + kParallelChunkSize - 1) / kParallelChunkSize;
+    t_chunkOffsets.assign(chunkCount + 1, 0);
+    const auto runChunks = [&](auto&& fn) {
+        if (!pool || chunkCount <= 1)
         {
-            if (!frustum.testSphere(bounds->worldCenter, bounds->worldRadius))
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk)
             {
-                continue; // Culled
+                fn(chunk);
             }
+            return;
         }
+        pool->parallelFor(0, chunkCount, 1, fn);
+    };
 
-        // Create render object descriptor
-        RenderObjectDesc desc;
-        desc.object_id = entityToId(entity);
-        desc.mesh_id = renderable.meshId;
-        desc.material_id = renderable.materialId;
-
-        // Copy world transform
-        std::memcpy(desc.transform, transform.worldMatrix.ptr(), sizeof(float) * 16);
+    std::vector<size_t>& offsets = t_chunkOffsets;
+    runChunks([&](size_t chunk) {
+        const size_t end = std::min(entityCount, (chunk + 1) * kParallelChunkSize);
+        size_t count = 0;
+        for (size_t i = chunk * kParallelChunkSize; i < end; ++i)
+        {
+            count += isVisible(i) ? 1 : 0;
+        }
+        offsets[chunk + 1] = count;
+    });
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        offsets[chunk + 1] += offsets[chunk];
+    }
 
-        // Copy bounding sphere
-        if (bounds)
+    const VisibleObjectWriter writer(registry, *packet, offsets[chunkCount]);
+    runChunks([&](size_t chunk) {
+        const size_t end = std::min(entityCount, (chunk + 1) * kParallelChunkSize);
+        size_t index = offsets[chunk];
+        for (size_t i = chunk * kParallelChunkSize; i < end; ++i)
         {
-            desc.bounding_sphere[0] = bounds->worldCenter.x;
-            desc.bounding_sphere[1] = bounds->worldCenter.y;
-            desc.bounding_sphere[2] = bounds->worldCenter.z;
-            desc.bounding_sphere[3] = bounds->worldRadius;
+            if (isVisible(i))
+            {
+                writer.write(index++, entities[i], renderableAt[i], i < groupSize ? &boundsAt[i] : nullptr);
+            }
         }
+    });
+}
 
-        packet->visibleObjects.push_back(desc);
-    }
+void RenderBridgeSystem::fillObjectUpdates(EntityRegistry& registry,
+                                            RenderPacket* packet)
+{
+    consumeObjectUpdates(registry, packet, true);
 }
 
-void RenderBridgeSystem::fillVisibleObjectsNoClip(EntityRegistry& registry,
-                                                   RenderPacket* packet)
+void RenderBridgeSystem::consumeObjectUpdates(EntityRegistry& registry,
+                                               RenderPacket* packet,
+                                               bool stampEpochs)
 {
     if (!packet)
         return;
 
-    auto view = registry.view<TransformComponent, RenderableComponent>();
-
-    for (auto [entity, transform, renderable] : view.each())
+    if (auto* removals = registry.ctx().find<RenderRemovals>())
     {
-        // Skip invisible
-        if (!renderable.visible)
-            continue;
-
-        // Skip invalid renderables
-        if (!renderable.isValid())
-            continue;
-
-        // Create render object descriptor
-        RenderObjectDesc desc;
-        desc.object_id = entityToId(entity);
-        desc.mesh_id = renderable.meshId;
-        desc.material_id = renderable.materialId;
+        packet->objectsToDelete.insert(packet->objectsToDelete.end(), removals->objectIds.begin(), removals->objectIds.end());
+        removals->objectIds.clear();
+    }
 
-        // Copy world transform
-        std::memcpy(desc.transform, transform.worldMatrix.ptr(), sizeof(float) * 16);
+    ChangeSet& changes = changeSet(registry, kRenderChangeSet);
+    if (changes.empty())
+        return;
 
-        // Copy bounding sphere if available
-        if (auto* bounds = registry.try_get<BoundingComponent>(entity))
-        {
-            desc.bounding_sphere[0] = bounds->worldCenter.x;
-            desc.bounding_sphere[1] = bounds->worldCenter.y;
-            desc.bounding_sphere[2] = bounds->worldCenter.z;
-            desc.bounding_sphere[3] = bounds->worldRadius;
-        }
+    // Packets refilled later must see these changes after the set is consumed
+    auto* epochs = registry.ctx().find<RenderChangeEpochs>();
+    if (epochs && stampEpochs)
+    {
+        epochs->stamp(registry);
+    }
 
-        packet->visibleObjects.push_back(desc);
+    // The set may hold entities destroyed (or stripped) since they changed
+    const auto& bounds = registry.storage<BoundingComponent>();
+    for (auto [entity, transform, renderable] : changes.view<TransformComponent, RenderableComponent>().each())
+    {
+        packet->objectsToUpdate.push_back(
+            makeObjectDesc(entity, transform, renderable, bounds.contains(entity) ? &bounds.get(entity) : nullptr));
     }
+    changes.clear();
 }
 
 } // namespace vesper
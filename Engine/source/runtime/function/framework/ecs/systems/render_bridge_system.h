@@ -3,42 +3,114 @@
 #include "runtime/function/framework/ecs/ecs_types.h"
 #include "runtime/function/framework/ecs/systems/frustum.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace vesper {
 
 // Forward declarations
 struct RenderPacket;
 class Camera;
+class WorkerPool;
+
+/// @brief Epoch at which each entity's render description last changed
+/// World keeps one in the registry context. Every fill stamps the entities of the kRenderChangeSet
+/// with a new epoch (unique across registries) before reading them, so an entry a packet received
+/// at epoch E is still current if its entity was stamped at or before E.
+struct RenderChangeEpochs
+{
+    /// @brief Entity index -> epoch of its last render change (0 = never stamped)
+    std::vector<uint64_t> changedAt;
+
+    /// @brief Stamp the entities of the registry's kRenderChangeSet with a new epoch (without consuming it)
+    /// @return The new epoch
+    uint64_t stamp(EntityRegistry& registry);
+
+    /// @brief Check if an entity is unchanged since the given epoch
+    bool unchangedSince(Entity entity, uint64_t epoch) const
+    {
+        const size_t index = static_cast<size_t>(entt::to_entity(entity));
+        return index < changedAt.size() && changedAt[index] != 0 && changedAt[index] <= epoch;
+    }
+};
+
+/// @brief Object ids of renderables destroyed since the last fill (consumed into RenderPacket::objectsToDelete)
+/// World keeps one in the registry context, fed by on_destroy<RenderableComponent>.
+struct RenderRemovals
+{
+    std::vector<uint32_t> objectIds;
+
+    /// @brief on_destroy<RenderableComponent> handler
+    void onRenderableDestroyed(EntityRegistry& /*registry*/, Entity entity)
+    {
+        objectIds.push_back(entityToId(entity));
+    }
+};
 
 /// @brief RenderBridgeSystem - converts ECS data to RenderPacket for rendering
+/// Visible objects are written by WorkerPool chunks straight into their final index (the count
+/// is known after culling, or from a per-chunk prefix sum without culling), in the packet's
+/// format: full descriptors, or instance ids when the consumer keeps an instance table from the
+/// deltas. With a World registry (RenderChangeEpochs in its context), refilling a recycled packet
+/// skips descriptors that already hold the same, unchanged object, so a static view copies no
+/// transforms.
 class RenderBridgeSystem
 {
 public:
-    /// @brief Fill a RenderPacket from ECS data with frustum culling
+    /// @brief Visible objects per parallel fill task
+    static constexpr size_t kParallelChunkSize = 4096;
+
+    /// @brief Fill a RenderPacket from ECS data with frustum culling (and object updates)
+    /// Clears the packet except visibleObjects, which is refilled in place.
     /// @param registry The entity registry containing scene data
     /// @param packet The packet to fill
     /// @param mainCamera The main camera entity
+    /// @param pool Pool used to split the culling and fill work (nullptr = calling thread)
+    /// @param frustumCull false when the consumer culls (GPU culling): every drawable object is listed
     static void fillRenderPacket(EntityRegistry& registry,
                                   RenderPacket* packet,
-                                  Entity mainCamera);
+                                  Entity mainCamera,
+                                  WorkerPool* pool = nullptr,
+                                  bool frustumCull = true);
 
     /// @brief Fill only camera parameters
     /// @param camera Camera to extract parameters from
     /// @param packet The packet to fill
     static void fillCameraParams(Camera* camera, RenderPacket* packet);
 
-    /// @brief Fill visible objects with frustum culling
+    /// @brief Replace the packet's visible objects with the ones passing frustum culling
     /// @param registry The entity registry
     /// @param packet The packet to fill
     /// @param frustum Frustum for culling
+    /// @param pool Pool used to split the culling and fill work (nullptr = calling thread)
     static void fillVisibleObjects(EntityRegistry& registry,
                                     RenderPacket* packet,
-                                    const Frustum& frustum);
+                                    const Frustum& frustum,
+                                    WorkerPool* pool = nullptr);
 
-    /// @brief Fill visible objects without frustum culling
+    /// @brief Replace the packet's visible objects with every drawable renderable (no culling)
     /// @param registry The entity registry
     /// @param packet The packet to fill
+    /// @param pool Pool used to split the fill work (nullptr = calling thread)
     static void fillVisibleObjectsNoClip(EntityRegistry& registry,
-                                          RenderPacket* packet);
+                                          RenderPacket* packet,
+                                          WorkerPool* pool = nullptr);
+
+    /// @brief Fill objectsToUpdate from the kRenderChangeSet and objectsToDelete from the RenderRemovals
+    /// Entities appear once per change (created, moved, bounds or renderable patched), not every
+    /// frame, so a static scene produces no updates. Deltas are only complete for a consumer that
+    /// sees every packet, or whose RenderPacketBuffer carries skipped ones over (LatestOnly).
+    /// @param registry The entity registry
+    /// @param packet The packet to fill
+    static void fillObjectUpdates(EntityRegistry& registry,
+                                  RenderPacket* packet);
+
+private:
+    /// @brief fillObjectUpdates, optionally without stamping RenderChangeEpochs first
+    /// (only safe right after a visible fill stamped the same, unmodified change set)
+    static void consumeObjectUpdates(EntityRegistry& registry,
+                                     RenderPacket* packet,
+                                     bool stampEpochs);
 };
 
 } // namespace vesper
@@ -0,0 +1,221 @@
+#include "runtime/function/framework/ecs/transform_hierarchy.h"
+#include "runtime/core/threading/worker_pool.h"
+#include "runtime/core/log/log_system.h"
+
+#include <algorithm>
+
+namespace vesper {
+
+void TransformHierarchy::update(EntityRegistry& registry, WorkerPool* pool)
+{
+    ChangeSet& changes = changeSet(registry, kTransformChangeSet);
+
+    m_changedEntities.clear();
+    if (!m_structureDirty && changes.empty())
+    {
+        return;
+    }
+
+    if (m_structureDirty)
+    {
+        rebuild(registry);
+    }
+
+    for (Entity entity : changes)
+    {
+        // Destroyed or unreachable entities have no slot
+        const size_t index = static_cast<size_t>(entt::to_entity(entity));
+        if (index < m_slotOfEntity.size())
+        {
+            const uint32_t slot = m_slotOfEntity[index];
+            if (slot != kNoParent && m_entities[slot] == entity)
+            {
+                seed(slot);
+            }
+        }
+    }
+    changes.clear();
+
+    // Levels run in order (children read their parent's result); slots within a level are independent
+    for (size_t level = 0; level < m_levelQueues.size(); ++level)
+    {
+        std::vector<uint32_t>& queue = m_levelQueues[level];
+        if (queue.empty())
+        {
+            continue;
+        }
+
+        // Seeds arrive in change order: sort so the level is walked front to back
+        if (!std::is_sorted(queue.begin(), queue.end()))
+        {
+            std::sort(queue.begin(), queue.end());
+        }
+
+        if (pool && queue.size() >= kParallelLevelThreshold)
+        {
+            pool->parallelForRange(0, queue.size(), kParallelGrainSize, [this, &queue](size_t chunkBegin, size_t chunkEnd) {
+                updateSlots(std::span<const uint32_t>(queue).subspan(chunkBegin, chunkEnd - chunkBegin));
+            });
+        }
+        else
+        {
+            updateSlots(queue);
+        }
+
+        // Every child of a recomputed slot follows in the next level
+        for (uint32_t slot : queue)
+        {
+            m_changedEntities.push_back(m_entities[slot]);
+            m_queued[slot] = 0;
+
+            const uint32_t firstChild = m_firstChildren[slot];
+            for (uint32_t child = firstChild; child < firstChild + m_childCounts[slot]; ++child)
+            {
+                if (!m_queued[child])
+                {
+                    m_queued[child] = 1;
+                    m_levelQueues[level + 1].push_back(child);
+                }
+            }
+        }
+        queue.clear();
+    }
+}
+
+void TransformHierarchy::rebuild(EntityRegistry& registry)
+{
+    auto& transforms = registry.storage<TransformComponent>();
+    const auto& hierarchies = registry.storage<HierarchyComponent>();
+
+    // Keep the previous layout to find entities whose parent changed
+    m_previousEntities.swap(m_entities);
+    m_previousParents.swap(m_parents);
+    m_entities.clear();
+    m_parents.clear();
+    m_firstChildren.clear();
+    m_childCounts.clear();
+    m_levelOffsets.clear();
+    m_entities.reserve(transforms.size());
+    m_parents.reserve(transforms.size());
+
+    // Level 0: no parent, or a parent without a transform (treated as the origin)
+    for (Entity entity : registry.view<TransformComponent>())
+    {
+        const Entity parent = hierarchies.contains(entity) ? hierarchies.get(entity).parent : NullEntity;
+        if (parent == NullEntity || !transforms.contains(parent))
+        {
+            m_entities.push_back(entity);
+            m_parents.push_back(kNoParent);
+        }
+    }
+
+    // Each following level is the children of the previous one, grouped by parent
+    size_t levelBegin = 0;
+    while (levelBegin < m_entities.size())
+    {
+        const size_t levelEnd = m_entities.size();
+        m_levelOffsets.push_back(levelBegin);
+
+        for (size_t slot = levelBegin; slot < levelEnd; ++slot)
+        {
+            const uint32_t firstChild = static_cast<uint32_t>(m_entities.size());
+            const Entity entity = m_entities[slot];
+            Entity child = hierarchies.contains(entity) ? hierarchies.get(entity).firstChild : NullEntity;
+            while (child != NullEntity)
+            {
+                // Children without a transform (and their subtrees) are not part of this hierarchy
+                if (transforms.contains(child))
+                {
+                    m_entities.push_back(child);
+                    m_parents.push_back(static_cast<uint32_t>(slot));
+                }
+                child = hierarchies.contains(child) ? hierarchies.get(child).nextSibling : NullEntity;
+            }
+            m_firstChildren.push_back(firstChild);
+            m_childCounts.push_back(static_cast<uint32_t>(m_entities.size()) - firstChild);
+        }
+
+        levelBegin = levelEnd;
+    }
+    m_levelOffsets.push_back(m_entities.size());
+
+    if (m_entities.size() != transforms.size())
+    {
+        LOG_WARN("TransformHierarchy: {} transforms are not reachable from a root (parent cycle) and will not be updated",
+                 transforms.size() - m_entities.size());
+    }
+
+    // Store the components in slot order so each level walks memory linearly
+    transforms.sort_as(m_entities.begin(), m_entities.end());
+
+    // World matrices of unchanged transforms are still valid: only changed entities get recomputed
+    m_transforms.resize(m_entities.size());
+    m_worldMatrices.resize(m_entities.size());
+    m_queued.assign(m_entities.size(), 0);
+    m_levelQueues.resize(levelCount() + 1);
+    for (auto& queue : m_levelQueues)
+    {
+        queue.clear();
+    }
+
+    std::vector<uint32_t> previousSlotOfEntity(m_slotOfEntity.size(), kNoParent);
+    previousSlotOfEntity.swap(m_slotOfEntity);
+
+    for (size_t slot = 0; slot < m_entities.size(); ++slot)
+    {
+        const Entity entity = m_entities[slot];
+        const size_t index = static_cast<size_t>(entt::to_entity(entity));
+        if (index >= m_slotOfEntity.size())
+        {
+            m_slotOfEntity.resize(index + 1, kNoParent);
+        }
+        m_slotOfEntity[index] = static_cast<uint32_t>(slot);
+
+        m_transforms[slot] = &transforms.get(entity);
+        m_worldMatrices[slot] = m_transforms[slot]->worldMatrix;
+
+        // Reparented without a patch (e.g. HierarchyComponent removed): the cached matrix is stale
+        const Entity parent = m_parents[slot] == kNoParent ? NullEntity : m_entities[m_parents[slot]];
+        const uint32_t previousSlot = index < previousSlotOfEntity.size() ? previousSlotOfEntity[index] : kNoParent;
+        if (previousSlot != kNoParent && m_previousEntities[previousSlot] == entity)
+        {
+            const uint32_t previousParent = m_previousParents[previousSlot];
+            if ((previousParent == kNoParent ? NullEntity : m_previousEntities[previousParent]) != parent)
+            {
+                seed(static_cast<uint32_t>(slot));
+            }
+        }
+    }
+
+    m_structureDirty = false;
+}
+
+void TransformHierarchy::seed(uint32_t slot)
+{
+    if (m_queued[slot])
+    {
+        return;
+    }
+    m_queued[slot] = 1;
+
+    const auto level = std::upper_bound(m_levelOffsets.begin(), m_levelOffsets.end(), slot) - m_levelOffsets.begin() - 1;
+    m_levelQueues[static_cast<size_t>(level)].push_back(slot);
+}
+
+void TransformHierarchy::updateSlots(std::span<const uint32_t> slots)
+{
+    for (uint32_t slot : slots)
+    {
+        Matrix4x4 world = m_transforms[slot]->getLocalMatrix();
+        const uint32_t parent = m_parents[slot];
+        if (parent != kNoParent)
+        {
+            world = world * m_worldMatrices[parent];
+        }
+
+        m_worldMatrices[slot] = world;
+        m_transforms[slot]->worldMatrix = world;
+    }
+}
+
+} // namespace vesper
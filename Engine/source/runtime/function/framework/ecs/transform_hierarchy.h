@@ -0,0 +1,100 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+#include "runtime/function/framework/ecs/ecs_types.h"
+#include "runtime/function/framework/component/transform/transform_component.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vesper {
+
+class WorkerPool;
+
+/// @brief Depth-sorted (breadth-first) view of the transform hierarchy used by World::updateTransforms
+/// Every entity with a TransformComponent gets one slot; slots are grouped by depth so that
+/// all parents of level N live in levels < N, and the children of one slot are contiguous in
+/// the next level. An update seeds the slots of the entities in the kTransformChangeSet and
+/// walks level by level through only those slots, entities whose parent changed in a rebuild,
+/// and their descendants, reading parent world matrices from a contiguous array by index;
+/// slots of one level are independent so large levels are split across the WorkerPool.
+/// With no changes an update costs nothing.
+///
+/// The layout is rebuilt lazily after a structural change: TransformComponent or
+/// HierarchyComponent being added/removed (World connects the registry signals) or
+/// World::setParent()/removeParent(). A rebuild also sorts the TransformComponent storage
+/// into slot order, so the storage must not be owned by a group. Slots cache
+/// TransformComponent pointers, which stay valid until the next such change (EnTT storage
+/// is paged); sorting the TransformComponent storage elsewhere must call markStructureDirty().
+class TransformHierarchy
+{
+public:
+    static constexpr uint32_t kNoParent = UINT32_MAX;
+
+    /// @brief Levels with fewer changed slots than this are updated on the calling thread
+    static constexpr size_t kParallelLevelThreshold = 2048;
+
+    /// @brief Slots per parallel chunk
+    static constexpr size_t kParallelGrainSize = 512;
+
+    TransformHierarchy() = default;
+
+    VESPER_DISABLE_COPY_AND_MOVE(TransformHierarchy)
+
+    /// @brief Request a rebuild of the depth-sorted layout before the next update
+    void markStructureDirty() { m_structureDirty = true; }
+
+    /// @brief Recompute world matrices of changed transforms and everything below them
+    /// Consumes (clears) the registry's kTransformChangeSet.
+    /// @param registry Registry owning the transforms
+    /// @param pool Pool used to split large levels (nullptr = update on the calling thread)
+    void update(EntityRegistry& registry, WorkerPool* pool);
+
+    /// @brief Entities whose world matrix was recomputed by the last update()
+    std::span<const Entity> changedEntities() const { return m_changedEntities; }
+
+    /// @brief Number of slots (transforms reachable from a root) in the current layout
+    size_t nodeCount() const { return m_transforms.size(); }
+
+    /// @brief Depth of the deepest hierarchy + 1 in the current layout
+    size_t levelCount() const { return m_levelOffsets.empty() ? 0 : m_levelOffsets.size() - 1; }
+
+private:
+    /// @brief Re-sort all transforms by depth (breadth-first from the roots)
+    void rebuild(EntityRegistry& registry);
+
+    /// @brief Queue a slot (and, through propagation, its subtree) for recomputation
+    void seed(uint32_t slot);
+
+    /// @brief Recompute the world matrices of the given slots (all in one level)
+    void updateSlots(std::span<const uint32_t> slots);
+
+private:
+    // Per slot, in depth order
+    std::vector<Entity> m_entities;
+    std::vector<TransformComponent*> m_transforms;
+    std::vector<uint32_t> m_parents;           // Slot of the parent, kNoParent for roots
+    std::vector<uint32_t> m_firstChildren;     // Children are [first, first + count) in the next level
+    std::vector<uint32_t> m_childCounts;
+    std::vector<Matrix4x4> m_worldMatrices;    // Last computed world matrix (read by children)
+    std::vector<uint8_t> m_queued;             // Already in a level queue this update
+
+    // Slots [m_levelOffsets[i], m_levelOffsets[i + 1]) are depth i
+    std::vector<size_t> m_levelOffsets;
+
+    // Entity index -> slot (check m_entities[slot] == entity: indices are recycled)
+    std::vector<uint32_t> m_slotOfEntity;
+
+    // Layout before the last rebuild
+    std::vector<Entity> m_previousEntities;
+    std::vector<uint32_t> m_previousParents;
+
+    // Per update scratch
+    std::vector<std::vector<uint32_t>> m_levelQueues;
+    std::vector<Entity> m_changedEntities;
+
+    bool m_structureDirty{true};
+};
+
+} // namespace vesper
@@ -1,7 +1,103 @@
 #include "runtime/function/framework/ecs/world.h"
+#include "runtime/function/framework/ecs/systems/culling_buffer.h"
+#include "runtime/function/framework/ecs/systems/bounding_volume_hierarchy.h"
+#include "runtime/function/framework/ecs/systems/render_bridge_system.h"
+#include "runtime/function/framework/component/mesh/render_resource_component.h"
 
 namespace vesper {
 
+namespace {
+
+/// @brief Drop an entity from a change set when the component that put it there goes away
+void discardChange(ChangeSet& changes, EntityRegistry& /*registry*/, Entity entity)
+{
+    changes.remove(entity);
+}
+
+/// @brief Put a renderable in a change set when a component its render description reads goes away
+void markRenderableChange(ChangeSet& changes, EntityRegistry& registry, Entity entity)
+{
+    if (registry.all_of<RenderableComponent>(entity) && !changes.contains(entity))
+    {
+        changes.emplace(entity);
+    }
+}
+
+/// @brief Keep RenderableComponent::hasResources equal to the presence of a RenderResourceComponent
+void onRenderableConstructed(EntityRegistry& registry, Entity entity)
+{
+    registry.get<RenderableComponent>(entity).hasResources = registry.all_of<RenderResourceComponent>(entity);
+}
+
+void onRenderResourcesConstructed(EntityRegistry& registry, Entity entity)
+{
+    if (auto* renderable = registry.try_get<RenderableComponent>(entity))
+    {
+        renderable->hasResources = true;
+    }
+}
+
+void onRenderResourcesDestroyed(EntityRegistry& registry, Entity entity)
+{
+    if (auto* renderable = registry.try_get<RenderableComponent>(entity))
+    {
+        renderable->hasResources = false;
+    }
+}
+
+} // namespace
+
+World::World()
+    : m_transformHierarchy(std::make_unique<TransformHierarchy>())
+{
+    // Any transform or hierarchy link appearing/disappearing changes the depth-sorted layout
+    TransformHierarchy& hierarchy = *m_transformHierarchy;
+    m_registry.on_construct<TransformComponent>().connect<&TransformHierarchy::markStructureDirty>(hierarchy);
+    m_registry.on_destroy<TransformComponent>().connect<&TransformHierarchy::markStructureDirty>(hierarchy);
+    m_registry.on_construct<HierarchyComponent>().connect<&TransformHierarchy::markStructureDirty>(hierarchy);
+    m_registry.on_destroy<HierarchyComponent>().connect<&TransformHierarchy::markStructureDirty>(hierarchy);
+
+    // Culling spheres and the BVH follow the bounds; both live in the registry context, which keeps
+    // them at a stable address across World moves (entt::any heap-allocates them)
+    CullingBuffer& culling = m_registry.ctx().emplace<CullingBuffer>();
+    m_registry.on_construct<BoundingComponent>().connect<&CullingBuffer::onBoundsConstructed>(culling);
+    m_registry.on_destroy<BoundingComponent>().connect<&CullingBuffer::onBoundsDestroyed>(culling);
+
+    BoundingVolumeHierarchy& bvh = m_registry.ctx().emplace<BoundingVolumeHierarchy>();
+    m_registry.on_construct<BoundingComponent>().connect<&BoundingVolumeHierarchy::onBoundsConstructed>(bvh);
+    m_registry.on_destroy<BoundingComponent>().connect<&BoundingVolumeHierarchy::onBoundsDestroyed>(bvh);
+
+    // Change sets live in the registry so they follow it when the World is moved. Entries leave
+    // with their component: a stale entity would collide with a recycled one.
+    changeSet(m_registry, kTransformChangeSet)
+        .on_construct<TransformComponent>()
+        .on_update<TransformComponent>()
+        .on_destroy<TransformComponent, &discardChange>();
+    changeSet(m_registry, kBoundsChangeSet)
+        .on_construct<BoundingComponent>()
+        .on_update<BoundingComponent>()
+        .on_destroy<BoundingComponent, &discardChange>();
+    changeSet(m_registry, kRenderChangeSet)
+        .on_construct<RenderableComponent>()
+        .on_update<RenderableComponent>()
+        .on_destroy<RenderableComponent, &discardChange>()
+        .on_destroy<BoundingComponent, &markRenderableChange>();
+
+    // Lets RenderBridgeSystem keep unchanged entries when it refills a recycled packet, and
+    // report destroyed renderables to instance-table consumers
+    m_registry.ctx().emplace<RenderChangeEpochs>();
+    RenderRemovals& removals = m_registry.ctx().emplace<RenderRemovals>();
+    m_registry.on_destroy<RenderableComponent>().connect<&RenderRemovals::onRenderableDestroyed>(removals);
+
+    // Renderables keep their resource references in a separate (cold) component
+    m_registry.on_construct<RenderableComponent>().connect<&onRenderableConstructed>();
+    m_registry.on_construct<RenderResourceComponent>().connect<&onRenderResourcesConstructed>();
+    m_registry.on_destroy<RenderResourceComponent>().connect<&onRenderResourcesDestroyed>();
+
+    // Created before any component exists, so the render hot path never pays for the initial sort
+    renderGroup(m_registry);
+}
+
 // =============================================================================
 // Entity Management
 // =============================================================================
@@ -65,75 +161,74 @@ size_t World::entityCount() const
 
 void World::updateTransforms()
 {
-    // First pass: update root entities (those without parents or with clean parents)
-    auto view = m_registry.view<TransformComponent>();
+    m_transformHierarchy->update(m_registry, nullptr);
+    propagateTransformChanges();
+}
 
-    for (auto [entity, transform] : view.each())
-    {
-        if (!transform.dirty)
-            continue;
+void World::updateTransforms(WorkerPool& pool)
+{
+    m_transformHierarchy->update(m_registry, &pool);
+    propagateTransformChanges();
+}
 
-        auto* hierarchy = tryGetComponent<HierarchyComponent>(entity);
+void World::propagateTransformChanges()
+{
+    ChangeSet& boundsChanges = changeSet(m_registry, kBoundsChangeSet);
+    ChangeSet& renderChanges = changeSet(m_registry, kRenderChangeSet);
+    const auto& bounds = m_registry.storage<BoundingComponent>();
 
-        // If no hierarchy or no parent, this is a root entity
-        if (!hierarchy || !hierarchy->hasParent())
-        {
-            Matrix4x4 localMatrix = transform.getLocalMatrix();
-            transform.worldMatrix = localMatrix;
-            transform.clearDirty();
+    const auto& renderables = m_registry.storage<RenderableComponent>();
 
-            // Update children recursively
-            if (hierarchy && hierarchy->hasChildren())
+    for (Entity entity : m_transformHierarchy->changedEntities())
+    {
+        // Entities with bounds reach the render set through updateBounds()
+        if (bounds.contains(entity))
+        {
+            if (!boundsChanges.contains(entity))
             {
-                updateTransformHierarchy(hierarchy->firstChild, transform.worldMatrix);
+                boundsChanges.emplace(entity);
             }
         }
-    }
-
-    // Second pass: handle remaining dirty transforms (orphaned hierarchies)
-    for (auto [entity, transform] : view.each())
-    {
-        if (transform.dirty)
+        else if (renderables.contains(entity) && !renderChanges.contains(entity))
         {
-            transform.worldMatrix = transform.getLocalMatrix();
-            transform.clearDirty();
+            renderChanges.emplace(entity);
         }
     }
 }
 
-void World::updateTransformHierarchy(Entity entity, const Matrix4x4& parentWorld)
+void World::updateBounds()
 {
-    while (entity != NullEntity)
+    ChangeSet& boundsChanges = changeSet(m_registry, kBoundsChangeSet);
+    if (boundsChanges.empty())
     {
-        auto* transform = tryGetComponent<TransformComponent>(entity);
-        auto* hierarchy = tryGetComponent<HierarchyComponent>(entity);
-
-        if (transform)
-        {
-            Matrix4x4 localMatrix = transform->getLocalMatrix();
-            transform->worldMatrix = localMatrix * parentWorld;
-            transform->clearDirty();
-
-            // Recurse to children
-            if (hierarchy && hierarchy->hasChildren())
-            {
-                updateTransformHierarchy(hierarchy->firstChild, transform->worldMatrix);
-            }
-        }
-
-        // Move to next sibling
-        entity = hierarchy ? hierarchy->nextSibling : NullEntity;
+        return;
     }
-}
 
-void World::updateBounds()
-{
-    auto view = m_registry.view<TransformComponent, BoundingComponent>();
+    ChangeSet& renderChanges = changeSet(m_registry, kRenderChangeSet);
+    CullingBuffer& culling = m_registry.ctx().get<CullingBuffer>();
+    BoundingVolumeHierarchy& bvh = m_registry.ctx().get<BoundingVolumeHierarchy>();
+    const auto& transforms = m_registry.storage<TransformComponent>();
+    auto& bounds = m_registry.storage<BoundingComponent>();
+    const auto& renderables = m_registry.storage<RenderableComponent>();
 
-    for (auto [entity, transform, bounds] : view.each())
+    for (Entity entity : boundsChanges)
     {
-        bounds.updateWorldBounds(transform.worldMatrix);
+        if (!transforms.contains(entity) || !bounds.contains(entity))
+        {
+            continue;
+        }
+
+        BoundingComponent& entityBounds = bounds.get(entity);
+        entityBounds.updateWorldBounds(transforms.get(entity).worldMatrix);
+        culling.update(entity, entityBounds.worldCenter, entityBounds.worldRadius,
+                       entityBounds.worldAabbMin, entityBounds.worldAabbMax);
+        bvh.update(entity, entityBounds.worldCenter, entityBounds.worldRadius);
+        if (renderables.contains(entity) && !renderChanges.contains(entity))
+        {
+            renderChanges.emplace(entity);
+        }
     }
+    boundsChanges.clear();
 }
 
 // =============================================================================
@@ -183,10 +278,12 @@ void World::setParent(Entity child, Entity parent)
         parentHierarchy.firstChild = child;
     }
 
-    // Mark transform dirty
-    if (auto* transform = tryGetComponent<TransformComponent>(child))
+    m_transformHierarchy->markStructureDirty();
+
+    // The world matrix now depends on a different parent
+    if (hasComponent<TransformComponent>(child))
     {
-        transform->markDirty();
+        m_registry.patch<TransformComponent>(child);
     }
 }
 
@@ -224,10 +321,12 @@ void World::removeParent(Entity child)
     childHierarchy->prevSibling = NullEntity;
     childHierarchy->nextSibling = NullEntity;
 
-    // Mark transform dirty
-    if (auto* transform = tryGetComponent<TransformComponent>(child))
+    m_transformHierarchy->markStructureDirty();
+
+    // The world matrix now depends on a different parent
+    if (hasComponent<TransformComponent>(child))
     {
-        transform->markDirty();
+        m_registry.patch<TransformComponent>(child);
     }
 }
 
@@ -3,16 +3,23 @@
 #include "runtime/function/framework/ecs/ecs_types.h"
 #include "runtime/function/framework/component/transform/transform_component.h"
 #include "runtime/function/framework/component/common/bounding_component.h"
+#include "runtime/function/framework/component/mesh/renderable_component.h"
+#include "runtime/function/framework/ecs/transform_hierarchy.h"
 
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace vesper {
 
+class WorkerPool;
+
 /// @brief World class - manages ECS registry and entity operations
 class World
 {
 public:
-    World() = default;
+    World();
     ~World() = default;
 
     // Non-copyable
@@ -47,15 +54,25 @@ public:
     // =========================================================================
 
     /// @brief Add a component to entity
+    /// Construction is recorded like a patch, so the returned reference may initialize the component
+    /// until the next update consumes the change sets; later edits go through patchComponent().
     template<typename T, typename... Args>
     T& addComponent(Entity entity, Args&&... args)
     {
         return m_registry.emplace<T>(entity, std::forward<Args>(args)...);
     }
 
-    /// @brief Get a component from entity
+    /// @brief Components whose edits feed a change set (transform, bounds and render)
+    /// World hands them out read-only: edit them with patchComponent(), which records the change.
+    /// Writing through registry() bypasses the change sets (use registry patch/replace there).
+    template<typename T>
+    static constexpr bool kChangeTracked = std::is_same_v<T, TransformComponent> ||
+                                           std::is_same_v<T, BoundingComponent> ||
+                                           std::is_same_v<T, RenderableComponent>;
+
+    /// @brief Get a component from entity (const for change-tracked components)
     template<typename T>
-    T& getComponent(Entity entity)
+    std::conditional_t<kChangeTracked<T>, const T, T>& getComponent(Entity entity)
     {
         return m_registry.get<T>(entity);
     }
@@ -67,9 +84,9 @@ public:
         return m_registry.get<T>(entity);
     }
 
-    /// @brief Try to get a component (returns nullptr if not exists)
+    /// @brief Try to get a component (returns nullptr if not exists; const for change-tracked components)
     template<typename T>
-    T* tryGetComponent(Entity entity)
+    std::conditional_t<kChangeTracked<T>, const T, T>* tryGetComponent(Entity entity)
     {
         return m_registry.try_get<T>(entity);
     }
@@ -88,6 +105,15 @@ public:
         return m_registry.all_of<T>(entity);
     }
 
+    /// @brief Modify a component in place and record the change
+    /// Runs each func(component) then fires the registry's on_update signal, which feeds the
+    /// change sets (e.g. a patched TransformComponent is recomputed by the next updateTransforms).
+    template<typename T, typename... Func>
+    T& patchComponent(Entity entity, Func&&... func)
+    {
+        return m_registry.patch<T>(entity, std::forward<Func>(func)...);
+    }
+
     /// @brief Remove a component from entity
     template<typename T>
     void removeComponent(Entity entity)
@@ -99,10 +125,19 @@ public:
     // System Updates
     // =========================================================================
 
-    /// @brief Update all dirty transforms (compute world matrices)
+    /// @brief Update changed transforms (compute world matrices)
+    /// Transforms in the kTransformChangeSet (added or patched since the last update) and all
+    /// of their descendants are recomputed, one hierarchy level at a time (see
+    /// TransformHierarchy). Recomputed entities are added to the bounds and render change sets.
     void updateTransforms();
 
-    /// @brief Update world bounds for all entities with BoundingComponent
+    /// @brief Update changed transforms, splitting large hierarchy levels across the pool
+    void updateTransforms(WorkerPool& pool);
+
+    /// @brief Update world bounds of entities in the kBoundsChangeSet
+    /// Covers moved entities and patched BoundingComponents; the new spheres are written to the
+    /// CullingBuffer and BoundingVolumeHierarchy, and bounds changes are forwarded to the render
+    /// change set.
     void updateBounds();
 
     // =========================================================================
@@ -118,6 +153,24 @@ public:
     /// @brief Get all children of an entity
     std::vector<Entity> getChildren(Entity parent) const;
 
+    // =========================================================================
+    // Render Group
+    // =========================================================================
+
+    /// @brief Owning group of renderables with bounds and a transform
+    /// The group's entities come first in the RenderableComponent and BoundingComponent storages,
+    /// in the same order, so the render path reads both arrays in lockstep (renderables without
+    /// bounds follow in the RenderableComponent storage). TransformComponent is only observed:
+    /// its storage is sorted by hierarchy depth (TransformHierarchy), which an owning group forbids.
+    using RenderGroup = decltype(std::declval<EntityRegistry&>().group<RenderableComponent, BoundingComponent>(
+        entt::get<TransformComponent>));
+
+    /// @brief The render group of a registry (created by World; created on first use otherwise)
+    static RenderGroup renderGroup(EntityRegistry& registry)
+    {
+        return registry.group<RenderableComponent, BoundingComponent>(entt::get<TransformComponent>);
+    }
+
     // =========================================================================
     // Registry Access
     // =========================================================================
@@ -129,10 +182,12 @@ public:
     const EntityRegistry& registry() const { return m_registry; }
 
 private:
-    /// @brief Recursively update transforms for hierarchy
-    void updateTransformHierarchy(Entity entity, const Matrix4x4& parentWorld);
+    /// @brief Forward the entities recomputed by the last hierarchy update to the downstream change sets
+    void propagateTransformChanges();
 
 private:
+    // Declared before the registry: destroyed after it, so no registry signal can reach a dead hierarchy
+    std::unique_ptr<TransformHierarchy> m_transformHierarchy;
     EntityRegistry m_registry;
 };
 
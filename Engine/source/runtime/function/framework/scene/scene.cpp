@@ -1,8 +1,11 @@
 #include "runtime/function/framework/scene/scene.h"
+#include "runtime/function/framework/ecs/systems/bounding_volume_hierarchy.h"
 #include "runtime/function/framework/ecs/systems/render_bridge_system.h"
+#include "runtime/function/physics/physics_scene.h"
 #include "runtime/function/render/render_packet.h"
 #include "runtime/function/render/mesh.h"
 #include "runtime/function/render/material.h"
+#include "runtime/core/threading/worker_pool.h"
 
 #include <cstring>
 
@@ -18,6 +21,11 @@ Scene::Scene(const std::string& name)
 {
 }
 
+Scene::~Scene()
+{
+    setPhysicsScene(nullptr);
+}
+
 // =============================================================================
 // Entity Creation
 // =============================================================================
@@ -35,14 +43,15 @@ Entity Scene::createRenderableEntity(const std::string& name,
 {
     Entity entity = createEntity(name);
 
-    // Add renderable component
-    auto& renderable = m_world.addComponent<RenderableComponent>(entity);
-    renderable.mesh = std::move(mesh);
-    renderable.material = std::move(material);
+    // Add renderable component, with the mesh and material as its resources
+    m_world.addComponent<RenderableComponent>(entity);
+    auto& resources = m_world.addComponent<RenderResourceComponent>(entity);
+    resources.mesh = std::move(mesh);
+    resources.material = std::move(material);
 
     // Add bounding component (initialized from mesh if possible)
     auto& bounds = m_world.addComponent<BoundingComponent>(entity);
-    if (renderable.mesh)
+    if (resources.mesh)
     {
         // TODO: Get actual bounds from mesh
         // For now, use default sphere
@@ -120,7 +129,7 @@ void Scene::update(float /*deltaTime*/)
     m_world.updateBounds();
 }
 
-void Scene::prepareForRendering(RenderPacketBuffer* buffer, uint64_t frameIndex)
+void Scene::prepareForRendering(RenderPacketBuffer* buffer, uint64_t frameIndex, WorkerPool* pool)
 {
     if (!buffer)
         return;
@@ -129,20 +138,76 @@ void Scene::prepareForRendering(RenderPacketBuffer* buffer, uint64_t frameIndex)
     if (!packet)
         return;
 
-    // Clear previous frame data
-    packet->clear();
     packet->frameIndex = frameIndex;
 
-    // Use RenderBridgeSystem for frustum-culled rendering
-    RenderBridgeSystem::fillRenderPacket(m_world.registry(), packet, m_mainCamera);
+    // The render thread keeps a RenderScene from the deltas (carried over across skipped packets
+    // in LatestOnly), so visible objects travel as instance ids
+    packet->format = RenderPacketFormat::Instanced;
+
+    // Use RenderBridgeSystem for frustum-culled rendering (it clears the previous frame data,
+    // refilling visible objects in place)
+    RenderBridgeSystem::fillRenderPacket(m_world.registry(), packet, m_mainCamera, pool, m_cpuCulling);
 
     buffer->releaseWrite();
 }
 
+void Scene::tick(WorkerPool& pool, float /*deltaTime*/, RenderPacketBuffer* buffer, uint64_t frameIndex)
+{
+    if (!m_frameGraph)
+    {
+        buildFrameGraph();
+    }
+
+    m_framePool = &pool;
+    m_framePacketBuffer = buffer;
+    m_frameIndex = frameIndex;
+    m_frameGraph->run(pool);
+}
+
+// =============================================================================
+// Physics
+// =============================================================================
+
+void Scene::setPhysicsScene(PhysicsScene* physicsScene)
+{
+    const BoundingVolumeHierarchy* bounds = m_world.registry().ctx().find<BoundingVolumeHierarchy>();
+
+    // Detach only our own bounds: another scene may have been attached since
+    if (m_physicsScene && m_physicsScene->getSceneBounds() == bounds)
+    {
+        m_physicsScene->setSceneBounds(nullptr);
+    }
+
+    m_physicsScene = physicsScene;
+    if (m_physicsScene)
+    {
+        m_physicsScene->setSceneBounds(bounds);
+    }
+}
+
 // =============================================================================
 // Private Methods
 // =============================================================================
 
+void Scene::buildFrameGraph()
+{
+    static const TaskNameId kTransformsName = internTaskName("Scene.UpdateTransforms");
+    static const TaskNameId kBoundsName = internTaskName("Scene.UpdateBounds");
+    static const TaskNameId kPacketName = internTaskName("Scene.FillRenderPacket");
+
+    m_frameGraph = std::make_unique<TaskGraph>();
+
+    const auto transforms = m_frameGraph->addNode([this]() { m_world.updateTransforms(*m_framePool); },
+        TaskAffinity::AnyThread, TaskPriority::High, kTransformsName);
+    const auto bounds = m_frameGraph->addNode([this]() { m_world.updateBounds(); },
+        TaskAffinity::AnyThread, TaskPriority::High, kBoundsName);
+    const auto packet = m_frameGraph->addNode([this]() { prepareForRendering(m_framePacketBuffer, m_frameIndex, m_framePool); },
+        TaskAffinity::AnyThread, TaskPriority::High, kPacketName);
+
+    m_frameGraph->addDependency(transforms, bounds);
+    m_frameGraph->addDependency(bounds, packet);
+}
+
 void Scene::fillCameraParams(RenderPacket* packet)
 {
     Camera* camera = getMainCameraInstance();
@@ -187,11 +252,11 @@ void Scene::fillVisibleObjects(RenderPacket* packet)
         // Create render object descriptor
         RenderObjectDesc desc;
         desc.object_id = entityToId(entity);
-        desc.mesh_id = renderable.meshId;
-        desc.material_id = renderable.materialId;
+        desc.mesh_id = static_cast<uint16_t>(renderable.meshId);
+        desc.material_id = static_cast<uint16_t>(renderable.materialId);
 
-        // Copy world transform
-        std::memcpy(desc.transform, transform.worldMatrix.ptr(), sizeof(float) * 16);
+        // World transform as a 3x4 affine matrix
+        desc.setTransform(transform.worldMatrix.ptr());
 
         // Copy bounding sphere if available
         if (auto* bounds = m_world.tryGetComponent<BoundingComponent>(entity))
@@ -2,8 +2,10 @@
 
 #include "runtime/function/framework/ecs/world.h"
 #include "runtime/function/framework/component/camera/camera_component.h"
-#include "runtime/function/framework/component/mesh/renderable_component.h"
+#include "runtime/function/framework/component/mesh/render_resource_component.h"
+#include "runtime/core/threading/task_graph.h"
 
+#include <memory>
 #include <string>
 
 namespace vesper {
@@ -13,6 +15,8 @@ class RenderPacketBuffer;
 struct RenderPacket;
 class Mesh;
 class Material;
+class WorkerPool;
+class PhysicsScene;
 
 /// @brief Scene class - high-level scene management
 class Scene
@@ -20,15 +24,13 @@ class Scene
 public:
     Scene();
     explicit Scene(const std::string& name);
-    ~Scene() = default;
+    ~Scene();
 
-    // Non-copyable
+    // Non-copyable and non-movable: the frame task graph captures this
     Scene(const Scene&) = delete;
     Scene& operator=(const Scene&) = delete;
-
-    // Movable
-    Scene(Scene&&) = default;
-    Scene& operator=(Scene&&) = default;
+    Scene(Scene&&) = delete;
+    Scene& operator=(Scene&&) = delete;
 
     // =========================================================================
     // Entity Creation Helpers
@@ -73,7 +75,37 @@ public:
     void update(float deltaTime);
 
     /// @brief Prepare scene data for rendering (fills RenderPacket)
-    void prepareForRendering(RenderPacketBuffer* buffer, uint64_t frameIndex);
+    /// @param pool Pool used to split the culling work (nullptr = calling thread)
+    void prepareForRendering(RenderPacketBuffer* buffer, uint64_t frameIndex, WorkerPool* pool = nullptr);
+
+    /// @brief Run update() and prepareForRendering() as a task graph on the worker pool
+    /// Stages: transform update -> bounds update -> render packet fill (incl. culling).
+    /// The graph is built on first use and reused every frame; blocks (help-running)
+    /// until the packet is published.
+    void tick(WorkerPool& pool, float deltaTime, RenderPacketBuffer* buffer, uint64_t frameIndex);
+
+    // =========================================================================
+    // Physics
+    // =========================================================================
+
+    /// @brief Answer the physics scene's queries from this scene's bounds (its World's
+    /// BoundingVolumeHierarchy); nullptr detaches. The scene detaches itself on destruction.
+    void setPhysicsScene(PhysicsScene* physicsScene);
+
+    /// @brief Get the physics scene attached to this scene (nullptr if none)
+    PhysicsScene* getPhysicsScene() const { return m_physicsScene; }
+
+    // =========================================================================
+    // Culling
+    // =========================================================================
+
+    /// @brief Frustum cull on the logic side before filling packets (default on)
+    /// Turn off when the renderer culls on the GPU: packets then list every drawable object, so
+    /// the GPU cull sees the whole scene instead of what already passed the CPU frustum test.
+    void setCpuCulling(bool enabled) { m_cpuCulling = enabled; }
+
+    /// @brief Check if packets are frustum culled on the logic side
+    bool isCpuCullingEnabled() const { return m_cpuCulling; }
 
     // =========================================================================
     // Accessors
@@ -96,10 +128,21 @@ private:
     /// @brief Fill visible objects into RenderPacket
     void fillVisibleObjects(RenderPacket* packet);
 
+    /// @brief Declare the per-frame task graph nodes and edges
+    void buildFrameGraph();
+
 private:
     std::string m_name;
     World m_world;
     Entity m_mainCamera{NullEntity};
+    PhysicsScene* m_physicsScene{nullptr};
+    bool m_cpuCulling{true};
+
+    // Per-frame task graph and the inputs its nodes read
+    std::unique_ptr<TaskGraph> m_frameGraph;
+    WorkerPool* m_framePool{nullptr};
+    RenderPacketBuffer* m_framePacketBuffer{nullptr};
+    uint64_t m_frameIndex{0};
 };
 
 } // namespace vesper
@@ -3,6 +3,7 @@
 #include "runtime/core/log/log_system.h"
 #include "runtime/core/threading/worker_pool.h"
 #include "runtime/core/event/event_bus.h"
+#include "runtime/function/physics/physics_manager.h"
 #include "runtime/function/render/render_packet.h"
 
 namespace vesper {
@@ -57,6 +58,10 @@ void RuntimeGlobalContext::startSystems(const RuntimeSystemsConfig& config) {
         RenderPacketBufferMode::LatestOnly
     );
 
+    // 4. Physics - scene queries, answered from the active scene's bounds
+    m_physics_manager = std::make_shared<PhysicsManager>();
+    m_physics_manager->initialize();
+
     LOG_INFO("RuntimeGlobalContext: Pipeline systems initialized");
 }
 
@@ -65,6 +70,12 @@ void RuntimeGlobalContext::shutdownSystems() {
 
     // Shutdown in reverse order of initialization
 
+    // 4. Physics (the active scene is released first and detaches itself)
+    if (m_physics_manager) {
+        m_physics_manager->shutdown();
+        m_physics_manager.reset();
+    }
+
     // 1. Stop worker pool first (wait for in-flight tasks)
     if (m_worker_pool) {
         m_worker_pool->shutdown();
@@ -82,7 +93,6 @@ void RuntimeGlobalContext::shutdownSystems() {
 
     // Reset other systems
     m_render_system.reset();
-    m_physics_manager.reset();
     m_asset_manager.reset();
     m_input_system.reset();
     m_window_system.reset();
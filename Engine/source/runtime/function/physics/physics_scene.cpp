@@ -1,4 +1,5 @@
 #include "physics_scene.h"
+#include "runtime/function/framework/ecs/systems/bounding_volume_hierarchy.h"
 
 namespace vesper {
 
@@ -31,8 +32,26 @@ void PhysicsScene::updateBodyTransform(uint32_t body_id, const float* transform)
 }
 
 bool PhysicsScene::raycast(const float* origin, const float* direction, float max_distance, float* hit_point) {
-    // TODO: Perform raycast
-    return false;
+    if (!m_scene_bounds) {
+        return false;
+    }
+
+    RaycastHit hit;
+    if (!m_scene_bounds->raycast(Vector3(origin[0], origin[1], origin[2]),
+                                 Vector3(direction[0], direction[1], direction[2]), max_distance, hit)) {
+        return false;
+    }
+
+    if (hit_point) {
+        hit_point[0] = hit.point.x;
+        hit_point[1] = hit.point.y;
+        hit_point[2] = hit.point.z;
+    }
+    return true;
+}
+
+void PhysicsScene::setSceneBounds(const BoundingVolumeHierarchy* scene_bounds) {
+    m_scene_bounds = scene_bounds;
 }
 
 void PhysicsScene::setGravity(float x, float y, float z) {
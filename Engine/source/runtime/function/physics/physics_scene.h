@@ -4,6 +4,8 @@
 
 namespace vesper {
 
+class BoundingVolumeHierarchy;
+
 class PhysicsScene {
 public:
     PhysicsScene();
@@ -19,13 +21,20 @@ public:
     void destroyRigidBody(uint32_t body_id);
     void updateBodyTransform(uint32_t body_id, const float* transform);
 
-    // Queries
+    // Queries (answered from the scene bounds: bounding spheres, not collision shapes)
     bool raycast(const float* origin, const float* direction, float max_distance, /* out */ float* hit_point);
 
+    // Scene bounds used to answer queries until bodies exist, attached by Scene::setPhysicsScene()
+    // (the World's BoundingVolumeHierarchy); nullptr to detach.
+    void setSceneBounds(const BoundingVolumeHierarchy* scene_bounds);
+    const BoundingVolumeHierarchy* getSceneBounds() const { return m_scene_bounds; }
+
     // Settings
     void setGravity(float x, float y, float z);
 
 private:
+    const BoundingVolumeHierarchy* m_scene_bounds = nullptr;
+
     // TODO: Jolt Physics handles
     // JPH::PhysicsSystem* m_physics_system;
     // JPH::TempAllocator* m_temp_allocator;
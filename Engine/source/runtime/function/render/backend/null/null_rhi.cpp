@@ -0,0 +1,825 @@
+#include "null_rhi.h"
+#include "runtime/core/log/log_system.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace vesper {
+
+namespace {
+
+bool isHostVisible(RHIMemoryUsage memoryUsage)
+{
+    return memoryUsage != RHIMemoryUsage::GpuOnly;
+}
+
+} // namespace
+
+// ============================================================================
+// Constructor / Destructor
+// ============================================================================
+
+NullRHI::NullRHI() = default;
+
+NullRHI::~NullRHI()
+{
+    if (m_initialized) {
+        shutdown();
+    }
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+bool NullRHI::initialize(const RHIConfig& config)
+{
+    LOG_INFO("Initializing Null RHI (headless, no GPU work)...");
+
+    m_validationEnabled = config.enableValidation;
+
+    m_graphicsQueue = std::make_shared<NullQueue>();
+    m_graphicsQueue->type = RHIQueueType::Graphics;
+
+    m_computeQueue = std::make_shared<NullQueue>();
+    m_computeQueue->type = RHIQueueType::Compute;
+    m_computeQueue->familyIndex = 1;
+
+    m_transferQueue = std::make_shared<NullQueue>();
+    m_transferQueue->type = RHIQueueType::Transfer;
+    m_transferQueue->familyIndex = 2;
+
+    // Report every capability the renderer may query, with desktop-class limits
+    std::strncpy(m_gpuInfo.deviceName, "Null Device", sizeof(m_gpuInfo.deviceName) - 1);
+    m_gpuInfo.dynamicRendering       = true;
+    m_gpuInfo.descriptorIndexing     = true;
+    m_gpuInfo.bufferDeviceAddress    = true;
+    m_gpuInfo.synchronization2       = true;
+    m_gpuInfo.timelineSemaphore      = true;
+    m_gpuInfo.maxTextureSize         = 16384;
+    m_gpuInfo.maxUniformBufferSize   = 65536;
+    m_gpuInfo.maxStorageBufferSize   = UINT32_MAX;
+    m_gpuInfo.maxPushConstantSize    = 256;
+    m_gpuInfo.maxBoundDescriptorSets = 32;
+    m_gpuInfo.maxColorAttachments    = 8;
+    for (int i = 0; i < 3; ++i) {
+        m_gpuInfo.maxComputeWorkGroupCount[i] = 65535;
+        m_gpuInfo.maxComputeWorkGroupSize[i]  = 1024;
+    }
+
+    resetStats();
+    m_frameIndex = 0;
+    m_completedFrameIndex = 0;
+    m_initialized = true;
+
+    LOG_INFO("Null RHI initialized");
+    return true;
+}
+
+void NullRHI::shutdown()
+{
+    if (!m_initialized) {
+        return;
+    }
+
+    m_graphicsQueue.reset();
+    m_computeQueue.reset();
+    m_transferQueue.reset();
+    m_initialized = false;
+
+    LOG_INFO("Null RHI shutdown complete");
+}
+
+// ============================================================================
+// Queue Management
+// ============================================================================
+
+RHIQueueHandle NullRHI::getQueue(RHIQueueType type)
+{
+    switch (type) {
+        case RHIQueueType::Graphics: return m_graphicsQueue;
+        case RHIQueueType::Compute:  return m_computeQueue;
+        case RHIQueueType::Transfer: return m_transferQueue;
+        default:                     return m_graphicsQueue;
+    }
+}
+
+// ============================================================================
+// SwapChain
+// ============================================================================
+
+RHISwapChainHandle NullRHI::createSwapChain(const RHISwapChainDesc& desc)
+{
+    // The window handle is ignored: images are plain offscreen textures
+    auto swapchain = std::make_shared<NullSwapChain>();
+    swapchain->width      = desc.width;
+    swapchain->height     = desc.height;
+    swapchain->imageCount = std::max(desc.imageCount, 1u);
+    swapchain->format     = desc.format;
+    createSwapChainImages(swapchain.get());
+
+    onResourceCreated();
+    return swapchain;
+}
+
+void NullRHI::destroySwapChain(RHISwapChainHandle swapChain)
+{
+    if (!swapChain) {
+        return;
+    }
+    releaseSwapChainImages(static_cast<NullSwapChain*>(swapChain.get()));
+    onResourceDestroyed();
+}
+
+void NullRHI::resizeSwapChain(RHISwapChainHandle swapChain, uint32_t width, uint32_t height)
+{
+    auto* swapchain = static_cast<NullSwapChain*>(swapChain.get());
+    swapchain->width  = width;
+    swapchain->height = height;
+    createSwapChainImages(swapchain);
+}
+
+RHITextureHandle NullRHI::getSwapChainImage(RHISwapChainHandle swapChain, uint32_t index)
+{
+    const auto* swapchain = static_cast<const NullSwapChain*>(swapChain.get());
+    if (index >= swapchain->imageTextures.size()) {
+        return nullptr;
+    }
+    return swapchain->imageTextures[index];
+}
+
+uint32_t NullRHI::getSwapChainImageCount(RHISwapChainHandle swapChain)
+{
+    return swapChain ? swapChain->imageCount : 0;
+}
+
+// ============================================================================
+// Resource Creation
+// ============================================================================
+
+RHIBufferHandle NullRHI::createBuffer(const RHIBufferDesc& desc)
+{
+    const uint64_t maxSize = m_maxBufferSize.load(std::memory_order_relaxed);
+    if (maxSize != 0 && desc.size > maxSize) {
+        LOG_ERROR("NullRHI::createBuffer: {} byte buffer exceeds the {} byte limit", desc.size, maxSize);
+        return nullptr;
+    }
+
+    auto buffer = std::make_shared<NullBuffer>();
+    buffer->size        = desc.size;
+    buffer->usage       = desc.usage;
+    buffer->memoryUsage = desc.memoryUsage;
+
+    // CPU-visible buffers are persistently mapped, as on Vulkan
+    if (isHostVisible(desc.memoryUsage)) {
+        buffer->storage.resize(static_cast<size_t>(desc.size));
+        buffer->mappedData = buffer->storage.data();
+    }
+    buffer->id = m_buffers.allocate(buffer.get());
+
+    onResourceCreated();
+    return buffer;
+}
+
+void NullRHI::destroyBuffer(RHIBufferHandle buffer)
+{
+    if (!buffer) {
+        return;
+    }
+    auto* nullBuffer = static_cast<NullBuffer*>(buffer.get());
+    m_buffers.release(nullBuffer->id);
+    nullBuffer->mappedData = nullptr;
+    nullBuffer->storage = {};
+    onResourceDestroyed();
+}
+
+RHITextureHandle NullRHI::createTexture(const RHITextureDesc& desc)
+{
+    auto texture = std::make_shared<NullTexture>();
+    texture->extent       = desc.extent;
+    texture->mipLevels    = desc.mipLevels;
+    texture->arrayLayers  = desc.arrayLayers;
+    texture->format       = desc.format;
+    texture->dimension    = desc.dimension;
+    texture->sampleCount  = desc.sampleCount;
+    texture->usage        = desc.usage;
+    texture->currentState = desc.initialState;
+    texture->id           = m_textures.allocate(texture.get());
+
+    onResourceCreated();
+    return texture;
+}
+
+void NullRHI::destroyTexture(RHITextureHandle texture)
+{
+    if (!texture) {
+        return;
+    }
+    m_textures.release(texture->id);
+    onResourceDestroyed();
+}
+
+RHISamplerHandle NullRHI::createSampler(const RHISamplerDesc& desc)
+{
+    (void)desc;
+    onResourceCreated();
+    return std::make_shared<NullSampler>();
+}
+
+void NullRHI::destroySampler(RHISamplerHandle sampler)
+{
+    if (!sampler) {
+        return;
+    }
+    onResourceDestroyed();
+}
+
+// ============================================================================
+// Buffer Operations
+// ============================================================================
+
+void* NullRHI::mapBuffer(RHIBufferHandle buffer)
+{
+    auto* nullBuffer = static_cast<NullBuffer*>(buffer.get());
+    if (!nullBuffer->mappedData) {
+        nullBuffer->storage.resize(static_cast<size_t>(nullBuffer->size));
+        nullBuffer->mappedData = nullBuffer->storage.data();
+    }
+    return nullBuffer->mappedData;
+}
+
+void NullRHI::unmapBuffer(RHIBufferHandle buffer)
+{
+    // Storage is kept, so contents survive until the buffer is destroyed. Persistently mapped
+    // (CPU-visible) buffers stay mapped, as on Vulkan
+    auto* nullBuffer = static_cast<NullBuffer*>(buffer.get());
+    if (!isHostVisible(nullBuffer->memoryUsage)) {
+        nullBuffer->mappedData = nullptr;
+    }
+}
+
+void NullRHI::updateBuffer(RHIBufferHandle buffer, const void* data, uint64_t size, uint64_t offset)
+{
+    auto* nullBuffer = static_cast<NullBuffer*>(buffer.get());
+    if (offset + size > nullBuffer->size) {
+        LOG_ERROR("NullRHI::updateBuffer: {} bytes at offset {} overflow a {} byte buffer",
+                  size, offset, nullBuffer->size);
+        return;
+    }
+
+    // GPU-only contents are never observable: only buffers that have host storage keep the data
+    if (!nullBuffer->storage.empty()) {
+        std::memcpy(nullBuffer->storage.data() + offset, data, static_cast<size_t>(size));
+    }
+
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    m_stats.bytesUpdated += size;
+}
+
+// ============================================================================
+// Shader and Pipeline
+// ============================================================================
+
+RHIShaderHandle NullRHI::createShader(const RHIShaderDesc& desc)
+{
+    // Code is not inspected: headless runs may pass none at all
+    auto shader = std::make_shared<NullShader>();
+    shader->stage = desc.stage;
+
+    onResourceCreated();
+    return shader;
+}
+
+void NullRHI::destroyShader(RHIShaderHandle shader)
+{
+    if (!shader) {
+        return;
+    }
+    onResourceDestroyed();
+}
+
+RHIDescriptorSetLayoutHandle NullRHI::createDescriptorSetLayout(const RHIDescriptorSetLayoutDesc& desc)
+{
+    auto layout = std::make_shared<NullDescriptorSetLayout>();
+    layout->bindings = desc.bindings;
+
+    onResourceCreated();
+    return layout;
+}
+
+void NullRHI::destroyDescriptorSetLayout(RHIDescriptorSetLayoutHandle layout)
+{
+    if (!layout) {
+        return;
+    }
+    onResourceDestroyed();
+}
+
+RHIPipelineHandle NullRHI::createGraphicsPipeline(const RHIGraphicsPipelineDesc& desc)
+{
+    (void)desc;
+    auto pipeline = std::make_shared<NullPipeline>();
+    pipeline->id = m_pipelines.allocate(pipeline.get());
+
+    onResourceCreated();
+    return pipeline;
+}
+
+RHIPipelineHandle NullRHI::createComputePipeline(const RHIComputePipelineDesc& desc)
+{
+    (void)desc;
+    auto pipeline = std::make_shared<NullPipeline>();
+    pipeline->isCompute = true;
+    pipeline->id = m_pipelines.allocate(pipeline.get());
+
+    onResourceCreated();
+    return pipeline;
+}
+
+void NullRHI::destroyPipeline(RHIPipelineHandle pipeline)
+{
+    if (!pipeline) {
+        return;
+    }
+    m_pipelines.release(pipeline->id);
+    onResourceDestroyed();
+}
+
+// ============================================================================
+// Descriptor Sets
+// ============================================================================
+
+RHIDescriptorSetHandle NullRHI::createDescriptorSet(RHIDescriptorSetLayoutHandle layout)
+{
+    (void)layout;
+    auto set = std::make_shared<NullDescriptorSet>();
+    set->id = m_descriptorSets.allocate(set.get());
+
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    ++m_stats.resourcesCreated;
+    ++m_stats.descriptorSetsCreated;
+    return set;
+}
+
+void NullRHI::destroyDescriptorSet(RHIDescriptorSetHandle set)
+{
+    if (!set) {
+        return;
+    }
+    m_descriptorSets.release(set->id);
+    onResourceDestroyed();
+}
+
+void NullRHI::updateDescriptorSet(RHIDescriptorSetHandle set, std::span<const RHIDescriptorWrite> writes)
+{
+    (void)set;
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    m_stats.descriptorWrites += writes.size();
+}
+
+// ============================================================================
+// Command Pools and Buffers
+// ============================================================================
+
+RHICommandPoolHandle NullRHI::createCommandPool(const RHICommandPoolDesc& desc)
+{
+    auto pool = std::make_shared<NullCommandPool>();
+    pool->queueType = desc.queueType;
+
+    onResourceCreated();
+    return pool;
+}
+
+void NullRHI::destroyCommandPool(RHICommandPoolHandle pool)
+{
+    if (!pool) {
+        return;
+    }
+    onResourceDestroyed();
+}
+
+void NullRHI::resetCommandPool(RHICommandPoolHandle pool)
+{
+    // Command buffers drop their recording in beginCommandBuffer()
+    (void)pool;
+}
+
+RHICommandBufferHandle NullRHI::allocateCommandBuffer(RHICommandPoolHandle pool, const RHICommandBufferDesc& desc)
+{
+    (void)pool;
+    auto cmd = std::make_shared<NullCommandBuffer>();
+    cmd->isSecondary = desc.secondary;
+    cmd->id = m_commandBuffers.allocate(cmd.get());
+
+    onResourceCreated();
+    return cmd;
+}
+
+void NullRHI::freeCommandBuffer(RHICommandPoolHandle pool, RHICommandBufferHandle cmd)
+{
+    (void)pool;
+    if (!cmd) {
+        return;
+    }
+    m_commandBuffers.release(cmd->id);
+    onResourceDestroyed();
+}
+
+// ============================================================================
+// Synchronization
+// ============================================================================
+
+RHIFenceHandle NullRHI::createFence(bool signaled)
+{
+    auto fence = std::make_shared<NullFence>();
+    fence->signaled = signaled;
+
+    onResourceCreated();
+    return fence;
+}
+
+void NullRHI::destroyFence(RHIFenceHandle fence)
+{
+    if (!fence) {
+        return;
+    }
+    onResourceDestroyed();
+}
+
+void NullRHI::waitForFence(RHIFenceHandle fence, uint64_t timeout)
+{
+    // Submitted work completes at submission, so an unsignaled fence was never submitted: waiting
+    // on it would hang a real device
+    (void)timeout;
+    if (m_validationEnabled && !fence->signaled) {
+        LOG_WARN("NullRHI::waitForFence: waiting on a fence that no submission signals");
+    }
+}
+
+void NullRHI::resetFence(RHIFenceHandle fence)
+{
+    fence->signaled = false;
+}
+
+bool NullRHI::isFenceSignaled(RHIFenceHandle fence)
+{
+    return fence->signaled;
+}
+
+RHISemaphoreHandle NullRHI::createSemaphore()
+{
+    onResourceCreated();
+    return std::make_shared<NullSemaphore>();
+}
+
+void NullRHI::destroySemaphore(RHISemaphoreHandle semaphore)
+{
+    if (!semaphore) {
+        return;
+    }
+    onResourceDestroyed();
+}
+
+// ============================================================================
+// Command Recording
+// ============================================================================
+
+template <typename... Args>
+NullCommandBuffer* NullRHI::record(RHICommandBufferId cmd, NullCommandType type, Args... args)
+{
+    const NullRecordMode mode = m_recordMode.load(std::memory_order_relaxed);
+    if (mode == NullRecordMode::Off) {
+        return nullptr;
+    }
+
+    NullCommandBuffer* nullCmd = m_commandBuffers.get(cmd);
+    if (!nullCmd) {
+        return nullptr;
+    }
+    if (m_validationEnabled && !nullCmd->isRecording) {
+        LOG_ERROR("NullRHI: command {} recorded outside begin/endCommandBuffer", static_cast<int>(type));
+    }
+
+    ++nullCmd->counts.commands[static_cast<size_t>(type)];
+    if (mode == NullRecordMode::Serialize) {
+        static_assert(sizeof...(Args) <= std::size(NullCommand{}.args), "NullCommand has too few arguments");
+        nullCmd->commands.push_back(NullCommand{type, {static_cast<uint64_t>(args)...}});
+    }
+    return nullCmd;
+}
+
+void NullRHI::beginCommandBuffer(RHICommandBufferId cmd)
+{
+    NullCommandBuffer* nullCmd = m_commandBuffers.get(cmd);
+    if (!nullCmd) {
+        return;
+    }
+    nullCmd->counts = {};
+    nullCmd->commands.clear();
+    nullCmd->isRecording = true;
+}
+
+void NullRHI::endCommandBuffer(RHICommandBufferId cmd)
+{
+    if (NullCommandBuffer* nullCmd = m_commandBuffers.get(cmd)) {
+        nullCmd->isRecording = false;
+    }
+}
+
+void NullRHI::cmdBeginRendering(RHICommandBufferId cmd, const RHIRenderingInfo& info)
+{
+    record(cmd, NullCommandType::BeginRendering,
+           info.colorAttachments.size(),
+           info.depthAttachment ? info.depthAttachment->texture.value() : 0,
+           info.renderArea.extent.width, info.renderArea.extent.height,
+           (info.suspending ? 1u : 0u) | (info.resuming ? 2u : 0u));
+}
+
+void NullRHI::cmdEndRendering(RHICommandBufferId cmd)
+{
+    record(cmd, NullCommandType::EndRendering);
+}
+
+void NullRHI::cmdSetViewport(RHICommandBufferId cmd, const RHIViewport& viewport)
+{
+    record(cmd, NullCommandType::SetViewport,
+           std::bit_cast<uint32_t>(viewport.x), std::bit_cast<uint32_t>(viewport.y),
+           std::bit_cast<uint32_t>(viewport.width), std::bit_cast<uint32_t>(viewport.height));
+}
+
+void NullRHI::cmdSetScissor(RHICommandBufferId cmd, const RHIRect2D& scissor)
+{
+    record(cmd, NullCommandType::SetScissor,
+           std::bit_cast<uint32_t>(scissor.offset.x), std::bit_cast<uint32_t>(scissor.offset.y),
+           scissor.extent.width, scissor.extent.height);
+}
+
+void NullRHI::cmdBindPipeline(RHICommandBufferId cmd, RHIPipelineId pipeline)
+{
+    record(cmd, NullCommandType::BindPipeline, pipeline.value());
+}
+
+void NullRHI::cmdBindDescriptorSets(RHICommandBufferId cmd, RHIPipelineId pipeline,
+                                    uint32_t firstSet, std::span<const RHIDescriptorSetId> sets,
+                                    std::span<const uint32_t> dynamicOffsets)
+{
+    NullCommandBuffer* nullCmd = record(cmd, NullCommandType::BindDescriptorSets,
+                                        pipeline.value(), firstSet, sets.size(), dynamicOffsets.size(),
+                                        sets.empty() ? 0 : sets[0].value());
+    if (nullCmd) {
+        nullCmd->counts.descriptorSetsBound += sets.size();
+    }
+}
+
+void NullRHI::cmdBindVertexBuffer(RHICommandBufferId cmd, uint32_t binding,
+                                  RHIBufferId buffer, uint64_t offset)
+{
+    record(cmd, NullCommandType::BindVertexBuffer, binding, buffer.value(), offset);
+}
+
+void NullRHI::cmdBindIndexBuffer(RHICommandBufferId cmd, RHIBufferId buffer,
+                                 uint64_t offset, bool use16Bit)
+{
+    record(cmd, NullCommandType::BindIndexBuffer, buffer.value(), offset, use16Bit);
+}
+
+void NullRHI::cmdDraw(RHICommandBufferId cmd, uint32_t vertexCount, uint32_t instanceCount,
+                      uint32_t firstVertex, uint32_t firstInstance)
+{
+    record(cmd, NullCommandType::Draw, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void NullRHI::cmdDrawIndexed(RHICommandBufferId cmd, uint32_t indexCount, uint32_t instanceCount,
+                             uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+{
+    record(cmd, NullCommandType::DrawIndexed, indexCount, instanceCount, firstIndex,
+           std::bit_cast<uint32_t>(vertexOffset), firstInstance);
+}
+
+void NullRHI::cmdDrawIndirect(RHICommandBufferId cmd, RHIBufferId buffer,
+                              uint64_t offset, uint32_t drawCount, uint32_t stride)
+{
+    record(cmd, NullCommandType::DrawIndirect, buffer.value(), offset, drawCount, stride);
+}
+
+void NullRHI::cmdDrawIndexedIndirect(RHICommandBufferId cmd, RHIBufferId buffer,
+                                     uint64_t offset, uint32_t drawCount, uint32_t stride)
+{
+    record(cmd, NullCommandType::DrawIndexedIndirect, buffer.value(), offset, drawCount, stride);
+}
+
+void NullRHI::cmdDispatch(RHICommandBufferId cmd, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+{
+    record(cmd, NullCommandType::Dispatch, groupCountX, groupCountY, groupCountZ);
+}
+
+void NullRHI::cmdDispatchIndirect(RHICommandBufferId cmd, RHIBufferId buffer, uint64_t offset)
+{
+    record(cmd, NullCommandType::DispatchIndirect, buffer.value(), offset);
+}
+
+void NullRHI::cmdPipelineBarrier(RHICommandBufferId cmd,
+                                 std::span<const RHIBufferBarrier> bufferBarriers,
+                                 std::span<const RHITextureBarrier> textureBarriers)
+{
+    // State tracking happens in every mode: RenderSystem reads it back (swapchain image srcState)
+    for (const auto& barrier : textureBarriers) {
+        if (NullTexture* texture = m_textures.get(barrier.texture)) {
+            texture->currentState = barrier.dstState;
+        }
+    }
+
+    NullCommandBuffer* nullCmd = record(cmd, NullCommandType::PipelineBarrier,
+                                        bufferBarriers.size(), textureBarriers.size());
+    if (nullCmd) {
+        nullCmd->counts.bufferBarriers  += bufferBarriers.size();
+        nullCmd->counts.textureBarriers += textureBarriers.size();
+    }
+}
+
+void NullRHI::cmdCopyBuffer(RHICommandBufferId cmd, RHIBufferId src, RHIBufferId dst,
+                            uint64_t srcOffset, uint64_t dstOffset, uint64_t size)
+{
+    record(cmd, NullCommandType::CopyBuffer, src.value(), dst.value(), srcOffset, dstOffset, size);
+}
+
+void NullRHI::cmdCopyBufferToTexture(RHICommandBufferId cmd, RHIBufferId src, RHITextureId dst,
+                                     uint64_t bufferOffset, uint32_t mipLevel, uint32_t arrayLayer)
+{
+    record(cmd, NullCommandType::CopyBufferToTexture, src.value(), dst.value(), bufferOffset, mipLevel, arrayLayer);
+}
+
+void NullRHI::cmdCopyTextureToBuffer(RHICommandBufferId cmd, RHITextureId src, RHIBufferId dst,
+                                     uint32_t mipLevel, uint32_t arrayLayer, uint64_t bufferOffset)
+{
+    record(cmd, NullCommandType::CopyTextureToBuffer, src.value(), dst.value(), mipLevel, arrayLayer, bufferOffset);
+}
+
+void NullRHI::cmdPushConstants(RHICommandBufferId cmd, RHIPipelineId pipeline,
+                               RHIShaderStage stages, uint32_t offset, uint32_t size, const void* data)
+{
+    (void)data;
+    NullCommandBuffer* nullCmd = record(cmd, NullCommandType::PushConstants,
+                                        pipeline.value(), static_cast<uint32_t>(stages), offset, size);
+    if (nullCmd) {
+        nullCmd->counts.pushConstantBytes += size;
+    }
+}
+
+void NullRHI::cmdBeginDebugLabel(RHICommandBufferId cmd, const char* label, float color[4])
+{
+    (void)label;
+    (void)color;
+    record(cmd, NullCommandType::BeginDebugLabel);
+}
+
+void NullRHI::cmdEndDebugLabel(RHICommandBufferId cmd)
+{
+    record(cmd, NullCommandType::EndDebugLabel);
+}
+
+void NullRHI::cmdInsertDebugLabel(RHICommandBufferId cmd, const char* label, float color[4])
+{
+    (void)label;
+    (void)color;
+    record(cmd, NullCommandType::InsertDebugLabel);
+}
+
+// ============================================================================
+// Queue Submission
+// ============================================================================
+
+void NullRHI::queueSubmit(RHIQueueHandle queue, const SubmitInfo& submitInfo)
+{
+    (void)queue;
+
+    // Work completes on submission
+    if (submitInfo.fence) {
+        submitInfo.fence->signaled = true;
+    }
+
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    ++m_stats.submits;
+    m_stats.commandBuffersSubmitted += submitInfo.commandBuffers.size();
+    for (const auto& cmd : submitInfo.commandBuffers) {
+        m_stats.submitted.add(static_cast<const NullCommandBuffer*>(cmd.get())->counts);
+    }
+}
+
+void NullRHI::queueWaitIdle(RHIQueueHandle queue)
+{
+    (void)queue;
+}
+
+// ============================================================================
+// SwapChain Present
+// ============================================================================
+
+RHI::AcquireResult NullRHI::acquireNextImage(RHISwapChainHandle swapChain, RHISemaphoreHandle semaphore,
+                                             RHIFenceHandle fence, uint64_t timeout, uint32_t* imageIndex)
+{
+    (void)semaphore;
+    (void)timeout;
+
+    if (swapChain->width == 0 || swapChain->height == 0) {
+        return AcquireResult::OutOfDate;
+    }
+
+    // Images are handed out round-robin, starting with image 0
+    const uint64_t frame = m_frameIndex.load();
+    *imageIndex = static_cast<uint32_t>(frame % swapChain->imageCount);
+    swapChain->currentImageIndex = *imageIndex;
+
+    if (fence) {
+        fence->signaled = true;
+    }
+    return AcquireResult::Success;
+}
+
+bool NullRHI::queuePresent(RHIQueueHandle queue, const PresentInfo& presentInfo)
+{
+    (void)queue;
+    (void)presentInfo;
+
+    {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        ++m_stats.presents;
+    }
+
+    // Nothing is ever in flight: the presented frame is also the last completed one
+    m_completedFrameIndex = m_frameIndex.load();
+    m_frameIndex++;
+    return true;
+}
+
+// ============================================================================
+// Utility
+// ============================================================================
+
+void NullRHI::waitIdle()
+{
+}
+
+NullRHIStats NullRHI::getStats() const
+{
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    return m_stats;
+}
+
+void NullRHI::resetStats()
+{
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    m_stats = {};
+}
+
+const NullCommandCounts& NullRHI::getRecordedCounts(const RHICommandBufferHandle& cmd)
+{
+    return static_cast<const NullCommandBuffer*>(cmd.get())->counts;
+}
+
+const std::vector<NullCommand>& NullRHI::getRecordedCommands(const RHICommandBufferHandle& cmd)
+{
+    return static_cast<const NullCommandBuffer*>(cmd.get())->commands;
+}
+
+// ============================================================================
+// Internal Helpers
+// ============================================================================
+
+void NullRHI::onResourceCreated()
+{
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    ++m_stats.resourcesCreated;
+}
+
+void NullRHI::onResourceDestroyed()
+{
+    std::lock_guard<std::mutex> lock(m_statsMutex);
+    ++m_stats.resourcesDestroyed;
+}
+
+void NullRHI::createSwapChainImages(NullSwapChain* swapchain)
+{
+    releaseSwapChainImages(swapchain);
+    for (uint32_t i = 0; i < swapchain->imageCount; ++i) {
+        auto image = std::make_shared<NullTexture>();
+        image->extent           = {swapchain->width, swapchain->height, 1};
+        image->format           = swapchain->format;
+        image->usage            = RHITextureUsage::ColorAttachment;
+        image->isSwapchainImage = true;
+        image->id               = m_textures.allocate(image.get());
+        swapchain->imageTextures.push_back(image);
+    }
+    swapchain->currentImageIndex = 0;
+}
+
+void NullRHI::releaseSwapChainImages(NullSwapChain* swapchain)
+{
+    for (const auto& image : swapchain->imageTextures) {
+        m_textures.release(image->id);
+    }
+    swapchain->imageTextures.clear();
+}
+
+} // namespace vesper
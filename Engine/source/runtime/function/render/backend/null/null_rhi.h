@@ -0,0 +1,290 @@
+#pragma once
+
+#include "runtime/function/render/rhi/rhi.h"
+#include "runtime/function/render/backend/null/null_types.h"
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+namespace vesper {
+
+/// @brief Headless RHI backend: no device, no window, no GPU work
+///
+/// Resources are bare objects (buffers get host memory only once mapped, or at creation when
+/// CPU-visible), fences signal on submit, the swapchain is a ring of offscreen textures and
+/// presenting completes the frame. Texture states follow barriers as they do on Vulkan, so
+/// RenderSystem runs unmodified on top of it.
+///
+/// cmd* calls go through a recorder (setRecordMode()): by default each command buffer counts its
+/// calls, barriers, bound descriptor sets and push constant bytes, and submission adds them to
+/// getStats(). Serialize mode also keeps a NullCommand per call. What remains is the CPU cost of
+/// the renderer itself, which is what draw submission, barrier and descriptor churn benchmarks
+/// want to measure.
+class NullRHI : public RHI
+{
+public:
+    NullRHI();
+    ~NullRHI() override;
+
+    // ========================================================================
+    // Lifecycle
+    // ========================================================================
+
+    bool initialize(const RHIConfig& config) override;
+    void shutdown() override;
+
+    // ========================================================================
+    // Device Information
+    // ========================================================================
+
+    RHIBackendType getBackendType() const override { return RHIBackendType::Null; }
+    const RHIGpuInfo& getGpuInfo() const override { return m_gpuInfo; }
+
+    // ========================================================================
+    // Queue Management
+    // ========================================================================
+
+    RHIQueueHandle getQueue(RHIQueueType type) override;
+
+    // ========================================================================
+    // SwapChain
+    // ========================================================================
+
+    RHISwapChainHandle createSwapChain(const RHISwapChainDesc& desc) override;
+    void destroySwapChain(RHISwapChainHandle swapChain) override;
+    void resizeSwapChain(RHISwapChainHandle swapChain, uint32_t width, uint32_t height) override;
+    RHITextureHandle getSwapChainImage(RHISwapChainHandle swapChain, uint32_t index) override;
+    uint32_t getSwapChainImageCount(RHISwapChainHandle swapChain) override;
+
+    // ========================================================================
+    // Resource Creation
+    // ========================================================================
+
+    RHIBufferHandle createBuffer(const RHIBufferDesc& desc) override;
+    void destroyBuffer(RHIBufferHandle buffer) override;
+
+    RHITextureHandle createTexture(const RHITextureDesc& desc) override;
+    void destroyTexture(RHITextureHandle texture) override;
+
+    RHISamplerHandle createSampler(const RHISamplerDesc& desc) override;
+    void destroySampler(RHISamplerHandle sampler) override;
+
+    // ========================================================================
+    // Buffer Operations
+    // ========================================================================
+
+    void* mapBuffer(RHIBufferHandle buffer) override;
+    void unmapBuffer(RHIBufferHandle buffer) override;
+    void updateBuffer(RHIBufferHandle buffer, const void* data, uint64_t size, uint64_t offset = 0) override;
+
+    // ========================================================================
+    // Shader and Pipeline
+    // ========================================================================
+
+    RHIShaderHandle createShader(const RHIShaderDesc& desc) override;
+    void destroyShader(RHIShaderHandle shader) override;
+
+    RHIDescriptorSetLayoutHandle createDescriptorSetLayout(const RHIDescriptorSetLayoutDesc& desc) override;
+    void destroyDescriptorSetLayout(RHIDescriptorSetLayoutHandle layout) override;
+
+    RHIPipelineHandle createGraphicsPipeline(const RHIGraphicsPipelineDesc& desc) override;
+    RHIPipelineHandle createComputePipeline(const RHIComputePipelineDesc& desc) override;
+    void destroyPipeline(RHIPipelineHandle pipeline) override;
+
+    // ========================================================================
+    // Descriptor Sets
+    // ========================================================================
+
+    RHIDescriptorSetHandle createDescriptorSet(RHIDescriptorSetLayoutHandle layout) override;
+    void destroyDescriptorSet(RHIDescriptorSetHandle set) override;
+    void updateDescriptorSet(RHIDescriptorSetHandle set, std::span<const RHIDescriptorWrite> writes) override;
+
+    // ========================================================================
+    // Command Pools and Buffers
+    // ========================================================================
+
+    RHICommandPoolHandle createCommandPool(const RHICommandPoolDesc& desc) override;
+    void destroyCommandPool(RHICommandPoolHandle pool) override;
+    void resetCommandPool(RHICommandPoolHandle pool) override;
+
+    RHICommandBufferHandle allocateCommandBuffer(RHICommandPoolHandle pool, const RHICommandBufferDesc& desc = {}) override;
+    void freeCommandBuffer(RHICommandPoolHandle pool, RHICommandBufferHandle cmd) override;
+
+    // ========================================================================
+    // Synchronization
+    // ========================================================================
+
+    RHIFenceHandle createFence(bool signaled = false) override;
+    void destroyFence(RHIFenceHandle fence) override;
+    void waitForFence(RHIFenceHandle fence, uint64_t timeout = UINT64_MAX) override;
+    void resetFence(RHIFenceHandle fence) override;
+    bool isFenceSignaled(RHIFenceHandle fence) override;
+
+    RHISemaphoreHandle createSemaphore() override;
+    void destroySemaphore(RHISemaphoreHandle semaphore) override;
+
+    // ========================================================================
+    // Command Recording
+    // ========================================================================
+
+    void beginCommandBuffer(RHICommandBufferId cmd) override;
+    void endCommandBuffer(RHICommandBufferId cmd) override;
+
+    void cmdBeginRendering(RHICommandBufferId cmd, const RHIRenderingInfo& info) override;
+    void cmdEndRendering(RHICommandBufferId cmd) override;
+
+    void cmdSetViewport(RHICommandBufferId cmd, const RHIViewport& viewport) override;
+    void cmdSetScissor(RHICommandBufferId cmd, const RHIRect2D& scissor) override;
+
+    void cmdBindPipeline(RHICommandBufferId cmd, RHIPipelineId pipeline) override;
+    void cmdBindDescriptorSets(RHICommandBufferId cmd, RHIPipelineId pipeline,
+                               uint32_t firstSet, std::span<const RHIDescriptorSetId> sets,
+                               std::span<const uint32_t> dynamicOffsets = {}) override;
+
+    void cmdBindVertexBuffer(RHICommandBufferId cmd, uint32_t binding,
+                             RHIBufferId buffer, uint64_t offset = 0) override;
+    void cmdBindIndexBuffer(RHICommandBufferId cmd, RHIBufferId buffer,
+                            uint64_t offset = 0, bool use16Bit = false) override;
+
+    void cmdDraw(RHICommandBufferId cmd, uint32_t vertexCount, uint32_t instanceCount = 1,
+                 uint32_t firstVertex = 0, uint32_t firstInstance = 0) override;
+    void cmdDrawIndexed(RHICommandBufferId cmd, uint32_t indexCount, uint32_t instanceCount = 1,
+                        uint32_t firstIndex = 0, int32_t vertexOffset = 0, uint32_t firstInstance = 0) override;
+    void cmdDrawIndirect(RHICommandBufferId cmd, RHIBufferId buffer,
+                         uint64_t offset, uint32_t drawCount, uint32_t stride) override;
+    void cmdDrawIndexedIndirect(RHICommandBufferId cmd, RHIBufferId buffer,
+                                uint64_t offset, uint32_t drawCount, uint32_t stride) override;
+
+    void cmdDispatch(RHICommandBufferId cmd, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) override;
+    void cmdDispatchIndirect(RHICommandBufferId cmd, RHIBufferId buffer, uint64_t offset) override;
+
+    void cmdPipelineBarrier(RHICommandBufferId cmd,
+                            std::span<const RHIBufferBarrier> bufferBarriers,
+                            std::span<const RHITextureBarrier> textureBarriers) override;
+
+    void cmdCopyBuffer(RHICommandBufferId cmd, RHIBufferId src, RHIBufferId dst,
+                       uint64_t srcOffset, uint64_t dstOffset, uint64_t size) override;
+    void cmdCopyBufferToTexture(RHICommandBufferId cmd, RHIBufferId src, RHITextureId dst,
+                                uint64_t bufferOffset, uint32_t mipLevel = 0, uint32_t arrayLayer = 0) override;
+    void cmdCopyTextureToBuffer(RHICommandBufferId cmd, RHITextureId src, RHIBufferId dst,
+                                uint32_t mipLevel, uint32_t arrayLayer, uint64_t bufferOffset) override;
+
+    void cmdPushConstants(RHICommandBufferId cmd, RHIPipelineId pipeline,
+                          RHIShaderStage stages, uint32_t offset, uint32_t size, const void* data) override;
+
+    void cmdBeginDebugLabel(RHICommandBufferId cmd, const char* label, float color[4] = nullptr) override;
+    void cmdEndDebugLabel(RHICommandBufferId cmd) override;
+    void cmdInsertDebugLabel(RHICommandBufferId cmd, const char* label, float color[4] = nullptr) override;
+
+    // ========================================================================
+    // Queue Submission
+    // ========================================================================
+
+    void queueSubmit(RHIQueueHandle queue, const SubmitInfo& submitInfo) override;
+    void queueWaitIdle(RHIQueueHandle queue) override;
+
+    // ========================================================================
+    // SwapChain Present
+    // ========================================================================
+
+    AcquireResult acquireNextImage(RHISwapChainHandle swapChain, RHISemaphoreHandle semaphore,
+                                   RHIFenceHandle fence, uint64_t timeout, uint32_t* imageIndex) override;
+    bool queuePresent(RHIQueueHandle queue, const PresentInfo& presentInfo) override;
+
+    // ========================================================================
+    // Utility
+    // ========================================================================
+
+    void waitIdle() override;
+    uint64_t getCurrentFrameIndex() const override { return m_frameIndex; }
+    uint64_t getCompletedFrameIndex() const override { return m_completedFrameIndex; }
+
+    // ========================================================================
+    // Null-Specific Accessors
+    // ========================================================================
+
+    /// @brief Choose what cmd* calls do (takes effect for the next call, on any thread)
+    void setRecordMode(NullRecordMode mode) { m_recordMode.store(mode, std::memory_order_relaxed); }
+    NullRecordMode getRecordMode() const { return m_recordMode.load(std::memory_order_relaxed); }
+
+    /// @brief Make createBuffer() fail for buffers larger than bytes, like a device out of memory
+    /// @param bytes Largest buffer that can still be created (0 = no limit)
+    void setMaxBufferSize(uint64_t bytes) { m_maxBufferSize.store(bytes, std::memory_order_relaxed); }
+
+    /// @brief Snapshot of the device-level counters
+    NullRHIStats getStats() const;
+    void resetStats();
+
+    /// @brief What a command buffer recorded since its last beginCommandBuffer()
+    static const NullCommandCounts& getRecordedCounts(const RHICommandBufferHandle& cmd);
+
+    /// @brief Calls serialized by a command buffer since its last beginCommandBuffer() (Serialize mode)
+    static const std::vector<NullCommand>& getRecordedCommands(const RHICommandBufferHandle& cmd);
+
+private:
+    // ========================================================================
+    // Internal Helpers
+    // ========================================================================
+
+    /// @brief Count (and in Serialize mode, store) one cmd* call
+    template <typename... Args>
+    NullCommandBuffer* record(RHICommandBufferId cmd, NullCommandType type, Args... args);
+
+    void onResourceCreated();
+    void onResourceDestroyed();
+
+    void createSwapChainImages(NullSwapChain* swapchain);
+    void releaseSwapChainImages(NullSwapChain* swapchain);
+
+private:
+    // ========================================================================
+    // Queues
+    // ========================================================================
+
+    std::shared_ptr<NullQueue>      m_graphicsQueue;
+    std::shared_ptr<NullQueue>      m_computeQueue;
+    std::shared_ptr<NullQueue>      m_transferQueue;
+
+    // ========================================================================
+    // GPU Information
+    // ========================================================================
+
+    RHIGpuInfo                      m_gpuInfo;
+
+    // ========================================================================
+    // Id Pools
+    // ========================================================================
+
+    RHIHandlePool<RHIBuffer, NullBuffer>                m_buffers;
+    RHIHandlePool<RHITexture, NullTexture>              m_textures;
+    RHIHandlePool<RHIPipeline, NullPipeline>            m_pipelines;
+    RHIHandlePool<RHIDescriptorSet, NullDescriptorSet>  m_descriptorSets;
+    RHIHandlePool<RHICommandBuffer, NullCommandBuffer>  m_commandBuffers;
+
+    // ========================================================================
+    // Recording and Statistics
+    // ========================================================================
+
+    std::atomic<NullRecordMode>     m_recordMode{NullRecordMode::Count};
+    std::atomic<uint64_t>           m_maxBufferSize{0};
+
+    mutable std::mutex              m_statsMutex;
+    NullRHIStats                    m_stats;
+
+    // ========================================================================
+    // Frame Tracking
+    // ========================================================================
+
+    std::atomic<uint64_t>           m_frameIndex{0};
+    std::atomic<uint64_t>           m_completedFrameIndex{0};
+
+    // ========================================================================
+    // Configuration
+    // ========================================================================
+
+    bool                            m_initialized = false;
+    bool                            m_validationEnabled = false;
+};
+
+} // namespace vesper
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "runtime/function/render/rhi/rhi.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace vesper {
+
+// ============================================================================
+// Command Recording
+// ============================================================================
+
+/// @brief One entry per RHI::cmd* call
+enum class NullCommandType : uint8_t
+{
+    BeginRendering,
+    EndRendering,
+    SetViewport,
+    SetScissor,
+    BindPipeline,
+    BindDescriptorSets,
+    BindVertexBuffer,
+    BindIndexBuffer,
+    Draw,
+    DrawIndexed,
+    DrawIndirect,
+    DrawIndexedIndirect,
+    Dispatch,
+    DispatchIndirect,
+    PipelineBarrier,
+    CopyBuffer,
+    CopyBufferToTexture,
+    CopyTextureToBuffer,
+    PushConstants,
+    BeginDebugLabel,
+    EndDebugLabel,
+    InsertDebugLabel,
+
+    Count
+};
+
+constexpr size_t kNullCommandTypeCount = static_cast<size_t>(NullCommandType::Count);
+
+/// @brief What the Null backend does with cmd* calls
+enum class NullRecordMode : uint8_t
+{
+    Off,        // Drop them (resource state tracking still happens)
+    Count,      // Count them per command buffer, totals added up on submit
+    Serialize,  // Count them and append a NullCommand per call to the command buffer
+};
+
+/// @brief A serialized cmd* call
+///
+/// Objects are stored as their id value (RHIHandle::value(), 0 for none), offsets and sizes as-is. Arguments, in call
+/// order after the command buffer:
+/// - BeginRendering: color attachment count, depth attachment id, render area width, height,
+///   flags (1 = suspending, 2 = resuming)
+/// - SetViewport / SetScissor: x, y, width, height (floats as their bits)
+/// - BindPipeline: pipeline
+/// - BindDescriptorSets: pipeline, firstSet, set count, dynamic offset count, first set
+/// - BindVertexBuffer: binding, buffer, offset / BindIndexBuffer: buffer, offset, use16Bit
+/// - Draw / DrawIndexed: the draw arguments (vertexOffset as its bits)
+/// - DrawIndirect / DrawIndexedIndirect: buffer, offset, drawCount, stride
+/// - Dispatch: group counts / DispatchIndirect: buffer, offset
+/// - PipelineBarrier: buffer barrier count, texture barrier count
+/// - CopyBuffer: src, dst, srcOffset, dstOffset, size
+/// - CopyBufferToTexture: src, dst, bufferOffset, mipLevel, arrayLayer
+/// - CopyTextureToBuffer: src, dst, mipLevel, arrayLayer, bufferOffset
+/// - PushConstants: pipeline, stages, offset, size
+/// - Debug labels: nothing (the text is not kept)
+struct NullCommand
+{
+    NullCommandType type = NullCommandType::Count;
+    uint64_t        args[6] = {};
+};
+
+/// @brief What a command buffer (or a run of submissions) recorded
+struct NullCommandCounts
+{
+    std::array<uint64_t, kNullCommandTypeCount> commands = {};
+
+    uint64_t bufferBarriers      = 0;
+    uint64_t textureBarriers     = 0;
+    uint64_t descriptorSetsBound = 0;
+    uint64_t pushConstantBytes   = 0;
+
+    uint64_t count(NullCommandType type) const { return commands[static_cast<size_t>(type)]; }
+
+    /// @brief Every cmd* call
+    uint64_t total() const
+    {
+        uint64_t sum = 0;
+        for (const uint64_t n : commands)
+        {
+            sum += n;
+        }
+        return sum;
+    }
+
+    /// @brief Draw calls of all kinds (an indirect call counts once)
+    uint64_t drawCalls() const
+    {
+        return count(NullCommandType::Draw) + count(NullCommandType::DrawIndexed) +
+               count(NullCommandType::DrawIndirect) + count(NullCommandType::DrawIndexedIndirect);
+    }
+
+    void add(const NullCommandCounts& other)
+    {
+        for (size_t i = 0; i < kNullCommandTypeCount; ++i)
+        {
+            commands[i] += other.commands[i];
+        }
+        bufferBarriers      += other.bufferBarriers;
+        textureBarriers     += other.textureBarriers;
+        descriptorSetsBound += other.descriptorSetsBound;
+        pushConstantBytes   += other.pushConstantBytes;
+    }
+};
+
+/// @brief Device-level activity, accumulated since initialize() or the last resetStats()
+struct NullRHIStats
+{
+    NullCommandCounts submitted;   // Counts of every command buffer submitted
+
+    uint64_t submits                = 0;
+    uint64_t commandBuffersSubmitted = 0;
+    uint64_t presents               = 0;
+
+    uint64_t resourcesCreated       = 0;
+    uint64_t resourcesDestroyed     = 0;
+    uint64_t descriptorSetsCreated  = 0;
+    uint64_t descriptorWrites       = 0;
+    uint64_t bytesUpdated           = 0;   // updateBuffer() traffic
+};
+
+// ============================================================================
+// Null Resource Types
+// ============================================================================
+
+struct NullBuffer : public RHIBuffer
+{
+    std::vector<uint8_t>    storage;   // Host memory, allocated on first map (or at creation for CPU-visible buffers)
+};
+
+struct NullTexture : public RHITexture
+{
+    bool isSwapchainImage = false;
+};
+
+struct NullSampler : public RHISampler
+{
+};
+
+struct NullShader : public RHIShader
+{
+};
+
+struct NullDescriptorSetLayout : public RHIDescriptorSetLayout
+{
+    std::vector<RHIDescriptorBinding> bindings;
+};
+
+struct NullPipeline : public RHIPipeline
+{
+};
+
+struct NullDescriptorSet : public RHIDescriptorSet
+{
+};
+
+struct NullCommandPool : public RHICommandPool
+{
+};
+
+struct NullCommandBuffer : public RHICommandBuffer
+{
+    // Cleared by beginCommandBuffer()
+    NullCommandCounts           counts;
+    std::vector<NullCommand>    commands;   // NullRecordMode::Serialize only
+};
+
+struct NullFence : public RHIFence
+{
+};
+
+struct NullSemaphore : public RHISemaphore
+{
+};
+
+struct NullQueue : public RHIQueue
+{
+};
+
+struct NullSwapChain : public RHISwapChain
+{
+    std::vector<RHITextureHandle> imageTextures;
+};
+
+} // namespace vesper
@@ -853,6 +853,7 @@ void VulkanRHI::createSwapChainInternal(VulkanSwapChain* swapchain, uint32_t wid
 
         VK_CHECK(vk.vkCreateImageView(m_device, &viewInfo, nullptr, &texture->imageView));
 
+        texture->id = m_textures.allocate(texture.get());
         swapchain->imageTextures.push_back(texture);
     }
 }
@@ -865,6 +866,7 @@ void VulkanRHI::destroySwapChainInternal(VulkanSwapChain* swapchain)
         if (vkTexture->imageView != VK_NULL_HANDLE) {
             vk.vkDestroyImageView(m_device, vkTexture->imageView, nullptr);
         }
+        m_textures.release(vkTexture->id);
     }
     swapchain->imageTextures.clear();
     swapchain->images.clear();
@@ -956,6 +958,7 @@ RHIBufferHandle VulkanRHI::createBuffer(const RHIBufferDesc& desc)
         setVkObjectName(m_device, buffer->buffer, VK_OBJECT_TYPE_BUFFER, desc.debugName);
     }
 
+    buffer->id = m_buffers.allocate(buffer.get());
     return buffer;
 }
 
@@ -964,6 +967,7 @@ void VulkanRHI::destroyBuffer(RHIBufferHandle buffer)
     if (!buffer) return;
 
     auto vkBuffer = std::static_pointer_cast<VulkanBuffer>(buffer);
+    m_buffers.release(vkBuffer->id);
     if (vkBuffer->buffer != VK_NULL_HANDLE) {
         vmaDestroyBuffer(m_allocator, vkBuffer->buffer, vkBuffer->allocation);
         vkBuffer->buffer = VK_NULL_HANDLE;
@@ -1030,6 +1034,7 @@ RHITextureHandle VulkanRHI::createTexture(const RHITextureDesc& desc)
         setVkObjectName(m_device, texture->image, VK_OBJECT_TYPE_IMAGE, desc.debugName);
     }
 
+    texture->id = m_textures.allocate(texture.get());
     return texture;
 }
 
@@ -1038,6 +1043,7 @@ void VulkanRHI::destroyTexture(RHITextureHandle texture)
     if (!texture) return;
 
     auto vkTexture = std::static_pointer_cast<VulkanTexture>(texture);
+    m_textures.release(vkTexture->id);
 
     if (vkTexture->imageView != VK_NULL_HANDLE) {
         vk.vkDestroyImageView(m_device, vkTexture->imageView, nullptr);
@@ -1413,6 +1419,7 @@ RHIPipelineHandle VulkanRHI::createGraphicsPipeline(const RHIGraphicsPipelineDes
         setVkObjectName(m_device, pipeline->pipeline, VK_OBJECT_TYPE_PIPELINE, desc.debugName);
     }
 
+    pipeline->id = m_pipelines.allocate(pipeline.get());
     return pipeline;
 }
 
@@ -1432,10 +1439,22 @@ RHIPipelineHandle VulkanRHI::createComputePipeline(const RHIComputePipelineDesc&
     }
     pipeline->descriptorSetLayouts = setLayouts;
 
+    // Push constant ranges
+    std::vector<VkPushConstantRange> pushConstantRanges;
+    for (const auto& range : desc.pushConstantRanges) {
+        VkPushConstantRange vkRange = {};
+        vkRange.stageFlags = toVkShaderStageFlags(range.stages);
+        vkRange.offset = range.offset;
+        vkRange.size = range.size;
+        pushConstantRanges.push_back(vkRange);
+    }
+
     VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
     pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(setLayouts.size());
     pipelineLayoutInfo.pSetLayouts = setLayouts.data();
+    pipelineLayoutInfo.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size());
+    pipelineLayoutInfo.pPushConstantRanges = pushConstantRanges.data();
 
     VK_CHECK_RETURN(vk.vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &pipeline->pipelineLayout), nullptr);
 
@@ -1456,6 +1475,7 @@ RHIPipelineHandle VulkanRHI::createComputePipeline(const RHIComputePipelineDesc&
         setVkObjectName(m_device, pipeline->pipeline, VK_OBJECT_TYPE_PIPELINE, desc.debugName);
     }
 
+    pipeline->id = m_pipelines.allocate(pipeline.get());
     return pipeline;
 }
 
@@ -1464,6 +1484,7 @@ void VulkanRHI::destroyPipeline(RHIPipelineHandle pipeline)
     if (!pipeline) return;
 
     auto vkPipeline = std::static_pointer_cast<VulkanPipeline>(pipeline);
+    m_pipelines.release(vkPipeline->id);
 
     if (vkPipeline->pipeline != VK_NULL_HANDLE) {
         vk.vkDestroyPipeline(m_device, vkPipeline->pipeline, nullptr);
@@ -1496,6 +1517,7 @@ RHIDescriptorSetHandle VulkanRHI::createDescriptorSet(RHIDescriptorSetLayoutHand
     std::lock_guard<std::mutex> lock(m_descriptorPoolMutex);
     VK_CHECK_RETURN(vk.vkAllocateDescriptorSets(m_device, &allocInfo, &set->set), nullptr);
 
+    set->id = m_descriptorSets.allocate(set.get());
     return set;
 }
 
@@ -1504,6 +1526,7 @@ void VulkanRHI::destroyDescriptorSet(RHIDescriptorSetHandle set)
     if (!set) return;
 
     auto vkSet = std::static_pointer_cast<VulkanDescriptorSet>(set);
+    m_descriptorSets.release(vkSet->id);
     if (vkSet->set != VK_NULL_HANDLE) {
         std::lock_guard<std::mutex> lock(m_descriptorPoolMutex);
         vk.vkFreeDescriptorSets(m_device, vkSet->pool, 1, &vkSet->set);
@@ -1633,6 +1656,7 @@ RHICommandBufferHandle VulkanRHI::allocateCommandBuffer(RHICommandPoolHandle poo
         setVkObjectName(m_device, cmd->commandBuffer, VK_OBJECT_TYPE_COMMAND_BUFFER, desc.debugName);
     }
 
+    cmd->id = m_commandBuffers.allocate(cmd.get());
     return cmd;
 }
 
@@ -1642,6 +1666,7 @@ void VulkanRHI::freeCommandBuffer(RHICommandPoolHandle pool, RHICommandBufferHan
 
     auto vkPool = std::static_pointer_cast<VulkanCommandPool>(pool);
     auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    m_commandBuffers.release(vkCmd->id);
 
     if (vkCmd->commandBuffer != VK_NULL_HANDLE) {
         vk.vkFreeCommandBuffers(m_device, vkPool->pool, 1, &vkCmd->commandBuffer);
@@ -1727,9 +1752,10 @@ void VulkanRHI::destroySemaphore(RHISemaphoreHandle semaphore)
 // Command Recording
 // ============================================================================
 
-void VulkanRHI::beginCommandBuffer(RHICommandBufferHandle cmd)
+void VulkanRHI::beginCommandBuffer(RHICommandBufferId cmd)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
 
     VkCommandBufferBeginInfo beginInfo = {};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -1739,20 +1765,23 @@ void VulkanRHI::beginCommandBuffer(RHICommandBufferHandle cmd)
     vkCmd->isRecording = true;
 }
 
-void VulkanRHI::endCommandBuffer(RHICommandBufferHandle cmd)
+void VulkanRHI::endCommandBuffer(RHICommandBufferId cmd)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
     VK_CHECK(vk.vkEndCommandBuffer(vkCmd->commandBuffer));
     vkCmd->isRecording = false;
 }
 
-void VulkanRHI::cmdBeginRendering(RHICommandBufferHandle cmd, const RHIRenderingInfo& info)
+void VulkanRHI::cmdBeginRendering(RHICommandBufferId cmd, const RHIRenderingInfo& info)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
 
     std::vector<VkRenderingAttachmentInfo> colorAttachments;
     for (const auto& attachment : info.colorAttachments) {
-        auto vkTexture = std::static_pointer_cast<VulkanTexture>(attachment.texture);
+        auto vkTexture = m_textures.get(attachment.texture);
+        if (!vkTexture) continue;
 
         VkRenderingAttachmentInfo attachmentInfo = {};
         attachmentInfo.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
@@ -1767,8 +1796,7 @@ void VulkanRHI::cmdBeginRendering(RHICommandBufferHandle cmd, const RHIRendering
             attachment.clearValue.color[3]
         }};
 
-        if (attachment.resolveTexture) {
-            auto vkResolve = std::static_pointer_cast<VulkanTexture>(attachment.resolveTexture);
+        if (auto vkResolve = m_textures.get(attachment.resolveTexture)) {
             attachmentInfo.resolveMode = VK_RESOLVE_MODE_AVERAGE_BIT;
             attachmentInfo.resolveImageView = vkResolve->imageView;
             attachmentInfo.resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
@@ -1778,11 +1806,10 @@ void VulkanRHI::cmdBeginRendering(RHICommandBufferHandle cmd, const RHIRendering
     }
 
     VkRenderingAttachmentInfo depthAttachment = {};
-    if (info.depthAttachment && info.depthAttachment->texture) {
-        auto vkTexture = std::static_pointer_cast<VulkanTexture>(info.depthAttachment->texture);
-
+    VulkanTexture* vkDepth = info.depthAttachment ? m_textures.get(info.depthAttachment->texture) : nullptr;
+    if (vkDepth) {
         depthAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
-        depthAttachment.imageView = vkTexture->imageView;
+        depthAttachment.imageView = vkDepth->imageView;
         depthAttachment.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
         depthAttachment.loadOp = toVkLoadOp(info.depthAttachment->loadOp);
         depthAttachment.storeOp = toVkStoreOp(info.depthAttachment->storeOp);
@@ -1794,12 +1821,14 @@ void VulkanRHI::cmdBeginRendering(RHICommandBufferHandle cmd, const RHIRendering
 
     VkRenderingInfo renderingInfo = {};
     renderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
+    renderingInfo.flags = (info.suspending ? VK_RENDERING_SUSPENDING_BIT : 0) |
+                          (info.resuming ? VK_RENDERING_RESUMING_BIT : 0);
     renderingInfo.renderArea.offset = {info.renderArea.offset.x, info.renderArea.offset.y};
     renderingInfo.renderArea.extent = {info.renderArea.extent.width, info.renderArea.extent.height};
     renderingInfo.layerCount = info.layerCount;
     renderingInfo.colorAttachmentCount = static_cast<uint32_t>(colorAttachments.size());
     renderingInfo.pColorAttachments = colorAttachments.data();
-    renderingInfo.pDepthAttachment = (info.depthAttachment && info.depthAttachment->texture) ? &depthAttachment : nullptr;
+    renderingInfo.pDepthAttachment = vkDepth ? &depthAttachment : nullptr;
     renderingInfo.pStencilAttachment = nullptr;  // TODO: stencil support
 
     if (!vk.vkCmdBeginRendering) {
@@ -1809,9 +1838,10 @@ void VulkanRHI::cmdBeginRendering(RHICommandBufferHandle cmd, const RHIRendering
     vk.vkCmdBeginRendering(vkCmd->commandBuffer, &renderingInfo);
 }
 
-void VulkanRHI::cmdEndRendering(RHICommandBufferHandle cmd)
+void VulkanRHI::cmdEndRendering(RHICommandBufferId cmd)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
     if (!vk.vkCmdEndRendering) {
         LOG_ERROR("vkCmdEndRendering is null - dynamic rendering not available");
         return;
@@ -1819,9 +1849,10 @@ void VulkanRHI::cmdEndRendering(RHICommandBufferHandle cmd)
     vk.vkCmdEndRendering(vkCmd->commandBuffer);
 }
 
-void VulkanRHI::cmdSetViewport(RHICommandBufferHandle cmd, const RHIViewport& viewport)
+void VulkanRHI::cmdSetViewport(RHICommandBufferId cmd, const RHIViewport& viewport)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
 
     VkViewport vkViewport = {};
     vkViewport.x = viewport.x;
@@ -1834,9 +1865,10 @@ void VulkanRHI::cmdSetViewport(RHICommandBufferHandle cmd, const RHIViewport& vi
     vk.vkCmdSetViewport(vkCmd->commandBuffer, 0, 1, &vkViewport);
 }
 
-void VulkanRHI::cmdSetScissor(RHICommandBufferHandle cmd, const RHIRect2D& scissor)
+void VulkanRHI::cmdSetScissor(RHICommandBufferId cmd, const RHIRect2D& scissor)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
 
     VkRect2D vkScissor = {};
     vkScissor.offset = {scissor.offset.x, scissor.offset.y};
@@ -1845,24 +1877,27 @@ void VulkanRHI::cmdSetScissor(RHICommandBufferHandle cmd, const RHIRect2D& sciss
     vk.vkCmdSetScissor(vkCmd->commandBuffer, 0, 1, &vkScissor);
 }
 
-void VulkanRHI::cmdBindPipeline(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline)
+void VulkanRHI::cmdBindPipeline(RHICommandBufferId cmd, RHIPipelineId pipeline)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkPipeline = std::static_pointer_cast<VulkanPipeline>(pipeline);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkPipeline = m_pipelines.get(pipeline);
+    if (!vkCmd || !vkPipeline) return;
 
     vk.vkCmdBindPipeline(vkCmd->commandBuffer, vkPipeline->bindPoint, vkPipeline->pipeline);
 }
 
-void VulkanRHI::cmdBindDescriptorSets(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline,
-                                      uint32_t firstSet, std::span<const RHIDescriptorSetHandle> sets,
+void VulkanRHI::cmdBindDescriptorSets(RHICommandBufferId cmd, RHIPipelineId pipeline,
+                                      uint32_t firstSet, std::span<const RHIDescriptorSetId> sets,
                                       std::span<const uint32_t> dynamicOffsets)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkPipeline = std::static_pointer_cast<VulkanPipeline>(pipeline);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkPipeline = m_pipelines.get(pipeline);
+    if (!vkCmd || !vkPipeline) return;
 
     std::vector<VkDescriptorSet> vkSets;
     for (const auto& set : sets) {
-        auto vkSet = std::static_pointer_cast<VulkanDescriptorSet>(set);
+        auto vkSet = m_descriptorSets.get(set);
+        if (!vkSet) return;
         vkSets.push_back(vkSet->set);
     }
 
@@ -1871,11 +1906,12 @@ void VulkanRHI::cmdBindDescriptorSets(RHICommandBufferHandle cmd, RHIPipelineHan
                                static_cast<uint32_t>(dynamicOffsets.size()), dynamicOffsets.data());
 }
 
-void VulkanRHI::cmdBindVertexBuffer(RHICommandBufferHandle cmd, uint32_t binding,
-                                    RHIBufferHandle buffer, uint64_t offset)
+void VulkanRHI::cmdBindVertexBuffer(RHICommandBufferId cmd, uint32_t binding,
+                                    RHIBufferId buffer, uint64_t offset)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkBuffer = std::static_pointer_cast<VulkanBuffer>(buffer);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkBuffer = m_buffers.get(buffer);
+    if (!vkCmd || !vkBuffer) return;
 
     VkBuffer buffers[] = {vkBuffer->buffer};
     VkDeviceSize offsets[] = {offset};
@@ -1883,67 +1919,75 @@ void VulkanRHI::cmdBindVertexBuffer(RHICommandBufferHandle cmd, uint32_t binding
     vk.vkCmdBindVertexBuffers(vkCmd->commandBuffer, binding, 1, buffers, offsets);
 }
 
-void VulkanRHI::cmdBindIndexBuffer(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+void VulkanRHI::cmdBindIndexBuffer(RHICommandBufferId cmd, RHIBufferId buffer,
                                    uint64_t offset, bool use16Bit)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkBuffer = std::static_pointer_cast<VulkanBuffer>(buffer);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkBuffer = m_buffers.get(buffer);
+    if (!vkCmd || !vkBuffer) return;
 
     vk.vkCmdBindIndexBuffer(vkCmd->commandBuffer, vkBuffer->buffer, offset,
                             use16Bit ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
 }
 
-void VulkanRHI::cmdDraw(RHICommandBufferHandle cmd, uint32_t vertexCount, uint32_t instanceCount,
+void VulkanRHI::cmdDraw(RHICommandBufferId cmd, uint32_t vertexCount, uint32_t instanceCount,
                         uint32_t firstVertex, uint32_t firstInstance)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
     vk.vkCmdDraw(vkCmd->commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
 }
 
-void VulkanRHI::cmdDrawIndexed(RHICommandBufferHandle cmd, uint32_t indexCount, uint32_t instanceCount,
+void VulkanRHI::cmdDrawIndexed(RHICommandBufferId cmd, uint32_t indexCount, uint32_t instanceCount,
                                uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
     vk.vkCmdDrawIndexed(vkCmd->commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 }
 
-void VulkanRHI::cmdDrawIndirect(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+void VulkanRHI::cmdDrawIndirect(RHICommandBufferId cmd, RHIBufferId buffer,
                                 uint64_t offset, uint32_t drawCount, uint32_t stride)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkBuffer = std::static_pointer_cast<VulkanBuffer>(buffer);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkBuffer = m_buffers.get(buffer);
+    if (!vkCmd || !vkBuffer) return;
 
     vk.vkCmdDrawIndirect(vkCmd->commandBuffer, vkBuffer->buffer, offset, drawCount, stride);
 }
 
-void VulkanRHI::cmdDrawIndexedIndirect(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+void VulkanRHI::cmdDrawIndexedIndirect(RHICommandBufferId cmd, RHIBufferId buffer,
                                        uint64_t offset, uint32_t drawCount, uint32_t stride)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkBuffer = std::static_pointer_cast<VulkanBuffer>(buffer);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkBuffer = m_buffers.get(buffer);
+    if (!vkCmd || !vkBuffer) return;
 
     vk.vkCmdDrawIndexedIndirect(vkCmd->commandBuffer, vkBuffer->buffer, offset, drawCount, stride);
 }
 
-void VulkanRHI::cmdDispatch(RHICommandBufferHandle cmd, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+void VulkanRHI::cmdDispatch(RHICommandBufferId cmd, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
     vk.vkCmdDispatch(vkCmd->commandBuffer, groupCountX, groupCountY, groupCountZ);
 }
 
-void VulkanRHI::cmdDispatchIndirect(RHICommandBufferHandle cmd, RHIBufferHandle buffer, uint64_t offset)
+void VulkanRHI::cmdDispatchIndirect(RHICommandBufferId cmd, RHIBufferId buffer, uint64_t offset)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkBuffer = std::static_pointer_cast<VulkanBuffer>(buffer);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkBuffer = m_buffers.get(buffer);
+    if (!vkCmd || !vkBuffer) return;
 
     vk.vkCmdDispatchIndirect(vkCmd->commandBuffer, vkBuffer->buffer, offset);
 }
 
-void VulkanRHI::cmdPipelineBarrier(RHICommandBufferHandle cmd,
+void VulkanRHI::cmdPipelineBarrier(RHICommandBufferId cmd,
                                    std::span<const RHIBufferBarrier> bufferBarriers,
                                    std::span<const RHITextureBarrier> textureBarriers)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
 
     std::vector<VkBufferMemoryBarrier> vkBufferBarriers;
     std::vector<VkImageMemoryBarrier> vkImageBarriers;
@@ -1952,7 +1996,8 @@ void VulkanRHI::cmdPipelineBarrier(RHICommandBufferHandle cmd,
     VkPipelineStageFlags dstStageMask = 0;
 
     for (const auto& barrier : bufferBarriers) {
-        auto vkBuffer = std::static_pointer_cast<VulkanBuffer>(barrier.buffer);
+        auto vkBuffer = m_buffers.get(barrier.buffer);
+        if (!vkBuffer) continue;
         auto srcInfo = toVkResourceState(barrier.srcState);
         auto dstInfo = toVkResourceState(barrier.dstState);
 
@@ -1972,7 +2017,8 @@ void VulkanRHI::cmdPipelineBarrier(RHICommandBufferHandle cmd,
     }
 
     for (const auto& barrier : textureBarriers) {
-        auto vkTexture = std::static_pointer_cast<VulkanTexture>(barrier.texture);
+        auto vkTexture = m_textures.get(barrier.texture);
+        if (!vkTexture) continue;
         bool isDepth = isDepthFormat(vkTexture->format);
         auto srcInfo = toVkResourceState(barrier.srcState, isDepth);
         auto dstInfo = toVkResourceState(barrier.dstState, isDepth);
@@ -2012,12 +2058,13 @@ void VulkanRHI::cmdPipelineBarrier(RHICommandBufferHandle cmd,
                             static_cast<uint32_t>(vkImageBarriers.size()), vkImageBarriers.data());
 }
 
-void VulkanRHI::cmdCopyBuffer(RHICommandBufferHandle cmd, RHIBufferHandle src, RHIBufferHandle dst,
+void VulkanRHI::cmdCopyBuffer(RHICommandBufferId cmd, RHIBufferId src, RHIBufferId dst,
                               uint64_t srcOffset, uint64_t dstOffset, uint64_t size)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkSrc = std::static_pointer_cast<VulkanBuffer>(src);
-    auto vkDst = std::static_pointer_cast<VulkanBuffer>(dst);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkSrc = m_buffers.get(src);
+    auto vkDst = m_buffers.get(dst);
+    if (!vkCmd || !vkSrc || !vkDst) return;
 
     VkBufferCopy copyRegion = {};
     copyRegion.srcOffset = srcOffset;
@@ -2027,12 +2074,13 @@ void VulkanRHI::cmdCopyBuffer(RHICommandBufferHandle cmd, RHIBufferHandle src, R
     vk.vkCmdCopyBuffer(vkCmd->commandBuffer, vkSrc->buffer, vkDst->buffer, 1, &copyRegion);
 }
 
-void VulkanRHI::cmdCopyBufferToTexture(RHICommandBufferHandle cmd, RHIBufferHandle src, RHITextureHandle dst,
+void VulkanRHI::cmdCopyBufferToTexture(RHICommandBufferId cmd, RHIBufferId src, RHITextureId dst,
                                        uint64_t bufferOffset, uint32_t mipLevel, uint32_t arrayLayer)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkSrc = std::static_pointer_cast<VulkanBuffer>(src);
-    auto vkDst = std::static_pointer_cast<VulkanTexture>(dst);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkSrc = m_buffers.get(src);
+    auto vkDst = m_textures.get(dst);
+    if (!vkCmd || !vkSrc || !vkDst) return;
 
     VkBufferImageCopy region = {};
     region.bufferOffset = bufferOffset;
@@ -2049,12 +2097,13 @@ void VulkanRHI::cmdCopyBufferToTexture(RHICommandBufferHandle cmd, RHIBufferHand
                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
 }
 
-void VulkanRHI::cmdCopyTextureToBuffer(RHICommandBufferHandle cmd, RHITextureHandle src, RHIBufferHandle dst,
+void VulkanRHI::cmdCopyTextureToBuffer(RHICommandBufferId cmd, RHITextureId src, RHIBufferId dst,
                                        uint32_t mipLevel, uint32_t arrayLayer, uint64_t bufferOffset)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkSrc = std::static_pointer_cast<VulkanTexture>(src);
-    auto vkDst = std::static_pointer_cast<VulkanBuffer>(dst);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkSrc = m_textures.get(src);
+    auto vkDst = m_buffers.get(dst);
+    if (!vkCmd || !vkSrc || !vkDst) return;
 
     VkBufferImageCopy region = {};
     region.bufferOffset = bufferOffset;
@@ -2071,21 +2120,23 @@ void VulkanRHI::cmdCopyTextureToBuffer(RHICommandBufferHandle cmd, RHITextureHan
                               VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, vkDst->buffer, 1, &region);
 }
 
-void VulkanRHI::cmdPushConstants(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline,
+void VulkanRHI::cmdPushConstants(RHICommandBufferId cmd, RHIPipelineId pipeline,
                                  RHIShaderStage stages, uint32_t offset, uint32_t size, const void* data)
 {
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
-    auto vkPipeline = std::static_pointer_cast<VulkanPipeline>(pipeline);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    auto vkPipeline = m_pipelines.get(pipeline);
+    if (!vkCmd || !vkPipeline) return;
 
     vk.vkCmdPushConstants(vkCmd->commandBuffer, vkPipeline->pipelineLayout,
                           toVkShaderStageFlags(stages), offset, size, data);
 }
 
-void VulkanRHI::cmdBeginDebugLabel(RHICommandBufferHandle cmd, const char* label, float color[4])
+void VulkanRHI::cmdBeginDebugLabel(RHICommandBufferId cmd, const char* label, float color[4])
 {
     if (!m_debugMarkersEnabled || !vk.vkCmdBeginDebugUtilsLabelEXT) return;
 
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
 
     VkDebugUtilsLabelEXT labelInfo = {};
     labelInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
@@ -2102,19 +2153,21 @@ void VulkanRHI::cmdBeginDebugLabel(RHICommandBufferHandle cmd, const char* label
     vk.vkCmdBeginDebugUtilsLabelEXT(vkCmd->commandBuffer, &labelInfo);
 }
 
-void VulkanRHI::cmdEndDebugLabel(RHICommandBufferHandle cmd)
+void VulkanRHI::cmdEndDebugLabel(RHICommandBufferId cmd)
 {
     if (!m_debugMarkersEnabled || !vk.vkCmdEndDebugUtilsLabelEXT) return;
 
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
     vk.vkCmdEndDebugUtilsLabelEXT(vkCmd->commandBuffer);
 }
 
-void VulkanRHI::cmdInsertDebugLabel(RHICommandBufferHandle cmd, const char* label, float color[4])
+void VulkanRHI::cmdInsertDebugLabel(RHICommandBufferId cmd, const char* label, float color[4])
 {
     if (!m_debugMarkersEnabled || !vk.vkCmdInsertDebugUtilsLabelEXT) return;
 
-    auto vkCmd = std::static_pointer_cast<VulkanCommandBuffer>(cmd);
+    auto vkCmd = m_commandBuffers.get(cmd);
+    if (!vkCmd) return;
 
     VkDebugUtilsLabelEXT labelInfo = {};
     labelInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
@@ -118,54 +118,54 @@ public:
     // Command Recording
     // ========================================================================
 
-    void beginCommandBuffer(RHICommandBufferHandle cmd) override;
-    void endCommandBuffer(RHICommandBufferHandle cmd) override;
+    void beginCommandBuffer(RHICommandBufferId cmd) override;
+    void endCommandBuffer(RHICommandBufferId cmd) override;
 
-    void cmdBeginRendering(RHICommandBufferHandle cmd, const RHIRenderingInfo& info) override;
-    void cmdEndRendering(RHICommandBufferHandle cmd) override;
+    void cmdBeginRendering(RHICommandBufferId cmd, const RHIRenderingInfo& info) override;
+    void cmdEndRendering(RHICommandBufferId cmd) override;
 
-    void cmdSetViewport(RHICommandBufferHandle cmd, const RHIViewport& viewport) override;
-    void cmdSetScissor(RHICommandBufferHandle cmd, const RHIRect2D& scissor) override;
+    void cmdSetViewport(RHICommandBufferId cmd, const RHIViewport& viewport) override;
+    void cmdSetScissor(RHICommandBufferId cmd, const RHIRect2D& scissor) override;
 
-    void cmdBindPipeline(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline) override;
-    void cmdBindDescriptorSets(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline,
-                               uint32_t firstSet, std::span<const RHIDescriptorSetHandle> sets,
+    void cmdBindPipeline(RHICommandBufferId cmd, RHIPipelineId pipeline) override;
+    void cmdBindDescriptorSets(RHICommandBufferId cmd, RHIPipelineId pipeline,
+                               uint32_t firstSet, std::span<const RHIDescriptorSetId> sets,
                                std::span<const uint32_t> dynamicOffsets = {}) override;
 
-    void cmdBindVertexBuffer(RHICommandBufferHandle cmd, uint32_t binding,
-                             RHIBufferHandle buffer, uint64_t offset = 0) override;
-    void cmdBindIndexBuffer(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+    void cmdBindVertexBuffer(RHICommandBufferId cmd, uint32_t binding,
+                             RHIBufferId buffer, uint64_t offset = 0) override;
+    void cmdBindIndexBuffer(RHICommandBufferId cmd, RHIBufferId buffer,
                             uint64_t offset = 0, bool use16Bit = false) override;
 
-    void cmdDraw(RHICommandBufferHandle cmd, uint32_t vertexCount, uint32_t instanceCount = 1,
+    void cmdDraw(RHICommandBufferId cmd, uint32_t vertexCount, uint32_t instanceCount = 1,
                  uint32_t firstVertex = 0, uint32_t firstInstance = 0) override;
-    void cmdDrawIndexed(RHICommandBufferHandle cmd, uint32_t indexCount, uint32_t instanceCount = 1,
+    void cmdDrawIndexed(RHICommandBufferId cmd, uint32_t indexCount, uint32_t instanceCount = 1,
                         uint32_t firstIndex = 0, int32_t vertexOffset = 0, uint32_t firstInstance = 0) override;
-    void cmdDrawIndirect(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+    void cmdDrawIndirect(RHICommandBufferId cmd, RHIBufferId buffer,
                          uint64_t offset, uint32_t drawCount, uint32_t stride) override;
-    void cmdDrawIndexedIndirect(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+    void cmdDrawIndexedIndirect(RHICommandBufferId cmd, RHIBufferId buffer,
                                 uint64_t offset, uint32_t drawCount, uint32_t stride) override;
 
-    void cmdDispatch(RHICommandBufferHandle cmd, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) override;
-    void cmdDispatchIndirect(RHICommandBufferHandle cmd, RHIBufferHandle buffer, uint64_t offset) override;
+    void cmdDispatch(RHICommandBufferId cmd, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) override;
+    void cmdDispatchIndirect(RHICommandBufferId cmd, RHIBufferId buffer, uint64_t offset) override;
 
-    void cmdPipelineBarrier(RHICommandBufferHandle cmd,
+    void cmdPipelineBarrier(RHICommandBufferId cmd,
                             std::span<const RHIBufferBarrier> bufferBarriers,
                             std::span<const RHITextureBarrier> textureBarriers) override;
 
-    void cmdCopyBuffer(RHICommandBufferHandle cmd, RHIBufferHandle src, RHIBufferHandle dst,
+    void cmdCopyBuffer(RHICommandBufferId cmd, RHIBufferId src, RHIBufferId dst,
                        uint64_t srcOffset, uint64_t dstOffset, uint64_t size) override;
-    void cmdCopyBufferToTexture(RHICommandBufferHandle cmd, RHIBufferHandle src, RHITextureHandle dst,
+    void cmdCopyBufferToTexture(RHICommandBufferId cmd, RHIBufferId src, RHITextureId dst,
                                 uint64_t bufferOffset, uint32_t mipLevel = 0, uint32_t arrayLayer = 0) override;
-    void cmdCopyTextureToBuffer(RHICommandBufferHandle cmd, RHITextureHandle src, RHIBufferHandle dst,
+    void cmdCopyTextureToBuffer(RHICommandBufferId cmd, RHITextureId src, RHIBufferId dst,
                                 uint32_t mipLevel, uint32_t arrayLayer, uint64_t bufferOffset) override;
 
-    void cmdPushConstants(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline,
+    void cmdPushConstants(RHICommandBufferId cmd, RHIPipelineId pipeline,
                           RHIShaderStage stages, uint32_t offset, uint32_t size, const void* data) override;
 
-    void cmdBeginDebugLabel(RHICommandBufferHandle cmd, const char* label, float color[4] = nullptr) override;
-    void cmdEndDebugLabel(RHICommandBufferHandle cmd) override;
-    void cmdInsertDebugLabel(RHICommandBufferHandle cmd, const char* label, float color[4] = nullptr) override;
+    void cmdBeginDebugLabel(RHICommandBufferId cmd, const char* label, float color[4] = nullptr) override;
+    void cmdEndDebugLabel(RHICommandBufferId cmd) override;
+    void cmdInsertDebugLabel(RHICommandBufferId cmd, const char* label, float color[4] = nullptr) override;
 
     // ========================================================================
     // Queue Submission
@@ -254,6 +254,16 @@ private:
     VkDescriptorPool                m_descriptorPool    = VK_NULL_HANDLE;
     std::mutex                      m_descriptorPoolMutex;
 
+    // ========================================================================
+    // Id Pools (resolve the ids command recording takes)
+    // ========================================================================
+
+    RHIHandlePool<RHIBuffer, VulkanBuffer>                  m_buffers;
+    RHIHandlePool<RHITexture, VulkanTexture>                m_textures;
+    RHIHandlePool<RHIPipeline, VulkanPipeline>              m_pipelines;
+    RHIHandlePool<RHIDescriptorSet, VulkanDescriptorSet>    m_descriptorSets;
+    RHIHandlePool<RHICommandBuffer, VulkanCommandBuffer>    m_commandBuffers;
+
     // ========================================================================
     // GPU Information
     // ========================================================================
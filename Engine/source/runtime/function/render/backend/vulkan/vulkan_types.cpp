@@ -639,7 +639,8 @@ VkResourceStateInfo toVkResourceState(RHIResourceState state, bool isDepth)
         case RHIResourceState::ShaderResource:
             info.accessMask = VK_ACCESS_SHADER_READ_BIT;
             info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-            info.stageMask = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            info.stageMask = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
             break;
 
         case RHIResourceState::UnorderedAccess:
@@ -168,6 +168,9 @@ public:
     /// @brief Get descriptor set for shader binding
     RHIDescriptorSetHandle getDescriptorSet() const { return m_descriptorSet; }
 
+    /// @brief Id of the descriptor set, for command recording (invalid if not created)
+    RHIDescriptorSetId getDescriptorSetId() const { return m_descriptorSet ? m_descriptorSet->id : RHIDescriptorSetId{}; }
+
     /// @brief Check if descriptor set is created
     bool hasDescriptorSet() const { return m_descriptorSet != nullptr; }
 
@@ -83,18 +83,18 @@ std::shared_ptr<Mesh> Mesh::create(RHI* rhi, const MeshData& data, const char* d
     return mesh;
 }
 
-void Mesh::bind(RHI* rhi, RHICommandBufferHandle cmd) const
+void Mesh::bind(RHI* rhi, RHICommandBufferId cmd) const
 {
     if (!isValid())
     {
         return;
     }
 
-    rhi->cmdBindVertexBuffer(cmd, 0, m_vertexBuffer, 0);
-    rhi->cmdBindIndexBuffer(cmd, m_indexBuffer, 0, false);  // false = 32-bit indices
+    rhi->cmdBindVertexBuffer(cmd, 0, m_vertexBuffer->id, 0);
+    rhi->cmdBindIndexBuffer(cmd, m_indexBuffer->id, 0, false);  // false = 32-bit indices
 }
 
-void Mesh::draw(RHI* rhi, RHICommandBufferHandle cmd, uint32_t instanceCount) const
+void Mesh::draw(RHI* rhi, RHICommandBufferId cmd, uint32_t instanceCount) const
 {
     if (!isValid())
     {
@@ -104,7 +104,7 @@ void Mesh::draw(RHI* rhi, RHICommandBufferHandle cmd, uint32_t instanceCount) co
     rhi->cmdDrawIndexed(cmd, m_indexCount, instanceCount, 0, 0, 0);
 }
 
-void Mesh::bindAndDraw(RHI* rhi, RHICommandBufferHandle cmd, uint32_t instanceCount) const
+void Mesh::bindAndDraw(RHI* rhi, RHICommandBufferId cmd, uint32_t instanceCount) const
 {
     bind(rhi, cmd);
     draw(rhi, cmd, instanceCount);
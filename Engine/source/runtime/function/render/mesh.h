@@ -80,16 +80,16 @@ public:
     /// @brief Bind vertex and index buffers to command buffer
     /// @param rhi RHI instance
     /// @param cmd Command buffer to bind to
-    void bind(RHI* rhi, RHICommandBufferHandle cmd) const;
+    void bind(RHI* rhi, RHICommandBufferId cmd) const;
 
     /// @brief Draw the mesh
     /// @param rhi RHI instance
     /// @param cmd Command buffer
     /// @param instanceCount Number of instances to draw
-    void draw(RHI* rhi, RHICommandBufferHandle cmd, uint32_t instanceCount = 1) const;
+    void draw(RHI* rhi, RHICommandBufferId cmd, uint32_t instanceCount = 1) const;
 
     /// @brief Bind and draw in one call
-    void bindAndDraw(RHI* rhi, RHICommandBufferHandle cmd, uint32_t instanceCount = 1) const;
+    void bindAndDraw(RHI* rhi, RHICommandBufferId cmd, uint32_t instanceCount = 1) const;
 
     // Accessors
     RHIBufferHandle getVertexBuffer() const { return m_vertexBuffer; }
@@ -104,7 +104,7 @@ bool Model::isValid() const
     return false;
 }
 
-void Model::drawAll(RHI* rhi, RHICommandBufferHandle cmd) const
+void Model::drawAll(RHI* rhi, RHICommandBufferId cmd) const
 {
     for (const auto& submesh : m_subMeshes)
     {
@@ -147,7 +147,7 @@ public:
     /// @brief Draw all submeshes (simple rendering, no hierarchy)
     /// @param rhi RHI instance
     /// @param cmd Command buffer
-    void drawAll(RHI* rhi, RHICommandBufferHandle cmd) const;
+    void drawAll(RHI* rhi, RHICommandBufferId cmd) const;
 
     /// @brief Get total vertex count across all submeshes
     uint32_t getTotalVertexCount() const;
@@ -1,222 +1,180 @@
 #include "runtime/function/render/render_packet.h"
 #include "runtime/core/log/log_system.h"
 
+#include <algorithm>
 #include <chrono>
-#include <limits>
-#include <thread>
 
 namespace vesper {
 
 RenderPacketBuffer::RenderPacketBuffer(uint32_t bufferCount, RenderPacketBufferMode mode)
-    : m_bufferCount(std::max(bufferCount, kDoubleBuffer))
+    : m_packets(std::max(bufferCount, kTripleBuffer))
+    , m_bufferCount(std::max(bufferCount, kDoubleBuffer))
     , m_mode(mode)
 {
-    m_buffers.reserve(m_bufferCount);
-    for (uint32_t i = 0; i < m_bufferCount; ++i)
-    {
-        m_buffers.push_back(std::make_unique<BufferSlot>());
-    }
+    resetExchange();
 
     LOG_INFO("RenderPacketBuffer: Created with {} buffers, mode={}",
              m_bufferCount,
              mode == RenderPacketBufferMode::LatestOnly ? "LatestOnly" : "Sequential");
 }
 
+// =============================================================================
+// Producer
+// =============================================================================
+
 RenderPacket* RenderPacketBuffer::acquireForWrite()
 {
-    uint32_t index = findWriteBuffer();
-
-    if (index == UINT32_MAX)
+    if (m_mode == RenderPacketBufferMode::Sequential)
     {
-        if (m_mode == RenderPacketBufferMode::Sequential)
-        {
-            // Block until a buffer becomes available using condition variable
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_writeCV.wait(lock, [this, &index]() {
-                index = findWriteBuffer();
-                return index != UINT32_MAX;
-            });
-        }
-        else
+        const uint64_t sequence = m_writeSequence.load(std::memory_order_relaxed);
+        const auto ringFull = [&]() {
+            return sequence - m_readSequence.load(std::memory_order_acquire) >= m_bufferCount;
+        };
+
+        while (ringFull())
         {
-            // LatestOnly: shouldn't happen with proper buffer count
-            // Only log once to avoid flooding the console
-            static bool warnedOnce = false;
-            if (!warnedOnce)
+            if (m_shutdown.load(std::memory_order_acquire))
             {
-                LOG_WARN("RenderPacketBuffer: No write buffer available (this warning will only appear once)");
-                warnedOnce = true;
+                return nullptr;
             }
-            return nullptr;
+
+            // Re-check after announcing ourselves: releaseRead() either sees the waiter or we see its slot
+            const EventCount::Key key = m_writerWake.prepareWait();
+            if (!ringFull() || m_shutdown.load(std::memory_order_acquire))
+            {
+                m_writerWake.cancelWait();
+                continue;
+            }
+            m_writerWake.wait(key);
         }
-    }
 
-    // Mark as writing
-    BufferState expected = BufferState::Empty;
-    if (!m_buffers[index]->state.compare_exchange_strong(expected, BufferState::Writing,
-        std::memory_order_acq_rel))
-    {
-        // Race condition, try again
-        return acquireForWrite();
+        m_writeSlot = static_cast<uint32_t>(sequence % m_bufferCount);
     }
 
-    m_writeIndex.store(index, std::memory_order_release);
-
-    // Clear the packet for reuse
-    m_buffers[index]->packet.clear();
-
-    return &m_buffers[index]->packet;
+    // The back slot (LatestOnly) or the ring slot is writer-owned until releaseWrite()
+    RenderPacket& packet = m_packets[m_writeSlot];
+    packet.clearForRefill();
+    return &packet;
 }
 
 void RenderPacketBuffer::releaseWrite()
 {
-    uint32_t index = m_writeIndex.load(std::memory_order_acquire);
-
-    auto& slot = *m_buffers[index];
+    RenderPacket& packet = m_packets[m_writeSlot];
 
     // Set frame info
-    slot.sequenceNumber = m_writeSequence.fetch_add(1, std::memory_order_relaxed);
-    slot.packet.frameIndex = slot.sequenceNumber;
-    slot.packet.timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+    const uint64_t sequence = m_writeSequence.load(std::memory_order_relaxed);
+    packet.frameIndex = sequence;
+    packet.timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::steady_clock::now().time_since_epoch()
     ).count();
 
-    // Publish the packet
-    slot.state.store(BufferState::Ready, std::memory_order_release);
-
     m_packetsWritten.fetch_add(1, std::memory_order_relaxed);
 
-    // Notify waiting readers that a packet is ready
-    m_readCV.notify_one();
+    if (m_mode == RenderPacketBufferMode::Sequential)
+    {
+        // Publish the slot
+        m_writeSequence.store(sequence + 1, std::memory_order_release);
+        return;
+    }
+
+    // The previous packet may still be skipped: carry its deltas over (harmless if it is read
+    // meanwhile; once read it is never fresh again, since only the writer sets the bit)
+    const uint32_t middle = m_middle.load(std::memory_order_acquire);
+    if (middle & kFreshBit)
+    {
+        packet.carryOver(m_packets[middle & kSlotMask], m_carrySpare);
+    }
+
+    // Publish the back slot as the fresh middle and take the old middle as the next back slot
+    m_writeSequence.store(sequence + 1, std::memory_order_relaxed);
+    const uint32_t previous = m_middle.exchange(m_writeSlot | kFreshBit, std::memory_order_acq_rel);
+    m_writeSlot = previous & kSlotMask;
+    if (previous & kFreshBit)
+    {
+        m_packetsSkipped.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 bool RenderPacketBuffer::canWrite() const
 {
-    return const_cast<RenderPacketBuffer*>(this)->findWriteBuffer() != UINT32_MAX;
+    if (m_mode == RenderPacketBufferMode::LatestOnly)
+    {
+        return true;
+    }
+    return m_writeSequence.load(std::memory_order_relaxed) - m_readSequence.load(std::memory_order_acquire) < m_bufferCount;
 }
 
+// =============================================================================
+// Consumer
+// =============================================================================
+
 RenderPacket* RenderPacketBuffer::acquireForRead()
 {
-    uint32_t index = findReadBuffer();
-
-    if (index == UINT32_MAX)
+    if (m_mode == RenderPacketBufferMode::Sequential)
     {
-        // No packet available
-        return nullptr;
+        const uint64_t sequence = m_readSequence.load(std::memory_order_relaxed);
+        if (sequence == m_writeSequence.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        m_readSlot = static_cast<uint32_t>(sequence % m_bufferCount);
+        return &m_packets[m_readSlot];
     }
 
-    // Mark as reading
-    BufferState expected = BufferState::Ready;
-    if (!m_buffers[index]->state.compare_exchange_strong(expected, BufferState::Reading,
-        std::memory_order_acq_rel))
+    // Only the writer sets the fresh bit, so the exchange below always takes a fresh packet
+    if (!(m_middle.load(std::memory_order_acquire) & kFreshBit))
     {
-        // Race condition or state changed, try again
-        return acquireForRead();
+        return nullptr;
     }
-
-    m_readIndex.store(index, std::memory_order_release);
-
-    return &m_buffers[index]->packet;
+    const uint32_t previous = m_middle.exchange(m_readSlot, std::memory_order_acq_rel);
+    m_readSlot = previous & kSlotMask;
+    return &m_packets[m_readSlot];
 }
 
 void RenderPacketBuffer::releaseRead()
 {
-    uint32_t index = m_readIndex.load(std::memory_order_acquire);
-
-    // Update read sequence
-    m_readSequence.store(m_buffers[index]->sequenceNumber + 1, std::memory_order_release);
-
-    // Mark as empty (available for writing again)
-    m_buffers[index]->state.store(BufferState::Empty, std::memory_order_release);
-
     m_packetsRead.fetch_add(1, std::memory_order_relaxed);
 
-    // Notify waiting writers that a buffer is available
-    m_writeCV.notify_one();
+    // LatestOnly keeps the front slot until the next acquire swaps it out
+    if (m_mode == RenderPacketBufferMode::Sequential)
+    {
+        m_readSequence.store(m_readSequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        m_writerWake.notifyOne();
+    }
 }
 
 bool RenderPacketBuffer::canRead() const
 {
-    return const_cast<RenderPacketBuffer*>(this)->findReadBuffer() != UINT32_MAX;
+    if (m_mode == RenderPacketBufferMode::Sequential)
+    {
+        return m_readSequence.load(std::memory_order_relaxed) != m_writeSequence.load(std::memory_order_acquire);
+    }
+    return (m_middle.load(std::memory_order_acquire) & kFreshBit) != 0;
 }
 
+// =============================================================================
+// Configuration
+// =============================================================================
+
 void RenderPacketBuffer::setMode(RenderPacketBufferMode mode)
 {
     m_mode = mode;
+    resetExchange();
 }
 
-uint32_t RenderPacketBuffer::findWriteBuffer()
+void RenderPacketBuffer::shutdown()
 {
-    // Find an empty buffer
-    for (uint32_t i = 0; i < m_bufferCount; ++i)
-    {
-        if (m_buffers[i]->state.load(std::memory_order_acquire) == BufferState::Empty)
-        {
-            return i;
-        }
-    }
-    return UINT32_MAX;
+    m_shutdown.store(true, std::memory_order_release);
+    m_writerWake.notifyAll();
 }
 
-uint32_t RenderPacketBuffer::findReadBuffer()
+void RenderPacketBuffer::resetExchange()
 {
-    if (m_mode == RenderPacketBufferMode::LatestOnly)
-    {
-        // Find the ready buffer with highest sequence number
-        uint32_t bestIndex = UINT32_MAX;
-        uint64_t bestSequence = 0;
-
-        for (uint32_t i = 0; i < m_bufferCount; ++i)
-        {
-            if (m_buffers[i]->state.load(std::memory_order_acquire) == BufferState::Ready)
-            {
-                if (bestIndex == UINT32_MAX || m_buffers[i]->sequenceNumber > bestSequence)
-                {
-                    // Skip old packets - mark them as empty
-                    if (bestIndex != UINT32_MAX)
-                    {
-                        BufferState expected = BufferState::Ready;
-                        if (m_buffers[bestIndex]->state.compare_exchange_strong(
-                            expected, BufferState::Empty, std::memory_order_acq_rel))
-                        {
-                            m_packetsSkipped.fetch_add(1, std::memory_order_relaxed);
-                        }
-                    }
-
-                    bestIndex = i;
-                    bestSequence = m_buffers[i]->sequenceNumber;
-                }
-                else
-                {
-                    // This packet is older, skip it
-                    BufferState expected = BufferState::Ready;
-                    if (m_buffers[i]->state.compare_exchange_strong(
-                        expected, BufferState::Empty, std::memory_order_acq_rel))
-                    {
-                        m_packetsSkipped.fetch_add(1, std::memory_order_relaxed);
-                    }
-                }
-            }
-        }
-
-        return bestIndex;
-    }
-    else // Sequential mode
-    {
-        // Find the ready buffer with the expected sequence number
-        uint64_t expectedSeq = m_readSequence.load(std::memory_order_acquire);
-
-        for (uint32_t i = 0; i < m_bufferCount; ++i)
-        {
-            if (m_buffers[i]->state.load(std::memory_order_acquire) == BufferState::Ready &&
-                m_buffers[i]->sequenceNumber == expectedSeq)
-            {
-                return i;
-            }
-        }
-
-        return UINT32_MAX;
-    }
+    // LatestOnly: back 0, front 1, middle 2 (not fresh)
+    m_writeSlot = 0;
+    m_readSlot = 1;
+    m_middle.store(2, std::memory_order_relaxed);
+    m_readSequence.store(m_writeSequence.load(std::memory_order_relaxed), std::memory_order_release);
 }
 
 } // namespace vesper
@@ -1,14 +1,11 @@
 #pragma once
 
 #include "runtime/core/base/macro.h"
+#include "runtime/core/threading/event_count.h"
 #include "runtime/function/render/render_swap_context.h"
 
 #include <atomic>
-#include <condition_variable>
 #include <cstdint>
-#include <memory>
-#include <mutex>
-#include <optional>
 #include <vector>
 
 namespace vesper {
@@ -20,6 +17,14 @@ enum class RenderPacketBufferMode : uint8_t
     Sequential,     // Process all packets in order (for recording/validation)
 };
 
+/// @brief How a RenderPacket lists its visible objects
+enum class RenderPacketFormat : uint8_t
+{
+    Full,           // visibleObjects: a full RenderObjectDesc per visible object (self-contained)
+    Instanced,      // visibleInstances: object ids into the consumer's persistent instance table,
+                    // which it maintains from the object deltas of every packet (see RenderScene)
+};
+
 /// @brief A complete render packet containing all data for one frame
 struct RenderPacket
 {
@@ -30,16 +35,25 @@ struct RenderPacket
     // Camera data
     CameraParams camera{};
 
-    // Visible objects for this frame
+    // Visible objects for this frame, as descriptors or instance ids depending on the format
+    RenderPacketFormat format{RenderPacketFormat::Full};
     std::vector<RenderObjectDesc> visibleObjects;
+    std::vector<uint32_t> visibleInstances;
+
+    // Where visibleObjects came from, so a refill of this (recycled) packet can leave unchanged
+    // entries in place (see RenderBridgeSystem::fillVisibleObjects); reset by clear()
+    const void* visibleSource{nullptr};
+    uint64_t visibleEpoch{0};
 
-    // Object updates
+    // Object deltas against the previous packet: adds and updates are upserts keyed by object_id,
+    // applied before deletes (see carryOver())
     std::vector<RenderObjectDesc> objectsToAdd;
     std::vector<RenderObjectDesc> objectsToUpdate;
     std::vector<uint32_t> objectsToDelete;
 
-    // Animation data
+    // Animation data: per skinned object, a range of jointMatrices (3x4 affine, kAffineMatrixFloats each)
     std::vector<SkinningMatrices> skinningData;
+    std::vector<float> jointMatrices;
 
     // Particle requests
     std::vector<ParticleRequest> particleRequests;
@@ -53,36 +67,103 @@ struct RenderPacket
     void clear()
     {
         visibleObjects.clear();
+        visibleInstances.clear();
+        visibleSource = nullptr;
+        visibleEpoch = 0;
+        clearForRefill();
+    }
+
+    /// @brief Clear all data except visibleObjects, which the next fill overwrites in place
+    void clearForRefill()
+    {
         objectsToAdd.clear();
         objectsToUpdate.clear();
         objectsToDelete.clear();
         skinningData.clear();
+        jointMatrices.clear();
         particleRequests.clear();
         levelResourceChanged = false;
         meshesToLoad.clear();
         texturesToLoad.clear();
     }
 
-    /// @brief Reserve capacity for expected data sizes
-    void reserve(size_t objectCount, size_t skinCount = 0, size_t particleCount = 0)
+    /// @brief Put what an unread packet must not lose if it gets skipped in front of this packet's
+    /// own: object deltas and resource requests (camera, visibility, skinning and particles are per-frame)
+    /// Each list is rebuilt in spare's (older entries, then this packet's) and swapped in, so nothing
+    /// is shifted; spare keeps the replaced storage for the next carry. Upserts are idempotent and a
+    /// deleted id never comes back, so a consumer applying upserts before deletes ends in the same
+    /// state whether it reads both packets or only this one.
+    void carryOver(const RenderPacket& unread, RenderPacket& spare)
+    {
+        const auto prepend = [](auto& own, const auto& older, auto& scratch) {
+            scratch.assign(older.begin(), older.end());
+            scratch.insert(scratch.end(), own.begin(), own.end());
+            own.swap(scratch);
+        };
+        prepend(objectsToAdd, unread.objectsToAdd, spare.objectsToAdd);
+        prepend(objectsToUpdate, unread.objectsToUpdate, spare.objectsToUpdate);
+        prepend(objectsToDelete, unread.objectsToDelete, spare.objectsToDelete);
+        levelResourceChanged = levelResourceChanged || unread.levelResourceChanged;
+        prepend(meshesToLoad, unread.meshesToLoad, spare.meshesToLoad);
+        prepend(texturesToLoad, unread.texturesToLoad, spare.texturesToLoad);
+    }
+
+    /// @brief Add a skinned object's joint matrices to the arena
+    /// @return The matrixCount matrices to write (valid until the next appendSkinning)
+    float* appendSkinning(uint32_t objectId, uint32_t matrixCount)
+    {
+        const uint32_t firstMatrix = static_cast<uint32_t>(jointMatrices.size() / kAffineMatrixFloats);
+        skinningData.push_back({objectId, firstMatrix, matrixCount});
+        jointMatrices.resize(jointMatrices.size() + size_t{matrixCount} * kAffineMatrixFloats);
+        return jointMatrices.data() + size_t{firstMatrix} * kAffineMatrixFloats;
+    }
+
+    /// @brief Joint matrices of one skinning entry
+    const float* jointMatricesOf(const SkinningMatrices& skinning) const
+    {
+        return jointMatrices.data() + size_t{skinning.first_matrix} * kAffineMatrixFloats;
+    }
+
+    /// @brief Reserve capacity for expected data sizes (clear() keeps it, so a reused packet stops allocating)
+    /// @param jointCount Expected joint matrices over all skinned objects
+    void reserve(size_t objectCount, size_t skinCount = 0, size_t particleCount = 0, size_t jointCount = 0)
     {
         visibleObjects.reserve(objectCount);
+        visibleInstances.reserve(objectCount);
         objectsToAdd.reserve(objectCount / 10);     // Expect ~10% new per frame max
         objectsToUpdate.reserve(objectCount / 2);   // Expect ~50% updates per frame
         objectsToDelete.reserve(objectCount / 20);  // Expect ~5% deletes per frame
         skinningData.reserve(skinCount);
+        jointMatrices.reserve(jointCount * kAffineMatrixFloats);
         particleRequests.reserve(particleCount);
     }
 };
 
-/// @brief Thread-safe double/triple buffer for RenderPacket exchange between logic and render threads
-/// Logic thread writes, render thread reads
+/// @brief Lock-free RenderPacket exchange between the logic thread (single producer) and the
+/// render thread (single consumer)
+///
+/// LatestOnly is a triple buffer: the writer owns a back slot, the reader a front slot, and the
+/// third (middle) slot changes hands through one atomic word holding its index and a fresh bit.
+/// Publishing exchanges back and middle; acquiring exchanges front and middle if the middle is
+/// fresh. Neither side ever waits, and publishing over an unread packet skips it; so that the
+/// skipped packet's object deltas still reach the reader, releaseWrite() first puts them in front
+/// of the new packet's (RenderPacket::carryOver) while the previous one is unread. The writer only
+/// reads that slot, which nobody writes until the writer itself takes it back.
+///
+/// Sequential is a wait-free SPSC ring of bufferCount slots indexed by two monotonic sequence
+/// counters. Only a writer facing a full ring blocks, on an EventCount that releaseRead()
+/// signals with a syscall only when the writer is actually asleep.
+///
+/// A slot is recycled without clearing visibleObjects/visibleInstances: the producer overwrites
+/// them (see RenderBridgeSystem), everything else is cleared by acquireForWrite().
 class RenderPacketBuffer
 {
 public:
     static constexpr uint32_t kDoubleBuffer = 2;
     static constexpr uint32_t kTripleBuffer = 3;
 
+    /// @param bufferCount Ring size in Sequential mode (LatestOnly always uses three slots)
+    /// @param mode Exchange mode
     explicit RenderPacketBuffer(uint32_t bufferCount = kTripleBuffer,
                                  RenderPacketBufferMode mode = RenderPacketBufferMode::LatestOnly);
     ~RenderPacketBuffer() = default;
@@ -94,21 +175,23 @@ public:
     // ========================================================================
 
     /// @brief Acquire a packet for writing (logic thread)
-    /// @return Pointer to packet for writing, or nullptr if no buffer available
+    /// Never fails in LatestOnly; blocks while the ring is full in Sequential.
+    /// @return Pointer to packet for writing, or nullptr after shutdown() with a full ring
     RenderPacket* acquireForWrite();
 
     /// @brief Release the packet after writing is complete (logic thread)
     /// This publishes the packet for the render thread to consume
     void releaseWrite();
 
-    /// @brief Check if a write buffer is available
+    /// @brief Check if acquireForWrite() would return without blocking
     [[nodiscard]] bool canWrite() const;
 
     // ========================================================================
     // Render Thread Interface (Consumer)
     // ========================================================================
 
-    /// @brief Acquire the latest packet for reading (render thread)
+    /// @brief Acquire the next packet for reading (render thread)
+    /// LatestOnly returns the newest unread packet, Sequential the oldest.
     /// @return Pointer to packet for reading, or nullptr if none available
     RenderPacket* acquireForRead();
 
@@ -123,6 +206,8 @@ public:
     // ========================================================================
 
     /// @brief Set buffer mode
+    /// Only while neither side holds a packet: resets the exchange, dropping unread packets (and
+    /// their deltas: a consumer mirroring the scene must be resynchronized).
     void setMode(RenderPacketBufferMode mode);
 
     /// @brief Get current mode
@@ -131,6 +216,9 @@ public:
     /// @brief Get buffer count
     [[nodiscard]] uint32_t bufferCount() const { return m_bufferCount; }
 
+    /// @brief Wake a writer blocked on a full ring; later acquireForWrite() calls on a full ring fail
+    void shutdown();
+
     // ========================================================================
     // Statistics
     // ========================================================================
@@ -154,56 +242,43 @@ public:
     }
 
 private:
-    // Buffer states
-    enum class BufferState : uint32_t
-    {
-        Empty,          // Available for writing
-        Writing,        // Currently being written by logic thread
-        Ready,          // Written and ready for reading
-        Reading,        // Currently being read by render thread
-    };
-
-    struct BufferSlot
-    {
-        RenderPacket packet;
-        std::atomic<BufferState> state{BufferState::Empty};
-        uint64_t sequenceNumber{0};
+    static constexpr size_t kCacheLineSize = 64;
 
-        BufferSlot() = default;
-        ~BufferSlot() = default;
+    // LatestOnly exchange word: middle slot index | kFreshBit
+    static constexpr uint32_t kSlotMask = 0x3;
+    static constexpr uint32_t kFreshBit = 0x4;
 
-        // Non-copyable, non-movable due to atomic
-        BufferSlot(const BufferSlot&) = delete;
-        BufferSlot& operator=(const BufferSlot&) = delete;
-        BufferSlot(BufferSlot&&) = delete;
-        BufferSlot& operator=(BufferSlot&&) = delete;
-    };
+    /// @brief Slot count: the Sequential ring or the LatestOnly triple buffer, whichever is larger
+    uint32_t slotCount() const { return static_cast<uint32_t>(m_packets.size()); }
 
-    uint32_t findWriteBuffer();
-    uint32_t findReadBuffer();
+    /// @brief Put both exchanges back in their initial (empty) state
+    void resetExchange();
 
 private:
-    std::vector<std::unique_ptr<BufferSlot>> m_buffers;
+    std::vector<RenderPacket> m_packets;
     uint32_t m_bufferCount;
     RenderPacketBufferMode m_mode;
 
-    // Current write/read indices
-    std::atomic<uint32_t> m_writeIndex{0};
-    std::atomic<uint32_t> m_readIndex{0};
-
-    // Sequence numbers for ordering
+    // Writer-owned: slot being written and next sequence number to publish
+    alignas(kCacheLineSize) uint32_t m_writeSlot{0};
     std::atomic<uint64_t> m_writeSequence{0};
+    RenderPacket m_carrySpare;  // Scratch lists of RenderPacket::carryOver (LatestOnly)
+
+    // Reader-owned: slot being read and next sequence number to consume (Sequential)
+    alignas(kCacheLineSize) uint32_t m_readSlot{1};
     std::atomic<uint64_t> m_readSequence{0};
 
+    // LatestOnly middle slot
+    alignas(kCacheLineSize) std::atomic<uint32_t> m_middle{2};
+
+    // Sequential: a writer sleeps here while the ring is full
+    EventCount m_writerWake;
+    std::atomic<bool> m_shutdown{false};
+
     // Statistics
-    std::atomic<uint64_t> m_packetsWritten{0};
+    alignas(kCacheLineSize) std::atomic<uint64_t> m_packetsWritten{0};
     std::atomic<uint64_t> m_packetsRead{0};
     std::atomic<uint64_t> m_packetsSkipped{0};
-
-    // Synchronization for blocking operations
-    mutable std::mutex m_mutex;
-    std::condition_variable m_writeCV;   // Notified when a buffer becomes empty (for writers)
-    std::condition_variable m_readCV;    // Notified when a buffer becomes ready (for readers)
 };
 
 } // namespace vesper
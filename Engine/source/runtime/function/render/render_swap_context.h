@@ -5,17 +5,35 @@
 
 namespace vesper {
 
-// Backend-agnostic render object descriptor
+// Largest mesh/material id a RenderObjectDesc can carry
+constexpr uint32_t kMaxRenderResourceId = UINT16_MAX;
+
+// Floats per 3x4 affine matrix (object transforms and joint matrices)
+constexpr uint32_t kAffineMatrixFloats = 12;
+
+// Backend-agnostic render object descriptor (72 bytes)
 struct RenderObjectDesc {
     uint32_t    object_id       = 0;
-    uint32_t    mesh_id         = 0;
-    uint32_t    material_id     = 0;
-    // Transform matrix (column-major)
-    float       transform[16]   = {1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1};
+    uint16_t    mesh_id         = 0;
+    uint16_t    material_id     = 0;
+    // World transform as a 3x4 affine matrix: rows of the column-vector form, i.e.
+    // world.x = dot(row 0, (p, 1)) (the constant (0, 0, 0, 1) row is not stored)
+    float       transform[kAffineMatrixFloats] = {1,0,0,0, 0,1,0,0, 0,0,1,0};
     // Bounding sphere (center + radius)
     float       bounding_sphere[4] = {0, 0, 0, 1};
+
+    // Set the transform from a row-major 4x4 row-vector matrix (p' = p * M, e.g. Matrix4x4::ptr())
+    void setTransform(const float* matrix) {
+        for (uint32_t row = 0; row < 3; ++row) {
+            for (uint32_t col = 0; col < 4; ++col) {
+                transform[row * 4 + col] = matrix[col * 4 + row];
+            }
+        }
+    }
 };
 
+static_assert(sizeof(RenderObjectDesc) == 72, "RenderObjectDesc is streamed every frame: keep it compact");
+
 // Camera parameters for rendering
 struct CameraParams {
     float view_matrix[16];
@@ -26,10 +44,12 @@ struct CameraParams {
     float far_plane;
 };
 
-// Skinning matrices for skeletal animation
+// Skinning matrices of one skinned object: a range of 3x4 affine joint matrices in a flat
+// arena (RenderPacket::jointMatrices / RenderSwapContext::joint_matrices)
 struct SkinningMatrices {
-    uint32_t            object_id;
-    std::vector<float>  joint_matrices;  // 4x4 matrices, column-major
+    uint32_t    object_id;
+    uint32_t    first_matrix;   // Index of the first matrix (arena offset / kAffineMatrixFloats)
+    uint32_t    matrix_count;
 };
 
 // Particle emission request
@@ -57,6 +77,7 @@ struct RenderSwapContext {
 
     // Animation
     std::vector<SkinningMatrices>   skinning_updates;
+    std::vector<float>              joint_matrices;
 
     // Particles
     std::vector<ParticleRequest>    particle_requests;
@@ -72,6 +93,7 @@ struct RenderSwapContext {
         objects_to_update.clear();
         objects_to_delete.clear();
         skinning_updates.clear();
+        joint_matrices.clear();
         particle_requests.clear();
     }
 };
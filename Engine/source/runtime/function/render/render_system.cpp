@@ -12,6 +12,7 @@
 #include "runtime/platform/input/input_system.h"
 #include "runtime/core/log/log_system.h"
 #include "runtime/core/math/matrix4x4.h"
+#include "runtime/core/threading/worker_pool.h"
 
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
@@ -19,6 +20,8 @@
 #include <fstream>
 #include <filesystem>
 #include <cmath>
+#include <cstring>
+#include <algorithm>
 
 namespace vesper
 {
@@ -38,7 +41,16 @@ bool RenderSystem::initialize(const RenderSystemConfig& config)
     m_workerPool     = config.workerPool;
     m_framesInFlight = config.framesInFlight;
 
-    if (!m_windowSystem)
+    // One scene command buffer per thread that can record: the workers plus the calling thread
+    m_sceneDrawsPerTask = std::max(config.sceneDrawsPerTask, 1u);
+    m_maxRecordingTasks = config.maxRecordingTasks;
+    if (m_maxRecordingTasks == 0)
+    {
+        m_maxRecordingTasks = m_workerPool ? m_workerPool->workerCount() + 1 : 1;
+    }
+    m_gpuCulling = config.gpuCulling;
+
+    if (!m_windowSystem && config.backend != RHIBackendType::Null)
     {
         LOG_ERROR("RenderSystem: WindowSystem is required for initialization");
         return false;
@@ -59,10 +71,13 @@ bool RenderSystem::initialize(const RenderSystemConfig& config)
         return false;
     }
 
-    // Create swapchain
-    GLFWwindow* window = m_windowSystem->getNativeWindow();
-    uint32_t width  = m_windowSystem->getWidth();
-    uint32_t height = m_windowSystem->getHeight();
+    // Create swapchain (offscreen when headless)
+    m_headlessWidth  = config.headlessWidth;
+    m_headlessHeight = config.headlessHeight;
+
+    GLFWwindow* window = m_windowSystem ? m_windowSystem->getNativeWindow() : nullptr;
+    uint32_t width  = m_windowSystem ? m_windowSystem->getWidth() : m_headlessWidth;
+    uint32_t height = m_windowSystem ? m_windowSystem->getHeight() : m_headlessHeight;
 
     if (!createSwapChain(window, width, height, config.presentMode))
     {
@@ -85,11 +100,14 @@ bool RenderSystem::initialize(const RenderSystemConfig& config)
     }
 
     // Register window resize callback
-    m_windowSystem->registerFramebufferSizeCallback(
-        [this](int width, int height) {
-            onWindowResize(static_cast<uint32_t>(width), static_cast<uint32_t>(height));
-        }
-    );
+    if (m_windowSystem)
+    {
+        m_windowSystem->registerFramebufferSizeCallback(
+            [this](int width, int height) {
+                onWindowResize(static_cast<uint32_t>(width), static_cast<uint32_t>(height));
+            }
+        );
+    }
 
     // Create minimal validation resources (triangle)
     if (!createMinimalResources())
@@ -168,8 +186,34 @@ void RenderSystem::shutdown()
     // Destroy per-frame resources
     for (auto& frame : m_frameResources)
     {
+        for (size_t i = 0; i < frame.scenePools.size(); ++i)
+        {
+            m_rhi->freeCommandBuffer(frame.scenePools[i], frame.sceneCommandBuffers[i]);
+            m_rhi->destroyCommandPool(frame.scenePools[i]);
+        }
+        if (frame.instanceSet)
+        {
+            m_rhi->destroyDescriptorSet(frame.instanceSet);
+        }
+        if (frame.instanceBuffer)
+        {
+            m_rhi->destroyBuffer(frame.instanceBuffer);
+        }
+        if (frame.instanceSlotBuffer)
+        {
+            m_rhi->destroyBuffer(frame.instanceSlotBuffer);
+        }
+        if (frame.indirectBuffer)
+        {
+            m_rhi->destroyBuffer(frame.indirectBuffer);
+        }
+        if (frame.cullCandidateBuffer)
+        {
+            m_rhi->destroyBuffer(frame.cullCandidateBuffer);
+        }
         if (frame.commandPool)
         {
+            m_rhi->freeCommandBuffer(frame.commandPool, frame.finishCommandBuffer);
             m_rhi->freeCommandBuffer(frame.commandPool, frame.commandBuffer);
             m_rhi->destroyCommandPool(frame.commandPool);
         }
@@ -243,13 +287,27 @@ void RenderSystem::tick(float deltaTime)
 
     // Reset and begin command buffer
     m_rhi->resetCommandPool(frame.commandPool);
-    m_rhi->beginCommandBuffer(frame.commandBuffer);
+    m_rhi->beginCommandBuffer(frame.commandBuffer->id);
+
+    // Batch the scene and fill this frame's instance and indirect buffers
+    const bool scenePrepared = prepareSceneInstances(frame);
 
-    // Record rendering commands
-    recordCommands(frame.commandBuffer, imageIndex);
+    // Record rendering commands (the main pass is left suspended when scene draws follow).
+    // Without prepared buffers the scene tasks would record from null instance/indirect buffers.
+    m_sceneTaskCount = scenePrepared ? computeSceneTaskCount() : 0;
+    recordCommands(frame.commandBuffer->id, imageIndex);
 
     // End command buffer
-    m_rhi->endCommandBuffer(frame.commandBuffer);
+    m_rhi->endCommandBuffer(frame.commandBuffer->id);
+
+    frame.submitList.clear();
+    frame.submitList.push_back(frame.commandBuffer);
+
+    // Record scene draws in parallel, then close the main pass
+    if (m_sceneTaskCount > 0)
+    {
+        recordSceneDraws(frame, imageIndex);
+    }
 
     // Submit and present
     endFrame(imageIndex);
@@ -258,8 +316,40 @@ void RenderSystem::tick(float deltaTime)
     m_currentFrame = (m_currentFrame + 1) % m_framesInFlight;
 }
 
+void RenderSystem::applyRenderPacket(const RenderPacket& packet)
+{
+    m_renderScene.applyPacket(packet);
+}
+
+bool RenderSystem::registerSceneMesh(uint16_t meshId, std::shared_ptr<Mesh> mesh)
+{
+    if (!mesh || !mesh->isValid() || !m_cubeMesh || mesh->getVertexStride() != m_cubeMesh->getVertexStride())
+    {
+        LOG_ERROR("RenderSystem: Scene mesh {} is invalid or not in the instanced vertex layout", meshId);
+        return false;
+    }
+    if (meshId < m_sceneMeshes.size() && m_sceneMeshes[meshId])
+    {
+        LOG_ERROR("RenderSystem: Scene mesh {} is already registered", meshId);
+        return false;
+    }
+
+    if (meshId >= m_sceneMeshes.size())
+    {
+        m_sceneMeshes.resize(static_cast<size_t>(meshId) + 1);
+    }
+    m_sceneMeshes[meshId] = std::move(mesh);
+    return true;
+}
+
 void RenderSystem::onWindowResize(uint32_t width, uint32_t height)
 {
+    if (!m_windowSystem)
+    {
+        m_headlessWidth  = width;
+        m_headlessHeight = height;
+    }
+
     if (width == 0 || height == 0)
     {
         m_minimized = true;
@@ -276,7 +366,7 @@ void RenderSystem::onWindowResize(uint32_t width, uint32_t height)
 
 bool RenderSystem::initializeRHI(const RenderSystemConfig& config)
 {
-    m_rhi = createRHI(RHIBackendType::Vulkan);
+    m_rhi = createRHI(config.backend);
     if (!m_rhi)
     {
         LOG_ERROR("RenderSystem: Failed to create RHI backend");
@@ -352,6 +442,33 @@ bool RenderSystem::createFrameResources()
             return false;
         }
 
+        frame.finishCommandBuffer = m_rhi->allocateCommandBuffer(frame.commandPool);
+        if (!frame.finishCommandBuffer)
+        {
+            LOG_ERROR("RenderSystem: Failed to allocate finish command buffer for frame {}", i);
+            return false;
+        }
+
+        // Scene recording pools: a pool may only be used by one thread at a time, so each
+        // recording task gets its own pool and command buffer
+        for (uint32_t task = 0; task < m_maxRecordingTasks; ++task)
+        {
+            RHICommandPoolHandle scenePool = m_rhi->createCommandPool(poolDesc);
+            RHICommandBufferHandle sceneCmd = scenePool ? m_rhi->allocateCommandBuffer(scenePool) : nullptr;
+            if (!sceneCmd)
+            {
+                if (scenePool)
+                {
+                    m_rhi->destroyCommandPool(scenePool);
+                }
+                LOG_ERROR("RenderSystem: Failed to create scene command buffer {} for frame {}", task, i);
+                return false;
+            }
+            frame.scenePools.push_back(scenePool);
+            frame.sceneCommandBuffers.push_back(sceneCmd);
+        }
+        frame.submitList.reserve(m_maxRecordingTasks + 2);
+
         // Create fence (signaled initially so first wait succeeds)
         frame.inFlightFence = m_rhi->createFence(true);
         if (!frame.inFlightFence)
@@ -385,7 +502,7 @@ bool RenderSystem::createDepthResources()
     depthDesc.extent      = {m_swapChainWidth, m_swapChainHeight, 1};
     depthDesc.format      = RHIFormat::D32_FLOAT;
     depthDesc.dimension   = RHITextureDimension::Tex2D;
-    depthDesc.usage       = RHITextureUsage::DepthStencil;
+    depthDesc.usage       = RHITextureUsage::DepthStencil | RHITextureUsage::Sampled;  // Sampled: HiZ build
     depthDesc.memoryUsage = RHIMemoryUsage::GpuOnly;
     depthDesc.debugName   = "DepthBuffer";
 
@@ -396,11 +513,21 @@ bool RenderSystem::createDepthResources()
         return false;
     }
 
+    // The HiZ pyramid follows the depth buffer's size
+    if (m_instanceCuller.isInitialized() &&
+        !m_instanceCuller.resize(m_depthTexture, m_swapChainWidth, m_swapChainHeight))
+    {
+        LOG_WARN("RenderSystem: Failed to resize the HiZ pyramid (scene occlusion culling disabled)");
+    }
+
     return true;
 }
 
 void RenderSystem::destroySwapChainResources()
 {
+    // The next frame has no previous depth to build the HiZ pyramid from
+    m_instanceCuller.invalidateHistory();
+
     // Destroy depth texture
     if (m_depthTexture)
     {
@@ -415,8 +542,8 @@ void RenderSystem::recreateSwapChain()
     m_rhi->waitIdle();
 
     // Get new dimensions
-    uint32_t width  = m_windowSystem->getWidth();
-    uint32_t height = m_windowSystem->getHeight();
+    uint32_t width  = m_windowSystem ? m_windowSystem->getWidth() : m_headlessWidth;
+    uint32_t height = m_windowSystem ? m_windowSystem->getHeight() : m_headlessHeight;
 
     if (width == 0 || height == 0)
     {
@@ -490,11 +617,21 @@ bool RenderSystem::beginFrame(uint32_t& imageIndex)
     return true;
 }
 
-void RenderSystem::recordCommands(RHICommandBufferHandle cmd, uint32_t imageIndex)
+void RenderSystem::recordCommands(RHICommandBufferId cmd, uint32_t imageIndex)
 {
     // Get swapchain image for this frame
     RHITextureHandle swapChainImage = m_rhi->getSwapChainImage(m_swapChain, imageIndex);
 
+    // Update camera aspect ratio
+    float aspectRatio = static_cast<float>(m_swapChainWidth) / static_cast<float>(m_swapChainHeight);
+    if (m_mainCamera)
+    {
+        m_mainCamera->setAspectRatio(aspectRatio);
+    }
+
+    // Compute work cannot run inside the pass
+    recordSceneCulling(cmd);
+
     // Transition resources for rendering
     {
         std::vector<RHITextureBarrier> barriers;
@@ -502,7 +639,7 @@ void RenderSystem::recordCommands(RHICommandBufferHandle cmd, uint32_t imageInde
         // Transition swapchain image to render target
         // Use tracked currentState (Undefined on first frame, Present on subsequent frames)
         RHITextureBarrier colorBarrier{};
-        colorBarrier.texture         = swapChainImage;
+        colorBarrier.texture         = swapChainImage->id;
         colorBarrier.srcState        = swapChainImage->currentState;
         colorBarrier.dstState        = RHIResourceState::RenderTarget;
         colorBarrier.baseMipLevel    = 0;
@@ -512,10 +649,13 @@ void RenderSystem::recordCommands(RHICommandBufferHandle cmd, uint32_t imageInde
         barriers.push_back(colorBarrier);
 
         // Transition depth texture to DepthWrite
-        // We clear each frame so treat as Undefined -> DepthWrite
+        // We clear each frame so treat as Undefined -> DepthWrite, unless the HiZ build read it
+        // this frame: the writes wait for those reads
         RHITextureBarrier depthBarrier{};
-        depthBarrier.texture         = m_depthTexture;
-        depthBarrier.srcState        = RHIResourceState::Undefined;
+        depthBarrier.texture         = m_depthTexture->id;
+        depthBarrier.srcState        = m_depthTexture->currentState == RHIResourceState::ShaderResource
+                                     ? RHIResourceState::ShaderResource
+                                     : RHIResourceState::Undefined;
         depthBarrier.dstState        = RHIResourceState::DepthWrite;
         depthBarrier.baseMipLevel    = 0;
         depthBarrier.mipLevelCount   = 1;
@@ -527,49 +667,18 @@ void RenderSystem::recordCommands(RHICommandBufferHandle cmd, uint32_t imageInde
     }
 
     // Setup rendering info
-    RHIRenderingAttachmentInfo colorAttachment{};
-    colorAttachment.texture    = swapChainImage;
-    colorAttachment.loadOp     = RHILoadOp::Clear;
-    colorAttachment.storeOp    = RHIStoreOp::Store;
-    colorAttachment.clearValue = RHIClearValue::Color(0.1f, 0.1f, 0.15f, 1.0f);
-
+    RHIRenderingInfo renderingInfo{};
     RHIRenderingAttachmentInfo depthAttachment{};
-    depthAttachment.texture    = m_depthTexture;
-    depthAttachment.loadOp     = RHILoadOp::Clear;
-    depthAttachment.storeOp    = RHIStoreOp::DontCare;
-    depthAttachment.clearValue = RHIClearValue::DepthStencil(1.0f, 0);
+    fillFrameRenderingInfo(imageIndex, renderingInfo, depthAttachment);
 
-    RHIRenderingInfo renderingInfo{};
-    renderingInfo.renderArea.offset = {0, 0};
-    renderingInfo.renderArea.extent = {m_swapChainWidth, m_swapChainHeight};
-    renderingInfo.layerCount        = 1;
-    renderingInfo.colorAttachments.push_back(colorAttachment);
-    renderingInfo.depthAttachment   = &depthAttachment;
+    // Scene draws continue this pass from their own command buffers
+    renderingInfo.suspending = m_sceneTaskCount > 0;
 
     // Begin dynamic rendering
     m_rhi->cmdBeginRendering(cmd, renderingInfo);
 
     // Set viewport and scissor
-    RHIViewport viewport{};
-    viewport.x        = 0.0f;
-    viewport.y        = 0.0f;
-    viewport.width    = static_cast<float>(m_swapChainWidth);
-    viewport.height   = static_cast<float>(m_swapChainHeight);
-    viewport.minDepth = 0.0f;
-    viewport.maxDepth = 1.0f;
-    m_rhi->cmdSetViewport(cmd, viewport);
-
-    RHIRect2D scissor{};
-    scissor.offset = {0, 0};
-    scissor.extent = {m_swapChainWidth, m_swapChainHeight};
-    m_rhi->cmdSetScissor(cmd, scissor);
-
-    // Update camera aspect ratio
-    float aspectRatio = static_cast<float>(m_swapChainWidth) / static_cast<float>(m_swapChainHeight);
-    if (m_mainCamera)
-    {
-        m_mainCamera->setAspectRatio(aspectRatio);
-    }
+    recordViewportAndScissor(cmd);
 
     // Debug: Log rendering state once
     static bool loggedOnce = false;
@@ -587,7 +696,7 @@ void RenderSystem::recordCommands(RHICommandBufferHandle cmd, uint32_t imageInde
     // Draw loaded model (if available)
     if (m_modelPipeline && m_loadedModel && m_mainCamera)
     {
-        m_rhi->cmdBindPipeline(cmd, m_modelPipeline);
+        m_rhi->cmdBindPipeline(cmd, m_modelPipeline->id);
 
         // Build Model matrix: rotate model to stand upright (-90 degrees around X axis)
         constexpr float PI_OVER_2 = 1.5707963267948966f;
@@ -610,7 +719,7 @@ void RenderSystem::recordCommands(RHICommandBufferHandle cmd, uint32_t imageInde
         pushData.mvp = mvpMatrix;
         pushData.model = modelMatrix;
 
-        m_rhi->cmdPushConstants(cmd, m_modelPipeline, RHIShaderStage::Vertex,
+        m_rhi->cmdPushConstants(cmd, m_modelPipeline->id, RHIShaderStage::Vertex,
                                 0, sizeof(PushConstantData), &pushData);
 
         // Draw all submeshes with their respective materials
@@ -622,13 +731,14 @@ void RenderSystem::recordCommands(RHICommandBufferHandle cmd, uint32_t imageInde
                 // Bind material's descriptor set if available, otherwise use fallback
                 if (submesh.material && submesh.material->hasDescriptorSet())
                 {
-                    RHIDescriptorSetHandle descSet = submesh.material->getDescriptorSet();
-                    m_rhi->cmdBindDescriptorSets(cmd, m_modelPipeline, 0, std::span(&descSet, 1));
+                    RHIDescriptorSetId descSet = submesh.material->getDescriptorSetId();
+                    m_rhi->cmdBindDescriptorSets(cmd, m_modelPipeline->id, 0, std::span(&descSet, 1));
                 }
                 else if (m_modelDescriptorSet)
                 {
                     // Fallback to default descriptor set
-                    m_rhi->cmdBindDescriptorSets(cmd, m_modelPipeline, 0, std::span(&m_modelDescriptorSet, 1));
+                    RHIDescriptorSetId descSet = m_modelDescriptorSet->id;
+                    m_rhi->cmdBindDescriptorSets(cmd, m_modelPipeline->id, 0, std::span(&descSet, 1));
                 }
 
                 submesh.mesh->bindAndDraw(m_rhi.get(), cmd);
@@ -638,7 +748,7 @@ void RenderSystem::recordCommands(RHICommandBufferHandle cmd, uint32_t imageInde
     // Fallback: Draw rotating cube if no model loaded
     else if (m_pipeline && m_cubeMesh && m_mainCamera)
     {
-        m_rhi->cmdBindPipeline(cmd, m_pipeline);
+        m_rhi->cmdBindPipeline(cmd, m_pipeline->id);
 
         // Build Model matrix: rotate cube around Y axis
         Matrix4x4 modelMatrix = Matrix4x4::rotationY(m_rotationTime);
@@ -654,7 +764,7 @@ void RenderSystem::recordCommands(RHICommandBufferHandle cmd, uint32_t imageInde
         // No transpose needed!
 
         // Push MVP matrix to shader
-        m_rhi->cmdPushConstants(cmd, m_pipeline, RHIShaderStage::Vertex,
+        m_rhi->cmdPushConstants(cmd, m_pipeline->id, RHIShaderStage::Vertex,
                                 0, sizeof(Matrix4x4), &mvpMatrix);
 
         // Bind and draw the cube mesh
@@ -664,28 +774,434 @@ void RenderSystem::recordCommands(RHICommandBufferHandle cmd, uint32_t imageInde
     // End dynamic rendering
     m_rhi->cmdEndRendering(cmd);
 
-    // Transition swapchain image to present
+    // Transition swapchain image to present (recordSceneDraws() does it after the scene)
+    if (m_sceneTaskCount == 0)
+    {
+        recordPresentTransition(cmd, imageIndex);
+    }
+}
+
+void RenderSystem::fillFrameRenderingInfo(uint32_t imageIndex, RHIRenderingInfo& info,
+                                          RHIRenderingAttachmentInfo& depthAttachment) const
+{
+    RHITextureHandle swapChainImage = m_rhi->getSwapChainImage(m_swapChain, imageIndex);
+
+    RHIRenderingAttachmentInfo colorAttachment{};
+    colorAttachment.texture    = swapChainImage->id;
+    colorAttachment.loadOp     = RHILoadOp::Clear;
+    colorAttachment.storeOp    = RHIStoreOp::Store;
+    colorAttachment.clearValue = RHIClearValue::Color(0.1f, 0.1f, 0.15f, 1.0f);
+
+    depthAttachment = {};
+    depthAttachment.texture    = m_depthTexture->id;
+    depthAttachment.loadOp     = RHILoadOp::Clear;
+    depthAttachment.storeOp    = m_instanceCuller.isInitialized() ? RHIStoreOp::Store  // Next frame's HiZ
+                                                                  : RHIStoreOp::DontCare;
+    depthAttachment.clearValue = RHIClearValue::DepthStencil(1.0f, 0);
+
+    info.renderArea.offset = {0, 0};
+    info.renderArea.extent = {m_swapChainWidth, m_swapChainHeight};
+    info.layerCount        = 1;
+    info.colorAttachments.clear();
+    info.colorAttachments.push_back(colorAttachment);
+    info.depthAttachment   = &depthAttachment;
+}
+
+void RenderSystem::recordViewportAndScissor(RHICommandBufferId cmd)
+{
+    RHIViewport viewport{};
+    viewport.x        = 0.0f;
+    viewport.y        = 0.0f;
+    viewport.width    = static_cast<float>(m_swapChainWidth);
+    viewport.height   = static_cast<float>(m_swapChainHeight);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    m_rhi->cmdSetViewport(cmd, viewport);
+
+    RHIRect2D scissor{};
+    scissor.offset = {0, 0};
+    scissor.extent = {m_swapChainWidth, m_swapChainHeight};
+    m_rhi->cmdSetScissor(cmd, scissor);
+}
+
+void RenderSystem::recordPresentTransition(RHICommandBufferId cmd, uint32_t imageIndex)
+{
+    RHITextureHandle swapChainImage = m_rhi->getSwapChainImage(m_swapChain, imageIndex);
+
+    RHITextureBarrier barrier{};
+    barrier.texture         = swapChainImage->id;
+    barrier.srcState        = RHIResourceState::RenderTarget;
+    barrier.dstState        = RHIResourceState::Present;
+    barrier.baseMipLevel    = 0;
+    barrier.mipLevelCount   = 1;
+    barrier.baseArrayLayer  = 0;
+    barrier.arrayLayerCount = 1;
+
+    m_rhi->cmdPipelineBarrier(cmd, {}, std::span(&barrier, 1));
+}
+
+// =============================================================================
+// Parallel Scene Recording
+// =============================================================================
+
+namespace
+{
+    // Slots uploaded per task when a frame's instance buffer catches up
+    constexpr size_t kInstanceUploadChunkSize = 4096;
+
+    // Smallest instance buffer capacity, in slots (buffers grow by doubling from there)
+    constexpr uint64_t kMinInstanceCapacity = 1024;
+
+    /// @brief (Re)create a persistently mapped buffer if it is smaller than size
+    /// @return true if the buffer was replaced
+    bool reserveBuffer(RHI& rhi, RHIBufferHandle& buffer, uint64_t size, RHIBufferUsage usage, const char* debugName)
     {
-        RHITextureBarrier barrier{};
-        barrier.texture         = swapChainImage;
-        barrier.srcState        = RHIResourceState::RenderTarget;
-        barrier.dstState        = RHIResourceState::Present;
-        barrier.baseMipLevel    = 0;
-        barrier.mipLevelCount   = 1;
-        barrier.baseArrayLayer  = 0;
-        barrier.arrayLayerCount = 1;
+        if (buffer && buffer->size >= size)
+        {
+            return false;
+        }
+
+        uint64_t capacity = buffer ? buffer->size : 0;
+        while (capacity < size)
+        {
+            capacity = std::max(capacity * 2, size);
+        }
+
+        if (buffer)
+        {
+            rhi.destroyBuffer(buffer);
+        }
 
-        m_rhi->cmdPipelineBarrier(cmd, {}, std::span(&barrier, 1));
+        RHIBufferDesc desc{};
+        desc.size        = capacity;
+        desc.usage       = usage;
+        desc.memoryUsage = RHIMemoryUsage::CpuToGpu;
+        desc.debugName   = debugName;
+        buffer = rhi.createBuffer(desc);
+        return true;
     }
 }
 
+bool RenderSystem::prepareSceneInstances(FrameResources& frame)
+{
+    // Every frame's copy of the instance buffer needs the slots written since it last ran. A copy
+    // that would owe more slots than exist (its frames kept drawing nothing) is rewritten whole.
+    const std::vector<uint32_t>& dirtySlots = m_renderScene.dirtySlots();
+    for (FrameResources& other : m_frameResources)
+    {
+        if (other.uploadAllInstances)
+        {
+            continue;
+        }
+        if (other.pendingSlots.size() + dirtySlots.size() >= m_renderScene.slotCount())
+        {
+            other.pendingSlots.clear();
+            other.uploadAllInstances = true;
+            continue;
+        }
+        other.pendingSlots.insert(other.pendingSlots.end(), dirtySlots.begin(), dirtySlots.end());
+    }
+    m_renderScene.clearDirty();
+
+    m_instanceBatcher.build(m_renderScene);
+    const std::span<const InstanceBatch> batches = m_instanceBatcher.batches();
+    m_batchMeshes.resize(batches.size());
+    for (size_t i = 0; i < batches.size(); ++i)
+    {
+        m_batchMeshes[i] = resolveSceneMesh(batches[i].meshId);
+    }
+
+    if (!m_instancedPipeline || m_instanceBatcher.batchCount() == 0 || !reserveInstanceBuffers(frame))
+    {
+        return false;
+    }
+
+    // Instance data: only what changed, unless the buffer is new (or all of it changed)
+    const std::vector<RenderObjectDesc>& instances = m_renderScene.instances();
+    auto* instanceData = static_cast<SceneInstanceData*>(m_rhi->mapBuffer(frame.instanceBuffer));
+    if (frame.uploadAllInstances)
+    {
+        frame.pendingSlots.resize(instances.size());
+        for (uint32_t slot = 0; slot < instances.size(); ++slot)
+        {
+            frame.pendingSlots[slot] = slot;
+        }
+        frame.uploadAllInstances = false;
+    }
+
+    const std::vector<uint32_t>& pendingSlots = frame.pendingSlots;
+    const auto uploadChunk = [&](size_t chunk) {
+        const size_t end = std::min(pendingSlots.size(), (chunk + 1) * kInstanceUploadChunkSize);
+        for (size_t i = chunk * kInstanceUploadChunkSize; i < end; ++i)
+        {
+            const uint32_t slot = pendingSlots[i];
+            SceneInstanceData& data = instanceData[slot];
+            std::memcpy(data.transform, instances[slot].transform, sizeof(data.transform));
+            std::memcpy(data.boundingSphere, instances[slot].bounding_sphere, sizeof(data.boundingSphere));
+        }
+    };
+    const size_t chunkCount = (pendingSlots.size() + kInstanceUploadChunkSize - 1) / kInstanceUploadChunkSize;
+    if (!m_workerPool || chunkCount <= 1)
+    {
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            uploadChunk(chunk);
+        }
+    }
+    else
+    {
+        m_workerPool->parallelFor(0, chunkCount, 1, uploadChunk);
+    }
+    frame.pendingSlots.clear();
+
+    // This frame's draw order (or, culling on the GPU, what to cull) and one indirect draw per batch
+    const std::span<const uint32_t> instanceSlots = m_instanceBatcher.instanceSlots();
+    const bool gpuCulling = isGpuCullingActive();
+    if (gpuCulling)
+    {
+        auto* candidates = static_cast<InstanceCullCandidate*>(m_rhi->mapBuffer(frame.cullCandidateBuffer));
+        for (uint32_t batch = 0; batch < batches.size(); ++batch)
+        {
+            const uint32_t end = batches[batch].firstInstance + batches[batch].instanceCount;
+            for (uint32_t i = batches[batch].firstInstance; i < end; ++i)
+            {
+                candidates[i].slot  = instanceSlots[i];
+                candidates[i].batch = batch;
+            }
+        }
+    }
+    else
+    {
+        std::memcpy(m_rhi->mapBuffer(frame.instanceSlotBuffer), instanceSlots.data(), instanceSlots.size_bytes());
+    }
+
+    auto* commands = static_cast<RHIDrawIndexedIndirectCommand*>(m_rhi->mapBuffer(frame.indirectBuffer));
+    for (size_t i = 0; i < batches.size(); ++i)
+    {
+        const InstanceBatch& batch = batches[i];
+        RHIDrawIndexedIndirectCommand& command = *commands++;
+        command.indexCount    = m_batchMeshes[i] ? m_batchMeshes[i]->getIndexCount() : 0;
+        command.instanceCount = gpuCulling ? 0 : batch.instanceCount;  // The cull counts its survivors
+        command.firstIndex    = 0;
+        command.vertexOffset  = 0;
+        command.firstInstance = batch.firstInstance;  // The shader's index into instanceSlotBuffer
+    }
+    return true;
+}
+
+bool RenderSystem::reserveInstanceBuffers(FrameResources& frame)
+{
+    const uint64_t slotCapacity = std::max<uint64_t>(m_renderScene.slotCount(), kMinInstanceCapacity);
+    const bool instancesMoved = reserveBuffer(*m_rhi, frame.instanceBuffer, slotCapacity * sizeof(SceneInstanceData),
+                                              RHIBufferUsage::Storage, "SceneInstances");
+    const uint64_t instanceCapacity = std::max<uint64_t>(m_instanceBatcher.instanceCount(), kMinInstanceCapacity);
+    const bool slotsMoved = reserveBuffer(*m_rhi, frame.instanceSlotBuffer, instanceCapacity * sizeof(uint32_t),
+                                          RHIBufferUsage::Storage, "SceneInstanceSlots");
+    // Storage: the cull writes the instance counts
+    const bool commandsMoved = reserveBuffer(*m_rhi, frame.indirectBuffer,
+                                             m_instanceBatcher.batchCount() * sizeof(RHIDrawIndexedIndirectCommand),
+                                             RHIBufferUsage::Indirect | RHIBufferUsage::Storage, "SceneIndirectDraws");
+    const bool gpuCulling = isGpuCullingActive();
+    const bool candidatesMoved = gpuCulling &&
+        reserveBuffer(*m_rhi, frame.cullCandidateBuffer, instanceCapacity * sizeof(InstanceCullCandidate),
+                      RHIBufferUsage::Storage, "SceneCullCandidates");
+
+    if (!frame.instanceBuffer || !frame.instanceSlotBuffer || !frame.indirectBuffer ||
+        (gpuCulling && !frame.cullCandidateBuffer))
+    {
+        LOG_ERROR("RenderSystem: Failed to create scene instance buffers");
+        return false;
+    }
+
+    if (gpuCulling && (instancesMoved || slotsMoved || commandsMoved || candidatesMoved))
+    {
+        InstanceCullBuffers cullBuffers;
+        cullBuffers.instances     = frame.instanceBuffer;
+        cullBuffers.candidates    = frame.cullCandidateBuffer;
+        cullBuffers.instanceSlots = frame.instanceSlotBuffer;
+        cullBuffers.drawCommands  = frame.indirectBuffer;
+        m_instanceCuller.bindFrameBuffers(m_currentFrame, cullBuffers);
+    }
+
+    // A new instance buffer starts empty
+    if (instancesMoved)
+    {
+        frame.pendingSlots.clear();
+        frame.uploadAllInstances = true;
+    }
+
+    if (!frame.instanceSet)
+    {
+        frame.instanceSet = m_rhi->createDescriptorSet(m_instanceSetLayout);
+        if (!frame.instanceSet)
+        {
+            LOG_ERROR("RenderSystem: Failed to create scene instance descriptor set");
+            return false;
+        }
+    }
+    else if (!instancesMoved && !slotsMoved)
+    {
+        return true;
+    }
+
+    RHIDescriptorWrite writes[2] = {};
+    writes[0].binding = 0;
+    writes[0].type    = RHIDescriptorType::StorageBuffer;
+    writes[0].buffer  = frame.instanceBuffer;
+    writes[1].binding = 1;
+    writes[1].type    = RHIDescriptorType::StorageBuffer;
+    writes[1].buffer  = frame.instanceSlotBuffer;
+    m_rhi->updateDescriptorSet(frame.instanceSet, writes);
+    return true;
+}
+
+void RenderSystem::recordSceneCulling(RHICommandBufferId cmd)
+{
+    if (m_sceneTaskCount == 0 || !isGpuCullingActive())
+    {
+        // This frame's depth is not what the last cull expected to be drawn
+        m_instanceCuller.invalidateHistory();
+        return;
+    }
+
+    const Matrix4x4 viewProjection = m_mainCamera->getViewMatrix() * m_mainCamera->getProjectionMatrix();
+    m_instanceCuller.recordCull(cmd, m_currentFrame, viewProjection,
+                                static_cast<uint32_t>(m_instanceBatcher.instanceCount()));
+}
+
+const Mesh* RenderSystem::resolveSceneMesh(uint16_t meshId)
+{
+    if (meshId < m_sceneMeshes.size() && m_sceneMeshes[meshId])
+    {
+        return m_sceneMeshes[meshId].get();
+    }
+
+    if (meshId >= m_missingMeshReported.size())
+    {
+        m_missingMeshReported.resize(static_cast<size_t>(meshId) + 1, 0);
+    }
+    if (!m_missingMeshReported[meshId])
+    {
+        LOG_ERROR("RenderSystem: No scene mesh registered for mesh_id {}, its instances are not drawn", meshId);
+        m_missingMeshReported[meshId] = 1;
+    }
+    return nullptr;
+}
+
+uint32_t RenderSystem::computeSceneTaskCount() const
+{
+    const size_t batchCount = m_instanceBatcher.batchCount();
+    if (batchCount == 0 || !m_instancedPipeline || !m_cubeMesh || !m_mainCamera)
+    {
+        return 0;
+    }
+
+    const size_t tasks = (batchCount + m_sceneDrawsPerTask - 1) / m_sceneDrawsPerTask;
+    return static_cast<uint32_t>(std::min<size_t>(tasks, m_maxRecordingTasks));
+}
+
+void RenderSystem::recordSceneDraws(FrameResources& frame, uint32_t imageIndex)
+{
+    // Every buffer resumes the same pass, so they all get the main pass's rendering info
+    RHIRenderingInfo renderingInfo{};
+    RHIRenderingAttachmentInfo depthAttachment{};
+    fillFrameRenderingInfo(imageIndex, renderingInfo, depthAttachment);
+    renderingInfo.resuming = true;
+
+    const Matrix4x4 viewProjection = m_mainCamera->getViewMatrix() * m_mainCamera->getProjectionMatrix();
+
+    // Task i records the i-th contiguous range of batches into the i-th buffer: the submit order
+    // (and so the draw order) does not depend on which thread ran which task
+    const size_t batchCount = m_instanceBatcher.batchCount();
+    const size_t taskCount  = m_sceneTaskCount;
+    const size_t rangeSize  = (batchCount + taskCount - 1) / taskCount;
+
+    const auto recordTask = [&](size_t task) {
+        const RHICommandBufferId cmd = frame.sceneCommandBuffers[task]->id;
+        m_rhi->resetCommandPool(frame.scenePools[task]);
+        m_rhi->beginCommandBuffer(cmd);
+
+        RHIRenderingInfo taskInfo = renderingInfo;
+        taskInfo.suspending = true;
+        recordSceneRange(cmd, frame, taskInfo, viewProjection,
+                         std::min(batchCount, task * rangeSize),
+                         std::min(batchCount, (task + 1) * rangeSize));
+
+        m_rhi->endCommandBuffer(cmd);
+    };
+
+    if (!m_workerPool || taskCount <= 1)
+    {
+        for (size_t task = 0; task < taskCount; ++task)
+        {
+            recordTask(task);
+        }
+    }
+    else
+    {
+        m_workerPool->parallelFor(0, taskCount, 1, recordTask);
+    }
+
+    for (size_t task = 0; task < taskCount; ++task)
+    {
+        frame.submitList.push_back(frame.sceneCommandBuffers[task]);
+    }
+
+    // Close the pass and hand the image to present
+    const RHICommandBufferId finish = frame.finishCommandBuffer->id;
+    m_rhi->beginCommandBuffer(finish);
+    m_rhi->cmdBeginRendering(finish, renderingInfo);
+    m_rhi->cmdEndRendering(finish);
+    recordPresentTransition(finish, imageIndex);
+    m_rhi->endCommandBuffer(finish);
+
+    frame.submitList.push_back(frame.finishCommandBuffer);
+}
+
+void RenderSystem::recordSceneRange(RHICommandBufferId cmd, const FrameResources& frame,
+                                    const RHIRenderingInfo& renderingInfo, const Matrix4x4& viewProjection,
+                                    size_t firstBatch, size_t endBatch)
+{
+    m_rhi->cmdBeginRendering(cmd, renderingInfo);
+
+    // Dynamic state and bindings do not carry over from other command buffers
+    recordViewportAndScissor(cmd);
+    m_rhi->cmdBindPipeline(cmd, m_instancedPipeline->id);
+
+    const RHIDescriptorSetId instanceSet = frame.instanceSet->id;
+    m_rhi->cmdBindDescriptorSets(cmd, m_instancedPipeline->id, 0, std::span(&instanceSet, 1));
+    m_rhi->cmdPushConstants(cmd, m_instancedPipeline->id, RHIShaderStage::Vertex,
+                            0, sizeof(Matrix4x4), &viewProjection);
+
+    // Batches are sorted by material then mesh: consecutive ones often share the mesh
+    const Mesh* boundMesh = nullptr;
+    for (size_t i = firstBatch; i < endBatch; ++i)
+    {
+        const Mesh* mesh = m_batchMeshes[i];
+        if (!mesh)
+        {
+            continue;
+        }
+        if (mesh != boundMesh)
+        {
+            mesh->bind(m_rhi.get(), cmd);
+            boundMesh = mesh;
+        }
+        m_rhi->cmdDrawIndexedIndirect(cmd, frame.indirectBuffer->id,
+                                      i * sizeof(RHIDrawIndexedIndirectCommand), 1,
+                                      sizeof(RHIDrawIndexedIndirectCommand));
+    }
+
+    m_rhi->cmdEndRendering(cmd);
+}
+
 void RenderSystem::endFrame(uint32_t imageIndex)
 {
     FrameResources& frame = m_frameResources[m_currentFrame];
 
     // Submit command buffer
     RHI::SubmitInfo submitInfo{};
-    submitInfo.commandBuffers   = std::span(&frame.commandBuffer, 1);
+    submitInfo.commandBuffers   = frame.submitList;
     submitInfo.waitSemaphores   = std::span(&frame.imageAvailableSemaphore, 1);
     submitInfo.signalSemaphores = std::span(&frame.renderFinishedSemaphore, 1);
     submitInfo.fence            = frame.inFlightFence;
@@ -794,7 +1310,10 @@ bool RenderSystem::createMinimalResources()
         }
     }
 
-    if (shaderDir.empty())
+    // The Null backend does not look at shader code: headless runs work without built shaders
+    const bool needsShaderCode = m_rhi->getBackendType() != RHIBackendType::Null;
+
+    if (shaderDir.empty() && needsShaderCode)
     {
         LOG_ERROR("RenderSystem: Could not find shader directory");
         return false;
@@ -804,7 +1323,7 @@ bool RenderSystem::createMinimalResources()
 
     // Load vertex shader
     auto vsCode = loadSpirv(shaderDir / "minimal.vert.spv");
-    if (vsCode.empty())
+    if (vsCode.empty() && needsShaderCode)
     {
         LOG_ERROR("RenderSystem: Failed to load minimal.vert.spv");
         return false;
@@ -826,7 +1345,7 @@ bool RenderSystem::createMinimalResources()
 
     // Load fragment shader
     auto fsCode = loadSpirv(shaderDir / "minimal.frag.spv");
-    if (fsCode.empty())
+    if (fsCode.empty() && needsShaderCode)
     {
         LOG_ERROR("RenderSystem: Failed to load minimal.frag.spv");
         return false;
@@ -902,11 +1421,158 @@ bool RenderSystem::createMinimalResources()
 
     LOG_INFO("RenderSystem: Created 3D cube pipeline successfully");
 
+    // -------------------------------------------------------------------------
+    // 5. Create instanced scene pipeline
+    // -------------------------------------------------------------------------
+
+    // Not fatal: without it the RenderScene is not drawn, the cube still is
+    if (!createInstancedPipeline(shaderDir, needsShaderCode))
+    {
+        LOG_WARN("RenderSystem: Failed to create instanced pipeline (scene instances will not be drawn)");
+    }
+    // Not fatal either: without it the scene is drawn as the CPU batched it
+    else if (m_gpuCulling && !createInstanceCuller(shaderDir, needsShaderCode))
+    {
+        LOG_WARN("RenderSystem: Failed to create GPU culling (scene instances will not be culled)");
+    }
+
+    return true;
+}
+
+bool RenderSystem::createInstancedPipeline(const std::filesystem::path& shaderDir, bool needsShaderCode)
+{
+    // Same vertex input, rasterization and targets as the cube pipeline; the transforms come from
+    // storage buffers (set 0) and the push constant holds the view-projection matrix
+    auto vsCode = loadSpirv(shaderDir / "instanced.vert.spv");
+    auto fsCode = loadSpirv(shaderDir / "instanced.frag.spv");
+    if ((vsCode.empty() || fsCode.empty()) && needsShaderCode)
+    {
+        LOG_ERROR("RenderSystem: Failed to load instanced.vert.spv / instanced.frag.spv");
+        return false;
+    }
+
+    RHIShaderDesc vsDesc{};
+    vsDesc.code       = vsCode.data();
+    vsDesc.codeSize   = vsCode.size();
+    vsDesc.stage      = RHIShaderStage::Vertex;
+    vsDesc.entryPoint = "main";
+    vsDesc.debugName  = "InstancedVertexShader";
+    m_instancedVertexShader = m_rhi->createShader(vsDesc);
+
+    RHIShaderDesc fsDesc{};
+    fsDesc.code       = fsCode.data();
+    fsDesc.codeSize   = fsCode.size();
+    fsDesc.stage      = RHIShaderStage::Fragment;
+    fsDesc.entryPoint = "main";
+    fsDesc.debugName  = "InstancedFragmentShader";
+    m_instancedFragmentShader = m_rhi->createShader(fsDesc);
+
+    if (!m_instancedVertexShader || !m_instancedFragmentShader)
+    {
+        LOG_ERROR("RenderSystem: Failed to create instanced shaders");
+        return false;
+    }
+
+    // Binding 0: transform per RenderScene slot, binding 1: slot of each drawn instance
+    RHIDescriptorSetLayoutDesc layoutDesc{};
+    layoutDesc.bindings.push_back({0, RHIDescriptorType::StorageBuffer, 1, RHIShaderStage::Vertex});
+    layoutDesc.bindings.push_back({1, RHIDescriptorType::StorageBuffer, 1, RHIShaderStage::Vertex});
+    m_instanceSetLayout = m_rhi->createDescriptorSetLayout(layoutDesc);
+    if (!m_instanceSetLayout)
+    {
+        LOG_ERROR("RenderSystem: Failed to create instance descriptor set layout");
+        return false;
+    }
+
+    RHIGraphicsPipelineDesc pipelineDesc{};
+    pipelineDesc.shaders.push_back(m_instancedVertexShader);
+    pipelineDesc.shaders.push_back(m_instancedFragmentShader);
+    pipelineDesc.vertexInput = m_cubeMesh->getVertexLayout();
+    pipelineDesc.topology    = RHIPrimitiveTopology::TriangleList;
+    pipelineDesc.descriptorLayouts.push_back(m_instanceSetLayout);
+
+    RHIPushConstantRange pushConstantRange{};
+    pushConstantRange.stages = RHIShaderStage::Vertex;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size   = sizeof(float) * 16;  // View-projection matrix
+    pipelineDesc.pushConstantRanges.push_back(pushConstantRange);
+
+    pipelineDesc.rasterization.cullMode    = RHICullMode::None;
+    pipelineDesc.rasterization.frontFace   = RHIFrontFace::Clockwise;
+    pipelineDesc.rasterization.polygonMode = RHIPolygonMode::Fill;
+
+    pipelineDesc.depthStencil.depthTestEnable  = true;
+    pipelineDesc.depthStencil.depthWriteEnable = true;
+    pipelineDesc.depthStencil.depthCompareOp   = RHICompareOp::Less;
+
+    RHIColorBlendAttachment colorAttachment{};
+    colorAttachment.blendEnable    = false;
+    colorAttachment.colorWriteMask = 0xF;
+    pipelineDesc.colorBlend.attachments.push_back(colorAttachment);
+
+    pipelineDesc.colorFormats.push_back(m_swapChain->format);
+    pipelineDesc.depthFormat = RHIFormat::D32_FLOAT;
+    pipelineDesc.debugName   = "InstancedScenePipeline";
+
+    m_instancedPipeline = m_rhi->createGraphicsPipeline(pipelineDesc);
+    if (!m_instancedPipeline)
+    {
+        LOG_ERROR("RenderSystem: Failed to create instanced pipeline");
+        return false;
+    }
+
+    LOG_INFO("RenderSystem: Created instanced scene pipeline successfully");
+    return true;
+}
+
+bool RenderSystem::createInstanceCuller(const std::filesystem::path& shaderDir, bool needsShaderCode)
+{
+    auto hizBuildCode = loadSpirv(shaderDir / "hiz_build.comp.spv");
+    auto cullCode     = loadSpirv(shaderDir / "instance_cull.comp.spv");
+    if ((hizBuildCode.empty() || cullCode.empty()) && needsShaderCode)
+    {
+        LOG_ERROR("RenderSystem: Failed to load hiz_build.comp.spv / instance_cull.comp.spv");
+        return false;
+    }
+
+    if (!m_instanceCuller.initialize(m_rhi.get(), hizBuildCode, cullCode, m_framesInFlight) ||
+        !m_instanceCuller.resize(m_depthTexture, m_swapChainWidth, m_swapChainHeight))
+    {
+        m_instanceCuller.shutdown();
+        return false;
+    }
+
+    LOG_INFO("RenderSystem: Created GPU instance culling ({} HiZ levels)", m_instanceCuller.hizLevels().size());
     return true;
 }
 
 void RenderSystem::destroyMinimalResources()
 {
+    // Destroy GPU culling
+    m_instanceCuller.shutdown();
+
+    // Destroy instanced scene pipeline
+    if (m_instancedPipeline)
+    {
+        m_rhi->destroyPipeline(m_instancedPipeline);
+        m_instancedPipeline = nullptr;
+    }
+    if (m_instanceSetLayout)
+    {
+        m_rhi->destroyDescriptorSetLayout(m_instanceSetLayout);
+        m_instanceSetLayout = nullptr;
+    }
+    if (m_instancedFragmentShader)
+    {
+        m_rhi->destroyShader(m_instancedFragmentShader);
+        m_instancedFragmentShader = nullptr;
+    }
+    if (m_instancedVertexShader)
+    {
+        m_rhi->destroyShader(m_instancedVertexShader);
+        m_instancedVertexShader = nullptr;
+    }
+
     // Destroy pipeline
     if (m_pipeline)
     {
@@ -927,7 +1593,10 @@ void RenderSystem::destroyMinimalResources()
         m_vertexShader = nullptr;
     }
 
-    // Reset mesh (shared_ptr handles cleanup)
+    // Reset meshes (shared_ptr handles cleanup)
+    m_batchMeshes.clear();
+    m_sceneMeshes.clear();
+    m_missingMeshReported.clear();
     m_cubeMesh.reset();
 
     // Reset camera
@@ -1004,20 +1673,6 @@ void RenderSystem::processCameraInput(InputSystem* input, float deltaTime)
     }
 }
 
-void RenderSystem::processPendingAssets()
-{
-    if (!m_initialized)
-    {
-        return;
-    }
-
-    // Process pending texture uploads (max 4 per frame to avoid stalls)
-    if (m_textureManager)
-    {
-        m_textureManager->processPendingUploads(4);
-    }
-}
-
 // =============================================================================
 // Model Resources
 // =============================================================================
@@ -2,10 +2,14 @@
 
 #include "runtime/function/render/rhi/rhi.h"
 #include "runtime/function/render/rhi/rhi_types.h"
+#include "runtime/function/render/scene/render_scene.h"
+#include "runtime/function/render/scene/instance_batcher.h"
+#include "runtime/function/render/scene/instance_culler.h"
 
 #include <memory>
 #include <vector>
 #include <cstdint>
+#include <filesystem>
 
 struct GLFWwindow;
 
@@ -21,17 +25,25 @@ class InputSystem;
 class TextureManager;
 class ModelLoader;
 class WorkerPool;
+class Matrix4x4;
+struct RenderPacket;
 
 /// @brief Configuration for RenderSystem initialization
 struct RenderSystemConfig
 {
-    WindowSystem*   windowSystem        = nullptr;
-    WorkerPool*     workerPool          = nullptr;  // For async texture/model loading
+    WindowSystem*   windowSystem        = nullptr;  // Optional with the Null backend (headless)
+    WorkerPool*     workerPool          = nullptr;  // For async texture/model loading and parallel recording
+    RHIBackendType  backend             = RHIBackendType::Vulkan;
     bool            enableValidation    = true;
     bool            enableDebugMarkers  = true;
     uint32_t        preferredGpuIndex   = 0;
     RHIPresentMode  presentMode         = RHIPresentMode::Fifo;
     uint32_t        framesInFlight      = 3;  // Must match swapchain image count
+    uint32_t        headlessWidth       = 1280;  // Offscreen swapchain size without a window
+    uint32_t        headlessHeight      = 720;
+    uint32_t        sceneDrawsPerTask   = 256;   // Scene batches (indirect draws) per parallel recording task
+    uint32_t        maxRecordingTasks   = 0;     // Scene command buffers per frame (0 = worker count + 1)
+    bool            gpuCulling          = true;  // Frustum and HiZ occlusion cull the scene in a compute pass
 };
 
 /// @brief Per-frame rendering resources
@@ -42,6 +54,26 @@ struct FrameResources
     RHIFenceHandle          inFlightFence;
     RHISemaphoreHandle      imageAvailableSemaphore;
     RHISemaphoreHandle      renderFinishedSemaphore;
+
+    // Scene draws are recorded in parallel, one task per command buffer, each from its own pool.
+    // The buffers continue the frame's render pass in task order; finishCommandBuffer closes it.
+    std::vector<RHICommandPoolHandle>   scenePools;
+    std::vector<RHICommandBufferHandle> sceneCommandBuffers;
+    RHICommandBufferHandle              finishCommandBuffer;
+
+    std::vector<RHICommandBufferHandle> submitList;  // This frame's command buffers, in submission order
+
+    // Instanced scene drawing (persistently mapped). The instance buffer mirrors the RenderScene's
+    // slots and only receives the slots written since this frame last ran; the others are
+    // rewritten every frame from the batches. With GPU culling the CPU writes the candidates and
+    // the commands with no instances, and the cull fills the slot buffer and the instance counts.
+    RHIBufferHandle                     instanceBuffer;      // SceneInstanceData per RenderScene slot
+    RHIBufferHandle                     instanceSlotBuffer;  // Slot of each drawn instance, batch by batch
+    RHIBufferHandle                     indirectBuffer;      // RHIDrawIndexedIndirectCommand per batch
+    RHIBufferHandle                     cullCandidateBuffer; // InstanceCullCandidate per visible instance
+    RHIDescriptorSetHandle              instanceSet;
+    std::vector<uint32_t>               pendingSlots;        // Slots this frame's instance buffer lacks
+    bool                                uploadAllInstances = true;
 };
 
 /// @brief Main rendering system - manages RHI, resources, and render loop
@@ -66,7 +98,18 @@ public:
     /// @param deltaTime Time since last frame in seconds
     void tick(float deltaTime);
 
-    /// @brief Handle window resize
+    /// @brief Bring the render scene up to date with a packet from the logic thread
+    /// Call with every packet acquired, before tick(): deltas are applied once, in order.
+    void applyRenderPacket(const RenderPacket& packet);
+
+    /// @brief Draw the scene instances with this mesh_id with a mesh (render thread)
+    /// Register when loading, before instances use the id: a registered mesh stays until shutdown,
+    /// since frames in flight may draw it. It must share the instanced pipeline's vertex layout
+    /// (ColorVertex). Instances whose mesh_id has no mesh are not drawn.
+    /// @return false if the mesh is invalid, has another layout, or the id is already taken
+    bool registerSceneMesh(uint16_t meshId, std::shared_ptr<Mesh> mesh);
+
+    /// @brief Handle window resize (or, headless, resize the offscreen swapchain)
     /// @param width New window width
     /// @param height New window height
     void onWindowResize(uint32_t width, uint32_t height);
@@ -79,13 +122,30 @@ public:
     RHISwapChainHandle getSwapChain() const { return m_swapChain; }
     uint32_t getCurrentFrameIndex() const { return m_currentFrame; }
     uint32_t getFramesInFlight() const { return m_framesInFlight; }
+    const FrameResources& getFrameResources(uint32_t index) const { return m_frameResources[index]; }
+
+    /// @brief Command buffers the last frame recorded scene draws into (0 when it drew no scene)
+    uint32_t getSceneTaskCount() const { return m_sceneTaskCount; }
 
     bool isInitialized() const { return m_initialized; }
     bool isMinimized() const { return m_minimized; }
+    bool isHeadless() const { return m_windowSystem == nullptr; }
 
     /// @brief Get the main camera
     Camera* getMainCamera() const { return m_mainCamera.get(); }
 
+    /// @brief Get the render-side mirror of the scene (instances, visible list, dirty slots)
+    const RenderScene& getRenderScene() const { return m_renderScene; }
+
+    /// @brief Get the batches the last frame drew the scene with
+    const InstanceBatcher& getInstanceBatcher() const { return m_instanceBatcher; }
+
+    /// @brief Get the GPU culling of the scene (not initialized when disabled or unavailable)
+    const InstanceCuller& getInstanceCuller() const { return m_instanceCuller; }
+
+    /// @brief Whether the scene is culled on the GPU rather than drawn as the CPU batched it
+    bool isGpuCullingActive() const { return m_gpuCulling && m_instanceCuller.isInitialized(); }
+
     /// @brief Get texture manager
     TextureManager* getTextureManager() const { return m_textureManager.get(); }
 
@@ -97,10 +157,6 @@ public:
     /// @param deltaTime Time since last frame
     void processCameraInput(InputSystem* input, float deltaTime);
 
-    /// @brief Process pending async asset uploads (textures, etc.)
-    /// Call this once per frame on render thread
-    void processPendingAssets();
-
 private:
     // =========================================================================
     // Initialization Helpers
@@ -119,9 +175,41 @@ private:
     // =========================================================================
 
     bool beginFrame(uint32_t& imageIndex);
-    void recordCommands(RHICommandBufferHandle cmd, uint32_t imageIndex);
+    void recordCommands(RHICommandBufferId cmd, uint32_t imageIndex);
     void endFrame(uint32_t imageIndex);
 
+    /// @brief Main pass: clear the swapchain image and depth over the whole swapchain
+    /// @param depthAttachment Storage for the depth attachment info points to
+    void fillFrameRenderingInfo(uint32_t imageIndex, RHIRenderingInfo& info,
+                                RHIRenderingAttachmentInfo& depthAttachment) const;
+    void recordViewportAndScissor(RHICommandBufferId cmd);
+    void recordPresentTransition(RHICommandBufferId cmd, uint32_t imageIndex);
+
+    /// @brief Batch the visible scene instances and write the frame's instance and indirect buffers
+    /// @return false if the frame has nothing to draw or its buffers could not be reserved
+    bool prepareSceneInstances(FrameResources& frame);
+
+    /// @brief Grow a frame's instance buffers to hold the scene and this frame's batches
+    /// @return false if a buffer could not be created (the scene is not drawn this frame)
+    bool reserveInstanceBuffers(FrameResources& frame);
+
+    /// @brief Cull the scene into the frame's indirect draws (before the main pass begins)
+    void recordSceneCulling(RHICommandBufferId cmd);
+
+    /// @brief Mesh the instances with a mesh_id are drawn with (nullptr, reported once, if none)
+    const Mesh* resolveSceneMesh(uint16_t meshId);
+
+    /// @brief Number of command buffers to split this frame's scene batches over
+    uint32_t computeSceneTaskCount() const;
+
+    /// @brief Record the scene batches across worker threads, then close the main pass
+    void recordSceneDraws(FrameResources& frame, uint32_t imageIndex);
+
+    /// @brief Draw batches [firstBatch, endBatch) inside the resumed main pass, one indirect draw each
+    void recordSceneRange(RHICommandBufferId cmd, const FrameResources& frame,
+                          const RHIRenderingInfo& renderingInfo, const Matrix4x4& viewProjection,
+                          size_t firstBatch, size_t endBatch);
+
 private:
     // =========================================================================
     // Core Systems
@@ -138,6 +226,8 @@ private:
     RHIQueueHandle          m_graphicsQueue;
     uint32_t                m_swapChainWidth  = 0;
     uint32_t                m_swapChainHeight = 0;
+    uint32_t                m_headlessWidth   = 0;  // Requested size when there is no window
+    uint32_t                m_headlessHeight  = 0;
 
     // =========================================================================
     // Depth Buffer
@@ -153,6 +243,14 @@ private:
     uint32_t                    m_framesInFlight = 3;
     uint32_t                    m_currentFrame   = 0;
 
+    // =========================================================================
+    // Parallel Recording
+    // =========================================================================
+
+    uint32_t                    m_sceneDrawsPerTask = 1024;
+    uint32_t                    m_maxRecordingTasks = 1;   // Scene command buffers per frame
+    uint32_t                    m_sceneTaskCount    = 0;   // Used by the current frame
+
     // =========================================================================
     // State
     // =========================================================================
@@ -167,6 +265,15 @@ private:
 
     std::shared_ptr<Camera> m_mainCamera;
 
+    // =========================================================================
+    // Scene
+    // =========================================================================
+
+    RenderScene             m_renderScene;
+    InstanceBatcher         m_instanceBatcher;
+    InstanceCuller          m_instanceCuller;
+    bool                    m_gpuCulling = true;
+
     // =========================================================================
     // Asset Management
     // =========================================================================
@@ -181,6 +288,13 @@ private:
 
     std::shared_ptr<Mesh>   m_cubeMesh;
 
+    // Scene meshes indexed by mesh_id, and the ids drawn without one that were reported
+    std::vector<std::shared_ptr<Mesh>>  m_sceneMeshes;
+    std::vector<uint8_t>                m_missingMeshReported;
+
+    // Mesh of each of the frame's batches (nullptr: not drawn)
+    std::vector<const Mesh*>            m_batchMeshes;
+
     // =========================================================================
     // Pipeline Resources (Color Cube)
     // =========================================================================
@@ -190,6 +304,15 @@ private:
     RHIPipelineHandle   m_pipeline;
     float               m_rotationTime = 0.0f;
 
+    // =========================================================================
+    // Pipeline Resources (Instanced Scene)
+    // =========================================================================
+
+    RHIShaderHandle                 m_instancedVertexShader;
+    RHIShaderHandle                 m_instancedFragmentShader;
+    RHIPipelineHandle               m_instancedPipeline;
+    RHIDescriptorSetLayoutHandle    m_instanceSetLayout;
+
     // =========================================================================
     // Model Resources (Textured Model)
     // =========================================================================
@@ -203,6 +326,8 @@ private:
     RHIDescriptorSetHandle          m_modelDescriptorSet;
 
     bool createMinimalResources();
+    bool createInstancedPipeline(const std::filesystem::path& shaderDir, bool needsShaderCode);
+    bool createInstanceCuller(const std::filesystem::path& shaderDir, bool needsShaderCode);
     void destroyMinimalResources();
     bool createModelResources();
     void destroyModelResources();
@@ -1,5 +1,6 @@
 #include "rhi.h"
 #include "runtime/function/render/backend/vulkan/vulkan_rhi.h"
+#include "runtime/function/render/backend/null/null_rhi.h"
 #include "runtime/core/log/log_system.h"
 
 namespace vesper {
@@ -19,6 +20,10 @@ std::unique_ptr<RHI> createRHI(RHIBackendType type)
             LOG_ERROR("Metal backend not yet implemented");
             return nullptr;
 
+        case RHIBackendType::Null:
+            LOG_INFO("Creating Null RHI backend (headless)");
+            return std::make_unique<NullRHI>();
+
         default:
             LOG_ERROR("Unknown RHI backend type");
             return nullptr;
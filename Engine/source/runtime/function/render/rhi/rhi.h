@@ -20,6 +20,7 @@ struct RHIBuffer
     RHIBufferUsage  usage       = RHIBufferUsage::None;
     RHIMemoryUsage  memoryUsage = RHIMemoryUsage::GpuOnly;
     void*           mappedData  = nullptr;
+    RHIBufferId     id;                     // Assigned by the backend at creation
 };
 
 struct RHITexture
@@ -34,6 +35,7 @@ struct RHITexture
     RHISampleCount      sampleCount = RHISampleCount::Count1;
     RHITextureUsage     usage       = RHITextureUsage::Sampled;
     RHIResourceState    currentState = RHIResourceState::Undefined;
+    RHITextureId        id;
 };
 
 struct RHISampler
@@ -53,6 +55,7 @@ struct RHIPipeline
     virtual ~RHIPipeline() = default;
 
     bool isCompute = false;
+    RHIPipelineId id;
 };
 
 struct RHIDescriptorSetLayout
@@ -63,6 +66,8 @@ struct RHIDescriptorSetLayout
 struct RHIDescriptorSet
 {
     virtual ~RHIDescriptorSet() = default;
+
+    RHIDescriptorSetId id;
 };
 
 struct RHICommandPool
@@ -78,6 +83,7 @@ struct RHICommandBuffer
 
     bool isRecording = false;
     bool isSecondary = false;
+    RHICommandBufferId id;
 };
 
 struct RHIFence
@@ -222,64 +228,67 @@ public:
     // Command Recording
     // ========================================================================
 
-    virtual void beginCommandBuffer(RHICommandBufferHandle cmd) = 0;
-    virtual void endCommandBuffer(RHICommandBufferHandle cmd) = 0;
+    // Objects are passed by id (handle->id): no reference counting per call. An id whose object
+    // has been destroyed resolves to nothing and the call is dropped.
+
+    virtual void beginCommandBuffer(RHICommandBufferId cmd) = 0;
+    virtual void endCommandBuffer(RHICommandBufferId cmd) = 0;
 
     // Dynamic Rendering (Vulkan 1.3+ / VK_KHR_dynamic_rendering)
-    virtual void cmdBeginRendering(RHICommandBufferHandle cmd, const RHIRenderingInfo& info) = 0;
-    virtual void cmdEndRendering(RHICommandBufferHandle cmd) = 0;
+    virtual void cmdBeginRendering(RHICommandBufferId cmd, const RHIRenderingInfo& info) = 0;
+    virtual void cmdEndRendering(RHICommandBufferId cmd) = 0;
 
     // Viewport and Scissor
-    virtual void cmdSetViewport(RHICommandBufferHandle cmd, const RHIViewport& viewport) = 0;
-    virtual void cmdSetScissor(RHICommandBufferHandle cmd, const RHIRect2D& scissor) = 0;
+    virtual void cmdSetViewport(RHICommandBufferId cmd, const RHIViewport& viewport) = 0;
+    virtual void cmdSetScissor(RHICommandBufferId cmd, const RHIRect2D& scissor) = 0;
 
     // Pipeline Binding
-    virtual void cmdBindPipeline(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline) = 0;
-    virtual void cmdBindDescriptorSets(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline,
-                                       uint32_t firstSet, std::span<const RHIDescriptorSetHandle> sets,
+    virtual void cmdBindPipeline(RHICommandBufferId cmd, RHIPipelineId pipeline) = 0;
+    virtual void cmdBindDescriptorSets(RHICommandBufferId cmd, RHIPipelineId pipeline,
+                                       uint32_t firstSet, std::span<const RHIDescriptorSetId> sets,
                                        std::span<const uint32_t> dynamicOffsets = {}) = 0;
 
     // Vertex/Index Buffers
-    virtual void cmdBindVertexBuffer(RHICommandBufferHandle cmd, uint32_t binding,
-                                     RHIBufferHandle buffer, uint64_t offset = 0) = 0;
-    virtual void cmdBindIndexBuffer(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+    virtual void cmdBindVertexBuffer(RHICommandBufferId cmd, uint32_t binding,
+                                     RHIBufferId buffer, uint64_t offset = 0) = 0;
+    virtual void cmdBindIndexBuffer(RHICommandBufferId cmd, RHIBufferId buffer,
                                     uint64_t offset = 0, bool use16Bit = false) = 0;
 
     // Draw Commands
-    virtual void cmdDraw(RHICommandBufferHandle cmd, uint32_t vertexCount, uint32_t instanceCount = 1,
+    virtual void cmdDraw(RHICommandBufferId cmd, uint32_t vertexCount, uint32_t instanceCount = 1,
                          uint32_t firstVertex = 0, uint32_t firstInstance = 0) = 0;
-    virtual void cmdDrawIndexed(RHICommandBufferHandle cmd, uint32_t indexCount, uint32_t instanceCount = 1,
+    virtual void cmdDrawIndexed(RHICommandBufferId cmd, uint32_t indexCount, uint32_t instanceCount = 1,
                                 uint32_t firstIndex = 0, int32_t vertexOffset = 0, uint32_t firstInstance = 0) = 0;
-    virtual void cmdDrawIndirect(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+    virtual void cmdDrawIndirect(RHICommandBufferId cmd, RHIBufferId buffer,
                                  uint64_t offset, uint32_t drawCount, uint32_t stride) = 0;
-    virtual void cmdDrawIndexedIndirect(RHICommandBufferHandle cmd, RHIBufferHandle buffer,
+    virtual void cmdDrawIndexedIndirect(RHICommandBufferId cmd, RHIBufferId buffer,
                                         uint64_t offset, uint32_t drawCount, uint32_t stride) = 0;
 
     // Compute Commands
-    virtual void cmdDispatch(RHICommandBufferHandle cmd, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) = 0;
-    virtual void cmdDispatchIndirect(RHICommandBufferHandle cmd, RHIBufferHandle buffer, uint64_t offset) = 0;
+    virtual void cmdDispatch(RHICommandBufferId cmd, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) = 0;
+    virtual void cmdDispatchIndirect(RHICommandBufferId cmd, RHIBufferId buffer, uint64_t offset) = 0;
 
     // Resource Barriers
-    virtual void cmdPipelineBarrier(RHICommandBufferHandle cmd,
+    virtual void cmdPipelineBarrier(RHICommandBufferId cmd,
                                     std::span<const RHIBufferBarrier> bufferBarriers,
                                     std::span<const RHITextureBarrier> textureBarriers) = 0;
 
     // Copy Commands
-    virtual void cmdCopyBuffer(RHICommandBufferHandle cmd, RHIBufferHandle src, RHIBufferHandle dst,
+    virtual void cmdCopyBuffer(RHICommandBufferId cmd, RHIBufferId src, RHIBufferId dst,
                                uint64_t srcOffset, uint64_t dstOffset, uint64_t size) = 0;
-    virtual void cmdCopyBufferToTexture(RHICommandBufferHandle cmd, RHIBufferHandle src, RHITextureHandle dst,
+    virtual void cmdCopyBufferToTexture(RHICommandBufferId cmd, RHIBufferId src, RHITextureId dst,
                                         uint64_t bufferOffset, uint32_t mipLevel = 0, uint32_t arrayLayer = 0) = 0;
-    virtual void cmdCopyTextureToBuffer(RHICommandBufferHandle cmd, RHITextureHandle src, RHIBufferHandle dst,
+    virtual void cmdCopyTextureToBuffer(RHICommandBufferId cmd, RHITextureId src, RHIBufferId dst,
                                         uint32_t mipLevel, uint32_t arrayLayer, uint64_t bufferOffset) = 0;
 
     // Push Constants
-    virtual void cmdPushConstants(RHICommandBufferHandle cmd, RHIPipelineHandle pipeline,
+    virtual void cmdPushConstants(RHICommandBufferId cmd, RHIPipelineId pipeline,
                                   RHIShaderStage stages, uint32_t offset, uint32_t size, const void* data) = 0;
 
     // Debug Markers
-    virtual void cmdBeginDebugLabel(RHICommandBufferHandle cmd, const char* label, float color[4] = nullptr) = 0;
-    virtual void cmdEndDebugLabel(RHICommandBufferHandle cmd) = 0;
-    virtual void cmdInsertDebugLabel(RHICommandBufferHandle cmd, const char* label, float color[4] = nullptr) = 0;
+    virtual void cmdBeginDebugLabel(RHICommandBufferId cmd, const char* label, float color[4] = nullptr) = 0;
+    virtual void cmdEndDebugLabel(RHICommandBufferId cmd) = 0;
+    virtual void cmdInsertDebugLabel(RHICommandBufferId cmd, const char* label, float color[4] = nullptr) = 0;
 
     // ========================================================================
     // Queue Submission
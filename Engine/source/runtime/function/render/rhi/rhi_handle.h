@@ -0,0 +1,214 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace vesper {
+
+// ============================================================================
+// Generational Handle
+// ============================================================================
+
+/// @brief 32-bit reference to an RHI object: a slot index in its backend pool and the slot's generation
+///
+/// Copying one is free, unlike the shared_ptr *Handle types that own objects. Destroying an object
+/// bumps its slot's generation, so a stale id resolves to nothing instead of to the slot's next
+/// occupant. The zero value is never issued (generations start at 1).
+template <typename T>
+class RHIHandle
+{
+public:
+    static constexpr uint32_t kIndexBits      = 20;
+    static constexpr uint32_t kGenerationBits = 32 - kIndexBits;
+    static constexpr uint32_t kIndexMask      = (1u << kIndexBits) - 1;
+    static constexpr uint32_t kGenerationMask = (1u << kGenerationBits) - 1;
+    static constexpr uint32_t kMaxIndices     = 1u << kIndexBits;
+
+    constexpr RHIHandle() = default;
+
+    static constexpr RHIHandle make(uint32_t index, uint32_t generation)
+    {
+        RHIHandle handle;
+        handle.m_value = (generation << kIndexBits) | (index & kIndexMask);
+        return handle;
+    }
+
+    static constexpr RHIHandle fromValue(uint32_t value)
+    {
+        RHIHandle handle;
+        handle.m_value = value;
+        return handle;
+    }
+
+    constexpr uint32_t index() const { return m_value & kIndexMask; }
+    constexpr uint32_t generation() const { return m_value >> kIndexBits; }
+    constexpr uint32_t value() const { return m_value; }
+
+    constexpr bool isValid() const { return m_value != 0; }
+    constexpr explicit operator bool() const { return isValid(); }
+
+    constexpr bool operator==(const RHIHandle&) const = default;
+
+private:
+    uint32_t m_value = 0;
+};
+
+struct RHIBuffer;
+struct RHITexture;
+struct RHIPipeline;
+struct RHIDescriptorSet;
+struct RHICommandBuffer;
+
+// Ids of the objects command recording refers to
+using RHIBufferId        = RHIHandle<RHIBuffer>;
+using RHITextureId       = RHIHandle<RHITexture>;
+using RHIPipelineId      = RHIHandle<RHIPipeline>;
+using RHIDescriptorSetId = RHIHandle<RHIDescriptorSet>;
+using RHICommandBufferId = RHIHandle<RHICommandBuffer>;
+
+// ============================================================================
+// Handle Pool
+// ============================================================================
+
+/// @brief Backend table resolving the ids of one object type to the backend's objects
+///
+/// Slots are dense and grow in fixed chunks that never move, so get() - the only call on the command
+/// recording path - is lock-free: a chunk load, a generation compare and a pointer load. allocate()
+/// and release() take a mutex (objects are created on worker threads too). Freed slots are reused
+/// LIFO, with their generation bumped.
+///
+/// The pool does not own objects: their shared_ptr handles do, and the backend releases the id in
+/// the object's destroy call.
+template <typename Tag, typename T>
+class RHIHandlePool
+{
+public:
+    using Handle = RHIHandle<Tag>;
+
+    RHIHandlePool() = default;
+
+    ~RHIHandlePool()
+    {
+        for (auto& chunk : m_chunks)
+        {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    VESPER_DISABLE_COPY_AND_MOVE(RHIHandlePool)
+
+    /// @brief Give an object an id (invalid when the pool is full)
+    Handle allocate(T* object)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        uint32_t index;
+        if (!m_freeIndices.empty())
+        {
+            index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+        }
+        else
+        {
+            if (m_nextIndex == Handle::kMaxIndices)
+            {
+                return {};
+            }
+            index = m_nextIndex++;
+            if ((index & kChunkMask) == 0)
+            {
+                m_chunks[index >> kChunkBits].store(new Slot[kChunkSize], std::memory_order_release);
+            }
+        }
+
+        Slot& slot = slotAt(index);
+        slot.object.store(object, std::memory_order_relaxed);
+        ++m_live;
+        return Handle::make(index, slot.generation.load(std::memory_order_relaxed));
+    }
+
+    /// @brief Retire an id: it (and any copy of it) resolves to nullptr from now on
+    /// No-op for ids that are invalid or already released.
+    void release(Handle handle)
+    {
+        if (!handle)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (handle.index() >= m_nextIndex)
+        {
+            return;
+        }
+
+        Slot& slot = slotAt(handle.index());
+        const uint32_t generation = slot.generation.load(std::memory_order_relaxed);
+        if (generation != handle.generation())
+        {
+            return;
+        }
+
+        uint32_t next = (generation + 1) & Handle::kGenerationMask;
+        slot.generation.store(next == 0 ? 1 : next, std::memory_order_relaxed);
+        slot.object.store(nullptr, std::memory_order_relaxed);
+        m_freeIndices.push_back(handle.index());
+        --m_live;
+    }
+
+    /// @brief Object of an id, or nullptr if the id is invalid or stale
+    T* get(Handle handle) const
+    {
+        const Slot* chunk = m_chunks[handle.index() >> kChunkBits].load(std::memory_order_acquire);
+        if (!chunk)
+        {
+            return nullptr;
+        }
+
+        const Slot& slot = chunk[handle.index() & kChunkMask];
+        if (slot.generation.load(std::memory_order_relaxed) != handle.generation())
+        {
+            return nullptr;
+        }
+        return slot.object.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of ids in use
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_live;
+    }
+
+private:
+    static constexpr uint32_t kChunkBits = 10;
+    static constexpr uint32_t kChunkSize = 1u << kChunkBits;
+    static constexpr uint32_t kChunkMask = kChunkSize - 1;
+    static constexpr uint32_t kMaxChunks = Handle::kMaxIndices / kChunkSize;
+
+    struct Slot
+    {
+        std::atomic<T*>       object{nullptr};
+        std::atomic<uint32_t> generation{1};
+    };
+
+    Slot& slotAt(uint32_t index)
+    {
+        return m_chunks[index >> kChunkBits].load(std::memory_order_relaxed)[index & kChunkMask];
+    }
+
+private:
+    std::array<std::atomic<Slot*>, kMaxChunks> m_chunks{};
+
+    mutable std::mutex      m_mutex;
+    std::vector<uint32_t>   m_freeIndices;
+    uint32_t                m_nextIndex = 0;
+    size_t                  m_live = 0;
+};
+
+} // namespace vesper
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "runtime/core/base/macro.h"
+#include "runtime/function/render/rhi/rhi_handle.h"
 
 #include <cstdint>
 #include <memory>
@@ -50,6 +51,9 @@ using RHISemaphoreHandle           = std::shared_ptr<RHISemaphore>;
 using RHIQueueHandle               = std::shared_ptr<RHIQueue>;
 using RHISwapChainHandle           = std::shared_ptr<RHISwapChain>;
 
+// The *Handle types own objects; command recording refers to buffers, textures, pipelines,
+// descriptor sets and command buffers by their 32-bit *Id instead (see rhi_handle.h).
+
 // ============================================================================
 // Enums
 // ============================================================================
@@ -59,6 +63,7 @@ enum class RHIBackendType : uint8_t
     Vulkan,
     D3D12,
     Metal,
+    Null,       // Headless: no device, cmd* calls are only counted (benchmarks, tests)
 };
 
 enum class RHIQueueType : uint8_t
@@ -651,11 +656,11 @@ struct RHIMultisampleState
 
 struct RHIRenderingAttachmentInfo
 {
-    RHITextureHandle    texture;
+    RHITextureId        texture;
     RHILoadOp           loadOp     = RHILoadOp::Clear;
     RHIStoreOp          storeOp    = RHIStoreOp::Store;
     RHIClearValue       clearValue;
-    RHITextureHandle    resolveTexture;  // For MSAA resolve
+    RHITextureId        resolveTexture;  // For MSAA resolve
 };
 
 struct RHIRenderingInfo
@@ -665,6 +670,11 @@ struct RHIRenderingInfo
     std::vector<RHIRenderingAttachmentInfo> colorAttachments;
     RHIRenderingAttachmentInfo*             depthAttachment   = nullptr;
     RHIRenderingAttachmentInfo*             stencilAttachment = nullptr;
+
+    // One render pass can span command buffers submitted together, in order: begin it with
+    // suspending set, then continue it in the next buffer with the same info and resuming set
+    bool                                    suspending = false;
+    bool                                    resuming   = false;
 };
 
 // ============================================================================
@@ -745,7 +755,7 @@ struct RHIComputePipelineDesc
 
 struct RHIBufferBarrier
 {
-    RHIBufferHandle     buffer;
+    RHIBufferId         buffer;
     RHIResourceState    srcState;
     RHIResourceState    dstState;
     uint64_t            offset = 0;
@@ -754,7 +764,7 @@ struct RHIBufferBarrier
 
 struct RHITextureBarrier
 {
-    RHITextureHandle    texture;
+    RHITextureId        texture;
     RHIResourceState    srcState;
     RHIResourceState    dstState;
     uint32_t            baseMipLevel   = 0;
@@ -763,6 +773,31 @@ struct RHITextureBarrier
     uint32_t            arrayLayerCount = 1;
 };
 
+// ============================================================================
+// Indirect Arguments
+// ============================================================================
+
+// Records of the buffers read by cmdDrawIndirect / cmdDrawIndexedIndirect (the layout every backend expects)
+struct RHIDrawIndirectCommand
+{
+    uint32_t    vertexCount   = 0;
+    uint32_t    instanceCount = 0;
+    uint32_t    firstVertex   = 0;
+    uint32_t    firstInstance = 0;
+};
+
+struct RHIDrawIndexedIndirectCommand
+{
+    uint32_t    indexCount    = 0;
+    uint32_t    instanceCount = 0;
+    uint32_t    firstIndex    = 0;
+    int32_t     vertexOffset  = 0;
+    uint32_t    firstInstance = 0;
+};
+
+static_assert(sizeof(RHIDrawIndirectCommand) == 16);
+static_assert(sizeof(RHIDrawIndexedIndirectCommand) == 20);
+
 // ============================================================================
 // GPU Information
 // ============================================================================
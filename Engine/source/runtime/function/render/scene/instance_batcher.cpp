@@ -0,0 +1,93 @@
+#include "runtime/function/render/scene/instance_batcher.h"
+#include "runtime/function/render/scene/render_scene.h"
+
+#include <array>
+
+namespace vesper {
+
+// =============================================================================
+// Batching
+// =============================================================================
+
+void InstanceBatcher::build(const RenderScene& scene)
+{
+    const std::vector<uint32_t>& visibleSlots = scene.visibleSlots();
+
+    m_entries.resize(visibleSlots.size());
+    for (size_t i = 0; i < visibleSlots.size(); ++i)
+    {
+        const RenderObjectDesc& desc = scene.instance(visibleSlots[i]);
+        const uint64_t key = makeKey(desc.material_id, desc.mesh_id);
+        m_entries[i] = (key << 32) | visibleSlots[i];
+    }
+
+    sortEntries();
+
+    m_sortedSlots.resize(m_entries.size());
+    m_batches.clear();
+    for (size_t i = 0; i < m_entries.size(); ++i)
+    {
+        const uint32_t key = static_cast<uint32_t>(m_entries[i] >> 32);
+        m_sortedSlots[i] = static_cast<uint32_t>(m_entries[i]);
+
+        if (m_batches.empty() || m_batches.back().key != key)
+        {
+            InstanceBatch batch;
+            batch.key           = key;
+            batch.materialId    = static_cast<uint16_t>(key >> 16);
+            batch.meshId        = static_cast<uint16_t>(key);
+            batch.firstInstance = static_cast<uint32_t>(i);
+            m_batches.push_back(batch);
+        }
+        ++m_batches.back().instanceCount;
+    }
+}
+
+// =============================================================================
+// Private Methods
+// =============================================================================
+
+void InstanceBatcher::sortEntries()
+{
+    if (m_entries.size() <= 1)
+    {
+        return;
+    }
+
+    // Digits every key shares do not reorder anything
+    const uint64_t first = m_entries[0];
+    uint64_t differing = 0;
+    for (const uint64_t entry : m_entries)
+    {
+        differing |= (entry ^ first);
+    }
+
+    m_scratch.resize(m_entries.size());
+    for (uint32_t shift = 32; shift < 64; shift += 8)
+    {
+        if (((differing >> shift) & 0xFF) == 0)
+        {
+            continue;
+        }
+
+        std::array<size_t, 256> offsets{};
+        for (const uint64_t entry : m_entries)
+        {
+            ++offsets[(entry >> shift) & 0xFF];
+        }
+        size_t sum = 0;
+        for (size_t& offset : offsets)
+        {
+            const size_t count = offset;
+            offset = sum;
+            sum += count;
+        }
+        for (const uint64_t entry : m_entries)
+        {
+            m_scratch[offsets[(entry >> shift) & 0xFF]++] = entry;
+        }
+        m_entries.swap(m_scratch);
+    }
+}
+
+} // namespace vesper
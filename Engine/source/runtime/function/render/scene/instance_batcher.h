@@ -0,0 +1,70 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vesper {
+
+class RenderScene;
+
+/// @brief Visible instances sharing a material and a mesh: one indirect draw
+struct InstanceBatch
+{
+    uint32_t key           = 0;
+    uint16_t materialId    = 0;
+    uint16_t meshId        = 0;
+    uint32_t firstInstance = 0;   // Offset of the batch's slots in InstanceBatcher::instanceSlots()
+    uint32_t instanceCount = 0;
+};
+
+/// @brief Groups a RenderScene's visible instances into batches for instanced indirect drawing
+///
+/// build() sorts the visible slots by batch key with a stable LSD radix sort (8-bit digits; digits
+/// every key shares are skipped, so a scene with a handful of meshes costs one or two passes), then
+/// cuts the sorted list into runs of equal keys. Within a batch, slots keep their visible-list order.
+///
+/// The key orders by material, then mesh. Materials will select their pipeline, so sorting by
+/// material first also groups pipelines; until then every batch is drawn with the instanced pipeline.
+class InstanceBatcher
+{
+public:
+    InstanceBatcher() = default;
+
+    VESPER_DISABLE_COPY(InstanceBatcher)
+
+    /// @brief Sort key of an instance: material in the high bits, mesh in the low bits
+    static constexpr uint32_t makeKey(uint16_t materialId, uint16_t meshId)
+    {
+        return (static_cast<uint32_t>(materialId) << 16) | meshId;
+    }
+
+    /// @brief Batch the scene's current visible list
+    void build(const RenderScene& scene);
+
+    /// @brief Visible slots grouped by batch, in batch order
+    std::span<const uint32_t> instanceSlots() const { return m_sortedSlots; }
+
+    /// @brief Batches of the last build(), in key order
+    std::span<const InstanceBatch> batches() const { return m_batches; }
+
+    size_t instanceCount() const { return m_sortedSlots.size(); }
+    size_t batchCount() const { return m_batches.size(); }
+
+private:
+    /// @brief Stable radix sort of m_entries by their key (the high 32 bits)
+    void sortEntries();
+
+private:
+    // (key << 32) | slot, per visible instance, and the sort's scratch buffer
+    std::vector<uint64_t> m_entries;
+    std::vector<uint64_t> m_scratch;
+
+    std::vector<uint32_t>      m_sortedSlots;
+    std::vector<InstanceBatch> m_batches;
+};
+
+} // namespace vesper
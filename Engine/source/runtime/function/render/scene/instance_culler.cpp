@@ -0,0 +1,416 @@
+#include "runtime/function/render/scene/instance_culler.h"
+#include "runtime/function/render/rhi/rhi.h"
+#include "runtime/function/framework/ecs/systems/frustum.h"
+#include "runtime/core/log/log_system.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace vesper {
+
+namespace
+{
+    /// @brief CullParams of instance_cull.comp.slang (std140)
+    struct CullParams
+    {
+        float    frustumPlanes[Frustum::kPlaneCount][4];
+        float    previousViewProjection[16];
+        uint32_t candidateCount = 0;
+        uint32_t hizLevelCount  = 0;
+        float    depthSize[2]   = {};
+        HiZLevel hizLevels[InstanceCuller::kMaxHiZLevels];
+    };
+    static_assert(sizeof(CullParams) == 432, "CullParams must match the std140 layout of the shader");
+
+    /// @brief PushConstants of hiz_build.comp.slang
+    struct HiZBuildConstants
+    {
+        uint32_t source[4];       // Size, offset, 1 if the source is the depth buffer
+        uint32_t destination[4];  // Size, offset
+    };
+
+    RHIShaderHandle createComputeShader(RHI& rhi, std::span<const uint8_t> code, const char* debugName)
+    {
+        RHIShaderDesc desc{};
+        desc.code       = code.data();
+        desc.codeSize   = code.size();
+        desc.stage      = RHIShaderStage::Compute;
+        desc.entryPoint = "main";  // Slang compiles all entry points to "main" in SPIR-V
+        desc.debugName  = debugName;
+        return rhi.createShader(desc);
+    }
+}
+
+InstanceCuller::~InstanceCuller()
+{
+    shutdown();
+}
+
+// =============================================================================
+// Lifecycle
+// =============================================================================
+
+bool InstanceCuller::initialize(RHI* rhi, std::span<const uint8_t> hizBuildCode, std::span<const uint8_t> cullCode,
+                                uint32_t framesInFlight)
+{
+    m_rhi = rhi;
+    if (!createPipelines(hizBuildCode, cullCode))
+    {
+        shutdown();
+        return false;
+    }
+
+    m_frames.resize(framesInFlight);
+    for (FrameState& frame : m_frames)
+    {
+        RHIBufferDesc paramsDesc{};
+        paramsDesc.size        = sizeof(CullParams);
+        paramsDesc.usage       = RHIBufferUsage::Uniform;
+        paramsDesc.memoryUsage = RHIMemoryUsage::CpuToGpu;
+        paramsDesc.debugName   = "InstanceCullParams";
+        frame.paramsBuffer = m_rhi->createBuffer(paramsDesc);
+        frame.set = m_rhi->createDescriptorSet(m_cullSetLayout);
+        if (!frame.paramsBuffer || !frame.set)
+        {
+            LOG_ERROR("InstanceCuller: Failed to create frame resources");
+            shutdown();
+            return false;
+        }
+    }
+
+    m_pyramidSet  = m_rhi->createDescriptorSet(m_pyramidSetLayout);
+    m_hizBuildSet = m_rhi->createDescriptorSet(m_hizBuildSetLayout);
+    if (!m_pyramidSet || !m_hizBuildSet)
+    {
+        LOG_ERROR("InstanceCuller: Failed to create pyramid descriptor sets");
+        shutdown();
+        return false;
+    }
+
+    return true;
+}
+
+void InstanceCuller::shutdown()
+{
+    if (!m_rhi)
+    {
+        return;
+    }
+
+    destroyPyramid();
+    if (m_hizBuildSet)
+    {
+        m_rhi->destroyDescriptorSet(m_hizBuildSet);
+        m_hizBuildSet = nullptr;
+    }
+    if (m_pyramidSet)
+    {
+        m_rhi->destroyDescriptorSet(m_pyramidSet);
+        m_pyramidSet = nullptr;
+    }
+
+    for (FrameState& frame : m_frames)
+    {
+        if (frame.set)
+        {
+            m_rhi->destroyDescriptorSet(frame.set);
+        }
+        if (frame.paramsBuffer)
+        {
+            m_rhi->destroyBuffer(frame.paramsBuffer);
+        }
+    }
+    m_frames.clear();
+
+    for (RHIPipelineHandle* pipeline : {&m_cullPipeline, &m_hizBuildPipeline})
+    {
+        if (*pipeline)
+        {
+            m_rhi->destroyPipeline(*pipeline);
+            *pipeline = nullptr;
+        }
+    }
+    for (RHIDescriptorSetLayoutHandle* layout : {&m_pyramidSetLayout, &m_cullSetLayout, &m_hizBuildSetLayout})
+    {
+        if (*layout)
+        {
+            m_rhi->destroyDescriptorSetLayout(*layout);
+            *layout = nullptr;
+        }
+    }
+    for (RHIShaderHandle* shader : {&m_cullShader, &m_hizBuildShader})
+    {
+        if (*shader)
+        {
+            m_rhi->destroyShader(*shader);
+            *shader = nullptr;
+        }
+    }
+
+    m_depthTexture = nullptr;
+    m_hasHistory   = false;
+    m_rhi          = nullptr;
+}
+
+bool InstanceCuller::resize(RHITextureHandle depthTexture, uint32_t width, uint32_t height)
+{
+    destroyPyramid();
+    m_hasHistory = false;
+
+    m_depthTexture = depthTexture;
+    m_depthWidth   = width;
+    m_depthHeight  = height;
+
+    // Level 0 halves the depth buffer (sizes round up), down to 1x1
+    uint32_t levelWidth  = width;
+    uint32_t levelHeight = height;
+    uint32_t offset      = 0;
+    while ((levelWidth > 1 || levelHeight > 1) && m_hizLevels.size() < kMaxHiZLevels)
+    {
+        levelWidth  = (levelWidth + 1) / 2;
+        levelHeight = (levelHeight + 1) / 2;
+
+        HiZLevel level;
+        level.width  = levelWidth;
+        level.height = levelHeight;
+        level.offset = offset;
+        m_hizLevels.push_back(level);
+        offset += levelWidth * levelHeight;
+    }
+    if (m_hizLevels.empty())
+    {
+        return true;
+    }
+
+    RHIBufferDesc pyramidDesc{};
+    pyramidDesc.size        = sizeof(float) * offset;
+    pyramidDesc.usage       = RHIBufferUsage::Storage;
+    pyramidDesc.memoryUsage = RHIMemoryUsage::GpuOnly;
+    pyramidDesc.debugName   = "HiZPyramid";
+    m_hizPyramid = m_rhi->createBuffer(pyramidDesc);
+    if (!m_hizPyramid)
+    {
+        LOG_ERROR("InstanceCuller: Failed to create the HiZ pyramid ({}x{})", width, height);
+        m_hizLevels.clear();
+        return false;
+    }
+
+    RHIDescriptorWrite buildWrites[2] = {};
+    buildWrites[0].binding = 0;
+    buildWrites[0].type    = RHIDescriptorType::SampledImage;
+    buildWrites[0].texture = m_depthTexture;
+    buildWrites[1].binding = 1;
+    buildWrites[1].type    = RHIDescriptorType::StorageBuffer;
+    buildWrites[1].buffer  = m_hizPyramid;
+    m_rhi->updateDescriptorSet(m_hizBuildSet, buildWrites);
+
+    RHIDescriptorWrite pyramidWrite{};
+    pyramidWrite.binding = 0;
+    pyramidWrite.type    = RHIDescriptorType::StorageBuffer;
+    pyramidWrite.buffer  = m_hizPyramid;
+    m_rhi->updateDescriptorSet(m_pyramidSet, std::span(&pyramidWrite, 1));
+    return true;
+}
+
+void InstanceCuller::bindFrameBuffers(uint32_t frameIndex, const InstanceCullBuffers& buffers)
+{
+    FrameState& frame = m_frames[frameIndex];
+    frame.instanceSlots = buffers.instanceSlots->id;
+    frame.drawCommands  = buffers.drawCommands->id;
+
+    RHIDescriptorWrite writes[5] = {};
+    const RHIBufferHandle storageBuffers[4] = {buffers.instances, buffers.candidates,
+                                               buffers.instanceSlots, buffers.drawCommands};
+    for (uint32_t binding = 0; binding < 4; ++binding)
+    {
+        writes[binding].binding = binding;
+        writes[binding].type    = RHIDescriptorType::StorageBuffer;
+        writes[binding].buffer  = storageBuffers[binding];
+    }
+    writes[4].binding = 4;
+    writes[4].type    = RHIDescriptorType::UniformBuffer;
+    writes[4].buffer  = frame.paramsBuffer;
+    m_rhi->updateDescriptorSet(frame.set, writes);
+}
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+void InstanceCuller::recordCull(RHICommandBufferId cmd, uint32_t frameIndex, const Matrix4x4& viewProjection,
+                                uint32_t candidateCount)
+{
+    FrameState& frame = m_frames[frameIndex];
+    if (candidateCount == 0 || !frame.drawCommands)
+    {
+        return;
+    }
+
+    const bool occlusion = m_hasHistory && m_hizPyramid;
+    if (occlusion)
+    {
+        recordPyramidBuild(cmd);
+    }
+
+    // Parameters: the frame's buffer is free again once its fence has been waited on
+    CullParams params{};
+    Frustum frustum;
+    frustum.extractFromViewProjection(viewProjection);
+    for (int i = 0; i < Frustum::kPlaneCount; ++i)
+    {
+        params.frustumPlanes[i][0] = frustum.planes[i].normal.x;
+        params.frustumPlanes[i][1] = frustum.planes[i].normal.y;
+        params.frustumPlanes[i][2] = frustum.planes[i].normal.z;
+        params.frustumPlanes[i][3] = frustum.planes[i].distance;
+    }
+    std::memcpy(params.previousViewProjection, m_historyViewProjection.m, sizeof(params.previousViewProjection));
+    params.candidateCount = candidateCount;
+    params.hizLevelCount  = occlusion ? static_cast<uint32_t>(m_hizLevels.size()) : 0;
+    params.depthSize[0]   = static_cast<float>(m_depthWidth);
+    params.depthSize[1]   = static_cast<float>(m_depthHeight);
+    std::copy(m_hizLevels.begin(), m_hizLevels.end(), params.hizLevels);
+    std::memcpy(m_rhi->mapBuffer(frame.paramsBuffer), &params, sizeof(params));
+
+    m_rhi->cmdBindPipeline(cmd, m_cullPipeline->id);
+    const RHIDescriptorSetId sets[2] = {frame.set->id, m_pyramidSet->id};
+    m_rhi->cmdBindDescriptorSets(cmd, m_cullPipeline->id, 0, sets);
+    m_rhi->cmdDispatch(cmd, (candidateCount + kCullGroupSize - 1) / kCullGroupSize, 1, 1);
+
+    // The draws read what the cull wrote
+    RHIBufferBarrier barriers[2] = {};
+    barriers[0].buffer   = frame.drawCommands;
+    barriers[0].srcState = RHIResourceState::UnorderedAccess;
+    barriers[0].dstState = RHIResourceState::IndirectArgument;
+    barriers[1].buffer   = frame.instanceSlots;
+    barriers[1].srcState = RHIResourceState::UnorderedAccess;
+    barriers[1].dstState = RHIResourceState::ShaderResource;
+    m_rhi->cmdPipelineBarrier(cmd, barriers, {});
+
+    m_historyViewProjection = viewProjection;
+    m_hasHistory = true;
+}
+
+// =============================================================================
+// Private Methods
+// =============================================================================
+
+bool InstanceCuller::createPipelines(std::span<const uint8_t> hizBuildCode, std::span<const uint8_t> cullCode)
+{
+    m_hizBuildShader = createComputeShader(*m_rhi, hizBuildCode, "HiZBuildShader");
+    m_cullShader     = createComputeShader(*m_rhi, cullCode, "InstanceCullShader");
+    if (!m_hizBuildShader || !m_cullShader)
+    {
+        LOG_ERROR("InstanceCuller: Failed to create compute shaders");
+        return false;
+    }
+
+    // Pyramid build: binding 0 the depth buffer, binding 1 the pyramid
+    RHIDescriptorSetLayoutDesc buildLayoutDesc{};
+    buildLayoutDesc.bindings.push_back({0, RHIDescriptorType::SampledImage, 1, RHIShaderStage::Compute});
+    buildLayoutDesc.bindings.push_back({1, RHIDescriptorType::StorageBuffer, 1, RHIShaderStage::Compute});
+    m_hizBuildSetLayout = m_rhi->createDescriptorSetLayout(buildLayoutDesc);
+
+    // Cull set 0: instances, candidates, slots, draw commands, parameters; set 1: the pyramid
+    RHIDescriptorSetLayoutDesc cullLayoutDesc{};
+    for (uint32_t binding = 0; binding < 4; ++binding)
+    {
+        cullLayoutDesc.bindings.push_back({binding, RHIDescriptorType::StorageBuffer, 1, RHIShaderStage::Compute});
+    }
+    cullLayoutDesc.bindings.push_back({4, RHIDescriptorType::UniformBuffer, 1, RHIShaderStage::Compute});
+    m_cullSetLayout = m_rhi->createDescriptorSetLayout(cullLayoutDesc);
+
+    RHIDescriptorSetLayoutDesc pyramidLayoutDesc{};
+    pyramidLayoutDesc.bindings.push_back({0, RHIDescriptorType::StorageBuffer, 1, RHIShaderStage::Compute});
+    m_pyramidSetLayout = m_rhi->createDescriptorSetLayout(pyramidLayoutDesc);
+
+    if (!m_hizBuildSetLayout || !m_cullSetLayout || !m_pyramidSetLayout)
+    {
+        LOG_ERROR("InstanceCuller: Failed to create descriptor set layouts");
+        return false;
+    }
+
+    RHIComputePipelineDesc buildDesc{};
+    buildDesc.shader = m_hizBuildShader;
+    buildDesc.descriptorLayouts.push_back(m_hizBuildSetLayout);
+    buildDesc.pushConstantRanges.push_back({RHIShaderStage::Compute, 0, sizeof(HiZBuildConstants)});
+    buildDesc.debugName = "HiZBuildPipeline";
+    m_hizBuildPipeline = m_rhi->createComputePipeline(buildDesc);
+
+    RHIComputePipelineDesc cullDesc{};
+    cullDesc.shader = m_cullShader;
+    cullDesc.descriptorLayouts.push_back(m_cullSetLayout);
+    cullDesc.descriptorLayouts.push_back(m_pyramidSetLayout);
+    cullDesc.debugName = "InstanceCullPipeline";
+    m_cullPipeline = m_rhi->createComputePipeline(cullDesc);
+
+    if (!m_hizBuildPipeline || !m_cullPipeline)
+    {
+        LOG_ERROR("InstanceCuller: Failed to create compute pipelines");
+        return false;
+    }
+
+    return true;
+}
+
+void InstanceCuller::recordPyramidBuild(RHICommandBufferId cmd)
+{
+    // The previous frame's depth becomes readable; the pyramid was last read by the previous cull
+    RHITextureBarrier depthBarrier{};
+    depthBarrier.texture  = m_depthTexture->id;
+    depthBarrier.srcState = m_depthTexture->currentState;
+    depthBarrier.dstState = RHIResourceState::ShaderResource;
+
+    RHIBufferBarrier pyramidBarrier{};
+    pyramidBarrier.buffer   = m_hizPyramid->id;
+    pyramidBarrier.srcState = RHIResourceState::ShaderResource;
+    pyramidBarrier.dstState = RHIResourceState::UnorderedAccess;
+    m_rhi->cmdPipelineBarrier(cmd, std::span(&pyramidBarrier, 1), std::span(&depthBarrier, 1));
+
+    m_rhi->cmdBindPipeline(cmd, m_hizBuildPipeline->id);
+    const RHIDescriptorSetId buildSet = m_hizBuildSet->id;
+    m_rhi->cmdBindDescriptorSets(cmd, m_hizBuildPipeline->id, 0, std::span(&buildSet, 1));
+
+    // One dispatch per level, each reading the one before it
+    for (size_t i = 0; i < m_hizLevels.size(); ++i)
+    {
+        const HiZLevel& level = m_hizLevels[i];
+        HiZBuildConstants constants{};
+        if (i == 0)
+        {
+            constants.source[0] = m_depthWidth;
+            constants.source[1] = m_depthHeight;
+            constants.source[3] = 1;
+        }
+        else
+        {
+            constants.source[0] = m_hizLevels[i - 1].width;
+            constants.source[1] = m_hizLevels[i - 1].height;
+            constants.source[2] = m_hizLevels[i - 1].offset;
+        }
+        constants.destination[0] = level.width;
+        constants.destination[1] = level.height;
+        constants.destination[2] = level.offset;
+
+        m_rhi->cmdPushConstants(cmd, m_hizBuildPipeline->id, RHIShaderStage::Compute,
+                                0, sizeof(constants), &constants);
+        m_rhi->cmdDispatch(cmd, (level.width + kHiZBuildGroupSize - 1) / kHiZBuildGroupSize,
+                           (level.height + kHiZBuildGroupSize - 1) / kHiZBuildGroupSize, 1);
+
+        pyramidBarrier.srcState = RHIResourceState::UnorderedAccess;
+        pyramidBarrier.dstState = i + 1 < m_hizLevels.size() ? RHIResourceState::UnorderedAccess
+                                                             : RHIResourceState::ShaderResource;
+        m_rhi->cmdPipelineBarrier(cmd, std::span(&pyramidBarrier, 1), {});
+    }
+}
+
+void InstanceCuller::destroyPyramid()
+{
+    if (m_hizPyramid)
+    {
+        m_rhi->destroyBuffer(m_hizPyramid);
+        m_hizPyramid = nullptr;
+    }
+    m_hizLevels.clear();
+}
+
+} // namespace vesper
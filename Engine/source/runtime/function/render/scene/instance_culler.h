@@ -0,0 +1,142 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+#include "runtime/core/math/matrix4x4.h"
+#include "runtime/function/render/render_swap_context.h"
+#include "runtime/function/render/rhi/rhi_types.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace vesper {
+
+class RHI;
+
+/// @brief Instance data per RenderScene slot, as the scene shaders read it (InstanceData)
+struct SceneInstanceData
+{
+    float transform[kAffineMatrixFloats];  // RenderObjectDesc::transform
+    float boundingSphere[4];               // World-space center and radius
+};
+
+/// @brief A visible instance to cull and the batch (indirect draw) it is drawn by
+struct InstanceCullCandidate
+{
+    uint32_t slot  = 0;
+    uint32_t batch = 0;
+};
+
+/// @brief Buffers of a frame the cull reads and writes
+struct InstanceCullBuffers
+{
+    RHIBufferHandle instances;      // SceneInstanceData per RenderScene slot
+    RHIBufferHandle candidates;     // InstanceCullCandidate per visible instance
+    RHIBufferHandle instanceSlots;  // Written: the surviving slots, at their batch's firstInstance
+    RHIBufferHandle drawCommands;   // RHIDrawIndexedIndirectCommand per batch, instanceCount = 0 on input
+};
+
+/// @brief One level of the hierarchical-Z pyramid
+struct HiZLevel
+{
+    uint32_t width   = 0;
+    uint32_t height  = 0;
+    uint32_t offset  = 0;  // In floats, into the pyramid buffer
+    uint32_t padding = 0;
+};
+
+/// @brief Culls instance bounding spheres on the GPU and compacts the survivors into indirect draws
+///
+/// recordCull() records two compute passes before the frame's main pass:
+///  1. The hierarchical-Z pyramid is rebuilt from the depth buffer, which still holds the previous
+///     frame: each level keeps the farthest depth of 2x2 texels of the level below, level 0 halving
+///     the depth buffer. All levels live in one storage buffer, which needs no per-mip views.
+///  2. One thread per candidate tests its sphere against the frustum, then projects it with the
+///     previous frame's view-projection and compares its nearest depth with the pyramid level where
+///     it covers at most 2x2 texels. A survivor increments its batch's instanceCount in the indirect
+///     buffer and writes its slot at firstInstance + the count it got: the indirect commands serve as
+///     the per-batch count buffer, and the draws need no count readback or drawCount change.
+///
+/// Occlusion culling needs depth history: on the first frame, after resize() or invalidateHistory(),
+/// only the frustum test runs. Survivors are written in no particular order within a batch.
+class InstanceCuller
+{
+public:
+    static constexpr uint32_t kMaxHiZLevels      = 16;
+    static constexpr uint32_t kCullGroupSize     = 64;  // numthreads of instance_cull.comp.slang
+    static constexpr uint32_t kHiZBuildGroupSize = 8;   // numthreads (x and y) of hiz_build.comp.slang
+
+    InstanceCuller() = default;
+    ~InstanceCuller();
+
+    VESPER_DISABLE_COPY_AND_MOVE(InstanceCuller)
+
+    /// @brief Create the compute pipelines and each frame's parameter buffer and descriptor set
+    /// @param hizBuildCode SPIR-V of hiz_build.comp.slang
+    /// @param cullCode SPIR-V of instance_cull.comp.slang
+    bool initialize(RHI* rhi, std::span<const uint8_t> hizBuildCode, std::span<const uint8_t> cullCode,
+                    uint32_t framesInFlight);
+    void shutdown();
+
+    bool isInitialized() const { return m_rhi != nullptr; }
+
+    /// @brief (Re)create the pyramid for a depth buffer (Sampled usage) and drop the depth history
+    bool resize(RHITextureHandle depthTexture, uint32_t width, uint32_t height);
+
+    /// @brief Point a frame's descriptor set at its buffers (call again when any is recreated)
+    void bindFrameBuffers(uint32_t frameIndex, const InstanceCullBuffers& buffers);
+
+    /// @brief Record the pyramid build and the cull of candidateCount candidates
+    /// The depth buffer is left in ShaderResource when the pyramid was built; the draw commands are
+    /// ready for the indirect draws and the slots for the vertex shader. The frame is expected to
+    /// render its depth with viewProjection: the next frame occlusion culls against it.
+    void recordCull(RHICommandBufferId cmd, uint32_t frameIndex, const Matrix4x4& viewProjection,
+                    uint32_t candidateCount);
+
+    /// @brief The depth buffer does not hold what the last cull was followed by
+    void invalidateHistory() { m_hasHistory = false; }
+
+    bool hasHistory() const { return m_hasHistory; }
+    std::span<const HiZLevel> hizLevels() const { return m_hizLevels; }
+    RHIBufferHandle hizPyramid() const { return m_hizPyramid; }
+
+private:
+    struct FrameState
+    {
+        RHIBufferHandle        paramsBuffer;
+        RHIDescriptorSetHandle set;
+        RHIBufferId            instanceSlots;
+        RHIBufferId            drawCommands;
+    };
+
+    bool createPipelines(std::span<const uint8_t> hizBuildCode, std::span<const uint8_t> cullCode);
+    void recordPyramidBuild(RHICommandBufferId cmd);
+    void destroyPyramid();
+
+private:
+    RHI* m_rhi = nullptr;
+
+    RHIShaderHandle              m_hizBuildShader;
+    RHIShaderHandle              m_cullShader;
+    RHIDescriptorSetLayoutHandle m_hizBuildSetLayout;  // Depth buffer + pyramid (written)
+    RHIDescriptorSetLayoutHandle m_cullSetLayout;      // A frame's buffers and parameters
+    RHIDescriptorSetLayoutHandle m_pyramidSetLayout;   // Pyramid (read)
+    RHIPipelineHandle            m_hizBuildPipeline;
+    RHIPipelineHandle            m_cullPipeline;
+
+    std::vector<FrameState> m_frames;
+
+    RHITextureHandle        m_depthTexture;
+    uint32_t                m_depthWidth  = 0;
+    uint32_t                m_depthHeight = 0;
+    std::vector<HiZLevel>   m_hizLevels;
+    RHIBufferHandle         m_hizPyramid;
+    RHIDescriptorSetHandle  m_hizBuildSet;
+    RHIDescriptorSetHandle  m_pyramidSet;
+
+    // View-projection the depth buffer was last rendered with, valid when m_hasHistory
+    Matrix4x4 m_historyViewProjection;
+    bool      m_hasHistory = false;
+};
+
+} // namespace vesper
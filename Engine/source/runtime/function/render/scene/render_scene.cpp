@@ -0,0 +1,169 @@
+#include "runtime/function/render/scene/render_scene.h"
+#include "runtime/function/render/render_packet.h"
+#include "runtime/function/framework/ecs/ecs_types.h"
+
+#include <cstring>
+
+namespace vesper {
+
+// =============================================================================
+// Packet Consumption
+// =============================================================================
+
+void RenderScene::applyPacket(const RenderPacket& packet)
+{
+    for (const RenderObjectDesc& desc : packet.objectsToAdd)
+    {
+        upsert(desc);
+    }
+    for (const RenderObjectDesc& desc : packet.objectsToUpdate)
+    {
+        upsert(desc);
+    }
+    for (const uint32_t objectId : packet.objectsToDelete)
+    {
+        remove(objectId);
+    }
+
+    m_visibleSlots.clear();
+    m_missingInstances = 0;
+
+    if (packet.format == RenderPacketFormat::Instanced)
+    {
+        m_visibleSlots.reserve(packet.visibleInstances.size());
+        for (const uint32_t objectId : packet.visibleInstances)
+        {
+            const uint32_t slot = slotOf(objectId);
+            if (slot == kInvalidSlot)
+            {
+                ++m_missingInstances;
+                continue;
+            }
+            m_visibleSlots.push_back(slot);
+        }
+        return;
+    }
+
+    // Full descriptors double as upserts: unchanged ones leave their slot clean
+    m_visibleSlots.reserve(packet.visibleObjects.size());
+    for (const RenderObjectDesc& desc : packet.visibleObjects)
+    {
+        m_visibleSlots.push_back(upsert(desc));
+    }
+}
+
+// =============================================================================
+// Instances
+// =============================================================================
+
+uint32_t RenderScene::upsert(const RenderObjectDesc& desc)
+{
+    const uint32_t index = indexOf(desc.object_id);
+    uint32_t slot = index < m_slotOfIndex.size() ? m_slotOfIndex[index] : kInvalidSlot;
+    if (slot != kInvalidSlot)
+    {
+        // Same object, or an older version of its entity index: that entity is destroyed (its
+        // delete may come later in the packet, after the upserts), so the new object takes its slot
+        if (std::memcmp(&m_instances[slot], &desc, sizeof(RenderObjectDesc)) != 0)
+        {
+            m_instances[slot] = desc;
+            markDirty(slot);
+        }
+        return slot;
+    }
+
+    if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        m_instances[slot] = desc;
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(m_instances.size());
+        m_instances.push_back(desc);
+        m_slotDirty.push_back(0);
+    }
+    markDirty(slot);
+
+    if (index >= m_slotOfIndex.size())
+    {
+        m_slotOfIndex.resize(static_cast<size_t>(index) + 1, kInvalidSlot);
+    }
+    m_slotOfIndex[index] = slot;
+    return slot;
+}
+
+void RenderScene::remove(uint32_t objectId)
+{
+    const uint32_t slot = slotOf(objectId);
+    if (slot == kInvalidSlot)
+    {
+        return;
+    }
+
+    // The slot keeps its place (and stays out of every visible list) until an add reuses it
+    m_instances[slot].object_id = kInvalidObjectId;
+    m_slotOfIndex[indexOf(objectId)] = kInvalidSlot;
+    m_freeSlots.push_back(slot);
+}
+
+void RenderScene::clear()
+{
+    m_instances.clear();
+    m_slotDirty.clear();
+    m_freeSlots.clear();
+    m_dirtySlots.clear();
+    m_visibleSlots.clear();
+    m_missingInstances = 0;
+    m_slotOfIndex.clear();
+}
+
+uint32_t RenderScene::slotOf(uint32_t objectId) const
+{
+    const uint32_t index = indexOf(objectId);
+    if (index >= m_slotOfIndex.size())
+    {
+        return kInvalidSlot;
+    }
+
+    const uint32_t slot = m_slotOfIndex[index];
+    if (slot == kInvalidSlot || m_instances[slot].object_id != objectId)
+    {
+        return kInvalidSlot;
+    }
+    return slot;
+}
+
+// =============================================================================
+// Per-Frame Output
+// =============================================================================
+
+void RenderScene::clearDirty()
+{
+    for (const uint32_t slot : m_dirtySlots)
+    {
+        m_slotDirty[slot] = 0;
+    }
+    m_dirtySlots.clear();
+}
+
+// =============================================================================
+// Private Methods
+// =============================================================================
+
+uint32_t RenderScene::indexOf(uint32_t objectId)
+{
+    return static_cast<uint32_t>(entt::to_entity(idToEntity(objectId)));
+}
+
+void RenderScene::markDirty(uint32_t slot)
+{
+    if (!m_slotDirty[slot])
+    {
+        m_slotDirty[slot] = 1;
+        m_dirtySlots.push_back(slot);
+    }
+}
+
+} // namespace vesper
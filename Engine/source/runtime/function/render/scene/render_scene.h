@@ -0,0 +1,120 @@
+#pragma once
+
+#include "runtime/core/base/macro.h"
+#include "runtime/function/render/render_swap_context.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vesper {
+
+struct RenderPacket;
+
+/// @brief Render-thread mirror of the logic scene's render objects, maintained from packet deltas
+///
+/// Instances live in dense slots, one RenderObjectDesc each, that do not move while their object
+/// lives: removing an object pushes its slot on a free-list and the next new object takes it. A GPU
+/// instance buffer indexed by slot therefore only needs the slots written since its last upload
+/// (dirtySlots()). An upsert carrying the bytes a slot already holds is not marked dirty, so Full
+/// packets, which resend every visible object each frame, only cost an upload for what changed.
+///
+/// applyPacket() also resolves the packet's visible list (instance ids or full descriptors) to
+/// slots, which the draw loop walks linearly (visibleSlots()).
+///
+/// Object ids are entity ids (RenderBridgeSystem): the id -> slot lookup is a flat array indexed by
+/// the entity index, checked against the stored id since indices are recycled. An upsert for a new
+/// version of an index takes the slot of the old (necessarily destroyed) one in place.
+class RenderScene
+{
+public:
+    static constexpr uint32_t kInvalidSlot = UINT32_MAX;
+
+    RenderScene() = default;
+
+    VESPER_DISABLE_COPY(RenderScene)
+
+    RenderScene(RenderScene&&) = default;
+    RenderScene& operator=(RenderScene&&) = default;
+
+    // =========================================================================
+    // Packet Consumption
+    // =========================================================================
+
+    /// @brief Apply a packet's object deltas, then take its visible list
+    /// Upserts (adds, then updates) are applied before deletes, so a packet carrying over the
+    /// deltas of a skipped one (RenderPacketBuffer, LatestOnly) replays them in a valid order.
+    void applyPacket(const RenderPacket& packet);
+
+    // =========================================================================
+    // Instances
+    // =========================================================================
+
+    /// @brief Insert or overwrite an object's instance
+    /// @return The object's slot
+    uint32_t upsert(const RenderObjectDesc& desc);
+
+    /// @brief Remove an object's instance (no-op if it has none)
+    void remove(uint32_t objectId);
+
+    /// @brief Remove every instance and forget the visible list
+    void clear();
+
+    /// @brief Slot of an object, or kInvalidSlot
+    uint32_t slotOf(uint32_t objectId) const;
+
+    /// @brief Check if an object has an instance
+    bool contains(uint32_t objectId) const { return slotOf(objectId) != kInvalidSlot; }
+
+    /// @brief Number of live instances
+    size_t size() const { return m_instances.size() - m_freeSlots.size(); }
+
+    /// @brief Number of slots, free ones included (the size of a buffer mirroring them)
+    size_t slotCount() const { return m_instances.size(); }
+
+    /// @brief Instance in a slot
+    const RenderObjectDesc& instance(uint32_t slot) const { return m_instances[slot]; }
+
+    /// @brief Every slot; free slots hold kInvalidObjectId
+    const std::vector<RenderObjectDesc>& instances() const { return m_instances; }
+
+    // =========================================================================
+    // Per-Frame Output
+    // =========================================================================
+
+    /// @brief Slots of the last applied packet's visible objects, in packet order
+    const std::vector<uint32_t>& visibleSlots() const { return m_visibleSlots; }
+
+    /// @brief Visible ids of the last applied packet that had no instance (their deltas never arrived)
+    size_t missingInstances() const { return m_missingInstances; }
+
+    /// @brief Slots written since the last clearDirty(), each listed once
+    const std::vector<uint32_t>& dirtySlots() const { return m_dirtySlots; }
+
+    /// @brief Mark every slot as uploaded
+    void clearDirty();
+
+private:
+    /// @brief Object id stored in free slots (entt::null, never a live entity)
+    static constexpr uint32_t kInvalidObjectId = UINT32_MAX;
+
+    /// @brief Index into m_slotOfIndex
+    static uint32_t indexOf(uint32_t objectId);
+
+    void markDirty(uint32_t slot);
+
+private:
+    // Per slot
+    std::vector<RenderObjectDesc> m_instances;
+    std::vector<uint8_t> m_slotDirty;
+
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<uint32_t> m_dirtySlots;
+    std::vector<uint32_t> m_visibleSlots;
+    size_t m_missingInstances = 0;
+
+    // Entity index -> slot (check m_instances[slot].object_id: indices are recycled)
+    std::vector<uint32_t> m_slotOfIndex;
+};
+
+} // namespace vesper
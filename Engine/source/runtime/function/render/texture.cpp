@@ -77,28 +77,28 @@ std::shared_ptr<Texture> Texture::create(
     auto cmdPool = rhi->createCommandPool(poolDesc);
     auto cmd = rhi->allocateCommandBuffer(cmdPool);
 
-    rhi->beginCommandBuffer(cmd);
+    rhi->beginCommandBuffer(cmd->id);
 
     // Transition to TransferDst
     RHITextureBarrier barrier{};
-    barrier.texture = texture->m_texture;
+    barrier.texture = texture->m_texture->id;
     barrier.srcState = RHIResourceState::Undefined;
     barrier.dstState = RHIResourceState::CopyDst;
     barrier.baseMipLevel = 0;
     barrier.mipLevelCount = 1;
     barrier.baseArrayLayer = 0;
     barrier.arrayLayerCount = 1;
-    rhi->cmdPipelineBarrier(cmd, {}, std::span(&barrier, 1));
+    rhi->cmdPipelineBarrier(cmd->id, {}, std::span(&barrier, 1));
 
     // Copy staging -> texture
-    rhi->cmdCopyBufferToTexture(cmd, stagingBuffer, texture->m_texture, 0, 0, 0);
+    rhi->cmdCopyBufferToTexture(cmd->id, stagingBuffer->id, texture->m_texture->id, 0, 0, 0);
 
     // Transition to ShaderResource
     barrier.srcState = RHIResourceState::CopyDst;
     barrier.dstState = RHIResourceState::ShaderResource;
-    rhi->cmdPipelineBarrier(cmd, {}, std::span(&barrier, 1));
+    rhi->cmdPipelineBarrier(cmd->id, {}, std::span(&barrier, 1));
 
-    rhi->endCommandBuffer(cmd);
+    rhi->endCommandBuffer(cmd->id);
 
     // Submit and wait
     auto queue = rhi->getQueue(RHIQueueType::Graphics);
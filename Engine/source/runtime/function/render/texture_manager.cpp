@@ -42,15 +42,6 @@ void TextureManager::shutdown()
         return;
     }
 
-    // Clear pending uploads
-    {
-        std::lock_guard lock(m_uploadMutex);
-        while (!m_pendingUploads.empty())
-        {
-            m_pendingUploads.pop();
-        }
-    }
-
     // Clear cache
     clearCache();
 
@@ -118,152 +109,83 @@ TexturePtr TextureManager::loadTextureSync(const std::string& path, bool isSRGB,
 // Asynchronous Loading
 // =============================================================================
 
-WaitGroupPtr TextureManager::loadTextureAsync(const std::string& path, bool isSRGB,
-                                               std::function<void(TexturePtr)> callback)
+AsyncTask<TexturePtr> TextureManager::loadTextureTask(std::string path, bool isSRGB)
 {
     if (!m_initialized)
     {
-        LOG_ERROR("TextureManager::loadTextureAsync: Not initialized");
-        if (callback)
-        {
-            callback(m_placeholderTexture);
-        }
-        return nullptr;
+        LOG_ERROR("TextureManager::loadTextureTask: Not initialized");
+        co_return m_placeholderTexture;
     }
 
-    // Check cache first
+    if (TexturePtr cached = getCached(path))
     {
-        std::lock_guard lock(m_cacheMutex);
-        auto it = m_cache.find(path);
-        if (it != m_cache.end())
-        {
-            if (callback)
-            {
-                callback(it->second);
-            }
-            return nullptr; // Already loaded, no wait needed
-        }
+        co_return cached;
     }
 
     // If no worker pool, fall back to sync loading
     if (!m_workerPool)
     {
-        TexturePtr tex = loadTextureSync(path, isSRGB, path.c_str());
-        if (callback)
-        {
-            callback(tex);
-        }
-        return nullptr;
+        co_return loadTextureSync(path, isSRGB, path.c_str());
     }
 
-    // Submit async load task
-    // Capture path by value to ensure it lives until task completion
-    std::string pathCopy = path;
+    // Stage 1: decode the file on a worker thread
+    co_await m_workerPool->schedule(TaskAffinity::AnyThread);
 
-    return m_workerPool->submit(
-        [this, pathCopy, isSRGB, cb = std::move(callback)]()
-        {
-            // Stage 1: Load file on worker thread
-            TextureData data = loadTextureDataFromFile(pathCopy, isSRGB);
-
-            if (!data.isValid())
-            {
-                LOG_WARN("TextureManager: Async load failed for '{}'", pathCopy);
-                // Queue a failed request so callback still fires with placeholder
-                {
-                    std::lock_guard lock(m_uploadMutex);
-                    TextureUploadRequest request;
-                    request.cachePath = pathCopy;
-                    request.callback = cb;
-                    request.isSRGB = isSRGB;
-                    // Empty data will trigger placeholder usage
-                    m_pendingUploads.push(std::move(request));
-                }
-                return;
-            }
+    TextureData data = loadTextureDataFromFile(path, isSRGB);
+    if (!data.isValid())
+    {
+        LOG_WARN("TextureManager: Async load failed for '{}', using placeholder", path);
+    }
 
-            // Queue for GPU upload on render thread
-            {
-                std::lock_guard lock(m_uploadMutex);
-                TextureUploadRequest request;
-                request.data = std::move(data);
-                request.cachePath = pathCopy;
-                request.callback = cb;
-                request.isSRGB = isSRGB;
-                m_pendingUploads.push(std::move(request));
-            }
-        },
-        TaskAffinity::AnyThread,
-        TaskPriority::Normal
-    );
-}
+    // Stage 2: create the GPU resource on the render thread
+    co_await m_workerPool->switchTo(TaskAffinity::RenderOnly);
 
-uint32_t TextureManager::processPendingUploads(uint32_t maxUploads)
-{
     if (!m_initialized)
     {
-        return 0;
+        // Shut down while the file was decoding
+        co_return nullptr;
     }
 
-    uint32_t uploadCount = 0;
-
-    while (uploadCount < maxUploads)
+    // Another request may have loaded the same file meanwhile
+    if (TexturePtr cached = getCached(path))
     {
-        TextureUploadRequest request;
-
-        // Get next pending upload
-        {
-            std::lock_guard lock(m_uploadMutex);
-            if (m_pendingUploads.empty())
-            {
-                break;
-            }
-            request = std::move(m_pendingUploads.front());
-            m_pendingUploads.pop();
-        }
+        co_return cached;
+    }
 
-        TexturePtr texture;
+    if (!data.isValid())
+    {
+        co_return m_placeholderTexture;
+    }
 
-        // Check if already in cache (could have been loaded by another request)
-        {
-            std::lock_guard lock(m_cacheMutex);
-            auto it = m_cache.find(request.cachePath);
-            if (it != m_cache.end())
-            {
-                texture = it->second;
-            }
-        }
+    TexturePtr texture = Texture::create(m_rhi, data, false, path.c_str());
+    if (!texture)
+    {
+        LOG_ERROR("TextureManager: Failed to create GPU texture for '{}'", path);
+        co_return m_placeholderTexture;
+    }
 
-        if (!texture)
-        {
-            if (request.data.isValid())
-            {
-                // Create GPU texture
-                texture = Texture::create(m_rhi, request.data, false, request.cachePath.c_str());
-                if (texture)
-                {
-                    std::lock_guard lock(m_cacheMutex);
-                    m_cache[request.cachePath] = texture;
-                }
-            }
+    {
+        std::lock_guard lock(m_cacheMutex);
+        m_cache[path] = texture;
+    }
 
-            // Use placeholder if creation failed
-            if (!texture)
-            {
-                texture = m_placeholderTexture;
-            }
-        }
+    co_return texture;
+}
 
-        // Fire callback
-        if (request.callback)
-        {
-            request.callback(texture);
-        }
+WaitGroupPtr TextureManager::loadTextureAsync(const std::string& path, bool isSRGB,
+                                               std::function<void(TexturePtr)> callback)
+{
+    return spawn(loadTextureWithCallback(path, isSRGB, std::move(callback)));
+}
 
-        ++uploadCount;
+AsyncTask<> TextureManager::loadTextureWithCallback(std::string path, bool isSRGB,
+                                                    std::function<void(TexturePtr)> callback)
+{
+    TexturePtr texture = co_await loadTextureTask(std::move(path), isSRGB);
+    if (callback)
+    {
+        callback(texture);
     }
-
-    return uploadCount;
 }
 
 // =============================================================================
@@ -1,37 +1,29 @@
 #pragma once
 
 #include "runtime/function/render/texture.h"
+#include "runtime/core/threading/coroutine.h"
 #include "runtime/core/threading/worker_pool.h"
 
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <string>
 #include <unordered_map>
 
 namespace vesper {
 
-/// @brief Pending texture upload data (CPU data waiting for GPU upload)
-struct TextureUploadRequest
-{
-    TextureData data;                              // CPU pixel data
-    std::string cachePath;                         // Cache key
-    std::function<void(TexturePtr)> callback;      // Completion callback
-    bool isSRGB = true;                            // Format hint
-};
-
 /// @brief Global texture manager with caching and async loading support
 ///
 /// Usage:
 /// - Synchronous: auto tex = texMgr->loadTextureSync("path/to/texture.png");
 /// - Asynchronous: texMgr->loadTextureAsync("path/to/texture.png", true, [](TexturePtr tex) { ... });
+/// - Coroutine: TexturePtr tex = co_await texMgr->loadTextureTask("path/to/texture.png");
 ///
-/// The async loading flow:
+/// The async loading flow (one coroutine, see loadTextureTask()):
 /// 1. Worker thread: stbi_load() reads file into CPU memory
-/// 2. Worker thread: Creates TextureUploadRequest and queues it
-/// 3. Render thread: processPendingUploads() creates GPU resources
-/// 4. Render thread: Triggers callback with completed texture
+/// 2. Hop to the render thread (RenderOnly task, run by WorkerPool::processAllRenderTasks)
+/// 3. Render thread: creates the GPU resource and inserts it into the cache
+/// 4. Render thread: resumes the awaiting coroutine / triggers the callback
 class TextureManager
 {
 public:
@@ -66,19 +58,21 @@ public:
     // Asynchronous Loading
     // =========================================================================
 
+    /// @brief Load texture as a coroutine (decode on a worker, upload on the render thread)
+    /// Completes on the render thread unless the texture was cached or no worker pool is set.
+    /// @param path File path to texture
+    /// @param isSRGB Whether to treat as sRGB
+    /// @return Texture, placeholder on failure, or nullptr if the manager shut down meanwhile
+    AsyncTask<TexturePtr> loadTextureTask(std::string path, bool isSRGB = true);
+
     /// @brief Load texture asynchronously
     /// @param path File path to texture
     /// @param isSRGB Whether to treat as sRGB
-    /// @param callback Called on render thread when texture is ready
-    /// @return WaitGroup that signals when load is complete (may be null if already cached)
+    /// @param callback Called on render thread when texture is ready (immediately if cached)
+    /// @return WaitGroup that signals when load is complete
     WaitGroupPtr loadTextureAsync(const std::string& path, bool isSRGB,
                                   std::function<void(TexturePtr)> callback);
 
-    /// @brief Process pending GPU uploads (call from render thread each frame)
-    /// @param maxUploads Maximum number of uploads to process per call
-    /// @return Number of textures uploaded
-    uint32_t processPendingUploads(uint32_t maxUploads = 4);
-
     // =========================================================================
     // Cache Management
     // =========================================================================
@@ -139,6 +133,10 @@ private:
     /// @brief Create checkerboard placeholder texture
     TexturePtr createPlaceholderTexture();
 
+    /// @brief Coroutine behind loadTextureAsync(): await the load, then fire the callback
+    AsyncTask<> loadTextureWithCallback(std::string path, bool isSRGB,
+                                        std::function<void(TexturePtr)> callback);
+
 private:
     RHI* m_rhi = nullptr;
     WorkerPool* m_workerPool = nullptr;
@@ -148,10 +146,6 @@ private:
     mutable std::mutex m_cacheMutex;
     std::unordered_map<std::string, TexturePtr> m_cache;
 
-    // Pending uploads queue (written by worker threads, consumed by render thread)
-    mutable std::mutex m_uploadMutex;
-    std::queue<TextureUploadRequest> m_pendingUploads;
-
     // Default textures
     TexturePtr m_placeholderTexture;
     TexturePtr m_defaultWhite;
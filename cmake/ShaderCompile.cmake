@@ -13,6 +13,23 @@
 #
 # This module compiles Slang shaders to SPIR-V and optionally generates C++ headers
 # with embedded shader bytecode.
+#
+# NAME.slang compiles its vertexMain and fragmentMain entry points to NAME.vert.spv and
+# NAME.frag.spv; compute shaders are named NAME.comp.slang and compile computeMain to
+# NAME.comp.spv.
+#
+# Every shader is a dependency of the target, so a Slang error fails the build. When
+# spirv-val was found (SPIRV_VALIDATOR), each output is also validated for Vulkan 1.3,
+# the version the RHI requires.
+
+# Extra custom command arguments validating SPV_FILE (empty without spirv-val)
+function(_vesper_spirv_validate_command OUT_VAR SPV_FILE)
+    if(SPIRV_VALIDATOR)
+        set(${OUT_VAR} COMMAND ${SPIRV_VALIDATOR} --target-env vulkan1.3 ${SPV_FILE} PARENT_SCOPE)
+    else()
+        set(${OUT_VAR} "" PARENT_SCOPE)
+    endif()
+endfunction()
 
 function(compile_slang_shader SHADER_FILES TARGET_NAME INCLUDE_FOLDER OUTPUT_FOLDER SLANG_COMPILER)
 
@@ -36,9 +53,38 @@ function(compile_slang_shader SHADER_FILES TARGET_NAME INCLUDE_FOLDER OUTPUT_FOL
             continue()
         endif()
 
+        # Compute shaders: a single computeMain entry point
+        if(${SHADER_FULL_NAME} MATCHES "\\.comp\\.slang$")
+            set(SPV_OUTPUT_COMP ${SPV_OUTPUT_DIR}/${SHADER_NAME}.comp.spv)
+            _vesper_spirv_validate_command(VALIDATE_COMP ${SPV_OUTPUT_COMP})
+
+            add_custom_command(
+                OUTPUT ${SPV_OUTPUT_COMP}
+                COMMAND ${SLANG_COMPILER}
+                    -I ${INCLUDE_FOLDER}
+                    -target spirv
+                    -profile glsl_450
+                    -entry computeMain
+                    -stage compute
+                    -o ${SPV_OUTPUT_COMP}
+                    ${SHADER}
+                ${VALIDATE_COMP}
+                DEPENDS ${SHADER}
+                COMMENT "Compiling Slang compute shader: ${SHADER_FULL_NAME}"
+                VERBATIM
+            )
+
+            add_custom_target(${SHADER_NAME}_comp_spv DEPENDS ${SPV_OUTPUT_COMP})
+            add_dependencies(${TARGET_NAME} ${SHADER_NAME}_comp_spv)
+            set_target_properties(${SHADER_NAME}_comp_spv PROPERTIES FOLDER "Shaders")
+            continue()
+        endif()
+
         # Output SPIR-V files for vertex and fragment stages
         set(SPV_OUTPUT_VERT ${SPV_OUTPUT_DIR}/${SHADER_NAME}.vert.spv)
         set(SPV_OUTPUT_FRAG ${SPV_OUTPUT_DIR}/${SHADER_NAME}.frag.spv)
+        _vesper_spirv_validate_command(VALIDATE_VERT ${SPV_OUTPUT_VERT})
+        _vesper_spirv_validate_command(VALIDATE_FRAG ${SPV_OUTPUT_FRAG})
 
         # Generate header name for C++ embedding (optional)
         string(REPLACE "." "_" HEADER_NAME ${SHADER_NAME})
@@ -55,6 +101,7 @@ function(compile_slang_shader SHADER_FILES TARGET_NAME INCLUDE_FOLDER OUTPUT_FOL
                 -stage vertex
                 -o ${SPV_OUTPUT_VERT}
                 ${SHADER}
+            ${VALIDATE_VERT}
             DEPENDS ${SHADER}
             COMMENT "Compiling Slang vertex shader: ${SHADER_FULL_NAME}"
             VERBATIM
@@ -71,6 +118,7 @@ function(compile_slang_shader SHADER_FILES TARGET_NAME INCLUDE_FOLDER OUTPUT_FOL
                 -stage fragment
                 -o ${SPV_OUTPUT_FRAG}
                 ${SHADER}
+            ${VALIDATE_FRAG}
             DEPENDS ${SHADER}
             COMMENT "Compiling Slang fragment shader: ${SHADER_FULL_NAME}"
             VERBATIM
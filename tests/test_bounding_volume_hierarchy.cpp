@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/framework/ecs/systems/bounding_volume_hierarchy.h"
+#include "runtime/function/framework/ecs/world.h"
+#include "runtime/function/framework/scene/scene.h"
+#include "runtime/function/physics/physics_scene.h"
+#include "test_frustum_utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+struct Sphere
+{
+    Entity entity;
+    Vector3 center;
+    float radius;
+};
+
+class RandomScene
+{
+public:
+    explicit RandomScene(uint32_t seed)
+        : m_rng(seed)
+    {
+    }
+
+    Vector3 randomPoint(float extent)
+    {
+        std::uniform_real_distribution<float> position(-extent, extent);
+        return Vector3(position(m_rng), position(m_rng), position(m_rng));
+    }
+
+    float randomRadius()
+    {
+        std::uniform_real_distribution<float> radius(0.1f, 4.0f);
+        return radius(m_rng);
+    }
+
+    uint32_t randomIndex(size_t count)
+    {
+        return std::uniform_int_distribution<uint32_t>(0, static_cast<uint32_t>(count - 1))(m_rng);
+    }
+
+private:
+    std::mt19937 m_rng;
+};
+
+std::vector<Entity> sorted(std::vector<Entity> entities)
+{
+    std::sort(entities.begin(), entities.end());
+    return entities;
+}
+
+template<typename Predicate>
+std::vector<Entity> bruteForce(const std::vector<Sphere>& spheres, Predicate&& predicate)
+{
+    std::vector<Entity> result;
+    for (const Sphere& sphere : spheres) {
+        if (predicate(sphere)) {
+            result.push_back(sphere.entity);
+        }
+    }
+    return sorted(result);
+}
+
+void expectQueriesMatchBruteForce(const BoundingVolumeHierarchy& bvh, const std::vector<Sphere>& spheres)
+{
+    const Frustum frustum = makeTestFrustum();
+    std::vector<Entity> result;
+
+    bvh.queryFrustum(frustum, result);
+    EXPECT_EQ(sorted(result), bruteForce(spheres, [&](const Sphere& s) { return frustum.testSphere(s.center, s.radius); }));
+
+    const Vector3 queryCenter(10.0f, -5.0f, 3.0f);
+    result.clear();
+    bvh.querySphere(queryCenter, 20.0f, result);
+    EXPECT_EQ(sorted(result), bruteForce(spheres, [&](const Sphere& s) {
+        return (s.center - queryCenter).length() <= 20.0f + s.radius;
+    }));
+
+    const Vector3 boxMin(-30.0f, 0.0f, -10.0f);
+    const Vector3 boxMax(0.0f, 25.0f, 40.0f);
+    result.clear();
+    bvh.queryAABB(boxMin, boxMax, result);
+    EXPECT_EQ(sorted(result), bruteForce(spheres, [&](const Sphere& s) {
+        const Vector3 closest = Vector3::clamp(s.center, boxMin, boxMax);
+        return (s.center - closest).squaredLength() <= s.radius * s.radius;
+    }));
+}
+
+} // namespace
+
+TEST(BoundingVolumeHierarchyTest, QueriesMatchBruteForce) {
+    RandomScene scene(42);
+    BoundingVolumeHierarchy bvh;
+    std::vector<Sphere> spheres;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        spheres.push_back({idToEntity(i), scene.randomPoint(100.0f), scene.randomRadius()});
+        bvh.insert(spheres.back().entity, spheres.back().center, spheres.back().radius);
+    }
+
+    ASSERT_EQ(bvh.size(), spheres.size());
+    EXPECT_LE(bvh.height(), 40u);
+    expectQueriesMatchBruteForce(bvh, spheres);
+}
+
+TEST(BoundingVolumeHierarchyTest, QueriesStayExactAfterMovesAndRemovals) {
+    RandomScene scene(7);
+    BoundingVolumeHierarchy bvh;
+    std::vector<Sphere> spheres;
+    for (uint32_t i = 0; i < 3000; ++i) {
+        spheres.push_back({idToEntity(i), scene.randomPoint(100.0f), scene.randomRadius()});
+        bvh.insert(spheres.back().entity, spheres.back().center, spheres.back().radius);
+    }
+
+    // Small moves stay inside the fat boxes, large ones re-insert
+    size_t reinserted = 0;
+    for (Sphere& sphere : spheres) {
+        sphere.center = sphere.center + scene.randomPoint(sphere.entity == spheres.front().entity ? 50.0f : 0.5f);
+        reinserted += bvh.update(sphere.entity, sphere.center, sphere.radius) ? 1 : 0;
+    }
+    EXPECT_LT(reinserted, spheres.size());
+
+    for (int i = 0; i < 1000; ++i) {
+        const uint32_t index = scene.randomIndex(spheres.size());
+        bvh.remove(spheres[index].entity);
+        EXPECT_FALSE(bvh.contains(spheres[index].entity));
+        spheres[index] = spheres.back();
+        spheres.pop_back();
+    }
+
+    ASSERT_EQ(bvh.size(), spheres.size());
+    EXPECT_LE(bvh.height(), 40u);
+    expectQueriesMatchBruteForce(bvh, spheres);
+}
+
+TEST(BoundingVolumeHierarchyTest, RaycastReturnsNearestHit) {
+    RandomScene scene(3);
+    BoundingVolumeHierarchy bvh;
+    std::vector<Sphere> spheres;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        spheres.push_back({idToEntity(i), scene.randomPoint(100.0f), scene.randomRadius()});
+        bvh.insert(spheres.back().entity, spheres.back().center, spheres.back().radius);
+    }
+
+    for (int ray = 0; ray < 200; ++ray) {
+        const Vector3 origin = scene.randomPoint(150.0f);
+        const Vector3 direction = (scene.randomPoint(50.0f) - origin).normalized();
+
+        // Brute force: nearest entry distance, 0 for origins inside a sphere
+        float nearest = 1000.0f;
+        for (const Sphere& sphere : spheres) {
+            const Vector3 offset = origin - sphere.center;
+            const float b = offset.dot(direction);
+            const float c = offset.squaredLength() - sphere.radius * sphere.radius;
+            const float discriminant = b * b - c;
+            if ((c > 0.0f && b > 0.0f) || discriminant < 0.0f) {
+                continue;
+            }
+            nearest = std::min(nearest, std::max(-b - std::sqrt(discriminant), 0.0f));
+        }
+
+        RaycastHit hit;
+        const bool hasHit = bvh.raycast(origin, direction, 1000.0f, hit);
+        ASSERT_EQ(hasHit, nearest < 1000.0f) << "ray " << ray;
+        if (hasHit) {
+            const float tolerance = 1e-3f + nearest * 1e-4f;
+            EXPECT_NEAR(hit.distance, nearest, tolerance) << "ray " << ray;
+            EXPECT_NEAR((hit.point - origin).length(), nearest, tolerance) << "ray " << ray;
+        }
+    }
+
+    RaycastHit hit;
+    EXPECT_FALSE(bvh.raycast(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 0.0f), 100.0f, hit));
+}
+
+TEST(BoundingVolumeHierarchyTest, WorldKeepsTreeInSyncWithBounds) {
+    World world;
+    const Entity entity = world.createEntity();
+    world.addComponent<TransformComponent>(entity);
+    world.addComponent<BoundingComponent>(entity).initFromSphere(Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+    world.updateTransforms();
+    world.updateBounds();
+
+    const BoundingVolumeHierarchy& bvh = world.registry().ctx().get<BoundingVolumeHierarchy>();
+    ASSERT_TRUE(bvh.contains(entity));
+
+    world.patchComponent<TransformComponent>(entity, [](TransformComponent& transform) {
+        transform.setPosition(Vector3(200.0f, 0.0f, 0.0f));
+    });
+    world.updateTransforms();
+    world.updateBounds();
+
+    std::vector<Entity> result;
+    EXPECT_EQ(bvh.querySphere(Vector3(0.0f, 0.0f, 0.0f), 5.0f, result), 0u);
+    EXPECT_EQ(bvh.querySphere(Vector3(200.0f, 0.0f, 0.0f), 5.0f, result), 1u);
+
+    world.destroyEntity(entity);
+    EXPECT_FALSE(bvh.contains(entity));
+    EXPECT_EQ(bvh.size(), 0u);
+}
+
+TEST(BoundingVolumeHierarchyTest, PhysicsSceneRaycastUsesSceneBounds) {
+    BoundingVolumeHierarchy bvh;
+    bvh.insert(idToEntity(1), Vector3(0.0f, 0.0f, 10.0f), 1.0f);
+    bvh.insert(idToEntity(2), Vector3(0.0f, 0.0f, 20.0f), 1.0f);
+
+    PhysicsScene physics;
+    const float origin[3] = {0.0f, 0.0f, 0.0f};
+    const float direction[3] = {0.0f, 0.0f, 1.0f};
+    float hitPoint[3] = {};
+    EXPECT_FALSE(physics.raycast(origin, direction, 100.0f, hitPoint));
+
+    physics.setSceneBounds(&bvh);
+    ASSERT_TRUE(physics.raycast(origin, direction, 100.0f, hitPoint));
+    EXPECT_NEAR(hitPoint[2], 9.0f, 1e-4f);
+    EXPECT_FALSE(physics.raycast(origin, direction, 5.0f, hitPoint));
+}
+
+TEST(BoundingVolumeHierarchyTest, SceneAttachesItsBoundsToPhysics) {
+    PhysicsScene physics;
+    const float origin[3] = {0.0f, 0.0f, 0.0f};
+    const float direction[3] = {0.0f, 0.0f, 1.0f};
+    float hitPoint[3] = {};
+
+    {
+        Scene scene("Physics");
+        World& world = scene.world();
+        const Entity entity = scene.createEntity("Target");
+        world.patchComponent<TransformComponent>(entity, [](TransformComponent& transform) {
+            transform.setPosition(Vector3(0.0f, 0.0f, 10.0f));
+        });
+        world.addComponent<BoundingComponent>(entity).initFromSphere(Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+        scene.update(0.0f);
+
+        scene.setPhysicsScene(&physics);
+        EXPECT_EQ(scene.getPhysicsScene(), &physics);
+        ASSERT_TRUE(physics.raycast(origin, direction, 100.0f, hitPoint));
+        EXPECT_NEAR(hitPoint[2], 9.0f, 1e-4f);
+    }
+
+    // The destroyed scene detached its bounds
+    EXPECT_EQ(physics.getSceneBounds(), nullptr);
+    EXPECT_FALSE(physics.raycast(origin, direction, 100.0f, hitPoint));
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include "runtime/core/threading/coroutine.h"
+#include "runtime/core/threading/worker_pool.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+AsyncTask<int> addLater(int a, int b) {
+    co_return a + b;
+}
+
+AsyncTask<> sumNested(int* result) {
+    const int first = co_await addLater(1, 2);
+    const int second = co_await addLater(first, 4);
+    *result = second;
+}
+
+AsyncTask<> recordScheduledThread(WorkerPool* pool, std::atomic<bool>* onWorker) {
+    co_await pool->schedule();
+    onWorker->store(ThreadContext::isWorkerThread());
+}
+
+AsyncTask<> hopToMainThread(WorkerPool* pool, std::thread::id* before, std::thread::id* after) {
+    co_await pool->schedule();
+    *before = std::this_thread::get_id();
+    co_await pool->switchTo(TaskAffinity::LogicOnly);
+    *after = std::this_thread::get_id();
+}
+
+AsyncTask<> fanOutAndAwait(WorkerPool* pool, std::atomic<int>* sum, int* observed) {
+    TaskCounter counter;
+    for (int i = 1; i <= 100; ++i) {
+        pool->submit(Task([sum, i]() { sum->fetch_add(i); }), counter);
+    }
+    co_await counter;
+
+    WaitGroupPtr last = pool->submit([sum]() { sum->fetch_add(1000); });
+    co_await last;
+
+    *observed = sum->load();
+}
+
+/// Drive LogicOnly continuations from the "main" thread until the coroutine finishes
+void pumpLogicUntilDone(WorkerPool& pool, const WaitGroupPtr& wg) {
+    while (!wg->isDone()) {
+        if (!pool.processLogicTask()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+} // namespace
+
+class CoroutineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        WorkerPoolConfig config;
+        config.numWorkers = 4;
+        ASSERT_TRUE(pool.initialize(config));
+    }
+
+    void TearDown() override {
+        pool.shutdown();
+    }
+
+    WorkerPool pool;
+};
+
+TEST(AsyncTaskTest, NestedAwaitReturnsValues) {
+    int result = 0;
+    WaitGroupPtr wg = spawn(sumNested(&result));
+
+    // Nothing suspends, so the task completes inside spawn()
+    EXPECT_TRUE(wg->isDone());
+    EXPECT_EQ(result, 7);
+}
+
+TEST(AsyncTaskTest, LazyTaskDoesNotRunUntilAwaited) {
+    int result = 0;
+    {
+        AsyncTask<> task = sumNested(&result);
+        EXPECT_FALSE(task.isDone());
+    }
+    EXPECT_EQ(result, 0);
+}
+
+TEST(AsyncTaskTest, FramesAreRecycled) {
+    int result = 0;
+    spawn(sumNested(&result));
+    const size_t warm = CoroutineFramePool::allocatedBytes();
+
+    for (int i = 0; i < 10000; ++i) {
+        spawn(sumNested(&result));
+    }
+    EXPECT_EQ(CoroutineFramePool::allocatedBytes(), warm);
+}
+
+TEST_F(CoroutineTest, ScheduleResumesOnWorker) {
+    std::atomic<bool> onWorker{false};
+    WaitGroupPtr wg = spawn(recordScheduledThread(&pool, &onWorker));
+
+    pool.waitFor(wg, false);
+    EXPECT_TRUE(onWorker.load());
+}
+
+TEST_F(CoroutineTest, SwitchToHopsToAffinityThread) {
+    ScopedThreadRegistration registration(ThreadType::Main);
+
+    std::thread::id before;
+    std::thread::id after;
+    WaitGroupPtr wg = spawn(hopToMainThread(&pool, &before, &after));
+    pumpLogicUntilDone(pool, wg);
+
+    EXPECT_NE(before, std::this_thread::get_id());
+    EXPECT_EQ(after, std::this_thread::get_id());
+}
+
+TEST_F(CoroutineTest, SwitchToMatchingThreadDoesNotSuspend) {
+    ScopedThreadRegistration registration(ThreadType::Main);
+
+    std::thread::id ranOn;
+    WaitGroupPtr wg = spawn([](WorkerPool* pool, std::thread::id* out) -> AsyncTask<> {
+        co_await pool->switchTo(TaskAffinity::LogicOnly);
+        *out = std::this_thread::get_id();
+    }(&pool, &ranOn));
+
+    EXPECT_TRUE(wg->isDone());
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+}
+
+TEST_F(CoroutineTest, AwaitCounterAndWaitGroup) {
+    std::atomic<int> sum{0};
+    int observed = 0;
+    WaitGroupPtr wg = spawn(fanOutAndAwait(&pool, &sum, &observed));
+
+    pool.waitFor(wg);
+    EXPECT_EQ(observed, 5050 + 1000);
+}
+
+TEST_F(CoroutineTest, ManyConcurrentCoroutines) {
+    constexpr int kCount = 2000;
+    std::atomic<int> onWorker{0};
+    std::vector<std::atomic<bool>> flags(kCount);
+    std::vector<WaitGroupPtr> groups;
+    groups.reserve(kCount);
+
+    for (int i = 0; i < kCount; ++i) {
+        groups.push_back(spawn(recordScheduledThread(&pool, &flags[i])));
+    }
+    for (auto& wg : groups) {
+        pool.waitFor(wg, false);
+    }
+    for (auto& flag : flags) {
+        onWorker += flag.load() ? 1 : 0;
+    }
+    EXPECT_EQ(onWorker.load(), kCount);
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include "runtime/core/threading/cpu_topology.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+void writeFile(const std::filesystem::path& path, const std::string& content) {
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream(path) << content << "\n";
+}
+
+/// Fake sysfs: 2 packages x 2 L3 domains x 2 cores x 2 SMT threads = 16 CPUs.
+/// Linux-style numbering: SMT siblings are cpu N and N + 8.
+std::filesystem::path makeFakeSysfs() {
+    const auto root = std::filesystem::temp_directory_path() / "vesper_fake_sysfs_cpu";
+    std::filesystem::remove_all(root);
+    writeFile(root / "online", "0-15");
+
+    for (int cpu = 0; cpu < 16; ++cpu) {
+        const int core = cpu % 8;              // Physical core 0..7
+        const int package = core / 4;
+        const int l3 = core / 2;               // Two cores per L3
+        const auto dir = root / ("cpu" + std::to_string(cpu));
+
+        writeFile(dir / "topology" / "physical_package_id", std::to_string(package));
+        writeFile(dir / "topology" / "thread_siblings_list",
+                  std::to_string(core) + "," + std::to_string(core + 8));
+
+        writeFile(dir / "cache" / "index0" / "level", "1");
+        writeFile(dir / "cache" / "index0" / "shared_cpu_list", std::to_string(cpu));
+        writeFile(dir / "cache" / "index3" / "level", "3");
+        writeFile(dir / "cache" / "index3" / "shared_cpu_list",
+                  std::to_string(l3 * 2) + "-" + std::to_string(l3 * 2 + 1) + "," +
+                  std::to_string(l3 * 2 + 8) + "-" + std::to_string(l3 * 2 + 9));
+    }
+    return root;
+}
+
+} // namespace
+
+TEST(CpuTopologyTest, ParsesCpuLists) {
+    EXPECT_EQ(CpuTopology::parseCpuList("0-3,8,10-11"), (std::vector<uint32_t>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(CpuTopology::parseCpuList("5"), (std::vector<uint32_t>{5}));
+    EXPECT_TRUE(CpuTopology::parseCpuList("").empty());
+}
+
+TEST(CpuTopologyTest, ReadsCoresCachesAndPackagesFromSysfs) {
+    const auto root = makeFakeSysfs();
+    const CpuTopology topology = CpuTopology::fromSysfs(root);
+    std::filesystem::remove_all(root);
+
+    ASSERT_TRUE(topology.isValid());
+    EXPECT_EQ(topology.cpus().size(), 16u);
+    EXPECT_EQ(topology.physicalCoreCount(), 8u);
+    EXPECT_EQ(topology.l3Count(), 4u);
+    EXPECT_EQ(topology.packageCount(), 2u);
+}
+
+TEST(CpuTopologyTest, PlacementFillsPhysicalCoresOneL3AtATime) {
+    const auto root = makeFakeSysfs();
+    const CpuTopology topology = CpuTopology::fromSysfs(root);
+    std::filesystem::remove_all(root);
+
+    const auto cores = topology.placementOrder(false);
+    ASSERT_EQ(cores.size(), 8u);
+    for (size_t i = 0; i < cores.size(); ++i) {
+        EXPECT_EQ(cores[i].id, i);              // Primary hardware thread of each core
+        EXPECT_EQ(cores[i].l3, (i / 2) * 2);    // Consecutive workers share an L3
+        EXPECT_EQ(cores[i].package, i / 4);
+    }
+
+    const auto threads = topology.placementOrder(true);
+    ASSERT_EQ(threads.size(), 16u);
+    EXPECT_EQ(threads[8].id, 8u);               // SMT siblings only after every core
+    EXPECT_EQ(threads[8].core, 0u);
+}
+
+TEST(CpuTopologyTest, RestrictsToAllowedCpus) {
+    const auto root = makeFakeSysfs();
+    const CpuTopology topology = CpuTopology::fromSysfs(root);
+    std::filesystem::remove_all(root);
+
+    // e.g. taskset -c 2,3,10: both cores of the second L3, one with its SMT sibling
+    const CpuTopology allowed = topology.restrictedTo({2, 3, 10});
+    ASSERT_EQ(allowed.cpus().size(), 3u);
+    EXPECT_EQ(allowed.physicalCoreCount(), 2u);
+    EXPECT_EQ(allowed.l3Count(), 1u);
+    EXPECT_EQ(allowed.packageCount(), 1u);
+
+    const auto cores = allowed.placementOrder(false);
+    ASSERT_EQ(cores.size(), 2u);
+    EXPECT_EQ(cores[0].id, 2u);
+    EXPECT_EQ(cores[1].id, 3u);
+    EXPECT_EQ(allowed.placementOrder(true).size(), 3u);
+
+    EXPECT_FALSE(topology.restrictedTo({99}).isValid());
+}
+
+TEST(CpuTopologyTest, MissingSysfsGivesEmptyTopology) {
+    const CpuTopology topology = CpuTopology::fromSysfs("/nonexistent/vesper/cpu");
+    EXPECT_FALSE(topology.isValid());
+    EXPECT_TRUE(topology.placementOrder(true).empty());
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/framework/ecs/systems/culling_buffer.h"
+#include "runtime/function/framework/component/common/bounding_component.h"
+#include "runtime/function/framework/ecs/world.h"
+#include "runtime/core/threading/worker_pool.h"
+#include "test_frustum_utils.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+struct Sphere
+{
+    Vector3 center;
+    float radius;
+};
+
+std::vector<Sphere> randomSpheres(size_t count, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> radius(0.1f, 5.0f);
+
+    std::vector<Sphere> spheres(count);
+    for (Sphere& sphere : spheres) {
+        sphere.center = Vector3(position(rng), position(rng), position(rng));
+        sphere.radius = radius(rng);
+    }
+    return spheres;
+}
+
+} // namespace
+
+TEST(CullingBufferTest, FrustumContainsPointsInFrontOfCamera) {
+    // Camera at z = -50 looking at the origin down +Z, far plane at z = 70
+    const Frustum frustum = makeTestFrustum();
+
+    EXPECT_TRUE(frustum.testPoint(Vector3(0.0f, 0.0f, 0.0f)));
+    EXPECT_TRUE(frustum.testPoint(Vector3(0.0f, 0.0f, 60.0f)));
+    EXPECT_FALSE(frustum.testPoint(Vector3(0.0f, 0.0f, -60.0f)));
+    EXPECT_FALSE(frustum.testPoint(Vector3(0.0f, 0.0f, 80.0f)));
+    EXPECT_FALSE(frustum.testPoint(Vector3(0.0f, 40.0f, 0.0f)));
+    EXPECT_FALSE(frustum.testPoint(Vector3(-60.0f, 0.0f, 0.0f)));
+}
+
+TEST(CullingBufferTest, MatchesScalarSphereTest) {
+    const Frustum frustum = makeTestFrustum();
+
+    for (size_t count : {size_t{0}, size_t{1}, size_t{63}, size_t{64}, size_t{1000}, size_t{40000}}) {
+        const std::vector<Sphere> spheres = randomSpheres(count, static_cast<uint32_t>(count));
+        CullingBuffer buffer;
+        for (size_t i = 0; i < count; ++i) {
+            buffer.add(idToEntity(static_cast<uint32_t>(i)), spheres[i].center, spheres[i].radius);
+        }
+
+        std::vector<uint32_t> expected;
+        for (size_t i = 0; i < count; ++i) {
+            if (frustum.testSphere(spheres[i].center, spheres[i].radius)) {
+                expected.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        std::vector<uint32_t> visible;
+        EXPECT_EQ(buffer.cullToSlots(frustum, visible), expected.size()) << count << " spheres";
+        EXPECT_EQ(visible, expected) << count << " spheres";
+    }
+}
+
+TEST(CullingBufferTest, TwoStageMatchesScalarSphereAndBox) {
+    const Frustum frustum = makeTestFrustum();
+    const std::vector<Sphere> spheres = randomSpheres(5000, 11);
+
+    // Thin boxes inside each sphere, along a random axis: many spheres pass where the box does not
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> axis(0, 2);
+    CullingBuffer buffer;
+    std::vector<uint32_t> expected;
+    size_t sphereVisible = 0;
+    for (size_t i = 0; i < spheres.size(); ++i) {
+        const float r = spheres[i].radius;
+        Vector3 extent(0.1f * r, 0.1f * r, 0.1f * r);
+        extent[static_cast<size_t>(axis(rng))] = 0.9f * r;
+        const Vector3 boxMin = spheres[i].center - extent;
+        const Vector3 boxMax = spheres[i].center + extent;
+        buffer.add(idToEntity(static_cast<uint32_t>(i)), spheres[i].center, r, boxMin, boxMax);
+
+        if (frustum.testSphere(spheres[i].center, r)) {
+            ++sphereVisible;
+            if (frustum.testAABB(boxMin, boxMax)) {
+                expected.push_back(static_cast<uint32_t>(i));
+            }
+        }
+    }
+
+    std::vector<uint32_t> visible;
+    buffer.cullToSlots(frustum, visible);
+    EXPECT_EQ(visible, expected);
+    EXPECT_LT(expected.size(), sphereVisible);
+}
+
+TEST(CullingBufferTest, WorldAabbEnclosesTransformedCorners) {
+    BoundingComponent bounds;
+    bounds.initFromAABB(Vector3(-1.0f, -0.5f, -4.0f), Vector3(2.0f, 0.5f, 4.0f));
+
+    const Matrix4x4 world = Matrix4x4::scaling(Vector3(1.0f, 2.0f, 0.5f)) *
+                            Matrix4x4::rotationRollPitchYaw(0.3f, 1.1f, -0.7f) *
+                            Matrix4x4::translation(Vector3(10.0f, -3.0f, 5.0f));
+    bounds.updateWorldBounds(world);
+
+    // The tightest world box is the one around the 8 transformed corners
+    Vector3 expectedMin(1e30f, 1e30f, 1e30f);
+    Vector3 expectedMax(-1e30f, -1e30f, -1e30f);
+    for (int corner = 0; corner < 8; ++corner) {
+        const Vector3 local((corner & 1) ? bounds.aabbMax.x : bounds.aabbMin.x,
+                            (corner & 2) ? bounds.aabbMax.y : bounds.aabbMin.y,
+                            (corner & 4) ? bounds.aabbMax.z : bounds.aabbMin.z);
+        const Vector4 transformed = world.transform(Vector4(local.x, local.y, local.z, 1.0f));
+        for (size_t axis = 0; axis < 3; ++axis) {
+            const float value = axis == 0 ? transformed.x : (axis == 1 ? transformed.y : transformed.z);
+            expectedMin[axis] = std::min(expectedMin[axis], value);
+            expectedMax[axis] = std::max(expectedMax[axis], value);
+        }
+    }
+
+    for (size_t axis = 0; axis < 3; ++axis) {
+        EXPECT_NEAR(bounds.worldAabbMin[axis], expectedMin[axis], 1e-4f);
+        EXPECT_NEAR(bounds.worldAabbMax[axis], expectedMax[axis], 1e-4f);
+    }
+
+    // Sphere radius follows the largest axis scale
+    EXPECT_NEAR(bounds.worldRadius, bounds.localRadius * 2.0f, 1e-4f);
+}
+
+TEST(CullingBufferTest, ParallelCullMatchesSerial) {
+    WorkerPool pool;
+    WorkerPoolConfig config;
+    config.numWorkers = 4;
+    ASSERT_TRUE(pool.initialize(config));
+
+    const Frustum frustum = makeTestFrustum();
+    const std::vector<Sphere> spheres = randomSpheres(100000, 7);
+    CullingBuffer buffer;
+    for (size_t i = 0; i < spheres.size(); ++i) {
+        buffer.add(idToEntity(static_cast<uint32_t>(i)), spheres[i].center, spheres[i].radius);
+    }
+
+    std::vector<uint64_t> serialBits;
+    std::vector<uint64_t> parallelBits;
+    const size_t serialCount = buffer.cull(frustum, serialBits);
+    const size_t parallelCount = buffer.cull(frustum, parallelBits, &pool);
+
+    EXPECT_GT(serialCount, 0u);
+    EXPECT_EQ(parallelCount, serialCount);
+    EXPECT_EQ(parallelBits, serialBits);
+    pool.shutdown();
+}
+
+TEST(CullingBufferTest, RemoveMovesLastSlotIntoHole) {
+    CullingBuffer buffer;
+    const Entity a = idToEntity(1);
+    const Entity b = idToEntity(2);
+    const Entity c = idToEntity(3);
+    buffer.add(a, Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+    buffer.add(b, Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+    buffer.add(c, Vector3(500.0f, 0.0f, 0.0f), 1.0f);
+
+    buffer.remove(a);
+    ASSERT_EQ(buffer.size(), 2u);
+    EXPECT_FALSE(buffer.contains(a));
+    EXPECT_EQ(buffer.entityAt(0), c);
+
+    // The moved slot kept its sphere, the freed slot is padding again
+    std::vector<uint32_t> visible;
+    buffer.cullToSlots(makeTestFrustum(), visible);
+    ASSERT_EQ(visible.size(), 1u);
+    EXPECT_EQ(buffer.entityAt(visible[0]), b);
+}
+
+TEST(CullingBufferTest, WorldKeepsBufferInSyncWithBounds) {
+    World world;
+    const Entity entity = world.createEntity();
+    world.addComponent<TransformComponent>(entity);
+    world.addComponent<BoundingComponent>(entity).initFromSphere(Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+    world.updateTransforms();
+    world.updateBounds();
+
+    const CullingBuffer& buffer = world.registry().ctx().get<CullingBuffer>();
+    const Frustum frustum = makeTestFrustum();
+    std::vector<uint32_t> visible;
+    EXPECT_EQ(buffer.cullToSlots(frustum, visible), 1u);
+
+    world.patchComponent<TransformComponent>(entity, [](TransformComponent& transform) {
+        transform.setPosition(Vector3(0.0f, 0.0f, -500.0f));
+    });
+    world.updateTransforms();
+    world.updateBounds();
+    EXPECT_EQ(buffer.cullToSlots(frustum, visible), 0u);
+
+    world.destroyEntity(entity);
+    EXPECT_EQ(buffer.size(), 0u);
+}
+
+} // namespace test
+} // namespace vesper
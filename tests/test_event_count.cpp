@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "runtime/core/threading/event_count.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+TEST(EventCountTest, NotifyWithoutWaitersIsANoOp) {
+    EventCount eventCount;
+    EXPECT_FALSE(eventCount.notifyOne());
+    EXPECT_FALSE(eventCount.notifyAll());
+    EXPECT_EQ(eventCount.waiterCount(), 0u);
+}
+
+TEST(EventCountTest, CancelWaitUnregisters) {
+    EventCount eventCount;
+    (void)eventCount.prepareWait();
+    EXPECT_EQ(eventCount.waiterCount(), 1u);
+    eventCount.cancelWait();
+    EXPECT_EQ(eventCount.waiterCount(), 0u);
+}
+
+TEST(EventCountTest, WaitReturnsImmediatelyAfterNotifyRace) {
+    EventCount eventCount;
+    const auto key = eventCount.prepareWait();
+    // Notification lands between prepareWait and wait: must not sleep
+    EXPECT_TRUE(eventCount.notifyOne());
+    eventCount.wait(key);
+    EXPECT_EQ(eventCount.waiterCount(), 0u);
+}
+
+TEST(EventCountTest, NotifyAllWakesEveryWaiter) {
+    constexpr int kWaiters = 4;
+    EventCount eventCount;
+    std::atomic<bool> ready{false};
+    std::atomic<int> woken{0};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kWaiters; ++i) {
+        threads.emplace_back([&]() {
+            while (!ready.load()) {
+                const auto key = eventCount.prepareWait();
+                if (ready.load()) {
+                    eventCount.cancelWait();
+                    break;
+                }
+                eventCount.wait(key);
+            }
+            woken.fetch_add(1);
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ready.store(true);
+    eventCount.notifyAll();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(woken.load(), kWaiters);
+}
+
+TEST(EventCountTest, ProducerConsumerNeverLosesWakeups) {
+    constexpr int kItems = 20000;
+    EventCount eventCount;
+    std::atomic<int> available{0};
+    int consumed = 0;
+
+    std::thread consumer([&]() {
+        while (consumed < kItems) {
+            if (available.load() > 0) {
+                available.fetch_sub(1);
+                ++consumed;
+                continue;
+            }
+            const auto key = eventCount.prepareWait();
+            if (available.load() > 0) {
+                eventCount.cancelWait();
+                continue;
+            }
+            eventCount.wait(key);
+        }
+    });
+
+    for (int i = 0; i < kItems; ++i) {
+        available.fetch_add(1);
+        eventCount.notifyOne();
+    }
+    consumer.join();
+    EXPECT_EQ(consumed, kItems);
+}
+
+} // namespace test
+} // namespace vesper
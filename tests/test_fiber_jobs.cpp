@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include "runtime/core/threading/fiber.h"
+#include "runtime/core/threading/worker_pool.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+/// Wait without help-running, so every task runs on a worker (and thus on a fiber)
+void spinUntilDone(const TaskCounter& counter) {
+    while (!counter.isDone()) {
+        std::this_thread::yield();
+    }
+}
+
+struct PingPong {
+    FiberContext thread;
+    FiberContext fiber;
+    std::vector<int> trace;
+};
+
+void pingPongEntry(void* arg) {
+    auto& state = *static_cast<PingPong*>(arg);
+    for (int i = 0;; ++i) {
+        state.trace.push_back(i);
+        FiberContext::switchTo(state.fiber, state.thread);
+    }
+}
+
+} // namespace
+
+TEST(FiberContextTest, SwitchesBackAndForth) {
+    PingPong state;
+    ASSERT_TRUE(state.thread.bindToThread());
+    ASSERT_TRUE(state.fiber.create(64 * 1024, &pingPongEntry, &state));
+
+    for (int i = 0; i < 3; ++i) {
+        FiberContext::switchTo(state.thread, state.fiber);
+    }
+    state.thread.unbindFromThread();
+
+    EXPECT_EQ(state.trace, (std::vector<int>{0, 1, 2}));
+}
+
+class FiberJobTest : public ::testing::Test {
+protected:
+    void start(uint32_t workers, uint32_t fibers) {
+        WorkerPoolConfig config;
+        config.numWorkers = workers;
+        config.enableFibers = true;
+        config.fiberCount = fibers;
+        config.fiberStackSize = 128 * 1024;
+        ASSERT_TRUE(pool.initialize(config));
+    }
+
+    void TearDown() override {
+        pool.shutdown();
+    }
+
+    WorkerPool pool;
+};
+
+TEST_F(FiberJobTest, NestedParallelForInsideTasks) {
+    start(4, 64);
+    constexpr int kOuter = 16;
+    constexpr size_t kInner = 20000;
+    std::atomic<size_t> visited{0};
+
+    TaskCounter counter;
+    for (int i = 0; i < kOuter; ++i) {
+        pool.submit(makeTask([&]() {
+            EXPECT_TRUE(pool.isInFiber());
+            pool.parallelFor(0, kInner, 64, [&visited](size_t) {
+                visited.fetch_add(1, std::memory_order_relaxed);
+            });
+        }), counter);
+    }
+    spinUntilDone(counter);
+
+    EXPECT_EQ(visited.load(), kOuter * kInner);
+}
+
+TEST_F(FiberJobTest, DeepWaitChainParksInsteadOfRecursing) {
+    // Each level waits on the next: with help-running this nests 200 frames on one stack
+    start(2, 256);
+    constexpr int kDepth = 200;
+    std::atomic<int> deepest{0};
+
+    std::function<void(int)> level = [&](int depth) {
+        deepest.store(std::max(deepest.load(), depth));
+        if (depth == kDepth) {
+            return;
+        }
+        TaskCounter child;
+        pool.submit(makeTask([&level, depth]() { level(depth + 1); }), child);
+        pool.waitFor(child);
+    };
+
+    TaskCounter root;
+    pool.submit(makeTask([&level]() { level(1); }), root);
+    spinUntilDone(root);
+
+    EXPECT_EQ(deepest.load(), kDepth);
+    EXPECT_GT(pool.stats().fibersParked.load(), 0u);
+}
+
+TEST_F(FiberJobTest, WaitGroupWaitParksFiber) {
+    start(2, 16);
+    std::atomic<bool> childRan{false};
+    std::atomic<bool> parentSawChild{false};
+
+    auto parent = pool.submit([&]() {
+        auto child = pool.submit([&childRan]() { childRan.store(true); });
+        pool.waitFor(child);
+        parentSawChild.store(childRan.load());
+    });
+    pool.waitFor(parent);
+
+    EXPECT_TRUE(parentSawChild.load());
+}
+
+TEST_F(FiberJobTest, ParkedWaiterMayDestroyCounterOnResume) {
+    start(4, 64);
+    std::atomic<int> completed{0};
+
+    // Each job parks on a heap counter and frees it the moment it is resumed
+    TaskCounter counter;
+    for (int i = 0; i < 256; ++i) {
+        pool.submit(makeTask([&]() {
+            auto inner = std::make_unique<TaskCounter>();
+            for (int j = 0; j < 4; ++j) {
+                pool.submit(makeTask([&completed]() { completed.fetch_add(1); }), *inner);
+            }
+            pool.waitFor(*inner);
+            inner.reset();
+        }), counter);
+    }
+    spinUntilDone(counter);
+
+    EXPECT_EQ(completed.load(), 256 * 4);
+}
+
+TEST_F(FiberJobTest, ExhaustedFiberPoolFallsBackToHelpRun) {
+    start(2, 2);
+    std::atomic<int> completed{0};
+
+    TaskCounter counter;
+    for (int i = 0; i < 32; ++i) {
+        pool.submit(makeTask([&]() {
+            TaskCounter inner;
+            pool.submit(makeTask([&completed]() { completed.fetch_add(1); }), inner);
+            pool.waitFor(inner);
+        }), counter);
+    }
+    spinUntilDone(counter);
+
+    EXPECT_EQ(completed.load(), 32);
+}
+
+} // namespace test
+} // namespace vesper
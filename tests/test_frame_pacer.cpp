@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include "runtime/core/threading/frame_pacer.h"
+#include "runtime/core/threading/worker_pool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+/// Interrupt condition that is always true: turns a blocking wait into a non-blocking probe
+bool alwaysInterrupt() {
+    return true;
+}
+
+} // namespace
+
+TEST(FramePacerTest, OneFrameAheadAllowsTwoFramesInFlight) {
+    FramePacer pacer(1);
+
+    for (int frame = 0; frame < 2; ++frame) {
+        ASSERT_EQ(pacer.waitForLogicSlot(alwaysInterrupt), FramePacer::WaitResult::Ready);
+        pacer.beginLogicFrame();
+        pacer.endLogicFrame();
+    }
+
+    // Frame 2 has to wait until render finishes frame 0
+    EXPECT_EQ(pacer.waitForLogicSlot(alwaysInterrupt), FramePacer::WaitResult::Interrupted);
+
+    ASSERT_EQ(pacer.waitForFrame(), FramePacer::WaitResult::Ready);
+    pacer.beginRenderFrame();
+    pacer.endRenderFrame();
+    EXPECT_EQ(pacer.waitForLogicSlot(alwaysInterrupt), FramePacer::WaitResult::Ready);
+}
+
+TEST(FramePacerTest, LockstepNeverOverlaps) {
+    FramePacer pacer(0);
+
+    ASSERT_EQ(pacer.waitForLogicSlot(alwaysInterrupt), FramePacer::WaitResult::Ready);
+    pacer.beginLogicFrame();
+    pacer.endLogicFrame();
+    EXPECT_EQ(pacer.waitForLogicSlot(alwaysInterrupt), FramePacer::WaitResult::Interrupted);
+}
+
+TEST(FramePacerTest, RenderTakesNewestFrameAndCountsSkipped) {
+    FramePacer pacer(2);
+
+    for (int frame = 0; frame < 3; ++frame) {
+        ASSERT_EQ(pacer.waitForLogicSlot(alwaysInterrupt), FramePacer::WaitResult::Ready);
+        pacer.beginLogicFrame();
+        pacer.endLogicFrame();
+    }
+
+    ASSERT_EQ(pacer.waitForFrame(), FramePacer::WaitResult::Ready);
+    EXPECT_EQ(pacer.beginRenderFrame(), 2u);
+    const FramePacer::FrameLatency latency = pacer.endRenderFrame();
+
+    EXPECT_EQ(latency.frameIndex, 2u);
+    EXPECT_EQ(latency.framesSkipped, 2u);
+    EXPECT_LE(latency.inputSampledNs, latency.producedNs);
+    EXPECT_LE(latency.producedNs, latency.consumeBeginNs);
+    EXPECT_LE(latency.consumeBeginNs, latency.consumedNs);
+    EXPECT_EQ(pacer.framesConsumed(), 3u);
+
+    // Nothing left to render
+    EXPECT_EQ(pacer.waitForFrame(alwaysInterrupt), FramePacer::WaitResult::Interrupted);
+}
+
+TEST(FramePacerTest, PipelinedThreadsStayWithinBudget) {
+    constexpr uint64_t kFrames = 2000;
+
+    for (uint32_t ahead = 0; ahead <= FramePacer::kMaxFramesAhead; ++ahead) {
+        FramePacer pacer(ahead);
+        std::atomic<uint64_t> worstLead{0};
+        uint64_t rendered = 0;
+
+        std::thread render([&]() {
+            while (pacer.waitForFrame() == FramePacer::WaitResult::Ready) {
+                pacer.beginRenderFrame();
+                const FramePacer::FrameLatency latency = pacer.endRenderFrame();
+                rendered += 1 + latency.framesSkipped;
+            }
+        });
+
+        for (uint64_t frame = 0; frame < kFrames; ++frame) {
+            ASSERT_EQ(pacer.waitForLogicSlot(), FramePacer::WaitResult::Ready);
+            const uint64_t lead = pacer.framesProduced() - pacer.framesConsumed();
+            worstLead.store(std::max(worstLead.load(), lead));
+            pacer.beginLogicFrame();
+            pacer.endLogicFrame();
+        }
+
+        // Let render drain, then shut down
+        while (pacer.framesConsumed() < kFrames) {
+            std::this_thread::yield();
+        }
+        pacer.stop();
+        render.join();
+
+        EXPECT_LE(worstLead.load(), ahead) << "framesAhead " << ahead;
+        EXPECT_EQ(rendered, kFrames);
+    }
+}
+
+TEST(FramePacerTest, StopUnblocksWaiters) {
+    FramePacer pacer(1);
+    std::atomic<int> stopped{0};
+
+    std::thread render([&]() {
+        if (pacer.waitForFrame() == FramePacer::WaitResult::Stopped) {
+            stopped.fetch_add(1);
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pacer.stop();
+    render.join();
+    EXPECT_EQ(stopped.load(), 1);
+}
+
+TEST(FramePacerTest, RenderOnlyTaskInterruptsRenderWait) {
+    WorkerPool pool;
+    WorkerPoolConfig config;
+    config.numWorkers = 1;
+    ASSERT_TRUE(pool.initialize(config));
+
+    FramePacer pacer(1);
+    pool.setAffinityWakeEvent(TaskAffinity::RenderOnly, &pacer.renderWakeEvent());
+
+    std::atomic<bool> ran{false};
+    std::thread render([&]() {
+        ScopedThreadRegistration registration(ThreadType::Render);
+        while (!ran.load()) {
+            const auto wait = pacer.waitForFrame([&pool]() {
+                return pool.hasPendingTasks(TaskAffinity::RenderOnly);
+            });
+            if (wait != FramePacer::WaitResult::Interrupted) {
+                break;
+            }
+            pool.processAllRenderTasks();
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pool.submit([&ran]() { ran.store(true); }, TaskAffinity::RenderOnly);
+    render.join();
+
+    EXPECT_TRUE(ran.load());
+    pool.setAffinityWakeEvent(TaskAffinity::RenderOnly, nullptr);
+    pool.shutdown();
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "runtime/function/framework/ecs/systems/frustum.h"
+#include "runtime/core/math/matrix4x4.h"
+#include "runtime/core/math/vector3.h"
+
+namespace vesper {
+namespace test {
+
+/// @brief Perspective frustum (1 rad vertical fov, 16:9) shared by the culling tests
+/// The default camera sits 50 units behind the origin looking at it, so a scene scattered in
+/// [-100, 100]^3 is partly inside, partly outside and partly on the planes.
+inline Frustum makeTestFrustum(const Vector3& eye = Vector3(0.0f, 0.0f, -50.0f),
+                               const Vector3& target = Vector3(0.0f, 0.0f, 0.0f),
+                               float farPlane = 120.0f)
+{
+    Frustum frustum;
+    const Matrix4x4 view = Matrix4x4::lookAtLH(eye, target, Vector3(0.0f, 1.0f, 0.0f));
+    const Matrix4x4 projection = Matrix4x4::perspectiveFovLH(1.0f, 16.0f / 9.0f, 0.1f, farPlane);
+    frustum.extractFromViewProjection(view * projection);
+    return frustum;
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/render/scene/instance_batcher.h"
+#include "runtime/function/render/scene/render_scene.h"
+#include "runtime/function/render/render_packet.h"
+#include "runtime/function/framework/ecs/ecs_types.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+uint32_t objectId(uint32_t index)
+{
+    return entityToId(entt::entt_traits<Entity>::construct(index, 0));
+}
+
+/// @brief Packet making objects [0, keys.size()) visible, object i with material/mesh keys[i]
+RenderPacket makePacket(const std::vector<std::pair<uint16_t, uint16_t>>& keys)
+{
+    RenderPacket packet;
+    packet.format = RenderPacketFormat::Full;
+    for (uint32_t i = 0; i < keys.size(); ++i)
+    {
+        RenderObjectDesc desc;
+        desc.object_id   = objectId(i);
+        desc.material_id = keys[i].first;
+        desc.mesh_id     = keys[i].second;
+        desc.transform[3] = static_cast<float>(i);
+        packet.visibleObjects.push_back(desc);
+    }
+    return packet;
+}
+
+} // namespace
+
+TEST(InstanceBatcherTest, GroupsByMaterialThenMesh) {
+    RenderScene scene;
+    scene.applyPacket(makePacket({{2, 1}, {1, 7}, {2, 1}, {1, 3}, {1, 7}, {2, 0}}));
+
+    InstanceBatcher batcher;
+    batcher.build(scene);
+    ASSERT_EQ(batcher.instanceCount(), 6u);
+    ASSERT_EQ(batcher.batchCount(), 4u);
+
+    const auto batches = batcher.batches();
+    const uint16_t expected[4][2] = {{1, 3}, {1, 7}, {2, 0}, {2, 1}};
+    uint32_t offset = 0;
+    for (size_t i = 0; i < batches.size(); ++i) {
+        EXPECT_EQ(batches[i].materialId, expected[i][0]);
+        EXPECT_EQ(batches[i].meshId, expected[i][1]);
+        EXPECT_EQ(batches[i].key, InstanceBatcher::makeKey(expected[i][0], expected[i][1]));
+        EXPECT_EQ(batches[i].firstInstance, offset);
+        offset += batches[i].instanceCount;
+    }
+    EXPECT_EQ(offset, 6u);
+
+    // Every slot of a batch carries the batch's key, in visible-list order
+    const auto slots = batcher.instanceSlots();
+    EXPECT_EQ(slots[1], scene.slotOf(objectId(1)));
+    EXPECT_EQ(slots[2], scene.slotOf(objectId(4)));
+    EXPECT_EQ(slots[4], scene.slotOf(objectId(0)));
+    EXPECT_EQ(slots[5], scene.slotOf(objectId(2)));
+}
+
+TEST(InstanceBatcherTest, EmptyAndSingleBatch) {
+    RenderScene scene;
+    InstanceBatcher batcher;
+    batcher.build(scene);
+    EXPECT_EQ(batcher.batchCount(), 0u);
+    EXPECT_EQ(batcher.instanceCount(), 0u);
+
+    scene.applyPacket(makePacket(std::vector<std::pair<uint16_t, uint16_t>>(100, {4, 9})));
+    batcher.build(scene);
+    ASSERT_EQ(batcher.batchCount(), 1u);
+    EXPECT_EQ(batcher.batches()[0].instanceCount, 100u);
+    EXPECT_TRUE(std::equal(batcher.instanceSlots().begin(), batcher.instanceSlots().end(),
+                           scene.visibleSlots().begin()));
+
+    // Rebuilding after the visible list shrinks drops the old batches
+    RenderPacket packet;
+    packet.format = RenderPacketFormat::Instanced;
+    packet.visibleInstances = {objectId(5), objectId(6)};
+    scene.applyPacket(packet);
+    batcher.build(scene);
+    ASSERT_EQ(batcher.batchCount(), 1u);
+    EXPECT_EQ(batcher.batches()[0].instanceCount, 2u);
+}
+
+TEST(InstanceBatcherTest, MatchesStableSortOnRandomKeys) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<uint32_t> material(0, 40);
+    std::uniform_int_distribution<uint32_t> mesh(0, 300);
+    std::vector<std::pair<uint16_t, uint16_t>> keys(20000);
+    for (auto& key : keys) {
+        key = {static_cast<uint16_t>(material(rng) * 1000), static_cast<uint16_t>(mesh(rng) * 200)};
+    }
+
+    RenderScene scene;
+    scene.applyPacket(makePacket(keys));
+    InstanceBatcher batcher;
+    batcher.build(scene);
+
+    std::vector<uint32_t> expected = scene.visibleSlots();
+    std::stable_sort(expected.begin(), expected.end(), [&](uint32_t a, uint32_t b) {
+        const RenderObjectDesc& da = scene.instance(a);
+        const RenderObjectDesc& db = scene.instance(b);
+        return InstanceBatcher::makeKey(da.material_id, da.mesh_id) <
+               InstanceBatcher::makeKey(db.material_id, db.mesh_id);
+    });
+    ASSERT_EQ(batcher.instanceCount(), expected.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), batcher.instanceSlots().begin()));
+
+    for (const InstanceBatch& batch : batcher.batches()) {
+        for (uint32_t i = batch.firstInstance; i < batch.firstInstance + batch.instanceCount; ++i) {
+            const RenderObjectDesc& desc = scene.instance(batcher.instanceSlots()[i]);
+            ASSERT_EQ(desc.material_id, batch.materialId);
+            ASSERT_EQ(desc.mesh_id, batch.meshId);
+        }
+    }
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/render/scene/instance_culler.h"
+#include "runtime/function/render/backend/null/null_rhi.h"
+#include "runtime/core/math/matrix4x4.h"
+
+#include <memory>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+struct CullerFixture
+{
+    std::unique_ptr<NullRHI> rhi = std::make_unique<NullRHI>();
+    InstanceCuller           culler;
+    RHITextureHandle         depth;
+    InstanceCullBuffers      buffers;
+};
+
+/// @brief Null RHI culler over a width x height depth buffer, frame 0 bound to fresh buffers
+bool initializeCuller(CullerFixture& fixture, uint32_t width, uint32_t height)
+{
+    fixture.rhi->initialize(RHIConfig{});
+
+    RHITextureDesc depthDesc{};
+    depthDesc.extent = {width, height, 1};
+    depthDesc.format = RHIFormat::D32_FLOAT;
+    depthDesc.usage  = RHITextureUsage::DepthStencil | RHITextureUsage::Sampled;
+    fixture.depth = fixture.rhi->createTexture(depthDesc);
+
+    if (!fixture.culler.initialize(fixture.rhi.get(), {}, {}, 2) ||
+        !fixture.culler.resize(fixture.depth, width, height))
+    {
+        return false;
+    }
+
+    const auto createBuffer = [&](uint64_t size, RHIBufferUsage usage) {
+        return fixture.rhi->createBuffer({size, usage, RHIMemoryUsage::CpuToGpu});
+    };
+    fixture.buffers.instances     = createBuffer(1024 * sizeof(SceneInstanceData), RHIBufferUsage::Storage);
+    fixture.buffers.candidates    = createBuffer(1024 * sizeof(InstanceCullCandidate), RHIBufferUsage::Storage);
+    fixture.buffers.instanceSlots = createBuffer(1024 * sizeof(uint32_t), RHIBufferUsage::Storage);
+    fixture.buffers.drawCommands  = createBuffer(16 * sizeof(RHIDrawIndexedIndirectCommand),
+                                                 RHIBufferUsage::Indirect | RHIBufferUsage::Storage);
+    fixture.culler.bindFrameBuffers(0, fixture.buffers);
+    return true;
+}
+
+} // namespace
+
+TEST(InstanceCullerTest, PyramidLevelsHalveDownToOneTexel) {
+    CullerFixture fixture;
+    ASSERT_TRUE(initializeCuller(fixture, 13, 6));
+
+    // Sizes round up, so every depth texel is under some texel of every level
+    const auto levels = fixture.culler.hizLevels();
+    const uint32_t expected[4][3] = {{7, 3, 0}, {4, 2, 21}, {2, 1, 29}, {1, 1, 31}};
+    ASSERT_EQ(levels.size(), 4u);
+    for (size_t i = 0; i < levels.size(); ++i) {
+        EXPECT_EQ(levels[i].width, expected[i][0]);
+        EXPECT_EQ(levels[i].height, expected[i][1]);
+        EXPECT_EQ(levels[i].offset, expected[i][2]);
+    }
+    ASSERT_TRUE(fixture.culler.hizPyramid());
+    EXPECT_EQ(fixture.culler.hizPyramid()->size, 32u * sizeof(float));
+
+    // 1280x720 goes down in 11 levels; a single pixel has no pyramid to build
+    ASSERT_TRUE(fixture.culler.resize(fixture.depth, 1280, 720));
+    EXPECT_EQ(fixture.culler.hizLevels().size(), 11u);
+    EXPECT_EQ(fixture.culler.hizLevels().back().width, 1u);
+    ASSERT_TRUE(fixture.culler.resize(fixture.depth, 1, 1));
+    EXPECT_TRUE(fixture.culler.hizLevels().empty());
+    EXPECT_FALSE(fixture.culler.hizPyramid());
+
+    fixture.culler.shutdown();
+    EXPECT_FALSE(fixture.culler.isInitialized());
+}
+
+TEST(InstanceCullerTest, BuildsThePyramidOnceTheDepthHasHistory) {
+    CullerFixture fixture;
+    ASSERT_TRUE(initializeCuller(fixture, 13, 6));
+    NullRHI& rhi = *fixture.rhi;
+    rhi.setRecordMode(NullRecordMode::Serialize);
+
+    auto pool = rhi.createCommandPool({});
+    auto cmd = rhi.allocateCommandBuffer(pool);
+    const Matrix4x4 viewProjection = Matrix4x4::perspectiveFovLH(0.8f, 1.5f, 0.1f, 100.0f);
+
+    // First frame: no previous depth, frustum culling only
+    rhi.beginCommandBuffer(cmd->id);
+    fixture.culler.recordCull(cmd->id, 0, viewProjection, 100);
+    rhi.endCommandBuffer(cmd->id);
+    EXPECT_TRUE(fixture.culler.hasHistory());
+    {
+        const std::vector<NullCommand>& commands = NullRHI::getRecordedCommands(cmd);
+        ASSERT_EQ(commands.size(), 4u);
+        EXPECT_EQ(commands[0].type, NullCommandType::BindPipeline);
+        EXPECT_EQ(commands[1].type, NullCommandType::BindDescriptorSets);
+        EXPECT_EQ(commands[1].args[2], 2u);
+        ASSERT_EQ(commands[2].type, NullCommandType::Dispatch);
+        EXPECT_EQ(commands[2].args[0], 2u);  // 100 candidates, 64 per group
+        ASSERT_EQ(commands[3].type, NullCommandType::PipelineBarrier);
+        EXPECT_EQ(commands[3].args[0], 2u);  // Draw commands and slots, for the draws
+    }
+
+    // The frame rendered its depth: the next one reads it into the pyramid, level by level
+    RHITextureBarrier depthWrite{};
+    depthWrite.texture  = fixture.depth->id;
+    depthWrite.srcState = RHIResourceState::Undefined;
+    depthWrite.dstState = RHIResourceState::DepthWrite;
+    rhi.beginCommandBuffer(cmd->id);
+    rhi.cmdPipelineBarrier(cmd->id, {}, std::span(&depthWrite, 1));
+    fixture.culler.recordCull(cmd->id, 0, viewProjection, 100);
+    rhi.endCommandBuffer(cmd->id);
+    {
+        const NullCommandCounts& counts = NullRHI::getRecordedCounts(cmd);
+        EXPECT_EQ(counts.count(NullCommandType::Dispatch), 4u + 1u);
+        EXPECT_EQ(counts.count(NullCommandType::PushConstants), 4u);
+        EXPECT_EQ(counts.textureBarriers, 2u);
+        EXPECT_EQ(counts.bufferBarriers, 1u + 4u + 2u);
+        EXPECT_EQ(fixture.depth->currentState, RHIResourceState::ShaderResource);
+
+        std::vector<const NullCommand*> dispatches;
+        for (const NullCommand& command : NullRHI::getRecordedCommands(cmd)) {
+            if (command.type == NullCommandType::Dispatch) {
+                dispatches.push_back(&command);
+            }
+        }
+        ASSERT_EQ(dispatches.size(), 5u);
+        EXPECT_EQ(dispatches[0]->args[0], 1u);  // 7x3 in 8x8 groups
+        EXPECT_EQ(dispatches[0]->args[1], 1u);
+        EXPECT_EQ(dispatches[4]->args[0], 2u);  // The cull comes last
+    }
+
+    // Without history (the depth holds something else), or without candidates, nothing is built
+    fixture.culler.invalidateHistory();
+    rhi.beginCommandBuffer(cmd->id);
+    fixture.culler.recordCull(cmd->id, 0, viewProjection, 100);
+    fixture.culler.recordCull(cmd->id, 0, viewProjection, 0);
+    rhi.endCommandBuffer(cmd->id);
+    EXPECT_EQ(NullRHI::getRecordedCounts(cmd).count(NullCommandType::Dispatch), 1u);
+
+    fixture.culler.shutdown();
+}
+
+} // namespace test
+} // namespace vesper
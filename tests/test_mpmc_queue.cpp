@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include "runtime/core/threading/mpmc_queue.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+TEST(MPMCQueueTest, FifoOnSingleThread) {
+    MPMCQueue<int, 8> queue;
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(queue.tryEnqueue(i));
+    }
+    EXPECT_EQ(queue.size(), 5u);
+
+    int value = -1;
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(queue.tryDequeue(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_FALSE(queue.tryDequeue(value));
+}
+
+TEST(MPMCQueueTest, FullQueueRejectsAndWrapsAround) {
+    MPMCQueue<int, 4> queue;
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(queue.tryEnqueue(lap * 4 + i));
+        }
+        EXPECT_TRUE(queue.isFull());
+        EXPECT_FALSE(queue.tryEnqueue(99));
+
+        for (int i = 0; i < 4; ++i) {
+            auto value = queue.tryDequeue();
+            ASSERT_TRUE(value.has_value());
+            EXPECT_EQ(*value, lap * 4 + i);
+        }
+    }
+    EXPECT_EQ(queue.stats().peak_depth.load(), 4u);
+}
+
+TEST(MPMCQueueTest, DropNewestPolicyCountsDrops) {
+    MPMCQueue<int, 2> queue;
+    EXPECT_TRUE(queue.enqueue(1, OverflowPolicy::DropNewest));
+    EXPECT_TRUE(queue.enqueue(2, OverflowPolicy::DropNewest));
+    EXPECT_FALSE(queue.enqueue(3, OverflowPolicy::DropNewest));
+    EXPECT_EQ(queue.stats().drop_count.load(), 1u);
+    EXPECT_EQ(queue.stats().enqueue_count.load(), 2u);
+}
+
+TEST(MPMCQueueTest, FailedEnqueueLeavesMoveOnlyItemIntact) {
+    MPMCQueue<std::unique_ptr<int>, 2> queue;
+    ASSERT_TRUE(queue.tryEnqueue(std::make_unique<int>(1)));
+    ASSERT_TRUE(queue.tryEnqueue(std::make_unique<int>(2)));
+
+    auto item = std::make_unique<int>(3);
+    EXPECT_FALSE(queue.tryEnqueue(std::move(item)));
+    ASSERT_NE(item, nullptr);
+    EXPECT_EQ(*item, 3);
+}
+
+TEST(MPMCQueueTest, BlockPolicyWaitsForConsumer) {
+    MPMCQueue<int, 2> queue;
+    ASSERT_TRUE(queue.tryEnqueue(1));
+    ASSERT_TRUE(queue.tryEnqueue(2));
+
+    std::atomic<bool> enqueued{false};
+    std::thread producer([&]() {
+        enqueued.store(queue.enqueue(3, OverflowPolicy::Block));
+    });
+
+    int value = 0;
+    while (!queue.tryDequeue(value)) {
+        std::this_thread::yield();
+    }
+    producer.join();
+
+    EXPECT_TRUE(enqueued.load());
+    EXPECT_EQ(queue.size(), 2u);
+}
+
+TEST(MPMCQueueTest, ShutdownUnblocksProducer) {
+    MPMCQueue<int, 2> queue;
+    ASSERT_TRUE(queue.tryEnqueue(1));
+    ASSERT_TRUE(queue.tryEnqueue(2));
+
+    std::atomic<int> result{-1};
+    std::thread producer([&]() {
+        result.store(queue.enqueue(3, OverflowPolicy::Block) ? 1 : 0);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    queue.shutdown();
+    producer.join();
+
+    EXPECT_EQ(result.load(), 0);
+    EXPECT_EQ(queue.stats().drop_count.load(), 1u);
+}
+
+TEST(MPMCQueueTest, ConcurrentProducersAndConsumersSeeEveryItemOnce) {
+    constexpr int kProducers = 4;
+    constexpr int kConsumers = 4;
+    constexpr int kPerProducer = 20000;
+    MPMCQueue<int, 256> queue;
+    std::vector<std::atomic<int>> seen(kProducers * kPerProducer);
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < kPerProducer; ++i) {
+                queue.enqueue(p * kPerProducer + i, OverflowPolicy::Block);
+            }
+        });
+    }
+    for (int c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&]() {
+            int value = 0;
+            while (consumed.load(std::memory_order_relaxed) < kProducers * kPerProducer) {
+                if (queue.tryDequeue(value)) {
+                    seen[value].fetch_add(1, std::memory_order_relaxed);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < seen.size(); ++i) {
+        ASSERT_EQ(seen[i].load(), 1) << "item " << i;
+    }
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+} // namespace test
+} // namespace vesper
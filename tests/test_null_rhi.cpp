@@ -0,0 +1,566 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/render/backend/null/null_rhi.h"
+#include "runtime/function/render/render_system.h"
+#include "runtime/function/render/mesh.h"
+#include "runtime/function/render/mesh_primitives.h"
+#include "runtime/function/render/render_packet.h"
+#include "runtime/function/framework/ecs/ecs_types.h"
+#include "runtime/core/threading/worker_pool.h"
+#include "runtime/core/math/matrix4x4.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+std::unique_ptr<NullRHI> createNullRHI()
+{
+    auto rhi = std::make_unique<NullRHI>();
+    RHIConfig config{};
+    config.enableValidation = true;
+    rhi->initialize(config);
+    return rhi;
+}
+
+/// @brief Packet with objectCount visible instances in a grid, spread over meshCount meshes
+RenderPacket makeScenePacket(uint32_t objectCount, uint32_t meshCount)
+{
+    RenderPacket packet;
+    packet.format = RenderPacketFormat::Full;
+    for (uint32_t i = 0; i < objectCount; ++i)
+    {
+        RenderObjectDesc desc;
+        desc.object_id = entityToId(entt::entt_traits<Entity>::construct(i, 0));
+        desc.mesh_id = static_cast<uint16_t>(1 + i % meshCount);
+        desc.transform[3] = static_cast<float>(i % 64) - 32.0f;
+        desc.transform[7] = static_cast<float>(i / 64 % 64) - 32.0f;
+        packet.visibleObjects.push_back(desc);
+    }
+    return packet;
+}
+
+/// @brief Register a cube mesh of its own for each mesh_id in [1, meshCount]
+void registerCubeMeshes(RenderSystem& renderSystem, uint32_t meshCount)
+{
+    const MeshData cube = createColorCubeMesh();
+    for (uint32_t meshId = 1; meshId <= meshCount; ++meshId)
+    {
+        renderSystem.registerSceneMesh(static_cast<uint16_t>(meshId), Mesh::create(renderSystem.getRHI(), cube));
+    }
+}
+
+/// @brief Headless render system drawing a packet's scene, recorded by pool's workers when given
+std::unique_ptr<RenderSystem> createSceneRenderSystem(WorkerPool* pool, uint32_t objectCount,
+                                                      uint32_t meshCount, uint32_t drawsPerTask,
+                                                      bool gpuCulling = true)
+{
+    RenderSystemConfig config{};
+    config.backend = RHIBackendType::Null;
+    config.workerPool = pool;
+    config.sceneDrawsPerTask = drawsPerTask;
+    config.gpuCulling = gpuCulling;
+
+    auto renderSystem = std::make_unique<RenderSystem>();
+    if (!renderSystem->initialize(config))
+    {
+        return nullptr;
+    }
+    registerCubeMeshes(*renderSystem, meshCount);
+    renderSystem->applyRenderPacket(makeScenePacket(objectCount, meshCount));
+    return renderSystem;
+}
+
+} // namespace
+
+TEST(NullRHITest, RecorderCountsAndSerializesCommands) {
+    auto rhi = createNullRHI();
+    rhi->setRecordMode(NullRecordMode::Serialize);
+
+    auto pool = rhi->createCommandPool({});
+    auto cmd = rhi->allocateCommandBuffer(pool);
+    auto pipeline = rhi->createGraphicsPipeline({});
+    auto texture = rhi->createTexture({});
+    auto buffer = rhi->createBuffer({1024, RHIBufferUsage::Vertex});
+
+    rhi->beginCommandBuffer(cmd->id);
+    RHITextureBarrier barrier{};
+    barrier.texture  = texture->id;
+    barrier.srcState = RHIResourceState::Undefined;
+    barrier.dstState = RHIResourceState::ShaderResource;
+    rhi->cmdPipelineBarrier(cmd->id, {}, std::span(&barrier, 1));
+    rhi->cmdBindPipeline(cmd->id, pipeline->id);
+    rhi->cmdBindVertexBuffer(cmd->id, 0, buffer->id, 64);
+    const float mvp[16] = {};
+    rhi->cmdPushConstants(cmd->id, pipeline->id, RHIShaderStage::Vertex, 0, sizeof(mvp), mvp);
+    rhi->cmdDraw(cmd->id, 3, 2, 0, 1);
+    rhi->cmdDrawIndexed(cmd->id, 36, 1, 0, -4, 0);
+    rhi->endCommandBuffer(cmd->id);
+
+    // Barriers track texture state whatever the record mode
+    EXPECT_EQ(texture->currentState, RHIResourceState::ShaderResource);
+
+    const NullCommandCounts& counts = NullRHI::getRecordedCounts(cmd);
+    EXPECT_EQ(counts.total(), 6u);
+    EXPECT_EQ(counts.drawCalls(), 2u);
+    EXPECT_EQ(counts.textureBarriers, 1u);
+    EXPECT_EQ(counts.pushConstantBytes, sizeof(mvp));
+
+    const std::vector<NullCommand>& commands = NullRHI::getRecordedCommands(cmd);
+    ASSERT_EQ(commands.size(), 6u);
+    EXPECT_EQ(commands[0].type, NullCommandType::PipelineBarrier);
+    EXPECT_EQ(commands[0].args[1], 1u);
+    EXPECT_EQ(commands[1].type, NullCommandType::BindPipeline);
+    EXPECT_EQ(commands[1].args[0], pipeline->id.value());
+    EXPECT_EQ(commands[2].args[1], buffer->id.value());
+    EXPECT_EQ(commands[2].args[2], 64u);
+    EXPECT_EQ(commands[4].type, NullCommandType::Draw);
+    EXPECT_EQ(commands[4].args[1], 2u);
+    EXPECT_EQ(static_cast<int32_t>(commands[5].args[3]), -4);
+
+    // Submission adds the command buffer's counts to the device's and signals the fence
+    auto fence = rhi->createFence(false);
+    RHI::SubmitInfo submitInfo{};
+    submitInfo.commandBuffers = std::span(&cmd, 1);
+    submitInfo.fence = fence;
+    rhi->queueSubmit(rhi->getQueue(RHIQueueType::Graphics), submitInfo);
+    EXPECT_TRUE(rhi->isFenceSignaled(fence));
+
+    const NullRHIStats stats = rhi->getStats();
+    EXPECT_EQ(stats.submits, 1u);
+    EXPECT_EQ(stats.submitted.total(), 6u);
+    EXPECT_EQ(stats.submitted.count(NullCommandType::PushConstants), 1u);
+
+    // Beginning again drops the previous recording; Off mode records nothing
+    rhi->setRecordMode(NullRecordMode::Off);
+    rhi->beginCommandBuffer(cmd->id);
+    rhi->cmdDraw(cmd->id, 3);
+    rhi->endCommandBuffer(cmd->id);
+    EXPECT_EQ(NullRHI::getRecordedCounts(cmd).total(), 0u);
+    EXPECT_TRUE(NullRHI::getRecordedCommands(cmd).empty());
+}
+
+TEST(NullRHITest, OffscreenSwapChainAndBuffers) {
+    auto rhi = createNullRHI();
+    EXPECT_EQ(rhi->getBackendType(), RHIBackendType::Null);
+
+    RHISwapChainDesc desc{};
+    desc.width = 640;
+    desc.height = 480;
+    desc.imageCount = 3;
+    auto swapChain = rhi->createSwapChain(desc);
+    ASSERT_TRUE(swapChain);
+    ASSERT_EQ(rhi->getSwapChainImageCount(swapChain), 3u);
+    EXPECT_EQ(rhi->getSwapChainImage(swapChain, 2)->extent.width, 640u);
+
+    // Images come round in order, one per presented frame
+    auto queue = rhi->getQueue(RHIQueueType::Graphics);
+    for (uint32_t frame = 0; frame < 7; ++frame) {
+        uint32_t imageIndex = UINT32_MAX;
+        ASSERT_EQ(rhi->acquireNextImage(swapChain, nullptr, nullptr, UINT64_MAX, &imageIndex), RHI::AcquireResult::Success);
+        EXPECT_EQ(imageIndex, frame % 3);
+
+        RHI::PresentInfo presentInfo{};
+        presentInfo.swapChain = swapChain;
+        presentInfo.imageIndex = imageIndex;
+        EXPECT_TRUE(rhi->queuePresent(queue, presentInfo));
+    }
+    EXPECT_EQ(rhi->getCurrentFrameIndex(), 7u);
+    EXPECT_EQ(rhi->getCompletedFrameIndex(), 6u);
+    EXPECT_EQ(rhi->getStats().presents, 7u);
+
+    rhi->resizeSwapChain(swapChain, 0, 0);
+    uint32_t imageIndex = 0;
+    EXPECT_EQ(rhi->acquireNextImage(swapChain, nullptr, nullptr, UINT64_MAX, &imageIndex), RHI::AcquireResult::OutOfDate);
+
+    // CPU-visible buffers are mapped from creation; GPU-only ones get memory once mapped
+    auto staging = rhi->createBuffer({16, RHIBufferUsage::TransferSrc, RHIMemoryUsage::CpuToGpu});
+    ASSERT_NE(staging->mappedData, nullptr);
+    const uint32_t values[4] = {1, 2, 3, 4};
+    rhi->updateBuffer(staging, values, sizeof(values));
+    EXPECT_EQ(std::memcmp(rhi->mapBuffer(staging), values, sizeof(values)), 0);
+
+    auto gpuOnly = rhi->createBuffer({16, RHIBufferUsage::Storage});
+    EXPECT_EQ(gpuOnly->mappedData, nullptr);
+    std::memcpy(rhi->mapBuffer(gpuOnly), values, sizeof(values));
+    rhi->unmapBuffer(gpuOnly);
+    EXPECT_EQ(std::memcmp(rhi->mapBuffer(gpuOnly), values, sizeof(values)), 0);
+}
+
+TEST(NullRHITest, RenderSystemTicksHeadless) {
+    RenderSystemConfig config{};
+    config.backend = RHIBackendType::Null;
+    config.headlessWidth = 320;
+    config.headlessHeight = 240;
+
+    RenderSystem renderSystem;
+    ASSERT_TRUE(renderSystem.initialize(config));
+    EXPECT_TRUE(renderSystem.isHeadless());
+    ASSERT_EQ(renderSystem.getRHI()->getBackendType(), RHIBackendType::Null);
+
+    auto* rhi = static_cast<NullRHI*>(renderSystem.getRHI());
+    rhi->resetStats();
+
+    constexpr uint32_t kFrames = 10;
+    for (uint32_t frame = 0; frame < kFrames; ++frame) {
+        renderSystem.tick(1.0f / 60.0f);
+    }
+
+    const NullRHIStats stats = rhi->getStats();
+    EXPECT_EQ(stats.submits, kFrames);
+    EXPECT_EQ(stats.presents, kFrames);
+    EXPECT_EQ(stats.submitted.count(NullCommandType::BeginRendering), kFrames);
+    EXPECT_GE(stats.submitted.drawCalls(), kFrames);
+    EXPECT_EQ(stats.submitted.textureBarriers, 3u * kFrames);
+
+    // Every presented image ends the frame in the Present state
+    RHITextureHandle image = rhi->getSwapChainImage(renderSystem.getSwapChain(), 0);
+    EXPECT_EQ(image->currentState, RHIResourceState::Present);
+
+    // Resizing without a window goes through the same swapchain recreation
+    renderSystem.onWindowResize(160, 120);
+    renderSystem.tick(1.0f / 60.0f);
+    renderSystem.tick(1.0f / 60.0f);
+    EXPECT_EQ(renderSystem.getSwapChain()->width, 160u);
+    EXPECT_EQ(rhi->getStats().presents, kFrames + 1);
+
+    renderSystem.shutdown();
+}
+
+TEST(NullRHITest, RenderSystemDrawsSceneBatchesInParallel) {
+    constexpr uint32_t kObjects = 3000;
+    constexpr uint32_t kMeshes = 64;
+    constexpr uint32_t kFrames = 4;
+
+    WorkerPool pool;
+    WorkerPoolConfig poolConfig;
+    poolConfig.numWorkers = 4;
+    ASSERT_TRUE(pool.initialize(poolConfig));
+
+    const auto runFrames = [&](WorkerPool* workers, uint32_t& taskCount) {
+        auto renderSystem = createSceneRenderSystem(workers, kObjects, kMeshes, 8, false);
+        EXPECT_NE(renderSystem, nullptr);
+        if (!renderSystem) {
+            return NullRHIStats{};
+        }
+        auto* rhi = static_cast<NullRHI*>(renderSystem->getRHI());
+        rhi->resetStats();
+        for (uint32_t frame = 0; frame < kFrames; ++frame) {
+            renderSystem->tick(1.0f / 60.0f);
+        }
+        taskCount = renderSystem->getSceneTaskCount();
+        EXPECT_EQ(renderSystem->getInstanceBatcher().batchCount(), kMeshes);
+
+        // The pass that the scene buffers continued still ends with the image ready to present
+        RHITextureHandle image = rhi->getSwapChainImage(renderSystem->getSwapChain(), 0);
+        EXPECT_EQ(image->currentState, RHIResourceState::Present);
+
+        const NullRHIStats stats = rhi->getStats();
+        renderSystem->shutdown();
+        return stats;
+    };
+
+    uint32_t parallelTasks = 0;
+    uint32_t serialTasks = 0;
+    const NullRHIStats parallel = runFrames(&pool, parallelTasks);
+    const NullRHIStats serial = runFrames(nullptr, serialTasks);
+
+    // One buffer per worker plus the calling thread; without a pool everything goes in one
+    EXPECT_EQ(parallelTasks, pool.workerCount() + 1);
+    EXPECT_EQ(serialTasks, 1u);
+
+    // Main buffer, the scene buffers, then the buffer that closes the pass
+    EXPECT_EQ(parallel.submits, kFrames);
+    EXPECT_EQ(parallel.commandBuffersSubmitted, kFrames * (parallelTasks + 2));
+    EXPECT_EQ(serial.commandBuffersSubmitted, kFrames * (serialTasks + 2));
+    EXPECT_EQ(parallel.submitted.count(NullCommandType::BeginRendering), kFrames * (parallelTasks + 2));
+    EXPECT_EQ(parallel.submitted.count(NullCommandType::BeginRendering),
+              parallel.submitted.count(NullCommandType::EndRendering));
+
+    // One indirect draw per batch (plus the fallback cube), however the batches were split
+    EXPECT_EQ(parallel.submitted.count(NullCommandType::DrawIndexedIndirect), kFrames * kMeshes);
+    EXPECT_EQ(parallel.submitted.drawCalls(), kFrames * (kMeshes + 1));
+    EXPECT_EQ(serial.submitted.drawCalls(), parallel.submitted.drawCalls());
+    EXPECT_EQ(parallel.submitted.textureBarriers, 3u * kFrames);
+
+    pool.shutdown();
+}
+
+TEST(NullRHITest, SceneInstancesReachTheIndirectBuffers) {
+    constexpr uint32_t kObjects = 1000;
+    constexpr uint32_t kMeshes = 3;
+
+    // Without GPU culling the CPU writes the final draws
+    auto renderSystem = createSceneRenderSystem(nullptr, kObjects, kMeshes, 256, false);
+    ASSERT_NE(renderSystem, nullptr);
+    ASSERT_FALSE(renderSystem->isGpuCullingActive());
+    auto* rhi = static_cast<NullRHI*>(renderSystem->getRHI());
+    rhi->setRecordMode(NullRecordMode::Serialize);
+    renderSystem->tick(1.0f / 60.0f);
+    ASSERT_EQ(renderSystem->getSceneTaskCount(), 1u);
+
+    const RenderScene& scene = renderSystem->getRenderScene();
+    const FrameResources& frame = renderSystem->getFrameResources(0);
+    const auto batches = renderSystem->getInstanceBatcher().batches();
+    ASSERT_EQ(batches.size(), kMeshes);
+
+    // One indirect command per batch, drawing the batch's range of the slot buffer
+    const auto* commands = static_cast<const RHIDrawIndexedIndirectCommand*>(rhi->mapBuffer(frame.indirectBuffer));
+    const auto* slots = static_cast<const uint32_t*>(rhi->mapBuffer(frame.instanceSlotBuffer));
+    const auto* instanceData = static_cast<const SceneInstanceData*>(rhi->mapBuffer(frame.instanceBuffer));
+    uint32_t drawn = 0;
+    for (size_t i = 0; i < batches.size(); ++i) {
+        EXPECT_EQ(commands[i].instanceCount, batches[i].instanceCount);
+        EXPECT_EQ(commands[i].firstInstance, drawn);
+        EXPECT_EQ(commands[i].indexCount, 36u);
+        for (uint32_t j = 0; j < commands[i].instanceCount; ++j) {
+            const uint32_t slot = slots[commands[i].firstInstance + j];
+            ASSERT_EQ(scene.instance(slot).mesh_id, batches[i].meshId);
+            ASSERT_EQ(std::memcmp(instanceData[slot].transform, scene.instance(slot).transform,
+                                  sizeof(float) * kAffineMatrixFloats), 0);
+            ASSERT_EQ(std::memcmp(instanceData[slot].boundingSphere, scene.instance(slot).bounding_sphere,
+                                  sizeof(float) * 4), 0);
+        }
+        drawn += commands[i].instanceCount;
+    }
+    EXPECT_EQ(drawn, kObjects);
+
+    // The scene buffer resumes and suspends the main pass and draws each batch indirectly
+    std::vector<const NullCommand*> indirectDraws;
+    uint64_t beginFlags = 0;
+    for (const NullCommand& command : NullRHI::getRecordedCommands(frame.sceneCommandBuffers[0])) {
+        if (command.type == NullCommandType::BeginRendering) {
+            beginFlags = command.args[4];
+        }
+        if (command.type == NullCommandType::DrawIndexedIndirect) {
+            indirectDraws.push_back(&command);
+        }
+    }
+    EXPECT_EQ(beginFlags, 3u);
+    ASSERT_EQ(indirectDraws.size(), kMeshes);
+    for (size_t i = 0; i < indirectDraws.size(); ++i) {
+        EXPECT_EQ(indirectDraws[i]->args[0], frame.indirectBuffer->id.value());
+        EXPECT_EQ(indirectDraws[i]->args[1], i * sizeof(RHIDrawIndexedIndirectCommand));
+        EXPECT_EQ(indirectDraws[i]->args[2], 1u);
+    }
+
+    // Only the last buffer moves the image to present
+    EXPECT_EQ(NullRHI::getRecordedCounts(frame.commandBuffer).textureBarriers, 2u);
+    EXPECT_EQ(NullRHI::getRecordedCounts(frame.finishCommandBuffer).textureBarriers, 1u);
+
+    renderSystem->shutdown();
+}
+
+TEST(NullRHITest, InstanceBuffersOnlyReceiveChangedSlots) {
+    constexpr uint32_t kObjects = 500;
+
+    auto renderSystem = createSceneRenderSystem(nullptr, kObjects, 1, 256);
+    ASSERT_NE(renderSystem, nullptr);
+    auto* rhi = static_cast<NullRHI*>(renderSystem->getRHI());
+    const uint32_t framesInFlight = renderSystem->getFramesInFlight();
+
+    // Every frame in flight fills its own copy once
+    for (uint32_t frame = 0; frame < framesInFlight; ++frame) {
+        renderSystem->tick(1.0f / 60.0f);
+    }
+
+    // Scribble over every copy: only the slot that moved may be rewritten from now on
+    for (uint32_t frame = 0; frame < framesInFlight; ++frame) {
+        const FrameResources& resources = renderSystem->getFrameResources(frame);
+        std::memset(rhi->mapBuffer(resources.instanceBuffer), 0, resources.instanceBuffer->size);
+    }
+
+    RenderPacket packet = makeScenePacket(kObjects, 1);
+    packet.visibleObjects[7].transform[3] = 1000.0f;
+    renderSystem->applyRenderPacket(packet);
+    const uint32_t movedSlot = renderSystem->getRenderScene().slotOf(packet.visibleObjects[7].object_id);
+    for (uint32_t frame = 0; frame < framesInFlight; ++frame) {
+        renderSystem->tick(1.0f / 60.0f);
+    }
+
+    for (uint32_t frame = 0; frame < framesInFlight; ++frame) {
+        const auto* instanceData = static_cast<const SceneInstanceData*>(
+            rhi->mapBuffer(renderSystem->getFrameResources(frame).instanceBuffer));
+        EXPECT_EQ(instanceData[movedSlot].transform[3], 1000.0f);
+        EXPECT_EQ(instanceData[movedSlot].transform[0], 1.0f);
+        EXPECT_EQ(instanceData[movedSlot].boundingSphere[3], 1.0f);
+        EXPECT_EQ(instanceData[(movedSlot + 1) % kObjects].transform[0], 0.0f);
+    }
+
+    renderSystem->shutdown();
+}
+
+TEST(NullRHITest, PendingInstanceSlotsStayBoundedWhileNothingIsDrawn) {
+    constexpr uint32_t kObjects = 100;
+    constexpr uint32_t kFrames = 64;
+
+    auto renderSystem = createSceneRenderSystem(nullptr, kObjects, 1, 256);
+    ASSERT_NE(renderSystem, nullptr);
+    renderSystem->tick(1.0f / 60.0f);
+
+    // Every object moves off-screen and keeps moving: each frame dirties every slot, draws no batch
+    RenderPacket packet = makeScenePacket(kObjects, 1);
+    packet.format = RenderPacketFormat::Instanced;
+    packet.objectsToUpdate = packet.visibleObjects;
+    packet.visibleObjects.clear();
+    for (uint32_t frame = 0; frame < kFrames; ++frame) {
+        for (RenderObjectDesc& desc : packet.objectsToUpdate) {
+            desc.transform[3] = 1000.0f + static_cast<float>(frame);
+        }
+        renderSystem->applyRenderPacket(packet);
+        renderSystem->tick(1.0f / 60.0f);
+        ASSERT_EQ(renderSystem->getInstanceBatcher().batchCount(), 0u);
+
+        for (uint32_t i = 0; i < renderSystem->getFramesInFlight(); ++i) {
+            ASSERT_LT(renderSystem->getFrameResources(i).pendingSlots.size(), kObjects);
+        }
+    }
+
+    // Back on screen, each copy is rewritten whole
+    packet = makeScenePacket(kObjects, 1);
+    renderSystem->applyRenderPacket(packet);
+    auto* rhi = static_cast<NullRHI*>(renderSystem->getRHI());
+    for (uint32_t frame = 0; frame < renderSystem->getFramesInFlight(); ++frame) {
+        renderSystem->tick(1.0f / 60.0f);
+    }
+    for (uint32_t frame = 0; frame < renderSystem->getFramesInFlight(); ++frame) {
+        const auto* instanceData = static_cast<const SceneInstanceData*>(
+            rhi->mapBuffer(renderSystem->getFrameResources(frame).instanceBuffer));
+        const RenderScene& scene = renderSystem->getRenderScene();
+        for (uint32_t slot = 0; slot < kObjects; ++slot) {
+            ASSERT_EQ(instanceData[slot].transform[3], scene.instance(slot).transform[3]);
+        }
+    }
+
+    renderSystem->shutdown();
+}
+
+TEST(NullRHITest, SceneIsSkippedWhenItsBuffersCannotBeCreated) {
+    auto renderSystem = createSceneRenderSystem(nullptr, 16, 1, 256, false);
+    ASSERT_NE(renderSystem, nullptr);
+    auto* rhi = static_cast<NullRHI*>(renderSystem->getRHI());
+
+    // The instance buffer cannot be created: no scene task may record from the missing buffers
+    rhi->setMaxBufferSize(1024);
+    renderSystem->tick(1.0f / 60.0f);
+    EXPECT_EQ(renderSystem->getInstanceBatcher().batchCount(), 1u);
+    EXPECT_EQ(renderSystem->getSceneTaskCount(), 0u);
+    EXPECT_EQ(renderSystem->getFrameResources(0).instanceBuffer, nullptr);
+
+    // Memory back: the scene is drawn again
+    rhi->setMaxBufferSize(0);
+    for (uint32_t frame = 0; frame < renderSystem->getFramesInFlight(); ++frame) {
+        renderSystem->tick(1.0f / 60.0f);
+        EXPECT_EQ(renderSystem->getSceneTaskCount(), 1u);
+    }
+
+    renderSystem->shutdown();
+}
+
+TEST(NullRHITest, InstancesWithoutASceneMeshAreNotDrawn) {
+    constexpr uint32_t kObjects = 300;
+    constexpr uint32_t kMeshes = 3;
+
+    RenderSystemConfig config{};
+    config.backend = RHIBackendType::Null;
+    config.gpuCulling = false;
+    RenderSystem renderSystem;
+    ASSERT_TRUE(renderSystem.initialize(config));
+    auto* rhi = static_cast<NullRHI*>(renderSystem.getRHI());
+    rhi->setRecordMode(NullRecordMode::Serialize);
+
+    // Meshes 1 and 2 only; an invalid mesh or a second mesh for an id is refused
+    registerCubeMeshes(renderSystem, kMeshes - 1);
+    EXPECT_FALSE(renderSystem.registerSceneMesh(3, nullptr));
+    EXPECT_FALSE(renderSystem.registerSceneMesh(1, Mesh::create(rhi, createColorCubeMesh())));
+
+    renderSystem.applyRenderPacket(makeScenePacket(kObjects, kMeshes));
+    renderSystem.tick(1.0f / 60.0f);
+
+    const FrameResources& frame = renderSystem.getFrameResources(0);
+    const auto batches = renderSystem.getInstanceBatcher().batches();
+    const auto* commands = static_cast<const RHIDrawIndexedIndirectCommand*>(rhi->mapBuffer(frame.indirectBuffer));
+    ASSERT_EQ(batches.size(), kMeshes);
+    for (size_t i = 0; i < batches.size(); ++i) {
+        EXPECT_EQ(commands[i].indexCount, batches[i].meshId == kMeshes ? 0u : 36u);
+    }
+    EXPECT_EQ(NullRHI::getRecordedCounts(frame.sceneCommandBuffers[0]).count(NullCommandType::DrawIndexedIndirect),
+              kMeshes - 1);
+
+    renderSystem.shutdown();
+}
+
+TEST(NullRHITest, SceneIsCulledOnTheGpuBeforeTheMainPass) {
+    constexpr uint32_t kObjects = 1000;
+    constexpr uint32_t kMeshes = 3;
+
+    auto renderSystem = createSceneRenderSystem(nullptr, kObjects, kMeshes, 256);
+    ASSERT_NE(renderSystem, nullptr);
+    ASSERT_TRUE(renderSystem->isGpuCullingActive());
+    const InstanceCuller& culler = renderSystem->getInstanceCuller();
+    EXPECT_EQ(culler.hizLevels().size(), 11u);  // 1280x720 down to 1x1
+
+    auto* rhi = static_cast<NullRHI*>(renderSystem->getRHI());
+    rhi->setRecordMode(NullRecordMode::Serialize);
+
+    // The cull's dispatch and barriers come before the main pass begins
+    const auto countBeforePass = [](const RHICommandBufferHandle& cmd, NullCommandType type) {
+        uint32_t count = 0;
+        for (const NullCommand& command : NullRHI::getRecordedCommands(cmd)) {
+            if (command.type == NullCommandType::BeginRendering) {
+                break;
+            }
+            count += command.type == type ? 1 : 0;
+        }
+        return count;
+    };
+
+    // First frame: no depth history yet, a single cull dispatch over every visible instance
+    renderSystem->tick(1.0f / 60.0f);
+    const FrameResources& frame = renderSystem->getFrameResources(0);
+    EXPECT_EQ(countBeforePass(frame.commandBuffer, NullCommandType::Dispatch), 1u);
+    EXPECT_TRUE(culler.hasHistory());
+
+    // The CPU writes what to cull and draws without instances: the cull fills the counts and slots
+    const auto batches = renderSystem->getInstanceBatcher().batches();
+    const auto slots = renderSystem->getInstanceBatcher().instanceSlots();
+    const auto* commands = static_cast<const RHIDrawIndexedIndirectCommand*>(rhi->mapBuffer(frame.indirectBuffer));
+    const auto* candidates = static_cast<const InstanceCullCandidate*>(rhi->mapBuffer(frame.cullCandidateBuffer));
+    ASSERT_EQ(batches.size(), kMeshes);
+    for (uint32_t i = 0; i < batches.size(); ++i) {
+        EXPECT_EQ(commands[i].instanceCount, 0u);
+        EXPECT_EQ(commands[i].firstInstance, batches[i].firstInstance);
+        for (uint32_t j = batches[i].firstInstance; j < batches[i].firstInstance + batches[i].instanceCount; ++j) {
+            ASSERT_EQ(candidates[j].slot, slots[j]);
+            ASSERT_EQ(candidates[j].batch, i);
+        }
+    }
+    EXPECT_EQ(NullRHI::getRecordedCounts(frame.sceneCommandBuffers[0]).count(NullCommandType::DrawIndexedIndirect),
+              kMeshes);
+
+    // Second frame: the first frame's depth is built into the pyramid, then culled against
+    renderSystem->tick(1.0f / 60.0f);
+    const FrameResources& next = renderSystem->getFrameResources(1);
+    EXPECT_EQ(countBeforePass(next.commandBuffer, NullCommandType::Dispatch), culler.hizLevels().size() + 1);
+    EXPECT_EQ(NullRHI::getRecordedCounts(next.commandBuffer).textureBarriers, 3u);
+
+    // A resize drops the history: the next frame culls against the frustum only
+    renderSystem->onWindowResize(640, 360);
+    renderSystem->tick(1.0f / 60.0f);
+    EXPECT_FALSE(culler.hasHistory());
+    EXPECT_EQ(culler.hizLevels().size(), 10u);
+    renderSystem->tick(1.0f / 60.0f);
+    const uint32_t resizedFrame = (renderSystem->getCurrentFrameIndex() + renderSystem->getFramesInFlight() - 1) %
+                                  renderSystem->getFramesInFlight();
+    EXPECT_EQ(countBeforePass(renderSystem->getFrameResources(resizedFrame).commandBuffer, NullCommandType::Dispatch),
+              1u);
+
+    renderSystem->shutdown();
+}
+
+} // namespace test
+} // namespace vesper
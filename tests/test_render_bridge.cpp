@@ -0,0 +1,333 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/framework/ecs/systems/render_bridge_system.h"
+#include "runtime/function/framework/component/mesh/render_resource_component.h"
+#include "runtime/function/framework/component/camera/camera_component.h"
+#include "runtime/function/framework/ecs/world.h"
+#include "runtime/function/render/render_packet.h"
+#include "runtime/core/threading/worker_pool.h"
+#include "test_frustum_utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+/// @brief Renderable entities with bounds scattered around the origin, transforms and bounds up to date
+std::vector<Entity> populate(World& world, size_t count, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+
+    std::vector<Entity> entities;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Entity entity = world.createEntity();
+        world.addComponent<TransformComponent>(entity).setPosition(Vector3(position(rng), position(rng), position(rng)));
+        world.addComponent<BoundingComponent>(entity).initFromSphere(Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+        world.addComponent<RenderableComponent>(entity).meshId = 1 + static_cast<uint32_t>(i % 7);
+        entities.push_back(entity);
+    }
+    world.updateTransforms();
+    world.updateBounds();
+    return entities;
+}
+
+void expectSameObjects(const std::vector<RenderObjectDesc>& actual, const std::vector<RenderObjectDesc>& expected)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        ASSERT_EQ(std::memcmp(&actual[i], &expected[i], sizeof(RenderObjectDesc)), 0) << "object " << i;
+    }
+}
+
+/// @brief Camera entity at z = -50 looking at the origin
+Entity createCamera(World& world)
+{
+    auto camera = std::make_shared<Camera>();
+    camera->setPosition(Vector3(0.0f, 0.0f, -50.0f));
+    camera->lookAt(Vector3(0.0f, 0.0f, 0.0f));
+
+    const Entity entity = world.createEntity();
+    world.addComponent<CameraComponent>(entity).camera = camera;
+    return entity;
+}
+
+const RenderObjectDesc* findObject(const RenderPacket& packet, Entity entity)
+{
+    for (const RenderObjectDesc& desc : packet.visibleObjects)
+    {
+        if (desc.object_id == entityToId(entity))
+        {
+            return &desc;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST(RenderBridgeTest, ParallelFillMatchesSerial) {
+    WorkerPool pool;
+    WorkerPoolConfig config;
+    config.numWorkers = 4;
+    ASSERT_TRUE(pool.initialize(config));
+
+    World world;
+    populate(world, 50000, 11);
+    const Frustum frustum = makeTestFrustum();
+
+    RenderPacket serial;
+    RenderPacket parallel;
+    RenderBridgeSystem::fillVisibleObjects(world.registry(), &serial, frustum);
+    RenderBridgeSystem::fillVisibleObjects(world.registry(), &parallel, frustum, &pool);
+    EXPECT_GT(serial.visibleObjects.size(), RenderBridgeSystem::kParallelChunkSize);
+    expectSameObjects(parallel.visibleObjects, serial.visibleObjects);
+
+    // Without culling: per-chunk counts and offsets must keep the serial order
+    serial.clear();
+    parallel.clear();
+    RenderBridgeSystem::fillVisibleObjectsNoClip(world.registry(), &serial);
+    RenderBridgeSystem::fillVisibleObjectsNoClip(world.registry(), &parallel, &pool);
+    EXPECT_EQ(serial.visibleObjects.size(), 50000u);
+    expectSameObjects(parallel.visibleObjects, serial.visibleObjects);
+    pool.shutdown();
+}
+
+TEST(RenderBridgeTest, RefillRewritesOnlyChangedObjects) {
+    World world;
+    populate(world, 2000, 5);
+    const Entity camera = createCamera(world);
+
+    RenderPacket packet;
+    RenderBridgeSystem::fillRenderPacket(world.registry(), &packet, camera);
+    ASSERT_GT(packet.visibleObjects.size(), 2u);
+    EXPECT_EQ(packet.objectsToUpdate.size(), 2000u);
+
+    // Mark every entry: a refill leaves the marks of objects it did not rewrite
+    for (RenderObjectDesc& desc : packet.visibleObjects)
+    {
+        desc.bounding_sphere[3] = 42.0f;
+    }
+
+    const Entity moved = idToEntity(packet.visibleObjects[0].object_id);
+    // The last culled slot: removing its bounds moves it to the unbounded tail without shifting the others
+    const Entity stripped = idToEntity(packet.visibleObjects.back().object_id);
+    world.patchComponent<TransformComponent>(moved, [](TransformComponent& transform) {
+        transform.setPosition(Vector3(0.5f, 0.0f, 0.0f));
+    });
+    world.removeComponent<BoundingComponent>(stripped);
+    world.updateTransforms();
+    world.updateBounds();
+
+    RenderBridgeSystem::fillRenderPacket(world.registry(), &packet, camera);
+    EXPECT_EQ(packet.objectsToUpdate.size(), 2u);
+
+    const RenderObjectDesc* movedDesc = findObject(packet, moved);
+    ASSERT_NE(movedDesc, nullptr);
+    EXPECT_EQ(movedDesc->bounding_sphere[3], 1.0f);
+    EXPECT_EQ(movedDesc->bounding_sphere[0], 0.5f);
+    EXPECT_EQ(movedDesc->transform[3], 0.5f);
+
+    const RenderObjectDesc* strippedDesc = findObject(packet, stripped);
+    ASSERT_NE(strippedDesc, nullptr);
+    EXPECT_EQ(strippedDesc->bounding_sphere[0], 0.0f);
+    EXPECT_EQ(strippedDesc->bounding_sphere[3], 1.0f);
+
+    size_t kept = 0;
+    for (const RenderObjectDesc& desc : packet.visibleObjects)
+    {
+        kept += desc.bounding_sphere[3] == 42.0f ? 1 : 0;
+    }
+    EXPECT_GE(kept, packet.visibleObjects.size() - 3);
+
+    // Another world's objects never reuse these entries, even with the same ids
+    World other;
+    populate(other, 2000, 6);
+    RenderBridgeSystem::fillVisibleObjects(other.registry(), &packet, makeTestFrustum());
+    for (const RenderObjectDesc& desc : packet.visibleObjects)
+    {
+        ASSERT_EQ(desc.bounding_sphere[3], 1.0f);
+    }
+}
+
+TEST(RenderBridgeTest, RenderGroupPacksRenderablesWithBounds) {
+    World world;
+    std::vector<Entity> entities = populate(world, 300, 9);
+
+    // Unbounded and resource-only renderables, bounds without a renderable
+    const Entity unbounded = world.createEntity();
+    world.addComponent<TransformComponent>(unbounded);
+    world.addComponent<RenderableComponent>(unbounded).meshId = 4;
+    const Entity withResources = world.createEntity();
+    world.addComponent<TransformComponent>(withResources);
+    world.addComponent<RenderResourceComponent>(withResources);
+    world.addComponent<RenderableComponent>(withResources);
+    const Entity boundsOnly = world.createEntity();
+    world.addComponent<TransformComponent>(boundsOnly);
+    world.addComponent<BoundingComponent>(boundsOnly);
+    world.destroyEntity(entities[10]);
+    world.removeComponent<BoundingComponent>(entities[20]);
+    world.updateTransforms();
+    world.updateBounds();
+
+    // The group leads both storages, in the same order
+    const auto group = World::renderGroup(world.registry());
+    const auto& renderables = world.registry().storage<RenderableComponent>();
+    const auto& bounds = world.registry().storage<BoundingComponent>();
+    ASSERT_EQ(group.size(), 298u);
+    for (size_t i = 0; i < group.size(); ++i)
+    {
+        ASSERT_EQ(renderables.data()[i], bounds.data()[i]);
+    }
+
+    EXPECT_TRUE(world.getComponent<RenderableComponent>(withResources).hasResources);
+    EXPECT_FALSE(world.getComponent<RenderableComponent>(unbounded).hasResources);
+    world.removeComponent<RenderResourceComponent>(withResources);
+    EXPECT_FALSE(world.getComponent<RenderableComponent>(withResources).hasResources);
+    world.addComponent<RenderResourceComponent>(withResources);
+
+    // Without culling: every drawable renderable, bounds taken from the group
+    RenderPacket packet;
+    RenderBridgeSystem::fillVisibleObjectsNoClip(world.registry(), &packet);
+    EXPECT_EQ(packet.visibleObjects.size(), 301u);
+    ASSERT_NE(findObject(packet, unbounded), nullptr);
+    ASSERT_NE(findObject(packet, withResources), nullptr);
+    EXPECT_EQ(findObject(packet, boundsOnly), nullptr);
+    EXPECT_EQ(findObject(packet, entities[10]), nullptr);
+    for (Entity entity : entities)
+    {
+        const RenderObjectDesc* desc = findObject(packet, entity);
+        if (entity == entities[10] || entity == entities[20])
+        {
+            continue;
+        }
+        ASSERT_NE(desc, nullptr);
+        const BoundingComponent& entityBounds = world.getComponent<BoundingComponent>(entity);
+        EXPECT_EQ(desc->bounding_sphere[0], entityBounds.worldCenter.x);
+        EXPECT_EQ(desc->bounding_sphere[3], entityBounds.worldRadius);
+    }
+
+    // With culling, the unbounded tail of the storage is always visible
+    RenderBridgeSystem::fillVisibleObjects(world.registry(), &packet, makeTestFrustum());
+    EXPECT_NE(findObject(packet, unbounded), nullptr);
+    EXPECT_NE(findObject(packet, entities[20]), nullptr);
+}
+
+TEST(RenderBridgeTest, DescriptorHoldsAffineTransform) {
+    World world;
+    const Entity entity = world.createEntity();
+    TransformComponent& transform = world.addComponent<TransformComponent>(entity);
+    transform.setPosition(Vector3(3.0f, -2.0f, 5.0f));
+    transform.setRotation(Quaternion::fromEulerAngles(0.3f, 1.1f, -0.4f));
+    transform.setScale(Vector3(2.0f, 0.5f, 1.5f));
+    world.addComponent<RenderableComponent>(entity).meshId = 9;
+    world.updateTransforms();
+
+    RenderPacket packet;
+    RenderBridgeSystem::fillVisibleObjectsNoClip(world.registry(), &packet);
+    ASSERT_EQ(packet.visibleObjects.size(), 1u);
+    const RenderObjectDesc& desc = packet.visibleObjects[0];
+    EXPECT_EQ(desc.mesh_id, 9u);
+
+    const Matrix4x4& worldMatrix = world.getComponent<TransformComponent>(entity).worldMatrix;
+    for (const Vector3& point : {Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 2.0f, 3.0f), Vector3(-4.0f, 0.5f, 2.0f)})
+    {
+        const Vector4 expected = worldMatrix.transform(Vector4(point.x, point.y, point.z, 1.0f));
+        const float p[4] = {point.x, point.y, point.z, 1.0f};
+        for (int row = 0; row < 3; ++row)
+        {
+            float actual = 0.0f;
+            for (int col = 0; col < 4; ++col)
+            {
+                actual += desc.transform[row * 4 + col] * p[col];
+            }
+            EXPECT_NEAR(actual, expected[row], 1e-4f);
+        }
+    }
+}
+
+TEST(RenderBridgeTest, InstancedFormatListsIdsAndDeltas) {
+    World world;
+    populate(world, 2000, 3);
+    const Entity camera = createCamera(world);
+
+    RenderPacket full;
+    RenderBridgeSystem::fillRenderPacket(world.registry(), &full, camera);
+
+    // A second world with the same content: its first packet carries the whole table as upserts
+    World mirrorWorld;
+    populate(mirrorWorld, 2000, 3);
+    const Entity mirrorCamera = createCamera(mirrorWorld);
+
+    RenderPacket instanced;
+    instanced.format = RenderPacketFormat::Instanced;
+    RenderBridgeSystem::fillRenderPacket(mirrorWorld.registry(), &instanced, mirrorCamera);
+    EXPECT_TRUE(instanced.visibleObjects.empty());
+    ASSERT_EQ(instanced.visibleInstances.size(), full.visibleObjects.size());
+    for (size_t i = 0; i < full.visibleObjects.size(); ++i)
+    {
+        EXPECT_EQ(instanced.visibleInstances[i], full.visibleObjects[i].object_id);
+    }
+    EXPECT_EQ(instanced.objectsToUpdate.size(), 2000u);
+
+    // Static frame: ids only, no deltas
+    RenderBridgeSystem::fillRenderPacket(mirrorWorld.registry(), &instanced, mirrorCamera);
+    EXPECT_TRUE(instanced.objectsToUpdate.empty());
+    EXPECT_TRUE(instanced.objectsToDelete.empty());
+
+    const uint32_t destroyed = instanced.visibleInstances[0];
+    mirrorWorld.destroyEntity(idToEntity(destroyed));
+    RenderBridgeSystem::fillRenderPacket(mirrorWorld.registry(), &instanced, mirrorCamera);
+    ASSERT_EQ(instanced.objectsToDelete.size(), 1u);
+    EXPECT_EQ(instanced.objectsToDelete[0], destroyed);
+    EXPECT_EQ(std::count(instanced.visibleInstances.begin(), instanced.visibleInstances.end(), destroyed), 0);
+}
+
+TEST(RenderBridgeTest, SkinningUsesOneJointArena) {
+    RenderPacket packet;
+    packet.reserve(16, 4, 0, 96);
+
+    float* first = packet.appendSkinning(7, 64);
+    first[0] = 1.0f;
+    float* second = packet.appendSkinning(8, 32);
+    second[kAffineMatrixFloats * 31] = 2.0f;
+
+    ASSERT_EQ(packet.skinningData.size(), 2u);
+    EXPECT_EQ(packet.skinningData[1].first_matrix, 64u);
+    EXPECT_EQ(packet.jointMatrices.size(), 96u * kAffineMatrixFloats);
+    EXPECT_EQ(packet.jointMatricesOf(packet.skinningData[0])[0], 1.0f);
+    EXPECT_EQ(packet.jointMatricesOf(packet.skinningData[1])[kAffineMatrixFloats * 31], 2.0f);
+
+    // Clearing keeps the arena: the next frame does not allocate
+    const float* arena = packet.jointMatrices.data();
+    packet.clear();
+    packet.appendSkinning(7, 96);
+    EXPECT_EQ(packet.jointMatrices.data(), arena);
+}
+
+TEST(RenderBridgeTest, UnculledFillListsEveryDrawableObject) {
+    World world;
+    populate(world, 2000, 9);
+    const Entity camera = createCamera(world);
+
+    RenderPacket culled;
+    RenderBridgeSystem::fillRenderPacket(world.registry(), &culled, camera);
+    ASSERT_LT(culled.visibleObjects.size(), 2000u);
+
+    // A consumer culling on the GPU still gets the camera, and the whole scene to cull
+    RenderPacket unculled;
+    RenderBridgeSystem::fillRenderPacket(world.registry(), &unculled, camera, nullptr, false);
+    EXPECT_EQ(unculled.visibleObjects.size(), 2000u);
+    EXPECT_EQ(std::memcmp(unculled.camera.view_matrix, culled.camera.view_matrix, sizeof(culled.camera.view_matrix)), 0);
+}
+
+} // namespace test
+} // namespace vesper
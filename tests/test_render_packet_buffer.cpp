@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/render/render_packet.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+/// @brief Write one packet tagged with a payload value
+bool writePacket(RenderPacketBuffer& buffer, uint32_t payload)
+{
+    RenderPacket* packet = buffer.acquireForWrite();
+    if (!packet)
+    {
+        return false;
+    }
+    packet->objectsToDelete.push_back(payload);
+    buffer.releaseWrite();
+    return true;
+}
+
+} // namespace
+
+TEST(RenderPacketBufferTest, LatestOnlyReturnsNewestAndCountsSkips) {
+    RenderPacketBuffer buffer(RenderPacketBuffer::kTripleBuffer, RenderPacketBufferMode::LatestOnly);
+    EXPECT_FALSE(buffer.canRead());
+    EXPECT_EQ(buffer.acquireForRead(), nullptr);
+
+    // The writer never runs out of slots, even with an unread packet
+    for (uint32_t payload = 1; payload <= 5; ++payload) {
+        ASSERT_TRUE(buffer.canWrite());
+        ASSERT_TRUE(writePacket(buffer, payload));
+    }
+    EXPECT_EQ(buffer.packetsSkipped(), 4u);
+
+    // The newest packet carries the deltas of the skipped ones, oldest first
+    ASSERT_TRUE(buffer.canRead());
+    RenderPacket* packet = buffer.acquireForRead();
+    ASSERT_NE(packet, nullptr);
+    EXPECT_EQ(packet->objectsToDelete, (std::vector<uint32_t>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(packet->frameIndex, 4u);
+
+    // The held packet is not touched by later writes, and nothing read is carried over again
+    ASSERT_TRUE(writePacket(buffer, 6));
+    ASSERT_TRUE(writePacket(buffer, 7));
+    EXPECT_EQ(packet->objectsToDelete.size(), 5u);
+    buffer.releaseRead();
+
+    packet = buffer.acquireForRead();
+    ASSERT_NE(packet, nullptr);
+    EXPECT_EQ(packet->objectsToDelete, (std::vector<uint32_t>{6, 7}));
+    buffer.releaseRead();
+    EXPECT_EQ(buffer.acquireForRead(), nullptr);
+    EXPECT_EQ(buffer.packetsRead(), 2u);
+}
+
+TEST(RenderPacketBufferTest, PacketReadDuringAWriteIsNotCarried) {
+    RenderPacketBuffer buffer(RenderPacketBuffer::kTripleBuffer, RenderPacketBufferMode::LatestOnly);
+    ASSERT_TRUE(writePacket(buffer, 1));
+    ASSERT_TRUE(writePacket(buffer, 2));
+
+    // The reader takes the pending packet (1 carried in front of 2) while the next one is written
+    RenderPacket* written = buffer.acquireForWrite();
+    ASSERT_NE(written, nullptr);
+    written->objectsToDelete.push_back(3);
+
+    RenderPacket* packet = buffer.acquireForRead();
+    ASSERT_NE(packet, nullptr);
+    EXPECT_EQ(packet->objectsToDelete, (std::vector<uint32_t>{1, 2}));
+    buffer.releaseRead();
+
+    // Nothing is carried into the packet published after that
+    buffer.releaseWrite();
+    packet = buffer.acquireForRead();
+    ASSERT_NE(packet, nullptr);
+    EXPECT_EQ(packet->objectsToDelete, (std::vector<uint32_t>{3}));
+    buffer.releaseRead();
+    EXPECT_EQ(buffer.packetsSkipped(), 1u);
+}
+
+TEST(RenderPacketBufferTest, SequentialDeliversEveryPacketInOrder) {
+    constexpr uint32_t kPackets = 20000;
+    RenderPacketBuffer buffer(RenderPacketBuffer::kTripleBuffer, RenderPacketBufferMode::Sequential);
+
+    std::thread producer([&]() {
+        for (uint32_t payload = 0; payload < kPackets; ++payload) {
+            ASSERT_TRUE(writePacket(buffer, payload));
+        }
+    });
+
+    uint32_t expected = 0;
+    while (expected < kPackets) {
+        RenderPacket* packet = buffer.acquireForRead();
+        if (!packet) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(packet->objectsToDelete.size(), 1u);
+        ASSERT_EQ(packet->objectsToDelete[0], expected);
+        ++expected;
+        buffer.releaseRead();
+    }
+    producer.join();
+
+    EXPECT_EQ(buffer.packetsWritten(), kPackets);
+    EXPECT_EQ(buffer.packetsRead(), kPackets);
+    EXPECT_EQ(buffer.packetsSkipped(), 0u);
+    EXPECT_FALSE(buffer.canRead());
+}
+
+TEST(RenderPacketBufferTest, ShutdownWakesBlockedWriter) {
+    RenderPacketBuffer buffer(RenderPacketBuffer::kDoubleBuffer, RenderPacketBufferMode::Sequential);
+    ASSERT_TRUE(writePacket(buffer, 0));
+    ASSERT_TRUE(writePacket(buffer, 1));
+    EXPECT_FALSE(buffer.canWrite());
+
+    std::atomic<bool> returned{false};
+    std::thread producer([&]() {
+        EXPECT_FALSE(writePacket(buffer, 2));
+        returned.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(returned.load());
+
+    buffer.shutdown();
+    producer.join();
+    EXPECT_TRUE(returned.load());
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/render/scene/render_scene.h"
+#include "runtime/function/render/render_packet.h"
+#include "runtime/function/framework/ecs/systems/render_bridge_system.h"
+#include "runtime/function/framework/component/mesh/renderable_component.h"
+#include "runtime/function/framework/component/camera/camera_component.h"
+#include "runtime/function/framework/ecs/world.h"
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+RenderObjectDesc makeDesc(uint32_t objectId, float x)
+{
+    RenderObjectDesc desc;
+    desc.object_id = objectId;
+    desc.mesh_id = 1;
+    desc.transform[3] = x;
+    desc.bounding_sphere[0] = x;
+    return desc;
+}
+
+/// @brief Entity ids for objects: index i, version 0
+uint32_t objectId(uint32_t index)
+{
+    return entityToId(entt::entt_traits<Entity>::construct(index, 0));
+}
+
+/// @brief Moving renderables scattered around the origin, and a camera looking at them
+Entity populate(World& world, size_t count, std::vector<Entity>& entities)
+{
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Entity entity = world.createEntity();
+        world.addComponent<TransformComponent>(entity).setPosition(Vector3(position(rng), position(rng), position(rng)));
+        world.addComponent<BoundingComponent>(entity).initFromSphere(Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+        world.addComponent<RenderableComponent>(entity).meshId = 1 + static_cast<uint32_t>(i % 5);
+        entities.push_back(entity);
+    }
+
+    auto camera = std::make_shared<Camera>();
+    camera->setPosition(Vector3(0.0f, 0.0f, -50.0f));
+    camera->lookAt(Vector3(0.0f, 0.0f, 0.0f));
+    const Entity cameraEntity = world.createEntity();
+    world.addComponent<CameraComponent>(cameraEntity).camera = camera;
+
+    world.updateTransforms();
+    world.updateBounds();
+    return cameraEntity;
+}
+
+} // namespace
+
+TEST(RenderSceneTest, SlotsStayPutAndAreReused) {
+    RenderScene scene;
+    RenderPacket packet;
+    for (uint32_t i = 0; i < 4; ++i) {
+        packet.objectsToUpdate.push_back(makeDesc(objectId(i), static_cast<float>(i)));
+    }
+    scene.applyPacket(packet);
+    ASSERT_EQ(scene.size(), 4u);
+    EXPECT_EQ(scene.dirtySlots().size(), 4u);
+    const uint32_t lastSlot = scene.slotOf(objectId(3));
+    scene.clearDirty();
+
+    // Removal leaves a hole instead of moving the last instance
+    packet.clear();
+    packet.objectsToDelete.push_back(objectId(1));
+    scene.applyPacket(packet);
+    EXPECT_FALSE(scene.contains(objectId(1)));
+    EXPECT_EQ(scene.slotOf(objectId(3)), lastSlot);
+    EXPECT_EQ(scene.size(), 3u);
+    EXPECT_TRUE(scene.dirtySlots().empty());
+
+    // A new object (here the recycled entity index, next version) takes the hole
+    const uint32_t recycled = entityToId(entt::entt_traits<Entity>::construct(1, 1));
+    packet.clear();
+    packet.objectsToAdd.push_back(makeDesc(recycled, 9.0f));
+    scene.applyPacket(packet);
+    EXPECT_EQ(scene.slotCount(), 4u);
+    EXPECT_EQ(scene.slotOf(recycled), scene.dirtySlots()[0]);
+    EXPECT_EQ(scene.dirtySlots().size(), 1u);
+    EXPECT_FALSE(scene.contains(objectId(1)));
+    EXPECT_EQ(scene.instance(scene.slotOf(recycled)).transform[3], 9.0f);
+}
+
+TEST(RenderSceneTest, UnchangedUpsertsStayClean) {
+    RenderScene scene;
+    RenderPacket packet;
+    for (uint32_t i = 0; i < 100; ++i) {
+        packet.visibleObjects.push_back(makeDesc(objectId(i), static_cast<float>(i)));
+    }
+    scene.applyPacket(packet);
+    EXPECT_EQ(scene.dirtySlots().size(), 100u);
+    EXPECT_EQ(scene.visibleSlots().size(), 100u);
+    scene.clearDirty();
+
+    // Full packets resend every visible object: only the changed one needs an upload
+    packet.visibleObjects[42].transform[3] = -1.0f;
+    scene.applyPacket(packet);
+    ASSERT_EQ(scene.dirtySlots().size(), 1u);
+    EXPECT_EQ(scene.dirtySlots()[0], scene.slotOf(objectId(42)));
+    EXPECT_EQ(scene.visibleSlots().size(), 100u);
+}
+
+TEST(RenderSceneTest, InstancedVisibleListResolvesSlots) {
+    RenderScene scene;
+    RenderPacket packet;
+    packet.format = RenderPacketFormat::Instanced;
+    for (uint32_t i = 0; i < 8; ++i) {
+        packet.objectsToUpdate.push_back(makeDesc(objectId(i), static_cast<float>(i)));
+    }
+    packet.visibleInstances = {objectId(6), objectId(2), objectId(20), objectId(4)};
+    scene.applyPacket(packet);
+
+    ASSERT_EQ(scene.visibleSlots().size(), 3u);
+    EXPECT_EQ(scene.missingInstances(), 1u);
+    EXPECT_EQ(scene.instance(scene.visibleSlots()[0]).object_id, objectId(6));
+    EXPECT_EQ(scene.instance(scene.visibleSlots()[1]).object_id, objectId(2));
+    EXPECT_EQ(scene.instance(scene.visibleSlots()[2]).object_id, objectId(4));
+}
+
+TEST(RenderSceneTest, MirrorsWorldThroughSkippedPackets) {
+    World world;
+    std::vector<Entity> entities;
+    const Entity camera = populate(world, 3000, entities);
+
+    RenderPacketBuffer buffer(RenderPacketBuffer::kTripleBuffer, RenderPacketBufferMode::LatestOnly);
+    RenderScene scene;
+    std::mt19937 rng(5);
+
+    for (int frame = 0; frame < 30; ++frame) {
+        // Move some objects, destroy a few and create replacements (recycling entity indices)
+        for (int i = 0; i < 50; ++i) {
+            const Entity entity = entities[rng() % entities.size()];
+            world.patchComponent<TransformComponent>(entity, [&](TransformComponent& transform) {
+                transform.setPosition(transform.localPosition + Vector3(0.5f, 0.0f, 0.0f));
+            });
+        }
+        for (int i = 0; i < 5; ++i) {
+            const size_t index = rng() % entities.size();
+            world.destroyEntity(entities[index]);
+            entities[index] = world.createEntity();
+            world.addComponent<TransformComponent>(entities[index]).setPosition(Vector3(0.0f, static_cast<float>(frame), 0.0f));
+            world.addComponent<RenderableComponent>(entities[index]).meshId = 3;
+        }
+        world.updateTransforms();
+        world.updateBounds();
+
+        RenderPacket* packet = buffer.acquireForWrite();
+        packet->format = RenderPacketFormat::Instanced;
+        RenderBridgeSystem::fillRenderPacket(world.registry(), packet, camera);
+        buffer.releaseWrite();
+
+        // The reader only keeps up with every third frame
+        if (frame % 3 == 2) {
+            RenderPacket* read = buffer.acquireForRead();
+            ASSERT_NE(read, nullptr);
+            scene.applyPacket(*read);
+            buffer.releaseRead();
+            EXPECT_EQ(scene.missingInstances(), 0u);
+        }
+    }
+    EXPECT_GT(buffer.packetsSkipped(), 0u);
+
+    // Every live renderable, and nothing else, is mirrored with its current descriptor
+    RenderPacket full;
+    RenderBridgeSystem::fillVisibleObjectsNoClip(world.registry(), &full);
+    ASSERT_EQ(scene.size(), full.visibleObjects.size());
+    for (const RenderObjectDesc& desc : full.visibleObjects) {
+        const uint32_t slot = scene.slotOf(desc.object_id);
+        ASSERT_NE(slot, RenderScene::kInvalidSlot);
+        ASSERT_EQ(std::memcmp(&scene.instance(slot), &desc, sizeof(RenderObjectDesc)), 0) << desc.object_id;
+    }
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/render/rhi/rhi_handle.h"
+#include "runtime/function/render/backend/null/null_rhi.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+struct Tag {};
+
+struct Object
+{
+    int value = 0;
+};
+
+using ObjectPool = RHIHandlePool<Tag, Object>;
+
+} // namespace
+
+TEST(RHIHandleTest, PacksIndexAndGeneration) {
+    using Handle = RHIHandle<Tag>;
+    static_assert(sizeof(Handle) == sizeof(uint32_t));
+
+    const Handle handle = Handle::make(12345, 7);
+    EXPECT_EQ(handle.index(), 12345u);
+    EXPECT_EQ(handle.generation(), 7u);
+    EXPECT_EQ(Handle::fromValue(handle.value()), handle);
+    EXPECT_TRUE(handle.isValid());
+
+    const Handle none{};
+    EXPECT_FALSE(none);
+    EXPECT_EQ(none.value(), 0u);
+}
+
+TEST(RHIHandleTest, PoolResolvesLiveIdsOnly) {
+    ObjectPool pool;
+    Object a{1};
+    Object b{2};
+
+    const auto idA = pool.allocate(&a);
+    const auto idB = pool.allocate(&b);
+    ASSERT_TRUE(idA);
+    ASSERT_TRUE(idB);
+    EXPECT_NE(idA, idB);
+    EXPECT_EQ(pool.get(idA), &a);
+    EXPECT_EQ(pool.get(idB), &b);
+    EXPECT_EQ(pool.size(), 2u);
+    EXPECT_EQ(pool.get({}), nullptr);
+
+    // A released slot is reused with a new generation: the old id stays dead
+    pool.release(idA);
+    EXPECT_EQ(pool.get(idA), nullptr);
+    Object c{3};
+    const auto idC = pool.allocate(&c);
+    EXPECT_EQ(idC.index(), idA.index());
+    EXPECT_NE(idC.generation(), idA.generation());
+    EXPECT_EQ(pool.get(idA), nullptr);
+    EXPECT_EQ(pool.get(idC), &c);
+
+    // Releasing a stale id does not touch the slot's new occupant
+    pool.release(idA);
+    EXPECT_EQ(pool.get(idC), &c);
+    EXPECT_EQ(pool.size(), 2u);
+}
+
+TEST(RHIHandleTest, PoolGrowsAcrossChunks) {
+    ObjectPool pool;
+    std::vector<Object> objects(5000);
+    std::vector<RHIHandle<Tag>> ids;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        objects[i].value = static_cast<int>(i);
+        ids.push_back(pool.allocate(&objects[i]));
+    }
+    for (size_t i = 0; i < objects.size(); ++i) {
+        ASSERT_EQ(pool.get(ids[i]), &objects[i]);
+    }
+
+    for (size_t i = 0; i < objects.size(); i += 2) {
+        pool.release(ids[i]);
+    }
+    EXPECT_EQ(pool.size(), objects.size() / 2);
+    EXPECT_EQ(pool.get(ids[0]), nullptr);
+    EXPECT_EQ(pool.get(ids[1]), &objects[1]);
+}
+
+TEST(RHIHandleTest, LookupsRaceWithAllocation) {
+    ObjectPool pool;
+    Object first{42};
+    const auto firstId = pool.allocate(&first);
+
+    std::atomic<bool> done{false};
+    std::atomic<int> misses{0};
+    std::thread reader([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            if (pool.get(firstId) != &first) {
+                misses.fetch_add(1);
+            }
+        }
+    });
+
+    std::vector<Object> objects(4096);
+    for (Object& object : objects) {
+        pool.allocate(&object);
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+    EXPECT_EQ(misses.load(), 0);
+}
+
+TEST(RHIHandleTest, BackendIdsGoStaleOnDestroy) {
+    auto rhi = std::make_unique<NullRHI>();
+    rhi->initialize({});
+
+    auto pool = rhi->createCommandPool({});
+    auto cmd = rhi->allocateCommandBuffer(pool);
+    auto texture = rhi->createTexture({});
+    ASSERT_TRUE(cmd->id);
+    ASSERT_TRUE(texture->id);
+
+    const RHITextureId staleTexture = texture->id;
+    rhi->destroyTexture(texture);
+    auto replacement = rhi->createTexture({});
+    EXPECT_EQ(replacement->id.index(), staleTexture.index());
+    EXPECT_NE(replacement->id, staleTexture);
+
+    // A barrier on the destroyed texture must not land on the one that took its slot
+    rhi->beginCommandBuffer(cmd->id);
+    RHITextureBarrier barrier{};
+    barrier.texture  = staleTexture;
+    barrier.srcState = RHIResourceState::Undefined;
+    barrier.dstState = RHIResourceState::ShaderResource;
+    rhi->cmdPipelineBarrier(cmd->id, {}, std::span(&barrier, 1));
+    rhi->endCommandBuffer(cmd->id);
+    EXPECT_EQ(replacement->currentState, RHIResourceState::Undefined);
+
+    // Recording into a freed command buffer is dropped
+    EXPECT_EQ(NullRHI::getRecordedCounts(cmd).total(), 1u);
+    const RHICommandBufferId staleCmd = cmd->id;
+    rhi->freeCommandBuffer(pool, cmd);
+    rhi->beginCommandBuffer(staleCmd);
+    rhi->cmdDraw(staleCmd, 3);
+    rhi->endCommandBuffer(staleCmd);
+    EXPECT_EQ(NullRHI::getRecordedCounts(cmd).total(), 1u);
+    EXPECT_EQ(NullRHI::getRecordedCounts(cmd).drawCalls(), 0u);
+
+    rhi->shutdown();
+}
+
+} // namespace test
+} // namespace vesper
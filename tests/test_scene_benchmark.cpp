@@ -0,0 +1,457 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/framework/ecs/world.h"
+#include "runtime/function/framework/ecs/systems/culling_buffer.h"
+#include "runtime/function/framework/ecs/systems/bounding_volume_hierarchy.h"
+#include "runtime/core/threading/worker_pool.h"
+#include "test_frustum_utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <tuple>
+
+namespace vesper {
+namespace test {
+
+// Throughput benchmarks for the per-frame scene stages. They assert only on correctness;
+// numbers are printed and recorded as test properties for comparison across changes.
+
+namespace {
+
+constexpr int kBenchmarkIterations = 5;
+
+/// @brief Original World::updateTransforms: recursive sibling-list walk with a component lookup per node
+void updateTransformsRecursive(World& world, Entity entity, const Matrix4x4& parentWorld)
+{
+    while (entity != NullEntity)
+    {
+        auto* transform = world.registry().try_get<TransformComponent>(entity);
+        auto* hierarchy = world.tryGetComponent<HierarchyComponent>(entity);
+        if (transform)
+        {
+            transform->worldMatrix = transform->getLocalMatrix() * parentWorld;
+            if (hierarchy && hierarchy->hasChildren())
+            {
+                updateTransformsRecursive(world, hierarchy->firstChild, transform->worldMatrix);
+            }
+        }
+        entity = hierarchy ? hierarchy->nextSibling : NullEntity;
+    }
+}
+
+void updateTransformsBaseline(World& world)
+{
+    for (auto [entity, transform] : world.registry().view<TransformComponent>().each())
+    {
+        auto* hierarchy = world.tryGetComponent<HierarchyComponent>(entity);
+        if (hierarchy && hierarchy->hasParent())
+        {
+            continue;
+        }
+        transform.worldMatrix = transform.getLocalMatrix();
+        if (hierarchy && hierarchy->hasChildren())
+        {
+            updateTransformsRecursive(world, hierarchy->firstChild, transform.worldMatrix);
+        }
+    }
+}
+
+/// @brief Build 'entities' transforms as trees of the given depth (1 = all roots)
+/// Every node below the root has 'fanout' children until the depth is reached.
+std::vector<Entity> buildForest(World& world, uint32_t entities, uint32_t depth, uint32_t fanout)
+{
+    std::vector<Entity> roots;
+    uint32_t created = 0;
+    while (created < entities)
+    {
+        std::vector<Entity> level{world.createEntity()};
+        world.addComponent<TransformComponent>(level.back()).setPosition(Vector3(static_cast<float>(created), 0.0f, 0.0f));
+        roots.push_back(level.back());
+        ++created;
+
+        for (uint32_t d = 1; d < depth && created < entities; ++d)
+        {
+            std::vector<Entity> next;
+            for (Entity parent : level)
+            {
+                for (uint32_t c = 0; c < fanout && created < entities; ++c)
+                {
+                    Entity child = world.createEntity();
+                    auto& transform = world.addComponent<TransformComponent>(child);
+                    transform.setPosition(Vector3(0.0f, 1.0f, 0.0f));
+                    transform.setRotation(Quaternion::rotationY(0.01f * static_cast<float>(c)));
+                    world.setParent(child, parent);
+                    next.push_back(child);
+                    ++created;
+                }
+            }
+            level = std::move(next);
+        }
+    }
+    return roots;
+}
+
+template<typename Fn>
+double bestMilliseconds(World& world, const std::vector<Entity>& roots, Fn&& update)
+{
+    double best = 1e30;
+    for (int i = 0; i < kBenchmarkIterations; ++i)
+    {
+        // Changed roots force the whole forest to be recomputed (empty = static scene)
+        for (Entity root : roots)
+        {
+            world.patchComponent<TransformComponent>(root);
+        }
+        const auto start = std::chrono::steady_clock::now();
+        update();
+        best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+template<typename Fn>
+double bestMilliseconds(Fn&& run)
+{
+    double best = 1e30;
+    for (int i = 0; i < kBenchmarkIterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+/// @brief Original FrustumCullSystem loop: registry view with a BoundingComponent lookup per entity
+size_t cullBaseline(World& world, const Frustum& frustum, std::vector<Entity>& visible)
+{
+    visible.clear();
+    for (auto [entity, transform] : world.registry().view<TransformComponent>().each())
+    {
+        const auto* bounds = world.tryGetComponent<BoundingComponent>(entity);
+        if (bounds && frustum.testSphere(bounds->worldCenter, bounds->worldRadius))
+        {
+            visible.push_back(entity);
+        }
+    }
+    return visible.size();
+}
+
+/// @brief Original BoundingComponent::updateWorldBounds: sphere only, three axis lengths
+void updateWorldSphereBaseline(BoundingComponent& bounds, const Matrix4x4& worldMatrix)
+{
+    const Vector4 center = worldMatrix.transform(Vector4(bounds.localCenter.x, bounds.localCenter.y, bounds.localCenter.z, 1.0f));
+    bounds.worldCenter = Vector3(center.x, center.y, center.z);
+
+    const float scaleX = Vector3(worldMatrix[0][0], worldMatrix[0][1], worldMatrix[0][2]).length();
+    const float scaleY = Vector3(worldMatrix[1][0], worldMatrix[1][1], worldMatrix[1][2]).length();
+    const float scaleZ = Vector3(worldMatrix[2][0], worldMatrix[2][1], worldMatrix[2][2]).length();
+    bounds.worldRadius = bounds.localRadius * std::max({scaleX, scaleY, scaleZ});
+}
+
+/// @brief Original RenderableComponent layout: ids, flags and layer around three resource references
+struct LegacyRenderableComponent
+{
+    uint32_t meshId{0};
+    uint32_t materialId{0};
+    std::shared_ptr<void> mesh;
+    std::shared_ptr<void> material;
+    std::shared_ptr<void> model;
+    uint32_t submeshIndex{0};
+    bool visible{true};
+    bool castShadow{true};
+    bool receiveShadow{true};
+    uint32_t renderLayer{0};
+    int32_t sortOrder{0};
+};
+
+/// @brief What a render fill reads per drawable entity, folded so the loop cannot be skipped
+double accumulateRenderInputs(const TransformComponent& transform, uint32_t meshId, const BoundingComponent* bounds)
+{
+    return transform.worldMatrix.m[3][0] + static_cast<double>(meshId) + (bounds ? bounds->worldRadius : 0.0f);
+}
+
+/// @brief Original render iteration: view over transforms and renderables, bounds looked up per entity
+double iterateRenderBaseline(World& world)
+{
+    double sum = 0.0;
+    for (auto [entity, transform, renderable] : world.registry().view<TransformComponent, LegacyRenderableComponent>().each())
+    {
+        if (renderable.visible && (renderable.meshId != 0 || renderable.mesh))
+        {
+            sum += accumulateRenderInputs(transform, renderable.meshId, world.tryGetComponent<BoundingComponent>(entity));
+        }
+    }
+    return sum;
+}
+
+} // namespace
+
+// (entities, depth, fanout)
+class TransformUpdateBenchmark : public ::testing::TestWithParam<std::tuple<uint32_t, uint32_t, uint32_t>> {
+protected:
+    void SetUp() override {
+        WorkerPoolConfig config;
+        config.numWorkers = 4;
+        ASSERT_TRUE(pool.initialize(config));
+    }
+
+    void TearDown() override {
+        pool.shutdown();
+    }
+
+    WorkerPool pool;
+};
+
+TEST_P(TransformUpdateBenchmark, UpdateMilliseconds) {
+    const auto [entities, depth, fanout] = GetParam();
+
+    auto world = std::make_unique<World>();
+    const std::vector<Entity> roots = buildForest(*world, entities, depth, fanout);
+
+    // First update builds the depth-sorted layout: keep it out of the timings
+    world->updateTransforms();
+    const Matrix4x4 expected = world->getComponent<TransformComponent>(world->registry().view<TransformComponent>().back()).worldMatrix;
+
+    const double baselineMs = bestMilliseconds(*world, roots, [&]() { updateTransformsBaseline(*world); });
+    const double serialMs = bestMilliseconds(*world, roots, [&]() { world->updateTransforms(); });
+    const double parallelMs = bestMilliseconds(*world, roots, [&]() { world->updateTransforms(pool); });
+    const double staticMs = bestMilliseconds(*world, {}, [&]() {
+        world->updateTransforms(pool);
+        world->updateBounds();
+    });
+
+    const Matrix4x4& actual = world->getComponent<TransformComponent>(world->registry().view<TransformComponent>().back()).worldMatrix;
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            EXPECT_NEAR(actual.m[row][col], expected.m[row][col], 1e-3f);
+        }
+    }
+
+    std::printf("[ BENCH    ] %7u entities, depth %2u x%u: recursive %8.2f ms, levels %8.2f ms, levels+pool %8.2f ms (%u workers), static %6.3f ms\n",
+                entities, depth, fanout, baselineMs, serialMs, parallelMs, pool.workerCount(), staticMs);
+    RecordProperty("recursive_us", static_cast<int>(baselineMs * 1000.0));
+    RecordProperty("levels_us", static_cast<int>(serialMs * 1000.0));
+    RecordProperty("levels_parallel_us", static_cast<int>(parallelMs * 1000.0));
+    RecordProperty("static_us", static_cast<int>(staticMs * 1000.0));
+}
+
+INSTANTIATE_TEST_SUITE_P(Hierarchies, TransformUpdateBenchmark, ::testing::Values(
+    std::make_tuple(10000u, 1u, 1u),        // Flat: roots only
+    std::make_tuple(10000u, 3u, 8u),        // Shallow: 1 + 8 + 64 per tree
+    std::make_tuple(10000u, 32u, 1u),       // Deep: chains of 32
+    std::make_tuple(100000u, 1u, 1u),
+    std::make_tuple(100000u, 3u, 8u),
+    std::make_tuple(100000u, 32u, 1u),
+    std::make_tuple(1000000u, 1u, 1u),
+    std::make_tuple(1000000u, 3u, 8u),
+    std::make_tuple(1000000u, 32u, 1u)));
+
+
+// (entities, half extent of the cube they are scattered in)
+class CullingBenchmark : public ::testing::TestWithParam<std::tuple<uint32_t, float>> {
+protected:
+    void SetUp() override {
+        WorkerPoolConfig config;
+        config.numWorkers = 4;
+        ASSERT_TRUE(pool.initialize(config));
+    }
+
+    void TearDown() override {
+        pool.shutdown();
+    }
+
+    WorkerPool pool;
+};
+
+TEST_P(CullingBenchmark, CullMilliseconds) {
+    const auto [entities, extent] = GetParam();
+
+    // Spheres scattered around a camera at the origin looking down +Z (far plane 1000):
+    // about 9% is visible for an extent of 500, under 0.1% for 5000
+    auto world = std::make_unique<World>();
+    std::mt19937 rng(entities);
+    std::uniform_real_distribution<float> position(-extent, extent);
+    for (uint32_t i = 0; i < entities; ++i)
+    {
+        Entity entity = world->createEntity();
+        world->addComponent<TransformComponent>(entity).setPosition(Vector3(position(rng), position(rng), position(rng)));
+        world->addComponent<BoundingComponent>(entity).initFromSphere(Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+    }
+    world->updateTransforms();
+    world->updateBounds();
+
+    const Frustum frustum = makeTestFrustum(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), 1000.0f);
+
+    const CullingBuffer& buffer = world->registry().ctx().get<CullingBuffer>();
+    const BoundingVolumeHierarchy& bvh = world->registry().ctx().get<BoundingVolumeHierarchy>();
+    std::vector<Entity> baselineVisible;
+    std::vector<Entity> bvhVisible;
+    std::vector<uint64_t> visibleBits;
+    std::vector<uint32_t> visibleSlots;
+    size_t baselineCount = 0;
+    size_t serialCount = 0;
+    size_t parallelCount = 0;
+    size_t slotCount = 0;
+    size_t bvhCount = 0;
+
+    const double baselineMs = bestMilliseconds([&]() { baselineCount = cullBaseline(*world, frustum, baselineVisible); });
+    const double serialMs = bestMilliseconds([&]() { serialCount = buffer.cull(frustum, visibleBits); });
+    const double parallelMs = bestMilliseconds([&]() { parallelCount = buffer.cull(frustum, visibleBits, &pool); });
+    const double slotsMs = bestMilliseconds([&]() { slotCount = buffer.cullToSlots(frustum, visibleSlots, &pool); });
+    const double bvhMs = bestMilliseconds([&]() {
+        bvhVisible.clear();
+        bvhCount = bvh.queryFrustum(frustum, bvhVisible);
+    });
+
+    EXPECT_GT(baselineCount, 0u);
+    EXPECT_EQ(serialCount, baselineCount);
+    EXPECT_EQ(parallelCount, baselineCount);
+    EXPECT_EQ(slotCount, baselineCount);
+    EXPECT_EQ(bvhCount, baselineCount);
+
+    std::printf("[ BENCH    ] %7u spheres in +-%4.0f (%5zu visible): view+lookup %8.3f ms, soa %8.3f ms, soa+pool %8.3f ms (%u workers), soa+pool to slots %8.3f ms, bvh %8.3f ms\n",
+                entities, extent, baselineCount, baselineMs, serialMs, parallelMs, pool.workerCount(), slotsMs, bvhMs);
+    RecordProperty("view_lookup_us", static_cast<int>(baselineMs * 1000.0));
+    RecordProperty("soa_us", static_cast<int>(serialMs * 1000.0));
+    RecordProperty("soa_parallel_us", static_cast<int>(parallelMs * 1000.0));
+    RecordProperty("soa_parallel_slots_us", static_cast<int>(slotsMs * 1000.0));
+    RecordProperty("bvh_us", static_cast<int>(bvhMs * 1000.0));
+}
+
+INSTANTIATE_TEST_SUITE_P(Spheres, CullingBenchmark, ::testing::Values(
+    std::make_tuple(10000u, 500.0f),
+    std::make_tuple(100000u, 500.0f),
+    std::make_tuple(500000u, 500.0f),
+    std::make_tuple(500000u, 5000.0f)));
+
+TEST(CullingAabbBenchmark, TwoStageMilliseconds) {
+    constexpr uint32_t kInstances = 500000;
+
+    // Instanced thin, long objects (poles, beams, walls) with random orientation: their sphere is
+    // far larger than their box, the typical source of sphere-culling false positives
+    std::mt19937 rng(15);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> angle(-3.14159f, 3.14159f);
+    std::vector<Matrix4x4> worldMatrices(kInstances);
+    std::vector<BoundingComponent> bounds(kInstances);
+    for (uint32_t i = 0; i < kInstances; ++i)
+    {
+        worldMatrices[i] = Matrix4x4::rotationRollPitchYaw(angle(rng), angle(rng), angle(rng)) *
+                           Matrix4x4::translation(Vector3(position(rng), position(rng), position(rng)));
+        bounds[i].initFromAABB(Vector3(-0.5f, -0.5f, -20.0f), Vector3(0.5f, 0.5f, 20.0f));
+    }
+
+    const double sphereUpdateMs = bestMilliseconds([&]() {
+        for (uint32_t i = 0; i < kInstances; ++i)
+        {
+            updateWorldSphereBaseline(bounds[i], worldMatrices[i]);
+        }
+    });
+    const double boundsUpdateMs = bestMilliseconds([&]() {
+        for (uint32_t i = 0; i < kInstances; ++i)
+        {
+            bounds[i].updateWorldBounds(worldMatrices[i]);
+        }
+    });
+
+    CullingBuffer twoStage;
+    for (uint32_t i = 0; i < kInstances; ++i)
+    {
+        twoStage.add(idToEntity(i), bounds[i].worldCenter, bounds[i].worldRadius, bounds[i].worldAabbMin, bounds[i].worldAabbMax);
+    }
+
+    const Frustum frustum = makeTestFrustum(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), 1000.0f);
+
+    std::vector<uint64_t> visibleBits;
+    size_t twoStageCount = 0;
+    const double twoStageMs = bestMilliseconds([&]() { twoStageCount = twoStage.cull(frustum, visibleBits); });
+
+    size_t sphereCount = 0;
+    size_t expectedCount = 0;
+    for (const BoundingComponent& instance : bounds)
+    {
+        if (frustum.testSphere(instance.worldCenter, instance.worldRadius))
+        {
+            ++sphereCount;
+            expectedCount += frustum.testAABB(instance.worldAabbMin, instance.worldAabbMax) ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(twoStageCount, expectedCount);
+    EXPECT_LT(twoStageCount, sphereCount);
+
+    const double falsePositives = sphereCount > 0 ? 100.0 * static_cast<double>(sphereCount - twoStageCount) / static_cast<double>(sphereCount) : 0.0;
+    const double toNs = 1e6 / static_cast<double>(kInstances);
+    std::printf("[ BENCH    ] %u instances: sphere visible %zu, sphere+aabb visible %zu (%.1f%% of sphere hits rejected)\n",
+                kInstances, sphereCount, twoStageCount, falsePositives);
+    std::printf("[ BENCH    ]   update: sphere only %.2f ns/entity, sphere+aabb %.2f ns/entity; sphere+aabb cull %.2f ns/entity\n",
+                sphereUpdateMs * toNs, boundsUpdateMs * toNs, twoStageMs * toNs);
+    RecordProperty("sphere_visible", static_cast<int>(sphereCount));
+    RecordProperty("sphere_aabb_visible", static_cast<int>(twoStageCount));
+    RecordProperty("sphere_update_us", static_cast<int>(sphereUpdateMs * 1000.0));
+    RecordProperty("sphere_aabb_update_us", static_cast<int>(boundsUpdateMs * 1000.0));
+    RecordProperty("sphere_aabb_cull_us", static_cast<int>(twoStageMs * 1000.0));
+}
+
+TEST(RenderIterationBenchmark, GroupBandwidth) {
+    constexpr uint32_t kEntities = 500000;
+
+    // Components added in unrelated orders, as in a scene built and edited over time: each
+    // storage lists the entities differently, so a view resolves the others at random
+    auto world = std::make_unique<World>();
+    std::mt19937 rng(21);
+    std::vector<Entity> entities(kEntities);
+    for (uint32_t i = 0; i < kEntities; ++i)
+    {
+        entities[i] = world->createEntity();
+        world->addComponent<TransformComponent>(entities[i]).setPosition(Vector3(static_cast<float>(i), 0.0f, 0.0f));
+    }
+    std::shuffle(entities.begin(), entities.end(), rng);
+    for (Entity entity : entities)
+    {
+        world->addComponent<BoundingComponent>(entity).initFromSphere(Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+    }
+    std::shuffle(entities.begin(), entities.end(), rng);
+    for (uint32_t i = 0; i < kEntities; ++i)
+    {
+        world->addComponent<RenderableComponent>(entities[i]).meshId = 1 + i % 7;
+        world->addComponent<LegacyRenderableComponent>(entities[i]).meshId = 1 + i % 7;
+    }
+    world->updateTransforms();
+    world->updateBounds();
+
+    double baselineSum = 0.0;
+    double groupSum = 0.0;
+    const double baselineMs = bestMilliseconds([&]() { baselineSum = iterateRenderBaseline(*world); });
+    const double groupMs = bestMilliseconds([&]() {
+        double sum = 0.0;
+        for (auto [entity, renderable, bounds, transform] : World::renderGroup(world->registry()).each())
+        {
+            if (renderable.visible && renderable.isValid())
+            {
+                sum += accumulateRenderInputs(transform, renderable.meshId, &bounds);
+            }
+        }
+        groupSum = sum;
+    });
+    EXPECT_EQ(World::renderGroup(world->registry()).size(), kEntities);
+    EXPECT_NEAR(groupSum, baselineSum, std::abs(baselineSum) * 1e-9);
+
+    // Bytes of renderable and bounds components streamed per second (transforms are read the same way by both)
+    const double baselineBytes = static_cast<double>(kEntities) * (sizeof(LegacyRenderableComponent) + sizeof(BoundingComponent));
+    const double groupBytes = static_cast<double>(kEntities) * (sizeof(RenderableComponent) + sizeof(BoundingComponent));
+    const double toNs = 1e6 / static_cast<double>(kEntities);
+    std::printf("[ BENCH    ] %u renderables: view+lookup (%zu-byte renderable) %.2f ns/entity, %.0f MB/s; group (%zu-byte renderable) %.2f ns/entity, %.0f MB/s\n",
+                kEntities, sizeof(LegacyRenderableComponent), baselineMs * toNs, baselineBytes / (baselineMs * 1e3),
+                sizeof(RenderableComponent), groupMs * toNs, groupBytes / (groupMs * 1e3));
+    RecordProperty("view_lookup_us", static_cast<int>(baselineMs * 1000.0));
+    RecordProperty("group_us", static_cast<int>(groupMs * 1000.0));
+}
+
+} // namespace test
+} // namespace vesper
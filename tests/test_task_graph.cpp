@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include "runtime/core/threading/task_graph.h"
+#include "runtime/core/threading/worker_pool.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+class TaskGraphTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        WorkerPoolConfig config;
+        config.numWorkers = 4;
+        ASSERT_TRUE(pool.initialize(config));
+    }
+
+    void TearDown() override {
+        pool.shutdown();
+    }
+
+    WorkerPool pool;
+};
+
+TEST_F(TaskGraphTest, LinearChainRunsInOrder) {
+    std::vector<int> order;
+    TaskGraph graph;
+
+    const auto a = graph.addNode([&order]() { order.push_back(0); });
+    const auto b = graph.addNode([&order]() { order.push_back(1); });
+    const auto c = graph.addNode([&order]() { order.push_back(2); });
+    graph.addDependency(a, b);
+    graph.addDependency(b, c);
+
+    ASSERT_TRUE(graph.run(pool));
+
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+    EXPECT_FALSE(graph.isRunning());
+}
+
+TEST_F(TaskGraphTest, JoinWaitsForAllPredecessors) {
+    constexpr int kBranches = 16;
+    std::atomic<int> finishedBranches{0};
+    int seenAtJoin = -1;
+
+    TaskGraph graph;
+    const auto root = graph.addNode([]() {});
+    const auto join = graph.addNode([&]() { seenAtJoin = finishedBranches.load(); });
+    for (int i = 0; i < kBranches; ++i) {
+        const auto branch = graph.addNode([&finishedBranches]() {
+            std::this_thread::yield();
+            finishedBranches.fetch_add(1);
+        });
+        graph.addDependency(root, branch);
+        graph.addDependency(branch, join);
+    }
+
+    ASSERT_TRUE(graph.run(pool));
+    EXPECT_EQ(seenAtJoin, kBranches);
+}
+
+TEST_F(TaskGraphTest, ReusedAcrossRuns) {
+    std::atomic<int> executions{0};
+    TaskGraph graph;
+
+    TaskGraph::NodeId previous = TaskGraph::kInvalidNode;
+    for (int i = 0; i < 8; ++i) {
+        const auto node = graph.addNode([&executions]() { executions.fetch_add(1); });
+        if (previous != TaskGraph::kInvalidNode) {
+            graph.addDependency(previous, node);
+        }
+        previous = node;
+    }
+
+    for (int frame = 0; frame < 100; ++frame) {
+        ASSERT_TRUE(graph.run(pool));
+    }
+    EXPECT_EQ(executions.load(), 800);
+}
+
+TEST_F(TaskGraphTest, NodesCanUseParallelFor) {
+    std::vector<int> values(10000, 1);
+    int sum = 0;
+
+    TaskGraph graph;
+    const auto fill = graph.addNode([&]() {
+        pool.parallelForEach(std::span<int>(values), [](int& v) { v = 2; }, 64);
+    });
+    const auto reduce = graph.addNode([&]() {
+        for (int v : values) {
+            sum += v;
+        }
+    });
+    graph.addDependency(fill, reduce);
+
+    ASSERT_TRUE(graph.run(pool));
+    EXPECT_EQ(sum, 20000);
+}
+
+TEST_F(TaskGraphTest, LogicOnlyNodeRunsOnWaitingMainThread) {
+    ScopedThreadRegistration registration(ThreadType::Main);
+    const auto mainThread = std::this_thread::get_id();
+    std::thread::id logicThread;
+    std::atomic<bool> workerRan{false};
+
+    TaskGraph graph;
+    const auto work = graph.addNode([&workerRan]() { workerRan.store(true); });
+    const auto logic = graph.addNode([&]() { logicThread = std::this_thread::get_id(); },
+                                     TaskAffinity::LogicOnly);
+    graph.addDependency(work, logic);
+
+    ASSERT_TRUE(graph.run(pool));
+    EXPECT_TRUE(workerRan.load());
+    EXPECT_EQ(logicThread, mainThread);
+}
+
+TEST_F(TaskGraphTest, CycleIsRejected) {
+    TaskGraph graph;
+    const auto a = graph.addNode([]() {});
+    const auto b = graph.addNode([]() {});
+    graph.addDependency(a, b);
+    graph.addDependency(b, a);
+
+    EXPECT_FALSE(graph.compile());
+    EXPECT_FALSE(graph.run(pool));
+}
+
+TEST(TaskGraphSyncModeTest, RunsInline) {
+    WorkerPool pool;
+    WorkerPoolConfig config;
+    config.numWorkers = UINT32_MAX;  // Forces sync mode
+    ASSERT_TRUE(pool.initialize(config));
+
+    std::vector<int> order;
+    TaskGraph graph;
+    const auto a = graph.addNode([&order]() { order.push_back(0); });
+    const auto b = graph.addNode([&order]() { order.push_back(1); });
+    graph.addDependency(a, b);
+
+    ASSERT_TRUE(graph.run(pool));
+    EXPECT_EQ(order, (std::vector<int>{0, 1}));
+    pool.shutdown();
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include "runtime/core/threading/task_profiler.h"
+#include "runtime/core/threading/worker_pool.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+std::string readFile(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+size_t countOf(const std::string& text, const std::string& needle) {
+    size_t count = 0;
+    for (size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+class TaskProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TaskProfiler::clear();
+        TaskProfiler::setEnabled(true);
+
+        WorkerPoolConfig config;
+        config.numWorkers = 2;
+        ASSERT_TRUE(pool.initialize(config));
+    }
+
+    void TearDown() override {
+        pool.shutdown();
+        TaskProfiler::setEnabled(false);
+        TaskProfiler::clear();
+        std::filesystem::remove(tracePath);
+    }
+
+    WorkerPool pool;
+    std::filesystem::path tracePath = std::filesystem::temp_directory_path() / "vesper_task_trace.json";
+};
+
+TEST_F(TaskProfilerTest, TracesNamedTasksAcrossThreads) {
+    static const TaskNameId kName = internTaskName("Test.ProfiledTask");
+
+    TaskCounter counter;
+    for (int i = 0; i < 50; ++i) {
+        pool.submit(Task([]() {}, TaskAffinity::AnyThread, TaskPriority::Normal, nullptr, kName), counter);
+    }
+    // No help-run: every task must start on a worker
+    while (!counter.isDone()) {
+        std::this_thread::yield();
+    }
+
+    ASSERT_TRUE(TaskProfiler::dumpChromeTrace(tracePath.string()));
+    const std::string trace = readFile(tracePath);
+
+    EXPECT_EQ(countOf(trace, "\"name\":\"Test.ProfiledTask\""), 50u);
+    EXPECT_EQ(countOf(trace, "\"ph\":\"s\""), 50u);   // Every task was queued first
+    EXPECT_NE(trace.find("\"queuedUs\":"), std::string::npos);
+    EXPECT_NE(trace.find("\"thread_name\""), std::string::npos);
+    EXPECT_NE(trace.find("VesperWorker-"), std::string::npos);
+    EXPECT_EQ(trace.back(), '\n');
+}
+
+TEST_F(TaskProfilerTest, ScopesOnNamedThreads) {
+    static const TaskNameId kPhase = internTaskName("Test.LogicPhase");
+
+    std::thread mainThread([]() {
+        ScopedThreadRegistration registration(ThreadType::Main);
+        ProfileScope scope(kPhase);
+    });
+    mainThread.join();
+
+    ASSERT_TRUE(TaskProfiler::dumpChromeTrace(tracePath.string()));
+    const std::string trace = readFile(tracePath);
+
+    EXPECT_EQ(countOf(trace, "\"name\":\"Test.LogicPhase\""), 1u);
+    EXPECT_NE(trace.find("\"name\":\"Main "), std::string::npos);
+}
+
+TEST_F(TaskProfilerTest, DisabledProfilerRecordsNothing) {
+    TaskProfiler::setEnabled(false);
+
+    Task task([]() {});
+    EXPECT_EQ(TaskProfiler::recordSubmit(task.debugNameId), 0u);
+    task.execute();
+    EXPECT_EQ(task.profileId, 0u);
+
+    ASSERT_TRUE(TaskProfiler::dumpChromeTrace(tracePath.string()));
+    EXPECT_EQ(countOf(readFile(tracePath), "\"ph\":\"X\""), 0u);
+}
+
+TEST_F(TaskProfilerTest, RingKeepsNewestEvents) {
+    static const TaskNameId kOld = internTaskName("Test.Old");
+    static const TaskNameId kNew = internTaskName("Test.New");
+
+    std::thread recorder([]() {
+        ProfileScope first(kOld);
+        for (size_t i = 0; i < TaskProfiler::kEventsPerThread; ++i) {
+            ProfileScope scope(kNew);
+        }
+    });
+    recorder.join();
+
+    ASSERT_TRUE(TaskProfiler::dumpChromeTrace(tracePath.string()));
+    const std::string trace = readFile(tracePath);
+
+    // The outer scope's start was overwritten; the newest half ring of scopes survives
+    EXPECT_EQ(countOf(trace, "Test.Old"), 0u);
+    EXPECT_EQ(countOf(trace, "\"name\":\"Test.New\""), TaskProfiler::kEventsPerThread / 2 - 1);
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,281 @@
+#include <gtest/gtest.h>
+
+#include "runtime/core/threading/mpmc_queue.h"
+#include "runtime/core/threading/worker_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace vesper {
+namespace test {
+
+// Throughput benchmarks for the task system. They assert only on correctness;
+// numbers are printed and recorded as test properties for comparison across changes.
+
+namespace {
+
+constexpr uint32_t kBenchmarkTasks = 20000;
+
+double tasksPerSecond(uint32_t tasks, std::chrono::steady_clock::duration elapsed)
+{
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    return seconds > 0.0 ? static_cast<double>(tasks) / seconds : 0.0;
+}
+
+/// @brief CPU time consumed by the whole process (all threads), in seconds
+double processCpuSeconds()
+{
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+    auto toSeconds = [](const FILETIME& time) {
+        return static_cast<double>((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) * 1e-7;
+    };
+    return toSeconds(kernel) + toSeconds(user);
+#else
+    timespec time{};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+    return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) * 1e-9;
+#endif
+}
+
+/// @brief Mutex-guarded ring with the same interface, as a contention baseline
+template<typename T, size_t Capacity>
+class MutexRingQueue
+{
+public:
+    bool tryEnqueue(T item)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_head - m_tail >= Capacity)
+        {
+            return false;
+        }
+        m_buffer[m_head++ % Capacity] = std::move(item);
+        return true;
+    }
+
+    bool tryDequeue(T& item)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_head == m_tail)
+        {
+            return false;
+        }
+        item = std::move(m_buffer[m_tail++ % Capacity]);
+        return true;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::array<T, Capacity> m_buffer{};
+    size_t m_head{0};
+    size_t m_tail{0};
+};
+
+/// @brief Push itemsPerProducer items from each producer through the queue, return items/sec
+template<typename Queue>
+double measureQueueThroughput(Queue& queue, uint32_t producers, uint32_t consumers, uint32_t itemsPerProducer)
+{
+    const uint64_t total = static_cast<uint64_t>(producers) * itemsPerProducer;
+    std::atomic<uint64_t> consumed{0};
+    std::atomic<uint64_t> checksum{0};
+    std::atomic<bool> go{false};
+
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&]() {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (uint32_t i = 1; i <= itemsPerProducer; ++i) {
+                while (!queue.tryEnqueue(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (uint32_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&]() {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            uint32_t value = 0;
+            uint64_t localSum = 0;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.tryDequeue(value)) {
+                    localSum += value;
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            checksum.fetch_add(localSum, std::memory_order_relaxed);
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const uint64_t expectedSum = static_cast<uint64_t>(producers) * itemsPerProducer * (itemsPerProducer + 1ull) / 2;
+    EXPECT_EQ(checksum.load(), expectedSum);
+    return tasksPerSecond(static_cast<uint32_t>(total), elapsed);
+}
+
+} // namespace
+
+class TaskSubmissionBenchmark : public ::testing::TestWithParam<uint32_t> {
+protected:
+    void SetUp() override {
+        WorkerPoolConfig config;
+        config.numWorkers = GetParam();
+        ASSERT_TRUE(pool.initialize(config));
+    }
+
+    void TearDown() override {
+        pool.shutdown();
+    }
+
+    WorkerPool pool;
+};
+
+TEST_P(TaskSubmissionBenchmark, TasksPerSecond) {
+    std::atomic<uint32_t> executed{0};
+
+    // Both paths use the same inline task records and differ only in how completion is signalled:
+    // this measures the per-task WaitGroup allocation, not the task system before inline records
+
+    // WaitGroup path: submit() returns a WaitGroup per task
+    auto start = std::chrono::steady_clock::now();
+    WaitGroupPtr last;
+    for (uint32_t i = 0; i < kBenchmarkTasks; ++i) {
+        last = pool.submit([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); });
+    }
+    while (executed.load(std::memory_order_acquire) < kBenchmarkTasks) {
+        pool.helpRunOne();
+    }
+    const double waitGroupRate = tasksPerSecond(kBenchmarkTasks, std::chrono::steady_clock::now() - start);
+    EXPECT_TRUE(last == nullptr || last->isDone());
+
+    // TaskCounter path: one caller-owned counter for all tasks, nothing allocated per task
+    executed.store(0);
+    start = std::chrono::steady_clock::now();
+    TaskCounter counter;
+    for (uint32_t i = 0; i < kBenchmarkTasks; ++i) {
+        pool.submit(Task([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }), counter);
+    }
+    pool.waitFor(counter);
+    const double counterRate = tasksPerSecond(kBenchmarkTasks, std::chrono::steady_clock::now() - start);
+    EXPECT_EQ(executed.load(), kBenchmarkTasks);
+
+    std::printf("[ BENCH    ] %2u workers: WaitGroup submit %10.0f tasks/s, TaskCounter submit %10.0f tasks/s\n",
+                GetParam(), waitGroupRate, counterRate);
+    RecordProperty("wait_group_tasks_per_sec", static_cast<int>(waitGroupRate));
+    RecordProperty("counter_tasks_per_sec", static_cast<int>(counterRate));
+}
+
+INSTANTIATE_TEST_SUITE_P(Workers, TaskSubmissionBenchmark, ::testing::Values(1u, 4u, 16u));
+
+// (producers, consumers)
+class QueueContentionBenchmark : public ::testing::TestWithParam<std::tuple<uint32_t, uint32_t>> {};
+
+TEST_P(QueueContentionBenchmark, ItemsPerSecond) {
+    const auto [producers, consumers] = GetParam();
+    constexpr uint32_t kItemsPerProducer = 50000;
+
+    auto mutexQueue = std::make_unique<MutexRingQueue<uint32_t, 1024>>();
+    auto lockFreeQueue = std::make_unique<MPMCQueue<uint32_t, 1024>>();
+
+    const double mutexRate = measureQueueThroughput(*mutexQueue, producers, consumers, kItemsPerProducer);
+    const double lockFreeRate = measureQueueThroughput(*lockFreeQueue, producers, consumers, kItemsPerProducer);
+
+    std::printf("[ BENCH    ] %2u producers x %2u consumers: mutex ring %10.0f items/s, MPMCQueue %10.0f items/s\n",
+                producers, consumers, mutexRate, lockFreeRate);
+    RecordProperty("mutex_items_per_sec", static_cast<int>(mutexRate));
+    RecordProperty("mpmc_items_per_sec", static_cast<int>(lockFreeRate));
+}
+
+INSTANTIATE_TEST_SUITE_P(Contention, QueueContentionBenchmark, ::testing::Values(
+    std::make_tuple(1u, 1u),
+    std::make_tuple(4u, 1u),
+    std::make_tuple(8u, 1u),
+    std::make_tuple(4u, 4u),
+    std::make_tuple(8u, 8u)));
+
+class WorkerParkingBenchmark : public ::testing::TestWithParam<uint32_t> {};
+
+TEST_P(WorkerParkingBenchmark, IdleCpuAndWakeLatency) {
+    WorkerPool pool;
+    WorkerPoolConfig config;
+    config.numWorkers = GetParam();
+    ASSERT_TRUE(pool.initialize(config));
+
+    // Idle CPU: nothing submitted, workers should be parked rather than polling
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const double cpuStart = processCpuSeconds();
+    const auto wallStart = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    const double idleCores = (processCpuSeconds() - cpuStart) /
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    // Wake latency: submit into a fully parked pool and time until the task starts
+    constexpr int kSamples = 50;
+    double totalLatencyUs = 0.0;
+    double worstLatencyUs = 0.0;
+    for (int i = 0; i < kSamples; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+        std::atomic<int64_t> startedNs{0};
+        TaskCounter counter;
+        const auto submitted = std::chrono::steady_clock::now();
+        pool.submit(makeTask([&startedNs]() {
+            startedNs.store(std::chrono::steady_clock::now().time_since_epoch().count());
+        }), counter);
+        while (!counter.isDone()) {
+            std::this_thread::yield();  // No help-run: the worker must pick the task up
+        }
+
+        const auto started = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(startedNs.load()));
+        const double latencyUs = std::chrono::duration<double, std::micro>(started - submitted).count();
+        totalLatencyUs += latencyUs;
+        worstLatencyUs = std::max(worstLatencyUs, latencyUs);
+    }
+
+    const auto& stats = pool.stats();
+    std::printf("[ BENCH    ] %2u workers: idle CPU %.3f cores, wake latency avg %.1f us / max %.1f us (%llu parks, %llu wakes)\n",
+                GetParam(), idleCores, totalLatencyUs / kSamples, worstLatencyUs,
+                static_cast<unsigned long long>(stats.workerParks.load()),
+                static_cast<unsigned long long>(stats.workerWakes.load()));
+    RecordProperty("idle_cpu_millicores", static_cast<int>(idleCores * 1000.0));
+    RecordProperty("wake_latency_avg_us", static_cast<int>(totalLatencyUs / kSamples));
+
+    EXPECT_GT(stats.workerParks.load(), 0u);
+    EXPECT_LT(idleCores, 0.25);
+    pool.shutdown();
+}
+
+INSTANTIATE_TEST_SUITE_P(Workers, WorkerParkingBenchmark, ::testing::Values(1u, 4u, 16u));
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include "runtime/function/framework/ecs/world.h"
+#include "runtime/function/framework/component/mesh/renderable_component.h"
+#include "runtime/core/threading/worker_pool.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+namespace {
+
+Entity createTransformEntity(World& world, const Vector3& position)
+{
+    Entity entity = world.createEntity();
+    world.addComponent<TransformComponent>(entity).setPosition(position);
+    return entity;
+}
+
+Vector3 worldPosition(World& world, Entity entity)
+{
+    const Matrix4x4& matrix = world.getComponent<TransformComponent>(entity).worldMatrix;
+    return Vector3(matrix.m[3][0], matrix.m[3][1], matrix.m[3][2]);
+}
+
+void expectNear(const Vector3& actual, const Vector3& expected)
+{
+    EXPECT_NEAR(actual.x, expected.x, 1e-4f);
+    EXPECT_NEAR(actual.y, expected.y, 1e-4f);
+    EXPECT_NEAR(actual.z, expected.z, 1e-4f);
+}
+
+// Tracked components are read-only through World: an edit that skips patchComponent() must not compile
+static_assert(std::is_const_v<std::remove_reference_t<decltype(std::declval<World&>().getComponent<TransformComponent>(NullEntity))>>);
+static_assert(std::is_const_v<std::remove_pointer_t<decltype(std::declval<World&>().tryGetComponent<BoundingComponent>(NullEntity))>>);
+static_assert(!std::is_const_v<std::remove_reference_t<decltype(std::declval<World&>().getComponent<HierarchyComponent>(NullEntity))>>);
+
+} // namespace
+
+TEST(TransformHierarchyTest, ChildrenAccumulateParentTransforms) {
+    World world;
+    Entity root = createTransformEntity(world, Vector3(1.0f, 0.0f, 0.0f));
+    Entity child = createTransformEntity(world, Vector3(0.0f, 2.0f, 0.0f));
+    Entity grandChild = createTransformEntity(world, Vector3(0.0f, 0.0f, 3.0f));
+    world.setParent(child, root);
+    world.setParent(grandChild, child);
+
+    world.updateTransforms();
+
+    expectNear(worldPosition(world, root), Vector3(1.0f, 0.0f, 0.0f));
+    expectNear(worldPosition(world, child), Vector3(1.0f, 2.0f, 0.0f));
+    expectNear(worldPosition(world, grandChild), Vector3(1.0f, 2.0f, 3.0f));
+}
+
+TEST(TransformHierarchyTest, DirtyChildOfCleanParentKeepsParentTransform) {
+    World world;
+    Entity root = createTransformEntity(world, Vector3(5.0f, 0.0f, 0.0f));
+    Entity child = createTransformEntity(world, Vector3(0.0f, 1.0f, 0.0f));
+    world.setParent(child, root);
+    world.updateTransforms();
+
+    world.patchComponent<TransformComponent>(child, [](TransformComponent& transform) {
+        transform.setPosition(Vector3(0.0f, 4.0f, 0.0f));
+    });
+    world.updateTransforms();
+
+    expectNear(worldPosition(world, child), Vector3(5.0f, 4.0f, 0.0f));
+}
+
+TEST(TransformHierarchyTest, DirtyParentPropagatesToDescendants) {
+    World world;
+    Entity root = createTransformEntity(world, Vector3(0.0f, 0.0f, 0.0f));
+    Entity child = createTransformEntity(world, Vector3(1.0f, 0.0f, 0.0f));
+    Entity grandChild = createTransformEntity(world, Vector3(1.0f, 0.0f, 0.0f));
+    world.setParent(child, root);
+    world.setParent(grandChild, child);
+    world.updateTransforms();
+
+    world.patchComponent<TransformComponent>(root, [](TransformComponent& transform) {
+        transform.setPosition(Vector3(0.0f, 0.0f, 10.0f));
+    });
+    world.updateTransforms();
+
+    expectNear(worldPosition(world, grandChild), Vector3(2.0f, 0.0f, 10.0f));
+}
+
+TEST(TransformHierarchyTest, ReparentAndDestroyRebuildLayout) {
+    World world;
+    Entity a = createTransformEntity(world, Vector3(1.0f, 0.0f, 0.0f));
+    Entity b = createTransformEntity(world, Vector3(0.0f, 1.0f, 0.0f));
+    Entity child = createTransformEntity(world, Vector3(0.0f, 0.0f, 1.0f));
+    world.setParent(child, a);
+    world.updateTransforms();
+    expectNear(worldPosition(world, child), Vector3(1.0f, 0.0f, 1.0f));
+
+    world.setParent(child, b);
+    world.updateTransforms();
+    expectNear(worldPosition(world, child), Vector3(0.0f, 1.0f, 1.0f));
+
+    world.removeParent(child);
+    world.updateTransforms();
+    expectNear(worldPosition(world, child), Vector3(0.0f, 0.0f, 1.0f));
+
+    // Destroying entities must not leave dangling slots behind
+    world.setParent(child, a);
+    world.destroyEntity(a);
+    EXPECT_FALSE(world.isValid(child));
+    Entity late = createTransformEntity(world, Vector3(7.0f, 0.0f, 0.0f));
+    world.updateTransforms();
+    expectNear(worldPosition(world, late), Vector3(7.0f, 0.0f, 0.0f));
+    expectNear(worldPosition(world, b), Vector3(0.0f, 1.0f, 0.0f));
+}
+
+TEST(TransformHierarchyTest, OnlyChangedSubtreesAreRecomputed) {
+    World world;
+    Entity staticRoot = createTransformEntity(world, Vector3(1.0f, 0.0f, 0.0f));
+    Entity movingRoot = createTransformEntity(world, Vector3(2.0f, 0.0f, 0.0f));
+    Entity movingChild = createTransformEntity(world, Vector3(0.0f, 1.0f, 0.0f));
+    world.addComponent<BoundingComponent>(movingChild).initFromSphere(Vector3(0.0f, 0.0f, 0.0f), 1.0f);
+    world.setParent(movingChild, movingRoot);
+    for (Entity entity : {staticRoot, movingRoot, movingChild}) {
+        world.addComponent<RenderableComponent>(entity);
+    }
+    world.updateTransforms();
+    world.updateBounds();
+    changeSet(world.registry(), kRenderChangeSet).clear();
+
+    // Static frame: nothing is touched (the matrix is poked behind the change sets' back)
+    world.registry().get<TransformComponent>(staticRoot).worldMatrix = Matrix4x4::ZERO;
+    world.updateTransforms();
+    world.updateBounds();
+    EXPECT_TRUE(changeSet(world.registry(), kRenderChangeSet).empty());
+    EXPECT_EQ(world.getComponent<TransformComponent>(staticRoot).worldMatrix, Matrix4x4::ZERO);
+
+    world.patchComponent<TransformComponent>(movingRoot, [](TransformComponent& transform) {
+        transform.setPosition(Vector3(3.0f, 0.0f, 0.0f));
+    });
+    world.updateTransforms();
+    world.updateBounds();
+
+    const ChangeSet& renderChanges = changeSet(world.registry(), kRenderChangeSet);
+    EXPECT_EQ(renderChanges.size(), 2u);
+    EXPECT_TRUE(renderChanges.contains(movingRoot));
+    EXPECT_TRUE(renderChanges.contains(movingChild));
+    EXPECT_EQ(world.getComponent<TransformComponent>(staticRoot).worldMatrix, Matrix4x4::ZERO);
+    expectNear(world.getComponent<BoundingComponent>(movingChild).worldCenter, Vector3(3.0f, 1.0f, 0.0f));
+}
+
+TEST(TransformHierarchyTest, ParallelUpdateMatchesSerial) {
+    constexpr int kRoots = 3000;
+    constexpr int kDepth = 4;
+
+    WorkerPool pool;
+    WorkerPoolConfig config;
+    config.numWorkers = 4;
+    ASSERT_TRUE(pool.initialize(config));
+
+    World serial;
+    World parallel;
+    std::vector<Entity> serialLeaves;
+    std::vector<Entity> parallelLeaves;
+    for (World* world : {&serial, &parallel}) {
+        auto& leaves = world == &serial ? serialLeaves : parallelLeaves;
+        for (int root = 0; root < kRoots; ++root) {
+            Entity parent = createTransformEntity(*world, Vector3(static_cast<float>(root), 0.0f, 0.0f));
+            for (int depth = 1; depth < kDepth; ++depth) {
+                Entity node = createTransformEntity(*world, Vector3(0.0f, 1.0f, static_cast<float>(depth)));
+                world->patchComponent<TransformComponent>(node, [depth](TransformComponent& transform) {
+                    transform.setRotation(Quaternion::rotationY(0.1f * static_cast<float>(depth)));
+                });
+                world->setParent(node, parent);
+                parent = node;
+            }
+            leaves.push_back(parent);
+        }
+    }
+
+    serial.updateTransforms();
+    parallel.updateTransforms(pool);
+
+    for (size_t i = 0; i < serialLeaves.size(); ++i) {
+        expectNear(worldPosition(parallel, parallelLeaves[i]), worldPosition(serial, serialLeaves[i]));
+    }
+    pool.shutdown();
+}
+
+} // namespace test
+} // namespace vesper
@@ -0,0 +1,337 @@
+#include <gtest/gtest.h>
+
+#include "runtime/core/threading/worker_pool.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vesper {
+namespace test {
+
+class WorkerPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        WorkerPoolConfig config;
+        config.numWorkers = 4;
+        ASSERT_TRUE(pool.initialize(config));
+    }
+
+    void TearDown() override {
+        pool.shutdown();
+    }
+
+    WorkerPool pool;
+};
+
+TEST_F(WorkerPoolTest, SubmitAndWait) {
+    std::atomic<int> value{0};
+    auto wg = pool.submit([&value]() { value.store(42); });
+
+    ASSERT_NE(wg, nullptr);
+    pool.waitFor(wg);
+
+    EXPECT_EQ(value.load(), 42);
+}
+
+TEST_F(WorkerPoolTest, ParallelForVisitsEveryIndexOnce) {
+    constexpr size_t kCount = 100000;
+    std::vector<std::atomic<uint32_t>> hits(kCount);
+
+    pool.parallelFor(0, kCount, 64, [&hits](size_t i) {
+        hits[i].fetch_add(1, std::memory_order_relaxed);
+    });
+
+    for (size_t i = 0; i < kCount; ++i) {
+        ASSERT_EQ(hits[i].load(), 1u) << "index " << i;
+    }
+    EXPECT_GT(pool.stats().rangeSplits.load(), 0u);
+}
+
+TEST_F(WorkerPoolTest, ParallelForRangeChunksNeverExceedGrainSize) {
+    constexpr size_t kCount = 10000;
+    constexpr size_t kGrain = 100;
+    std::atomic<size_t> covered{0};
+    std::atomic<size_t> largestChunk{0};
+
+    pool.parallelForRange(0, kCount, kGrain, [&](size_t begin, size_t end) {
+        covered.fetch_add(end - begin);
+        size_t largest = largestChunk.load();
+        while (end - begin > largest && !largestChunk.compare_exchange_weak(largest, end - begin)) {
+        }
+    });
+
+    EXPECT_EQ(covered.load(), kCount);
+    EXPECT_LE(largestChunk.load(), kGrain);
+}
+
+TEST_F(WorkerPoolTest, ParallelForEachOverSpan) {
+    std::vector<int> values(5000);
+    std::iota(values.begin(), values.end(), 0);
+
+    pool.parallelForEach(std::span<int>(values), [](int& v) { v *= 2; });
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(values[i], static_cast<int>(i) * 2);
+    }
+}
+
+TEST_F(WorkerPoolTest, ParallelForEmptyAndTinyRanges) {
+    int calls = 0;
+    pool.parallelFor(10, 10, 1, [&calls](size_t) { ++calls; });
+    EXPECT_EQ(calls, 0);
+
+    // Smaller than the grain: runs inline on the caller
+    pool.parallelFor(0, 8, 64, [&calls](size_t) { ++calls; });
+    EXPECT_EQ(calls, 8);
+}
+
+TEST_F(WorkerPoolTest, NestedParallelFor) {
+    constexpr size_t kOuter = 64;
+    constexpr size_t kInner = 256;
+    std::atomic<size_t> total{0};
+
+    pool.parallelFor(0, kOuter, 1, [&](size_t) {
+        pool.parallelFor(0, kInner, 16, [&](size_t) {
+            total.fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+
+    EXPECT_EQ(total.load(), kOuter * kInner);
+}
+
+TEST_F(WorkerPoolTest, ParallelForFromWorkerTask) {
+    constexpr size_t kCount = 20000;
+    std::atomic<size_t> total{0};
+
+    auto wg = pool.submit([&]() {
+        pool.parallelFor(0, kCount, 32, [&](size_t) {
+            total.fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+    pool.waitFor(wg);
+
+    EXPECT_EQ(total.load(), kCount);
+}
+
+TEST_F(WorkerPoolTest, ParallelForFromRegisteredMainThread) {
+    ScopedThreadRegistration registration(ThreadType::Main);
+
+    constexpr size_t kCount = 20000;
+    std::atomic<size_t> total{0};
+    pool.parallelFor(0, kCount, 32, [&](size_t) {
+        total.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    EXPECT_EQ(total.load(), kCount);
+}
+
+TEST_F(WorkerPoolTest, SubmitWithCounter) {
+    constexpr int kTasks = 1000;
+    std::atomic<int> sum{0};
+    TaskCounter counter;
+
+    for (int i = 0; i < kTasks; ++i) {
+        ASSERT_TRUE(pool.submit(Task([&sum, i]() { sum.fetch_add(i, std::memory_order_relaxed); }), counter));
+    }
+    pool.waitFor(counter);
+
+    EXPECT_TRUE(counter.isDone());
+    EXPECT_EQ(sum.load(), kTasks * (kTasks - 1) / 2);
+}
+
+TEST_F(WorkerPoolTest, CounterCanBeDestroyedAsSoonAsWaitReturns) {
+    // Heap-allocated so a completion touching the counter after its final decrement is a
+    // use-after-free the sanitizers report
+    for (int round = 0; round < 2000; ++round) {
+        auto counter = std::make_unique<TaskCounter>();
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(pool.submit(Task([]() {}), *counter));
+        }
+        pool.waitFor(*counter);
+        counter.reset();
+    }
+}
+
+TEST(TaskCounterTest, ResumedWaiterMayDestroyCounter) {
+    struct Waiter : CounterWaiter {
+        TaskCounter* counter{nullptr};
+        std::atomic<bool> resumed{false};
+    };
+
+    constexpr int kRounds = 20000;
+    std::atomic<TaskCounter*> toComplete{nullptr};
+    std::atomic<int> completedRounds{0};
+
+    // Registration races the final decrement: either side may end up resuming the waiter,
+    // which frees the counter at once
+    std::thread completer([&]() {
+        for (int round = 0; round < kRounds; ++round) {
+            TaskCounter* counter = nullptr;
+            while (!(counter = toComplete.exchange(nullptr, std::memory_order_acquire))) {
+                std::this_thread::yield();
+            }
+            counter->done();
+            completedRounds.fetch_add(1, std::memory_order_release);
+        }
+    });
+
+    for (int round = 0; round < kRounds; ++round) {
+        Waiter waiter;
+        waiter.counter = new TaskCounter(1);
+        waiter.resume = [](CounterWaiter* node) {
+            auto* self = static_cast<Waiter*>(node);
+            delete self->counter;
+            self->resumed.store(true, std::memory_order_release);
+        };
+
+        toComplete.store(waiter.counter, std::memory_order_release);
+        waiter.counter->addSuspendedWaiter(&waiter);
+        while (completedRounds.load(std::memory_order_acquire) <= round) {
+            std::this_thread::yield();
+        }
+        ASSERT_TRUE(waiter.resumed.load(std::memory_order_acquire));
+    }
+    completer.join();
+}
+
+TEST_F(WorkerPoolTest, SubmitLightBatchWithCounter) {
+    constexpr size_t kTasks = 64;
+    std::atomic<int> hits[kTasks]{};
+    LightTaskFunc functions[kTasks];
+    void* userData[kTasks];
+    for (size_t i = 0; i < kTasks; ++i) {
+        functions[i] = [](void* data) { static_cast<std::atomic<int>*>(data)->fetch_add(1); };
+        userData[i] = &hits[i];
+    }
+
+    TaskCounter counter;
+    pool.submitLightBatch(counter, functions, userData, kTasks);
+    pool.waitFor(counter);
+
+    for (size_t i = 0; i < kTasks; ++i) {
+        EXPECT_EQ(hits[i].load(), 1);
+    }
+}
+
+TEST_F(WorkerPoolTest, TaskRecordsAreRecycled) {
+    // Warm up the record pool, then make sure repeated parallelFor calls reuse it
+    pool.parallelFor(0, 100000, 16, [](size_t) {});
+    const size_t allocated = TaskPool::allocatedCount();
+
+    for (int i = 0; i < 20; ++i) {
+        pool.parallelFor(0, 100000, 16, [](size_t) {});
+    }
+
+    EXPECT_LE(TaskPool::allocatedCount(), allocated + 1024);
+}
+
+TEST_F(WorkerPoolTest, WorkerStealsAreSplitByCacheDomain) {
+    // Nested parallelFor from inside a task: the splits land on a worker deque
+    TaskCounter counter;
+    pool.submit(makeTask([this]() {
+        pool.parallelFor(0, 200000, 16, [](size_t) {});
+    }), counter);
+    pool.waitFor(counter);
+
+    const auto& stats = pool.stats();
+    EXPECT_LE(stats.localSteals.load() + stats.remoteSteals.load(), stats.tasksStolen.load());
+}
+
+TEST(WorkerPoolPlacementTest, UnpinnedPoolRunsParallelFor) {
+    WorkerPool pool;
+    WorkerPoolConfig config;
+    config.numWorkers = 4;
+    config.threadConfig.pinToPhysicalCores = false;
+    ASSERT_TRUE(pool.initialize(config));
+
+    std::atomic<int> sum{0};
+    pool.parallelFor(0, 10000, 8, [&sum](size_t) { sum.fetch_add(1, std::memory_order_relaxed); });
+    EXPECT_EQ(sum.load(), 10000);
+    pool.shutdown();
+}
+
+TEST(WorkerPoolPlacementTest, NeverPinsTwoWorkersToOneCpu) {
+    // More workers than CPUs: the extra ones must stay unpinned rather than share a CPU
+    const CpuTopology topology = CpuTopology::detect();
+    WorkerPool pool;
+    WorkerPoolConfig config;
+    config.numWorkers = static_cast<uint32_t>(topology.cpus().size()) * 2 + 2;
+    config.threadConfig.useSmtSiblings = true;
+    ASSERT_TRUE(pool.initialize(config));
+
+    std::set<uint32_t> pinnedCpus;
+    uint32_t pinnedCount = 0;
+    for (uint32_t worker = 0; worker < pool.workerCount(); ++worker) {
+        const uint32_t cpu = pool.workerCpu(worker);
+        if (cpu != WorkerPool::kUnpinnedCpu) {
+            ++pinnedCount;
+            EXPECT_TRUE(pinnedCpus.insert(cpu).second) << "CPU " << cpu << " pinned twice";
+        }
+    }
+    EXPECT_LE(pinnedCount, topology.cpus().size());
+
+    std::atomic<int> sum{0};
+    pool.parallelFor(0, 10000, 8, [&sum](size_t) { sum.fetch_add(1, std::memory_order_relaxed); });
+    EXPECT_EQ(sum.load(), 10000);
+    pool.shutdown();
+}
+
+TEST(TaskTest, InlineFunctionIsMoveOnlyAndDestroysCaptures) {
+    auto payload = std::make_shared<int>(7);
+    std::weak_ptr<int> observer = payload;
+    int result = 0;
+
+    {
+        InlineTaskFunction fn([payload = std::move(payload), &result]() { result = *payload; });
+        InlineTaskFunction moved = std::move(fn);
+        EXPECT_FALSE(static_cast<bool>(fn));
+        ASSERT_TRUE(static_cast<bool>(moved));
+        moved();
+        EXPECT_FALSE(observer.expired());
+    }
+
+    EXPECT_EQ(result, 7);
+    EXPECT_TRUE(observer.expired());
+}
+
+TEST(TaskTest, EmptyStdFunctionStaysEmpty) {
+    InlineTaskFunction fn(TaskFunction{});
+    EXPECT_FALSE(static_cast<bool>(fn));
+    EXPECT_FALSE(Task(TaskFunction{}).isValid());
+}
+
+TEST(TaskTest, DebugNamesAreInterned) {
+    const TaskNameId a = internTaskName("Culling");
+    const TaskNameId b = internTaskName(std::string("Cull") + "ing");
+
+    EXPECT_NE(a, kInvalidTaskNameId);
+    EXPECT_EQ(a, b);
+    EXPECT_STREQ(taskNameString(a), "Culling");
+    EXPECT_EQ(internTaskName(""), kInvalidTaskNameId);
+
+    Task task = TaskBuilder().withFunction([]() {}).withDebugName("Culling").build();
+    EXPECT_STREQ(task.debugName(), "Culling");
+}
+
+TEST(WorkerPoolSyncModeTest, ParallelForRunsInline) {
+    WorkerPool pool;
+    WorkerPoolConfig config;
+    config.numWorkers = UINT32_MAX;  // Forces sync mode
+    ASSERT_TRUE(pool.initialize(config));
+
+    std::vector<int> values(1000, 1);
+    pool.parallelForEach(std::span<int>(values), [](int& v) { v += 1; }, 10);
+
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 2000);
+    EXPECT_EQ(pool.stats().rangeSplits.load(), 0u);
+    pool.shutdown();
+}
+
+} // namespace test
+} // namespace vesper